@@ -2,13 +2,36 @@
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Helpers/PCGExChainTestHelpers.h"
+#include "Helpers/PCGExNodeClassHelpers.h"
+#include "Helpers/PCGExPersistentCacheHelpers.h"
 #include "Algo/RemoveIf.h"
+#include "Async/ParallelFor.h"
 #include "PCGExH.h"
 
 namespace PCGExTest
 {
 	using PCGExGraphs::FLink;
 
+	namespace
+	{
+		/** Drop empty chains and keep the first chain of each UniqueHash, preserving order */
+		void RemoveDuplicateChains(TArray<TSharedPtr<FTestChain>>& OutChains)
+		{
+			TSet<uint64> UniqueHashSet;
+			UniqueHashSet.Reserve(OutChains.Num());
+
+			OutChains.SetNum(Algo::StableRemoveIf(
+				OutChains,
+				[&UniqueHashSet](const TSharedPtr<FTestChain>& Chain)
+				{
+					if (!Chain || Chain->Links.IsEmpty()) { return true; }
+					bool bAlreadySet = false;
+					UniqueHashSet.Add(Chain->UniqueHash, &bAlreadySet);
+					return bAlreadySet;
+				}));
+		}
+	}
+
 #pragma region FTestChain
 
 	void FTestChain::FixUniqueHash()
@@ -38,14 +61,15 @@ namespace PCGExTest
 
 		while (FromNode)
 		{
-			if (FromNode->IsLeaf() || FromNode->IsComplex() || (Breakpoints && (*Breakpoints)[FromNode->PointIndex]))
+			const int32 FromIndex = FromNode->Index;
+			if (Cluster->IsLeaf(FromIndex) || Cluster->IsComplex(FromIndex) || (Breakpoints && (*Breakpoints)[FromNode->PointIndex]))
 			{
 				bIsClosedLoop = false;
 				break;
 			}
 
-			FLink NextLink = FromNode->Links[0];
-			if (NextLink.Node == Last.Node) { NextLink = FromNode->Links[1]; }
+			FLink NextLink = Cluster->GetLink(FromIndex, 0);
+			if (NextLink.Node == Last.Node) { NextLink = Cluster->GetLink(FromIndex, 1); }
 
 			if (NextLink.Node == Seed.Node)
 			{
@@ -61,7 +85,7 @@ namespace PCGExTest
 		}
 
 		// Set leaf status
-		bIsLeaf = Cluster->GetNode(Seed.Node)->IsLeaf() || Cluster->GetNode(Links.Last().Node)->IsLeaf();
+		bIsLeaf = Cluster->IsLeaf(Seed.Node) || Cluster->IsLeaf(Links.Last().Node);
 		if (bIsClosedLoop) { bIsLeaf = false; }
 		FixUniqueHash();
 	}
@@ -101,10 +125,156 @@ namespace PCGExTest
 
 #pragma endregion
 
+#pragma region FCachedChainData
+
+	const FName FCachedChainData::CacheKey = FName(TEXT("PCGExTest.Chains"));
+
+	void FCachedChainData::Build(const TSharedRef<FTestCluster>& Cluster, const TSharedPtr<TArray<int8>>& InBreakpoints)
+	{
+		TestChainHelpers::BuildChainsParallel(Cluster, BaseChains, nullptr);
+		BuildFromBaseChains(Cluster, InBreakpoints);
+	}
+
+	void FCachedChainData::BuildFromBaseChains(const TSharedRef<FTestCluster>& Cluster, const TSharedPtr<TArray<int8>>& InBreakpoints)
+	{
+		Breakpoints.Reset();
+		if (InBreakpoints) { Breakpoints = *InBreakpoints; }
+
+		// Index every point a chain goes through, seed included (SplitChain checks it)
+		const int32 NumPoints = Cluster->NumRawVtx;
+		PointChainOffsets.Init(0, NumPoints + 1);
+
+		for (const TSharedPtr<FTestChain>& Chain : BaseChains)
+		{
+			PointChainOffsets[Cluster->GetNodePointIndex(Chain->Seed.Node) + 1]++;
+			for (const FLink& Lk : Chain->Links) { PointChainOffsets[Cluster->GetNodePointIndex(Lk.Node) + 1]++; }
+		}
+
+		for (int32 i = 0; i < NumPoints; i++) { PointChainOffsets[i + 1] += PointChainOffsets[i]; }
+
+		TArray<int32> WriteIndices(PointChainOffsets.GetData(), NumPoints);
+		PointChains.SetNumUninitialized(PointChainOffsets[NumPoints]);
+
+		for (int32 c = 0; c < BaseChains.Num(); c++)
+		{
+			const FTestChain& Chain = *BaseChains[c];
+			PointChains[WriteIndices[Cluster->GetNodePointIndex(Chain.Seed.Node)]++] = c;
+			for (const FLink& Lk : Chain.Links) { PointChains[WriteIndices[Cluster->GetNodePointIndex(Lk.Node)]++] = c; }
+		}
+
+		SplitChains.Reset();
+		SplitChains.SetNum(BaseChains.Num());
+		ParallelFor(BaseChains.Num(), [&](const int32 c) { SplitBaseChain(Cluster, c); });
+	}
+
+	int32 FCachedChainData::UpdateBreakpoints(const TSharedRef<FTestCluster>& Cluster, const TSharedPtr<TArray<int8>>& InBreakpoints, const TConstArrayView<int32> DirtyPoints)
+	{
+		Breakpoints.Reset();
+		if (InBreakpoints) { Breakpoints = *InBreakpoints; }
+
+		TBitArray<> DirtyChainMask(false, BaseChains.Num());
+		TArray<int32> DirtyChains;
+
+		for (const int32 PointIndex : DirtyPoints)
+		{
+			if (!PointChainOffsets.IsValidIndex(PointIndex + 1)) { continue; }
+			for (int32 i = PointChainOffsets[PointIndex]; i < PointChainOffsets[PointIndex + 1]; i++)
+			{
+				const int32 ChainIndex = PointChains[i];
+				if (DirtyChainMask[ChainIndex]) { continue; }
+				DirtyChainMask[ChainIndex] = true;
+				DirtyChains.Add(ChainIndex);
+			}
+		}
+
+		ParallelFor(DirtyChains.Num(), [&](const int32 i) { SplitBaseChain(Cluster, DirtyChains[i]); });
+
+		return DirtyChains.Num();
+	}
+
+	int32 FCachedChainData::UpdateBreakpoints(const TSharedRef<FTestCluster>& Cluster, const TSharedPtr<TArray<int8>>& InBreakpoints)
+	{
+		const int32 NumPoints = PointChainOffsets.Num() - 1;
+		const TArray<int8> Empty;
+		const TArray<int8>& NewBreakpoints = InBreakpoints ? *InBreakpoints : Empty;
+
+		auto IsSet = [](const TArray<int8>& Array, const int32 Index) { return Array.IsValidIndex(Index) && Array[Index]; };
+
+		TArray<int32> DirtyPoints;
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			if (IsSet(Breakpoints, i) != IsSet(NewBreakpoints, i)) { DirtyPoints.Add(i); }
+		}
+
+		return UpdateBreakpoints(Cluster, InBreakpoints, DirtyPoints);
+	}
+
+	void FCachedChainData::Gather(TArray<TSharedPtr<FTestChain>>& OutChains) const
+	{
+		int32 Total = 0;
+		for (const TArray<TSharedPtr<FTestChain>>& Segments : SplitChains) { Total += Segments.Num(); }
+
+		OutChains.Reset(Total);
+		for (const TArray<TSharedPtr<FTestChain>>& Segments : SplitChains) { OutChains.Append(Segments); }
+
+		// Same dedup as ApplyBreakpoints, segments of different chains can coincide
+		RemoveDuplicateChains(OutChains);
+	}
+
+	void FCachedChainData::SplitBaseChain(const TSharedRef<FTestCluster>& Cluster, const int32 ChainIndex)
+	{
+		TArray<TSharedPtr<FTestChain>>& Segments = SplitChains[ChainIndex];
+		Segments.Reset();
+
+		if (Breakpoints.IsEmpty())
+		{
+			Segments.Add(BaseChains[ChainIndex]);
+			return;
+		}
+
+		TestChainHelpers::SplitChain(BaseChains[ChainIndex], Cluster, Breakpoints, Segments);
+	}
+
+	int64 GetCachedDataSize(const FCachedChainData& Data)
+	{
+		int64 Size = sizeof(FCachedChainData);
+		Size += Data.BaseChains.GetAllocatedSize() + Data.SplitChains.GetAllocatedSize();
+		Size += Data.Breakpoints.GetAllocatedSize() + Data.PointChainOffsets.GetAllocatedSize() + Data.PointChains.GetAllocatedSize();
+
+		TSet<const FTestChain*> Counted;
+		auto CountChain = [&](const TSharedPtr<FTestChain>& Chain)
+		{
+			bool bAlreadyCounted = false;
+			Counted.Add(Chain.Get(), &bAlreadyCounted);
+			if (!bAlreadyCounted) { Size += sizeof(FTestChain) + Chain->Links.GetAllocatedSize(); }
+		};
+
+		for (const TSharedPtr<FTestChain>& Chain : Data.BaseChains) { CountChain(Chain); }
+		for (const TArray<TSharedPtr<FTestChain>>& Segments : Data.SplitChains)
+		{
+			Size += Segments.GetAllocatedSize();
+			for (const TSharedPtr<FTestChain>& Chain : Segments) { CountChain(Chain); }
+		}
+
+		return Size;
+	}
+
+#pragma endregion
+
 #pragma region TestChainHelpers
 
 	namespace TestChainHelpers
 	{
+		namespace
+		{
+			/** (Re)insert the chain cache with its current footprint; splits are updated in place and change it */
+			void SetCachedChains(const TSharedRef<FTestCluster>& Cluster, const TSharedPtr<FCachedChainData>& Cached)
+			{
+				// Only a cache store accounts sizes, skip the walk otherwise
+				Cluster->SetCachedData(FCachedChainData::CacheKey, Cached, Cluster->GetCacheStore() ? GetCachedDataSize(*Cached) : 0);
+			}
+		}
+
 		bool BuildChains(
 			const TSharedRef<FTestCluster>& Cluster,
 			TArray<TSharedPtr<FTestChain>>& OutChains,
@@ -118,26 +288,25 @@ namespace PCGExTest
 
 			for (int32 i = 0; i < NumNodes; i++)
 			{
-				PCGExClusters::FNode* Node = Cluster->GetNode(i);
-				if (!Node || Node->IsEmpty()) { continue; }
+				if (Cluster->IsIsolated(i)) { continue; }
 
-				if (Node->IsLeaf())
+				if (Cluster->IsLeaf(i))
 				{
-					OutChains.Add(MakeShared<FTestChain>(FLink(Node->Index, Node->Links[0].Edge)));
+					OutChains.Add(MakeShared<FTestChain>(FLink(i, Cluster->GetLink(i, 0).Edge)));
 					continue;
 				}
 
-				if (Node->IsBinary())
+				if (Cluster->IsBinary(i))
 				{
 					NumBinaries++;
 					continue;
 				}
 
-				for (const FLink& Lk : Node->Links)
+				for (const FLink& Lk : Cluster->GetLinks(i))
 				{
 					// Skip immediately known leaves to avoid double-sampling
-					if (Cluster->GetNode(Lk.Node)->IsLeaf()) { continue; }
-					OutChains.Add(MakeShared<FTestChain>(FLink(Node->Index, Lk.Edge)));
+					if (Cluster->IsLeaf(Lk.Node)) { continue; }
+					OutChains.Add(MakeShared<FTestChain>(FLink(i, Lk.Edge)));
 				}
 			}
 
@@ -148,7 +317,7 @@ namespace PCGExTest
 				if (NumBinaries > 0 && NumBinaries == NumNodes)
 				{
 					// Isolated closed loop - all nodes are binary
-					OutChains.Add(MakeShared<FTestChain>(Cluster->GetNode(0)->Links[0]));
+					OutChains.Add(MakeShared<FTestChain>(Cluster->GetLink(0, 0)));
 				}
 				else
 				{
@@ -186,170 +355,355 @@ namespace PCGExTest
 			return !OutChains.IsEmpty();
 		}
 
-		void ApplyBreakpoints(
-			const TArray<TSharedPtr<FTestChain>>& SourceChains,
+		bool BuildChainsParallel(
 			const TSharedRef<FTestCluster>& Cluster,
-			const TSharedPtr<TArray<int8>>& Breakpoints,
-			TArray<TSharedPtr<FTestChain>>& OutChains)
+			TArray<TSharedPtr<FTestChain>>& OutChains,
+			const TSharedPtr<TArray<int8>>& Breakpoints)
 		{
-			if (!Breakpoints || Breakpoints->IsEmpty())
+			OutChains.Reset();
+
+			const int32 NumNodes = Cluster->NumNodes();
+			if (NumNodes <= 0) { return false; }
+
+			// Only leaves and complex nodes seed chains. Their class lists are merged back into
+			// node order so chain indices match BuildChains; binaries are never visited.
+			// The cluster's cached classes are reused, but building chains doesn't cache new ones.
+			const TSharedPtr<FCachedNodeClasses> NodeClasses = TestNodeClasses::GetOrBuildNodeClasses(Cluster, false);
+			const TConstArrayView<int32> Leaves = NodeClasses->GetLeaves();
+			const TConstArrayView<int32> Complex = NodeClasses->GetComplex();
+
+			TArray<int32> SeedNodes;
+			SeedNodes.SetNumUninitialized(Leaves.Num() + Complex.Num());
+			for (int32 i = 0, l = 0, c = 0; i < SeedNodes.Num(); i++)
 			{
-				OutChains = SourceChains;
-				return;
+				SeedNodes[i] = c == Complex.Num() || (l < Leaves.Num() && Leaves[l] < Complex[c]) ? Leaves[l++] : Complex[c++];
 			}
 
-			OutChains.Reset();
-			OutChains.Reserve(SourceChains.Num() * 2);
+			TArray<int32> SeedOffsets;
+			SeedOffsets.SetNumUninitialized(SeedNodes.Num() + 1);
+			SeedOffsets[0] = 0;
 
-			const TArray<int8>& BreakpointsRef = *Breakpoints;
+			ParallelFor(
+				SeedNodes.Num(), [&](const int32 s)
+				{
+					const int32 i = SeedNodes[s];
+					int32 Count = 0;
+					if (NodeClasses->IsLeaf(i)) { Count = 1; }
+					else
+					{
+						for (const FLink& Lk : Cluster->GetLinks(i)) { if (!NodeClasses->IsLeaf(Lk.Node)) { Count++; } }
+					}
+					SeedOffsets[s + 1] = Count;
+				});
 
-			for (const TSharedPtr<FTestChain>& SourceChain : SourceChains)
+			for (int32 s = 0; s < SeedNodes.Num(); s++) { SeedOffsets[s + 1] += SeedOffsets[s]; }
+
+			const int32 NumSeeds = SeedOffsets[SeedNodes.Num()];
+			TArray<FLink> Seeds;
+
+			if (NumSeeds == 0)
 			{
-				if (!SourceChain) { continue; }
+				// Isolated closed loop - all nodes are binary
+				const int32 NumBinaries = NodeClasses->Num(ETestNodeClass::Binary);
+				if (NumBinaries == 0 || NumBinaries != NumNodes) { return false; }
+				Seeds.Add(Cluster->GetLink(0, 0));
+			}
+			else
+			{
+				Seeds.SetNumUninitialized(NumSeeds);
+				ParallelFor(
+					SeedNodes.Num(), [&](const int32 s)
+					{
+						const int32 i = SeedNodes[s];
+						int32 WriteIndex = SeedOffsets[s];
+						if (WriteIndex == SeedOffsets[s + 1]) { return; }
+
+						if (NodeClasses->IsLeaf(i))
+						{
+							Seeds[WriteIndex] = FLink(i, Cluster->GetLink(i, 0).Edge);
+							return;
+						}
+
+						for (const FLink& Lk : Cluster->GetLinks(i))
+						{
+							if (NodeClasses->IsLeaf(Lk.Node)) { continue; }
+							Seeds[WriteIndex++] = FLink(i, Lk.Edge);
+						}
+					});
+			}
+
+			// Each open chain is found twice, once from each end; the walk from seed A ends on
+			// seed B's edge. EdgeOwner holds the lowest seed index whose walk ended on that edge,
+			// so a seed can skip its walk if a lower seed already covered it. Whatever got walked
+			// anyway is discarded below against the final owners, which don't depend on timing.
+			TArray<int32> EdgeOwner;
+			EdgeOwner.Init(MAX_int32, Cluster->Edges->Num());
 
-				// Single edge chains can't be split - pass through as-is
-				if (SourceChain->SingleEdge != -1)
+			auto ClaimEdge = [&EdgeOwner](const int32 Edge, const int32 SeedIndex)
+			{
+				volatile int32* Dest = &EdgeOwner[Edge];
+				int32 Current = FPlatformAtomics::AtomicRead(Dest);
+				while (SeedIndex < Current)
 				{
-					OutChains.Add(SourceChain);
-					continue;
+					const int32 Previous = FPlatformAtomics::InterlockedCompareExchange(Dest, SeedIndex, Current);
+					if (Previous == Current) { break; }
+					Current = Previous;
 				}
+			};
 
-				// For closed loops, extend the walk to include the wrap-around back to the seed.
-				// The Links array doesn't contain the seed node — the closure is implicit via bIsClosedLoop.
-				TArray<FLink> ExtendedLinks;
-				const TArray<FLink>& WalkLinks = [&]() -> const TArray<FLink>&
+			const bool bHasBreakpoints = Breakpoints && !Breakpoints->IsEmpty();
+
+			TArray<TSharedPtr<FTestChain>> BaseChains;
+			TArray<TArray<TSharedPtr<FTestChain>>> Segments;
+			BaseChains.SetNum(Seeds.Num());
+			if (bHasBreakpoints) { Segments.SetNum(Seeds.Num()); }
+
+			ParallelFor(
+				Seeds.Num(), [&](const int32 SeedIndex)
 				{
-					if (SourceChain->bIsClosedLoop)
-					{
-						ExtendedLinks = SourceChain->Links;
-						ExtendedLinks.Add(FLink(SourceChain->Seed.Node, SourceChain->Seed.Edge));
-						return ExtendedLinks;
-					}
-					return SourceChain->Links;
-				}();
+					const FLink& Seed = Seeds[SeedIndex];
+					if (FPlatformAtomics::AtomicRead(&EdgeOwner[Seed.Edge]) < SeedIndex) { return; }
+
+					TSharedPtr<FTestChain> Chain = MakeShared<FTestChain>(Seed);
+					Chain->BuildChain(Cluster, nullptr);
 
-				// Walk through the chain and split at breakpoints
-				TArray<FLink> CurrentSegmentLinks;
-				CurrentSegmentLinks.Reserve(WalkLinks.Num());
+					if (!Chain->bIsClosedLoop) { ClaimEdge(Chain->Links.Last().Edge, SeedIndex); }
 
-				int32 SegmentSeedNode = SourceChain->Seed.Node;
+					if (bHasBreakpoints) { SplitChain(Chain, Cluster, *Breakpoints, Segments[SeedIndex]); }
+					BaseChains[SeedIndex] = MoveTemp(Chain);
+				});
+
+			// Keep chains in seed order, dropping reverse duplicates
+			OutChains.Reserve(Seeds.Num());
+			for (int32 SeedIndex = 0; SeedIndex < Seeds.Num(); SeedIndex++)
+			{
+				if (!BaseChains[SeedIndex] || EdgeOwner[Seeds[SeedIndex].Edge] < SeedIndex) { continue; }
 
-				// For closed loops, Seed.Edge was overwritten with the closing edge during BuildChain.
-				// The first segment needs the original edge from seed to first link (Links[0].Edge).
-				int32 SegmentSeedEdge = (SourceChain->bIsClosedLoop && !SourceChain->Links.IsEmpty())
-				                        ? SourceChain->Links[0].Edge
-				                        : SourceChain->Seed.Edge;
+				if (bHasBreakpoints) { OutChains.Append(MoveTemp(Segments[SeedIndex])); }
+				else { OutChains.Add(MoveTemp(BaseChains[SeedIndex])); }
+			}
 
-				const int32 OriginalSeedPI = Cluster->GetNodePointIndex(SourceChain->Seed.Node);
-				const bool bOriginalSeedIsBreakpoint = BreakpointsRef.IsValidIndex(OriginalSeedPI) && BreakpointsRef[OriginalSeedPI];
-				bool bSegmentStartIsBreakpoint = bOriginalSeedIsBreakpoint;
+			// Same final dedup as the sequential path, so split segments shared by two chains collapse identically
+			RemoveDuplicateChains(OutChains);
 
-				// For closed loops where the seed is NOT a breakpoint, merge the first and last
-				// emitted segments to rejoin the chain across the arbitrary seed split point.
-				const bool bNeedsMerge = SourceChain->bIsClosedLoop && !bOriginalSeedIsBreakpoint;
-				int32 FirstEmittedIndex = -1;
+			return !OutChains.IsEmpty();
+		}
 
-				for (int32 i = 0; i < WalkLinks.Num(); i++)
+		void SplitChain(
+			const TSharedPtr<FTestChain>& SourceChain,
+			const TSharedRef<FTestCluster>& Cluster,
+			const TArray<int8>& Breakpoints,
+			TArray<TSharedPtr<FTestChain>>& OutSegments)
+		{
+			if (!SourceChain) { return; }
+
+			// Single edge chains can't be split - pass through as-is
+			if (SourceChain->SingleEdge != -1)
+			{
+				OutSegments.Add(SourceChain);
+				return;
+			}
+
+			// For closed loops, extend the walk to include the wrap-around back to the seed.
+			// The Links array doesn't contain the seed node — the closure is implicit via bIsClosedLoop.
+			TArray<FLink> ExtendedLinks;
+			const TArray<FLink>& WalkLinks = [&]() -> const TArray<FLink>&
+			{
+				if (SourceChain->bIsClosedLoop)
 				{
-					const FLink& Link = WalkLinks[i];
-					const int32 NodePointIndex = Cluster->GetNodePointIndex(Link.Node);
-					const bool bIsBreakpoint = BreakpointsRef.IsValidIndex(NodePointIndex) && BreakpointsRef[NodePointIndex];
+					ExtendedLinks = SourceChain->Links;
+					ExtendedLinks.Add(FLink(SourceChain->Seed.Node, SourceChain->Seed.Edge));
+					return ExtendedLinks;
+				}
+				return SourceChain->Links;
+			}();
 
-					if (bIsBreakpoint)
-					{
-						// Include this link in the current segment (chain goes TO the breakpoint)
-						CurrentSegmentLinks.Add(Link);
+			// Walk through the chain and split at breakpoints
+			TArray<FLink> CurrentSegmentLinks;
+			CurrentSegmentLinks.Reserve(WalkLinks.Num());
 
-						// Emit current segment
-						TSharedPtr<FTestChain> NewChain = MakeShared<FTestChain>(FLink(SegmentSeedNode, SegmentSeedEdge));
-						NewChain->Links = MoveTemp(CurrentSegmentLinks);
-						NewChain->bIsClosedLoop = false;
+			int32 SegmentSeedNode = SourceChain->Seed.Node;
 
-						// Determine if this segment is a leaf chain (topology only)
-						const PCGExClusters::FNode* StartNode = Cluster->GetNode(SegmentSeedNode);
-						const PCGExClusters::FNode* EndNode = Cluster->GetNode(NewChain->Links.Last().Node);
-						NewChain->bIsLeaf = (StartNode && StartNode->IsLeaf()) || (EndNode && EndNode->IsLeaf());
+			// For closed loops, Seed.Edge was overwritten with the closing edge during BuildChain.
+			// The first segment needs the original edge from seed to first link (Links[0].Edge).
+			int32 SegmentSeedEdge = (SourceChain->bIsClosedLoop && !SourceChain->Links.IsEmpty())
+			                        ? SourceChain->Links[0].Edge
+			                        : SourceChain->Seed.Edge;
 
-						NewChain->FixUniqueHash();
+			const int32 OriginalSeedPI = Cluster->GetNodePointIndex(SourceChain->Seed.Node);
+			const bool bOriginalSeedIsBreakpoint = Breakpoints.IsValidIndex(OriginalSeedPI) && Breakpoints[OriginalSeedPI];
+			bool bSegmentStartIsBreakpoint = bOriginalSeedIsBreakpoint;
 
-						if (FirstEmittedIndex == -1) { FirstEmittedIndex = OutChains.Num(); }
-						OutChains.Add(NewChain);
+			// For closed loops where the seed is NOT a breakpoint, merge the first and last
+			// emitted segments to rejoin the chain across the arbitrary seed split point.
+			const bool bNeedsMerge = SourceChain->bIsClosedLoop && !bOriginalSeedIsBreakpoint;
+			int32 FirstEmittedIndex = -1;
 
-						CurrentSegmentLinks.Reset();
-						CurrentSegmentLinks.Reserve(WalkLinks.Num() - i);
+			for (int32 i = 0; i < WalkLinks.Num(); i++)
+			{
+				const FLink& Link = WalkLinks[i];
+				const int32 NodePointIndex = Cluster->GetNodePointIndex(Link.Node);
+				const bool bIsBreakpoint = Breakpoints.IsValidIndex(NodePointIndex) && Breakpoints[NodePointIndex];
 
-						// Start new segment from breakpoint node
-						SegmentSeedNode = Link.Node;
-						SegmentSeedEdge = (i + 1 < WalkLinks.Num()) ? WalkLinks[i + 1].Edge : Link.Edge;
-						bSegmentStartIsBreakpoint = true;
-					}
-					else
-					{
-						CurrentSegmentLinks.Add(Link);
-					}
+				if (bIsBreakpoint)
+				{
+					// Include this link in the current segment (chain goes TO the breakpoint)
+					CurrentSegmentLinks.Add(Link);
+
+					// Emit current segment
+					TSharedPtr<FTestChain> NewChain = MakeShared<FTestChain>(FLink(SegmentSeedNode, SegmentSeedEdge));
+					NewChain->Links = MoveTemp(CurrentSegmentLinks);
+					NewChain->bIsClosedLoop = false;
+
+					// Determine if this segment is a leaf chain (topology only)
+					NewChain->bIsLeaf = Cluster->IsLeaf(SegmentSeedNode) || Cluster->IsLeaf(NewChain->Links.Last().Node);
+
+					NewChain->FixUniqueHash();
+
+					if (FirstEmittedIndex == -1) { FirstEmittedIndex = OutSegments.Num(); }
+					OutSegments.Add(NewChain);
+
+					CurrentSegmentLinks.Reset();
+					CurrentSegmentLinks.Reserve(WalkLinks.Num() - i);
+
+					// Start new segment from breakpoint node
+					SegmentSeedNode = Link.Node;
+					SegmentSeedEdge = (i + 1 < WalkLinks.Num()) ? WalkLinks[i + 1].Edge : Link.Edge;
+					bSegmentStartIsBreakpoint = true;
 				}
+				else
+				{
+					CurrentSegmentLinks.Add(Link);
+				}
+			}
 
-				// Emit final segment
-				if (!CurrentSegmentLinks.IsEmpty())
+			// Emit final segment
+			if (!CurrentSegmentLinks.IsEmpty())
+			{
+				if (bNeedsMerge && FirstEmittedIndex >= 0)
 				{
-					if (bNeedsMerge && FirstEmittedIndex >= 0)
-					{
-						// Merge last + first segments across the arbitrary seed node.
-						TSharedPtr<FTestChain>& FirstSeg = OutChains[FirstEmittedIndex];
-						CurrentSegmentLinks.Append(FirstSeg->Links);
+					// Merge last + first segments across the arbitrary seed node.
+					TSharedPtr<FTestChain>& FirstSeg = OutSegments[FirstEmittedIndex];
+					CurrentSegmentLinks.Append(FirstSeg->Links);
 
-						TSharedPtr<FTestChain> MergedChain = MakeShared<FTestChain>(FLink(SegmentSeedNode, SegmentSeedEdge));
-						MergedChain->Links = MoveTemp(CurrentSegmentLinks);
-						MergedChain->bIsClosedLoop = false;
+					TSharedPtr<FTestChain> MergedChain = MakeShared<FTestChain>(FLink(SegmentSeedNode, SegmentSeedEdge));
+					MergedChain->Links = MoveTemp(CurrentSegmentLinks);
+					MergedChain->bIsClosedLoop = false;
 
-						const PCGExClusters::FNode* StartNode = Cluster->GetNode(SegmentSeedNode);
-						const PCGExClusters::FNode* EndNode = Cluster->GetNode(MergedChain->Links.Last().Node);
-						MergedChain->bIsLeaf = (StartNode && StartNode->IsLeaf()) || (EndNode && EndNode->IsLeaf());
+					MergedChain->bIsLeaf = Cluster->IsLeaf(SegmentSeedNode) || Cluster->IsLeaf(MergedChain->Links.Last().Node);
 
-						MergedChain->FixUniqueHash();
-						OutChains[FirstEmittedIndex] = MergedChain;
-					}
-					else if (bNeedsMerge)
-					{
-						// Closed loop with no breakpoints in any link — pass through unchanged
-						OutChains.Add(SourceChain);
-					}
-					else
-					{
-						TSharedPtr<FTestChain> NewChain = MakeShared<FTestChain>(FLink(SegmentSeedNode, SegmentSeedEdge));
-						NewChain->Links = MoveTemp(CurrentSegmentLinks);
+					MergedChain->FixUniqueHash();
+					OutSegments[FirstEmittedIndex] = MergedChain;
+				}
+				else if (bNeedsMerge)
+				{
+					// Closed loop with no breakpoints in any link — pass through unchanged
+					OutSegments.Add(SourceChain);
+				}
+				else
+				{
+					TSharedPtr<FTestChain> NewChain = MakeShared<FTestChain>(FLink(SegmentSeedNode, SegmentSeedEdge));
+					NewChain->Links = MoveTemp(CurrentSegmentLinks);
 
-						// Check for closed loop (only if source was a closed loop and no breakpoints hit)
-						NewChain->bIsClosedLoop = SourceChain->bIsClosedLoop &&
-						                          SegmentSeedNode == SourceChain->Seed.Node &&
-						                          !bSegmentStartIsBreakpoint;
+					// Check for closed loop (only if source was a closed loop and no breakpoints hit)
+					NewChain->bIsClosedLoop = SourceChain->bIsClosedLoop &&
+					                          SegmentSeedNode == SourceChain->Seed.Node &&
+					                          !bSegmentStartIsBreakpoint;
 
-						// Determine if this is a leaf chain (topology only)
-						const PCGExClusters::FNode* StartNode = Cluster->GetNode(SegmentSeedNode);
-						const PCGExClusters::FNode* EndNode = Cluster->GetNode(NewChain->Links.Last().Node);
-						NewChain->bIsLeaf = (StartNode && StartNode->IsLeaf()) || (EndNode && EndNode->IsLeaf());
+					// Determine if this is a leaf chain (topology only)
+					NewChain->bIsLeaf = Cluster->IsLeaf(SegmentSeedNode) || Cluster->IsLeaf(NewChain->Links.Last().Node);
 
-						if (NewChain->bIsClosedLoop) { NewChain->bIsLeaf = false; }
+					if (NewChain->bIsClosedLoop) { NewChain->bIsLeaf = false; }
 
-						NewChain->FixUniqueHash();
-						OutChains.Add(NewChain);
-					}
+					NewChain->FixUniqueHash();
+					OutSegments.Add(NewChain);
 				}
 			}
+		}
+
+		void ApplyBreakpoints(
+			const TArray<TSharedPtr<FTestChain>>& SourceChains,
+			const TSharedRef<FTestCluster>& Cluster,
+			const TSharedPtr<TArray<int8>>& Breakpoints,
+			TArray<TSharedPtr<FTestChain>>& OutChains)
+		{
+			if (!Breakpoints || Breakpoints->IsEmpty())
+			{
+				OutChains = SourceChains;
+				return;
+			}
+
+			OutChains.Reset();
+			OutChains.Reserve(SourceChains.Num() * 2);
+
+			for (const TSharedPtr<FTestChain>& SourceChain : SourceChains)
+			{
+				SplitChain(SourceChain, Cluster, *Breakpoints, OutChains);
+			}
 
 			// Deduplicate results
-			TSet<uint64> UniqueHashSet;
-			UniqueHashSet.Reserve(OutChains.Num());
+			RemoveDuplicateChains(OutChains);
+		}
 
-			OutChains.SetNum(Algo::StableRemoveIf(
-				OutChains,
-				[&UniqueHashSet](const TSharedPtr<FTestChain>& Chain)
-				{
-					if (!Chain || Chain->Links.IsEmpty()) { return true; }
-					bool bAlreadySet = false;
-					UniqueHashSet.Add(Chain->UniqueHash, &bAlreadySet);
-					return bAlreadySet;
-				}));
+		TSharedPtr<FCachedChainData> GetOrBuildCachedChains(
+			const TSharedRef<FTestCluster>& Cluster,
+			const TSharedPtr<TArray<int8>>& Breakpoints,
+			FPersistentArtifactCache* PersistentCache)
+		{
+			TSharedPtr<FCachedChainData> Cached = Cluster->GetCachedData<FCachedChainData>(FCachedChainData::CacheKey);
+			if (Cached)
+			{
+				Cached->UpdateBreakpoints(Cluster, Breakpoints);
+				SetCachedChains(Cluster, Cached);
+				return Cached;
+			}
+
+			if (PersistentCache)
+			{
+				// Persisted chains are unsplit; breakpoints are applied as an incremental update
+				Cached = FindOrBuildArtifact<FCachedChainData>(
+					Cluster, FCachedChainData::CacheKey, 0, [&]()
+					{
+						TSharedPtr<FCachedChainData> Built = MakeShared<FCachedChainData>();
+						Built->Build(Cluster, nullptr);
+						return Built;
+					}, *PersistentCache);
+
+				Cached->UpdateBreakpoints(Cluster, Breakpoints);
+				SetCachedChains(Cluster, Cached);
+				return Cached;
+			}
+
+			Cached = MakeShared<FCachedChainData>();
+			Cached->Build(Cluster, Breakpoints);
+			SetCachedChains(Cluster, Cached);
+			return Cached;
+		}
+
+		int32 UpdateChains(
+			const TSharedRef<FTestCluster>& Cluster,
+			const TSharedPtr<TArray<int8>>& Breakpoints,
+			const TConstArrayView<int32> DirtyPoints,
+			TArray<TSharedPtr<FTestChain>>& OutChains)
+		{
+			TSharedPtr<FCachedChainData> Cached = Cluster->GetCachedData<FCachedChainData>(FCachedChainData::CacheKey);
+			int32 NumUpdated = 0;
+
+			if (!Cached)
+			{
+				Cached = MakeShared<FCachedChainData>();
+				Cached->Build(Cluster, Breakpoints);
+				NumUpdated = Cached->BaseChains.Num();
+			}
+			else
+			{
+				NumUpdated = Cached->UpdateBreakpoints(Cluster, Breakpoints, DirtyPoints);
+			}
+
+			SetCachedChains(Cluster, Cached);
+
+			Cached->Gather(OutChains);
+			return NumUpdated;
 		}
 
 		void FilterLeavesOnly(
@@ -407,6 +761,44 @@ namespace PCGExTest
 			}
 			return Count;
 		}
+
+		bool ChainsMatch(
+			const TArray<TSharedPtr<FTestChain>>& A,
+			const TArray<TSharedPtr<FTestChain>>& B,
+			FString* OutMismatch)
+		{
+			auto Fail = [&](const FString& Reason)
+			{
+				if (OutMismatch) { *OutMismatch = Reason; }
+				return false;
+			};
+
+			if (A.Num() != B.Num()) { return Fail(FString::Printf(TEXT("Chain count %d vs %d"), A.Num(), B.Num())); }
+
+			for (int32 i = 0; i < A.Num(); i++)
+			{
+				const FTestChain* CA = A[i].Get();
+				const FTestChain* CB = B[i].Get();
+				if (!CA || !CB) { return Fail(FString::Printf(TEXT("Chain %d is null"), i)); }
+
+				if (CA->Seed.Node != CB->Seed.Node || CA->Seed.Edge != CB->Seed.Edge) { return Fail(FString::Printf(TEXT("Chain %d seed differs"), i)); }
+				if (CA->SingleEdge != CB->SingleEdge) { return Fail(FString::Printf(TEXT("Chain %d SingleEdge differs"), i)); }
+				if (CA->bIsClosedLoop != CB->bIsClosedLoop) { return Fail(FString::Printf(TEXT("Chain %d bIsClosedLoop differs"), i)); }
+				if (CA->bIsLeaf != CB->bIsLeaf) { return Fail(FString::Printf(TEXT("Chain %d bIsLeaf differs"), i)); }
+				if (CA->UniqueHash != CB->UniqueHash) { return Fail(FString::Printf(TEXT("Chain %d UniqueHash differs"), i)); }
+				if (CA->Links.Num() != CB->Links.Num()) { return Fail(FString::Printf(TEXT("Chain %d has %d vs %d links"), i, CA->Links.Num(), CB->Links.Num())); }
+
+				for (int32 j = 0; j < CA->Links.Num(); j++)
+				{
+					if (CA->Links[j].Node != CB->Links[j].Node || CA->Links[j].Edge != CB->Links[j].Edge)
+					{
+						return Fail(FString::Printf(TEXT("Chain %d link %d differs"), i, j));
+					}
+				}
+			}
+
+			return true;
+		}
 	}
 
 #pragma endregion
@@ -0,0 +1,248 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Helpers/PCGExClusterCacheHelpers.h"
+#include "Clusters/Artifacts/PCGExPlanarFaceEnumerator.h"
+
+namespace PCGExTest
+{
+#pragma region Sizes
+
+	int64 GetCachedDataSize(const PCGExClusters::ICachedClusterData& Data)
+	{
+		return sizeof(PCGExClusters::ICachedClusterData);
+	}
+
+	int64 GetCachedDataSize(const PCGExClusters::FCachedTangentFrames& Data)
+	{
+		int64 Size = sizeof(PCGExClusters::FCachedTangentFrames);
+		if (Data.NodeTangentFrames) { Size += Data.NodeTangentFrames->GetAllocatedSize(); }
+		return Size;
+	}
+
+	int64 GetCachedDataSize(const PCGExClusters::FCachedFaceEnumerator& Data)
+	{
+		int64 Size = sizeof(PCGExClusters::FCachedFaceEnumerator);
+		if (Data.ProjectedPositions) { Size += Data.ProjectedPositions->GetAllocatedSize(); }
+		if (Data.Enumerator)
+		{
+			// The enumerator doesn't expose its storage; estimate it from its counts
+			// (half-edge: origin, twin, next, face; face: first half-edge, area, flags)
+			Size += sizeof(PCGExClusters::FPlanarFaceEnumerator);
+			Size += static_cast<int64>(Data.Enumerator->GetNumHalfEdges()) * 4 * sizeof(int32);
+			Size += static_cast<int64>(Data.Enumerator->GetNumFaces()) * (sizeof(int32) + sizeof(double) + sizeof(int32));
+		}
+		return Size;
+	}
+
+#pragma endregion
+
+#pragma region FClusterCacheStats
+
+	double FClusterCacheStats::GetHitRatio() const
+	{
+		const int64 Lookups = Hits + Misses;
+		return Lookups > 0 ? static_cast<double>(Hits) / static_cast<double>(Lookups) : 0;
+	}
+
+	FString FClusterCacheStats::ToString() const
+	{
+		return FString::Printf(
+			TEXT("%d entries, %lld bytes (peak %lld), %lld hits / %lld misses (%.1f%%), %lld stale, %lld evicted, %lld rejected"),
+			NumEntries, BytesInUse, PeakBytes, Hits, Misses, GetHitRatio() * 100.0, StaleDrops, Evictions, Rejections);
+	}
+
+#pragma endregion
+
+#pragma region FClusterCacheStore
+
+	FClusterCacheStore::FClusterCacheStore(const int64 InBudgetBytes, const double InLowWaterRatio)
+		: BudgetBytes(InBudgetBytes),
+		  LowWaterRatio(FMath::Clamp(InLowWaterRatio, 0.0, 1.0))
+	{
+	}
+
+	void FClusterCacheStore::SetBudget(const int64 InBudgetBytes)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		BudgetBytes = InBudgetBytes;
+		EvictToFit_Unsafe(0);
+	}
+
+	TSharedPtr<PCGExClusters::ICachedClusterData> FClusterCacheStore::Find(const void* Owner, const FName Key, const uint32 ExpectedContextHash, const uint32 ExpectedVersion)
+	{
+		return FindImpl(Owner, Key, ExpectedContextHash, ExpectedVersion, nullptr);
+	}
+
+	bool FClusterCacheStore::AddWithSize(const void* Owner, const FName Key, const TSharedPtr<PCGExClusters::ICachedClusterData>& Data, const int64 SizeBytes, const uint32 Version, const FCachedDataTypeId TypeId)
+	{
+		return AddImpl(Owner, Key, Data, SizeBytes, Version, TypeId);
+	}
+
+	TSharedPtr<PCGExClusters::ICachedClusterData> FClusterCacheStore::FindImpl(const void* Owner, const FName Key, const uint32 ExpectedContextHash, const uint32 ExpectedVersion, const FTypeId ExpectedType)
+	{
+		const FEntryKey EntryKey{Owner, Key};
+		TSharedPtr<FEntry> Entry;
+
+		{
+			FReadScopeLock ReadLock(Lock);
+			if (const TSharedPtr<FEntry>* Found = Entries.Find(EntryKey)) { Entry = *Found; }
+		}
+
+		if (!Entry)
+		{
+			Misses.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		const bool bStale =
+			Entry->Version != ExpectedVersion ||
+			(ExpectedContextHash != 0 && Entry->Data->ContextHash != ExpectedContextHash) ||
+			(ExpectedType && Entry->TypeId && Entry->TypeId != ExpectedType);
+
+		if (bStale)
+		{
+			{
+				FWriteScopeLock WriteLock(Lock);
+				// Only drop it if nobody replaced it in the meantime
+				const TSharedPtr<FEntry>* Current = Entries.Find(EntryKey);
+				if (Current && *Current == Entry) { RemoveEntry_Unsafe(EntryKey); }
+			}
+
+			StaleDrops.fetch_add(1, std::memory_order_relaxed);
+			Misses.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		Entry->LastAccess.store(AccessTick.fetch_add(1, std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		Hits.fetch_add(1, std::memory_order_relaxed);
+		return Entry->Data;
+	}
+
+	bool FClusterCacheStore::AddImpl(const void* Owner, const FName Key, const TSharedPtr<PCGExClusters::ICachedClusterData>& Data, const int64 SizeBytes, const uint32 Version, const FTypeId TypeId)
+	{
+		if (!Data) { return false; }
+
+		const FEntryKey EntryKey{Owner, Key};
+
+		FWriteScopeLock WriteLock(Lock);
+
+		// Replacing an entry releases its bytes first
+		RemoveEntry_Unsafe(EntryKey);
+
+		if (BudgetBytes > 0 && SizeBytes > BudgetBytes)
+		{
+			Rejections.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		EvictToFit_Unsafe(SizeBytes);
+
+		TSharedPtr<FEntry> Entry = MakeShared<FEntry>();
+		Entry->Data = Data;
+		Entry->SizeBytes = SizeBytes;
+		Entry->Version = Version;
+		Entry->TypeId = TypeId;
+		Entry->LastAccess.store(AccessTick.fetch_add(1, std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+		Entries.Add(EntryKey, Entry);
+		BytesInUse += SizeBytes;
+		PeakBytes = FMath::Max(PeakBytes, BytesInUse);
+
+		Insertions.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	bool FClusterCacheStore::Remove(const void* Owner, const FName Key)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		const int32 NumBefore = Entries.Num();
+		RemoveEntry_Unsafe(FEntryKey{Owner, Key});
+		return Entries.Num() != NumBefore;
+	}
+
+	int32 FClusterCacheStore::RemoveOwner(const void* Owner)
+	{
+		FWriteScopeLock WriteLock(Lock);
+
+		int32 NumRemoved = 0;
+		for (auto It = Entries.CreateIterator(); It; ++It)
+		{
+			if (It->Key.Owner != Owner) { continue; }
+			BytesInUse -= It->Value->SizeBytes;
+			It.RemoveCurrent();
+			NumRemoved++;
+		}
+
+		return NumRemoved;
+	}
+
+	void FClusterCacheStore::Empty()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		Entries.Empty();
+		BytesInUse = 0;
+	}
+
+	FClusterCacheStats FClusterCacheStore::GetStats() const
+	{
+		FClusterCacheStats Stats;
+		Stats.Hits = Hits.load(std::memory_order_relaxed);
+		Stats.Misses = Misses.load(std::memory_order_relaxed);
+		Stats.StaleDrops = StaleDrops.load(std::memory_order_relaxed);
+		Stats.Evictions = Evictions.load(std::memory_order_relaxed);
+		Stats.Insertions = Insertions.load(std::memory_order_relaxed);
+		Stats.Rejections = Rejections.load(std::memory_order_relaxed);
+
+		FReadScopeLock ReadLock(Lock);
+		Stats.BytesInUse = BytesInUse;
+		Stats.PeakBytes = PeakBytes;
+		Stats.NumEntries = Entries.Num();
+		return Stats;
+	}
+
+	void FClusterCacheStore::ResetStats()
+	{
+		Hits.store(0, std::memory_order_relaxed);
+		Misses.store(0, std::memory_order_relaxed);
+		StaleDrops.store(0, std::memory_order_relaxed);
+		Evictions.store(0, std::memory_order_relaxed);
+		Insertions.store(0, std::memory_order_relaxed);
+		Rejections.store(0, std::memory_order_relaxed);
+
+		FWriteScopeLock WriteLock(Lock);
+		PeakBytes = BytesInUse;
+	}
+
+	void FClusterCacheStore::RemoveEntry_Unsafe(const FEntryKey& Key)
+	{
+		TSharedPtr<FEntry> Removed;
+		if (Entries.RemoveAndCopyValue(Key, Removed)) { BytesInUse -= Removed->SizeBytes; }
+	}
+
+	void FClusterCacheStore::EvictToFit_Unsafe(const int64 IncomingBytes)
+	{
+		if (BudgetBytes <= 0 || BytesInUse + IncomingBytes <= BudgetBytes) { return; }
+
+		// Evict down to the low-water mark so the next insertions don't each trigger a pass
+		const int64 Target = FMath::Max<int64>(0, static_cast<int64>(BudgetBytes * LowWaterRatio) - IncomingBytes);
+
+		TArray<TPair<uint64, FEntryKey>> ByAge;
+		ByAge.Reserve(Entries.Num());
+		for (const TPair<FEntryKey, TSharedPtr<FEntry>>& Pair : Entries)
+		{
+			ByAge.Emplace(Pair.Value->LastAccess.load(std::memory_order_relaxed), Pair.Key);
+		}
+
+		ByAge.Sort([](const TPair<uint64, FEntryKey>& A, const TPair<uint64, FEntryKey>& B) { return A.Key < B.Key; });
+
+		for (const TPair<uint64, FEntryKey>& Oldest : ByAge)
+		{
+			if (BytesInUse <= Target) { break; }
+			RemoveEntry_Unsafe(Oldest.Value);
+			Evictions.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+#pragma endregion
+}
@@ -3,6 +3,8 @@
 
 #include "Helpers/PCGExClusterHelpers.h"
 
+#include <atomic>
+
 namespace PCGExTest
 {
 #pragma region FTestCluster
@@ -11,7 +13,8 @@ namespace PCGExTest
 		const TSharedPtr<PCGEx::FIndexLookup>& InNodeIndexLookup,
 		const TSharedPtr<TArray<PCGExClusters::FNode>>& InNodes,
 		const TSharedPtr<TArray<PCGExGraphs::FEdge>>& InEdges,
-		const TArray<FVector>& InPositions)
+		const TArray<FVector>& InPositions,
+		const bool bReleaseNodeLinks)
 	{
 		NodeIndexLookup = InNodeIndexLookup;
 		Nodes = InNodes;
@@ -24,6 +27,13 @@ namespace PCGExTest
 		NumRawVtx = InPositions.Num();
 		NumRawEdges = InEdges->Num();
 
+		BuildAdjacency();
+
+		if (bReleaseNodeLinks)
+		{
+			for (PCGExClusters::FNode& Node : *Nodes) { Node.Links.Empty(); }
+		}
+
 		bValid = true;
 
 		// Compute bounds
@@ -35,18 +45,110 @@ namespace PCGExTest
 		Bounds = Bounds.ExpandBy(10);
 	}
 
-	void FTestCluster::SetCachedData(FName Key, const TSharedPtr<PCGExClusters::ICachedClusterData>& Data)
+	void FTestCluster::BuildAdjacency()
+	{
+		static std::atomic<uint64> NextTopologyVersion{1};
+		TopologyVersion = NextTopologyVersion.fetch_add(1, std::memory_order_relaxed);
+
+		const int32 NumNodes = Nodes->Num();
+
+		AdjacencyOffsets.SetNumUninitialized(NumNodes + 1);
+		AdjacencyOffsets[0] = 0;
+
+		bool bNodesHaveLinks = false;
+		for (const PCGExClusters::FNode& Node : *Nodes)
+		{
+			if (!Node.IsEmpty())
+			{
+				bNodesHaveLinks = true;
+				break;
+			}
+		}
+
+		if (bNodesHaveLinks)
+		{
+			for (int32 i = 0; i < NumNodes; i++) { AdjacencyOffsets[i + 1] = AdjacencyOffsets[i] + NodesDataPtr[i].Num(); }
+
+			AdjacencyLinks.SetNumUninitialized(AdjacencyOffsets[NumNodes]);
+			for (int32 i = 0; i < NumNodes; i++)
+			{
+				FMemory::Memcpy(AdjacencyLinks.GetData() + AdjacencyOffsets[i], NodesDataPtr[i].Links.GetData(), NodesDataPtr[i].Num() * sizeof(PCGExGraphs::FLink));
+			}
+
+			return;
+		}
+
+		// Counting sort of edge endpoints
+		TArray<int32> Degrees;
+		Degrees.Init(0, NumNodes);
+
+		for (const PCGExGraphs::FEdge& Edge : *Edges)
+		{
+			Degrees[NodeIndexLookup->Get(Edge.Start)]++;
+			Degrees[NodeIndexLookup->Get(Edge.End)]++;
+		}
+
+		for (int32 i = 0; i < NumNodes; i++) { AdjacencyOffsets[i + 1] = AdjacencyOffsets[i] + Degrees[i]; }
+
+		// Reuse degrees as write cursors
+		FMemory::Memcpy(Degrees.GetData(), AdjacencyOffsets.GetData(), NumNodes * sizeof(int32));
+
+		AdjacencyLinks.SetNumUninitialized(AdjacencyOffsets[NumNodes]);
+		for (const PCGExGraphs::FEdge& Edge : *Edges)
+		{
+			const int32 StartNode = NodeIndexLookup->Get(Edge.Start);
+			const int32 EndNode = NodeIndexLookup->Get(Edge.End);
+			AdjacencyLinks[Degrees[StartNode]++] = PCGExGraphs::FLink(EndNode, Edge.Index);
+			AdjacencyLinks[Degrees[EndNode]++] = PCGExGraphs::FLink(StartNode, Edge.Index);
+		}
+	}
+
+	FTestCluster::~FTestCluster()
+	{
+		if (CacheStore) { CacheStore->RemoveOwner(this); }
+	}
+
+	void FTestCluster::SetCachedDataImpl(FName Key, const TSharedPtr<PCGExClusters::ICachedClusterData>& Data, const int64 SizeBytes, const FCachedDataTypeId TypeId)
 	{
+		if (CacheStore)
+		{
+			CacheStore->AddWithSize(this, Key, Data, SizeBytes, 0, TypeId);
+			return;
+		}
+
 		FWriteScopeLock WriteLock(ClusterLock);
-		CachedData.Add(Key, Data);
+		CachedData.Add(Key, FLocalCachedData{Data, TypeId});
 	}
 
 	void FTestCluster::ClearCachedData()
 	{
+		if (CacheStore) { CacheStore->RemoveOwner(this); }
+
 		FWriteScopeLock WriteLock(ClusterLock);
 		CachedData.Empty();
 	}
 
+	void FTestCluster::SetCacheStore(const TSharedPtr<FClusterCacheStore>& InCacheStore)
+	{
+		TMap<FName, FLocalCachedData> Migrating;
+
+		{
+			FWriteScopeLock WriteLock(ClusterLock);
+			Migrating = MoveTemp(CachedData);
+			CachedData.Reset();
+		}
+
+		if (CacheStore && CacheStore != InCacheStore) { CacheStore->RemoveOwner(this); }
+		CacheStore = InCacheStore;
+
+		// Sized as their concrete type, which local entries don't account until now
+		for (const TPair<FName, FLocalCachedData>& Pair : Migrating)
+		{
+			const FLocalCachedData& Entry = Pair.Value;
+			SetCachedDataImpl(Pair.Key, Entry.Data, Entry.Data && CacheStore ? GetCachedDataSize(*Entry.Data, Entry.TypeId) : 0, Entry.TypeId);
+		}
+	}
+
 #pragma endregion
 
 #pragma region FClusterBuilder
@@ -75,6 +177,12 @@ namespace PCGExTest
 		return *this;
 	}
 
+	FClusterBuilder& FClusterBuilder::WithCompactAdjacency(const bool bEnabled)
+	{
+		bCompactAdjacency = bEnabled;
+		return *this;
+	}
+
 	FClusterBuilder& FClusterBuilder::WithLinearChain(const int32 NumNodes, const double Spacing, const FVector& Origin)
 	{
 		Positions.Reset();
@@ -176,6 +284,75 @@ namespace PCGExTest
 		return *this;
 	}
 
+	FClusterBuilder& FClusterBuilder::WithSparseGrid(
+		const int32 Size, const float KeepRatio, const int32 Seed,
+		const TFunction<double(int32, int32)>& Height,
+		const FQuat& Rotation,
+		const double Spacing)
+	{
+		Positions.Reset();
+		EdgeDefinitions.Reset();
+		PointToNodeIndex.Reset();
+
+		FRandomStream Random(Seed);
+
+		// Create nodes
+		for (int32 y = 0; y < Size; y++)
+		{
+			for (int32 x = 0; x < Size; x++)
+			{
+				const double Z = Height ? Height(x, y) : 0;
+				AddNode(y * Size + x, Rotation.RotateVector(FVector(x * Spacing, y * Spacing, Z)));
+			}
+		}
+
+		// Create edges, each one kept with probability KeepRatio
+		for (int32 y = 0; y < Size; y++)
+		{
+			for (int32 x = 0; x < Size; x++)
+			{
+				const int32 Index = y * Size + x;
+				if (x < Size - 1 && Random.FRand() < KeepRatio) { AddEdge(Index, Index + 1); }
+				if (y < Size - 1 && Random.FRand() < KeepRatio) { AddEdge(Index, Index + Size); }
+			}
+		}
+
+		return *this;
+	}
+
+	FClusterBuilder& FClusterBuilder::WithShuffledPoints(const int32 Seed)
+	{
+		const int32 NumPoints = Positions.Num();
+
+		// Node order is point order; Build requires point indices 0..N-1
+		TArray<int32> OldToNew;
+		OldToNew.SetNumUninitialized(NumPoints);
+		for (int32 i = 0; i < NumPoints; i++) { OldToNew[i] = i; }
+
+		FRandomStream Random(Seed);
+		for (int32 i = NumPoints - 1; i > 0; i--) { Swap(OldToNew[i], OldToNew[Random.RandRange(0, i)]); }
+
+		TArray<FVector> OldPositions = MoveTemp(Positions);
+		TMap<int32, int32> OldPointToNodeIndex = MoveTemp(PointToNodeIndex);
+
+		Positions.SetNumUninitialized(NumPoints);
+		PointToNodeIndex.Reset();
+		for (const TPair<int32, int32>& Pair : OldPointToNodeIndex)
+		{
+			const int32 NewIndex = OldToNew[Pair.Value];
+			Positions[NewIndex] = OldPositions[Pair.Value];
+			PointToNodeIndex.Add(NewIndex, NewIndex);
+		}
+
+		for (TPair<int32, int32>& EdgeDef : EdgeDefinitions)
+		{
+			EdgeDef.Key = OldToNew[OldPointToNodeIndex.FindChecked(EdgeDef.Key)];
+			EdgeDef.Value = OldToNew[OldPointToNodeIndex.FindChecked(EdgeDef.Value)];
+		}
+
+		return *this;
+	}
+
 	TSharedRef<FTestCluster> FClusterBuilder::Build()
 	{
 		TSharedRef<FTestCluster> Cluster = MakeShared<FTestCluster>();
@@ -223,7 +400,9 @@ namespace PCGExTest
 			Edge.IOIndex = 0;
 			Edge.bValid = 1;
 
-			// Link nodes
+			// Link nodes (compact clusters get their links from the edge list through the CSR)
+			if (bCompactAdjacency) { continue; }
+
 			(*Nodes)[StartNode].Link(EndNode, i);
 			(*Nodes)[EndNode].Link(StartNode, i);
 		}
@@ -254,7 +433,7 @@ namespace PCGExTest
 			{
 				return false;
 			}
-			return (*Cluster->Nodes)[NodeIndex].Num() == ExpectedNeighbors;
+			return Cluster->GetNumLinks(NodeIndex) == ExpectedNeighbors;
 		}
 
 		bool NodeIsLeaf(const TSharedRef<FTestCluster>& Cluster, const int32 NodeIndex)
@@ -263,7 +442,7 @@ namespace PCGExTest
 			{
 				return false;
 			}
-			return (*Cluster->Nodes)[NodeIndex].IsLeaf();
+			return Cluster->IsLeaf(NodeIndex);
 		}
 
 		bool NodeIsBinary(const TSharedRef<FTestCluster>& Cluster, const int32 NodeIndex)
@@ -272,7 +451,7 @@ namespace PCGExTest
 			{
 				return false;
 			}
-			return (*Cluster->Nodes)[NodeIndex].IsBinary();
+			return Cluster->IsBinary(NodeIndex);
 		}
 
 		bool NodeIsComplex(const TSharedRef<FTestCluster>& Cluster, const int32 NodeIndex)
@@ -281,7 +460,7 @@ namespace PCGExTest
 			{
 				return false;
 			}
-			return (*Cluster->Nodes)[NodeIndex].IsComplex();
+			return Cluster->IsComplex(NodeIndex);
 		}
 
 		int32 CountNodesWithNeighbors(const TSharedRef<FTestCluster>& Cluster, const int32 NeighborCount)
@@ -292,9 +471,9 @@ namespace PCGExTest
 			}
 
 			int32 Count = 0;
-			for (const PCGExClusters::FNode& Node : *Cluster->Nodes)
+			for (int32 i = 0; i < Cluster->NumNodes(); i++)
 			{
-				if (Node.Num() == NeighborCount)
+				if (Cluster->GetNumLinks(i) == NeighborCount)
 				{
 					Count++;
 				}
@@ -320,9 +499,9 @@ namespace PCGExTest
 			}
 
 			int32 Count = 0;
-			for (const PCGExClusters::FNode& Node : *Cluster->Nodes)
+			for (int32 i = 0; i < Cluster->NumNodes(); i++)
 			{
-				if (Node.IsComplex())
+				if (Cluster->IsComplex(i))
 				{
 					Count++;
 				}
@@ -0,0 +1,130 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Helpers/PCGExClusterReorderHelpers.h"
+#include "Async/ParallelFor.h"
+#include "PCGExH.h"
+#include "Sorting/PCGExSortingHelpers.h"
+
+namespace PCGExTest::TestClusterReorder
+{
+	TSharedRef<FTestCluster> BuildMortonOrdered(const FTestCluster& Source, FClusterOrder& OutOrder, const bool bParallel)
+	{
+		const int32 NumNodes = Source.Nodes ? Source.Nodes->Num() : 0;
+		const int32 NumEdges = Source.Edges ? Source.Edges->Num() : 0;
+
+		OutOrder.NodeToSource = MakeShared<PCGEx::FIndexLookup>(NumNodes);
+		OutOrder.SourceToNode = MakeShared<PCGEx::FIndexLookup>(NumNodes);
+		OutOrder.PointToSourcePoint = MakeShared<PCGEx::FIndexLookup>(NumNodes);
+		OutOrder.EdgeToSource = MakeShared<PCGEx::FIndexLookup>(NumEdges);
+
+		TSharedRef<FTestCluster> Cluster = MakeShared<FTestCluster>();
+		if (!NumNodes || !NumEdges) { return Cluster; }
+
+		// Nodes by Morton code of their position
+		TArray<PCGEx::FIndexKey> NodeKeys;
+		NodeKeys.SetNumUninitialized(NumNodes);
+		ParallelFor(NumNodes, [&](const int32 i) { NodeKeys[i] = {i, PCGEx::MH64(Source.GetPos(i))}; }, !bParallel);
+
+		// Stable, so coincident nodes keep their source order
+		PCGExSortingHelpers::RadixSort(NodeKeys);
+
+		PCGEx::FIndexLookup& NodeToSource = *OutOrder.NodeToSource;
+		PCGEx::FIndexLookup& SourceToNode = *OutOrder.SourceToNode;
+		PCGEx::FIndexLookup& PointToSourcePoint = *OutOrder.PointToSourcePoint;
+
+		TSharedPtr<PCGEx::FIndexLookup> NodeIndexLookup = MakeShared<PCGEx::FIndexLookup>(NumNodes);
+		TSharedPtr<TArray<PCGExClusters::FNode>> Nodes = MakeShared<TArray<PCGExClusters::FNode>>();
+		TArray<FVector> Positions;
+
+		Nodes->SetNum(NumNodes);
+		Positions.SetNumUninitialized(NumNodes);
+
+		ParallelFor(
+			NumNodes, [&](const int32 i)
+			{
+				const int32 SourceNode = NodeKeys[i].Index;
+				NodeToSource.Set(i, SourceNode);
+				SourceToNode.Set(SourceNode, i);
+				PointToSourcePoint.Set(i, Source.GetNodePointIndex(SourceNode));
+				NodeIndexLookup->Set(i, i);
+
+				PCGExClusters::FNode& Node = (*Nodes)[i];
+				Node.Index = i;
+				Node.PointIndex = i;
+				Node.bValid = Source.GetNode(SourceNode)->bValid;
+
+				Positions[i] = Source.GetPos(SourceNode);
+			}, !bParallel);
+
+		const PCGExGraphs::FEdge* SourceEdges = Source.Edges->GetData();
+		const PCGEx::FIndexLookup& SourceLookup = *Source.NodeIndexLookup;
+
+		// Edges by their reordered endpoints, lowest first
+		TArray<PCGEx::FIndexKey> EdgeKeys;
+		EdgeKeys.SetNumUninitialized(NumEdges);
+		ParallelFor(
+			NumEdges, [&](const int32 i)
+			{
+				const uint64 A = SourceToNode.Get(SourceLookup.Get(SourceEdges[i].Start));
+				const uint64 B = SourceToNode.Get(SourceLookup.Get(SourceEdges[i].End));
+				EdgeKeys[i] = {i, A < B ? (A << 32) | B : (B << 32) | A};
+			}, !bParallel);
+
+		PCGExSortingHelpers::RadixSort(EdgeKeys);
+
+		PCGEx::FIndexLookup& EdgeToSource = *OutOrder.EdgeToSource;
+		TSharedPtr<TArray<PCGExGraphs::FEdge>> Edges = MakeShared<TArray<PCGExGraphs::FEdge>>();
+		Edges->SetNum(NumEdges);
+
+		ParallelFor(
+			NumEdges, [&](const int32 i)
+			{
+				const int32 SourceEdge = EdgeKeys[i].Index;
+				const PCGExGraphs::FEdge& From = SourceEdges[SourceEdge];
+				EdgeToSource.Set(i, SourceEdge);
+
+				PCGExGraphs::FEdge& Edge = (*Edges)[i];
+				Edge = From;
+				Edge.Index = i;
+				Edge.Start = static_cast<uint32>(SourceToNode.Get(SourceLookup.Get(From.Start)));
+				Edge.End = static_cast<uint32>(SourceToNode.Get(SourceLookup.Get(From.End)));
+			}, !bParallel);
+
+		// Keep per-node links only if the source had them, in the new edge order
+		bool bNodesHaveLinks = false;
+		for (const PCGExClusters::FNode& Node : *Source.Nodes)
+		{
+			if (!Node.IsEmpty())
+			{
+				bNodesHaveLinks = true;
+				break;
+			}
+		}
+
+		if (bNodesHaveLinks)
+		{
+			for (const PCGExGraphs::FEdge& Edge : *Edges)
+			{
+				(*Nodes)[Edge.Start].Link(Edge.End, Edge.Index);
+				(*Nodes)[Edge.End].Link(Edge.Start, Edge.Index);
+			}
+		}
+
+		Cluster->Initialize(NodeIndexLookup, Nodes, Edges, Positions);
+		return Cluster;
+	}
+
+	double GetAverageEdgeSpan(const FTestCluster& Cluster)
+	{
+		if (!Cluster.Edges || Cluster.Edges->IsEmpty()) { return 0; }
+
+		double Sum = 0;
+		for (const PCGExGraphs::FEdge& Edge : *Cluster.Edges)
+		{
+			Sum += FMath::Abs(Cluster.NodeIndexLookup->Get(Edge.Start) - Cluster.NodeIndexLookup->Get(Edge.End));
+		}
+
+		return Sum / Cluster.Edges->Num();
+	}
+}
@@ -0,0 +1,708 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Helpers/PCGExDCELTestHelpers.h"
+#include "Helpers/PCGExPersistentCacheHelpers.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Rotate.h"
+#include "Async/ParallelFor.h"
+#include "Clusters/Artifacts/PCGExCachedFaceEnumerator.h"
+
+namespace PCGExTest
+{
+#pragma region FTestDCEL
+
+	void FTestDCEL::Build(const FTestCluster& Cluster, const FVector& InProjectionNormal, const bool bParallel)
+	{
+		const int32 NumClusterNodes = Cluster.NumNodes();
+
+		ProjectionNormal = InProjectionNormal.GetSafeNormal();
+		NodeNormals.Reset();
+
+		const FQuat ToPlane = FQuat::FindBetweenNormals(ProjectionNormal, FVector::UpVector);
+
+		Positions2D.SetNumUninitialized(NumClusterNodes);
+		ParallelFor(
+			NumClusterNodes, [&](const int32 i)
+			{
+				const FVector Projected = ToPlane.RotateVector(Cluster.GetPos(i));
+				Positions2D[i] = FVector2D(Projected.X, Projected.Y);
+			}, !bParallel);
+
+		BuildImpl(
+			Cluster, [&](const int32 FromNode, const int32 ToNode)
+			{
+				const FVector2D Dir = Positions2D[ToNode] - Positions2D[FromNode];
+				return FMath::Atan2(Dir.Y, Dir.X);
+			}, bParallel);
+	}
+
+	void FTestDCEL::Build(const FTestCluster& Cluster, const TArray<FQuat>& NodeFrames, const bool bParallel)
+	{
+		check(NodeFrames.Num() == Cluster.NumNodes());
+
+		Positions2D.Reset();
+
+		NodeNormals.SetNumUninitialized(NodeFrames.Num());
+		ParallelFor(NodeFrames.Num(), [&](const int32 i) { NodeNormals[i] = NodeFrames[i].GetUpVector(); }, !bParallel);
+
+		BuildImpl(
+			Cluster, [&](const int32 FromNode, const int32 ToNode)
+			{
+				const FVector Local = NodeFrames[FromNode].UnrotateVector(Cluster.GetPos(ToNode) - Cluster.GetPos(FromNode));
+				return FMath::Atan2(Local.Y, Local.X);
+			}, bParallel);
+	}
+
+	void FTestDCEL::BuildImpl(const FTestCluster& Cluster, TFunctionRef<double(int32 FromNode, int32 ToNode)> ComputeAngle, const bool bParallel)
+	{
+		const int32 NumClusterNodes = Cluster.NumNodes();
+		const int32 NumEdges = Cluster.Edges ? Cluster.Edges->Num() : 0;
+
+		Offsets = Cluster.AdjacencyOffsets;
+		const int32 NumHalf = Offsets[NumClusterNodes];
+
+		Origin.SetNumUninitialized(NumHalf);
+		Target.SetNumUninitialized(NumHalf);
+		Edge.SetNumUninitialized(NumHalf);
+		Twin.SetNumUninitialized(NumHalf);
+		Next.SetNumUninitialized(NumHalf);
+		RingPos.SetNumUninitialized(NumHalf);
+		Angle.SetNumUninitialized(NumHalf);
+
+		// Both half-edges of each edge, [start side, end side]. Every slot is written by a single node.
+		TArray<int32> EdgeHalfEdges;
+		EdgeHalfEdges.Init(-1, NumEdges * 2);
+
+		// Per-node angular sort
+		ParallelFor(
+			NumClusterNodes, [&](const int32 Node)
+			{
+				const TConstArrayView<PCGExGraphs::FLink> Links = Cluster.GetLinks(Node);
+				const int32 Start = Offsets[Node];
+
+				TArray<TPair<double, int32>, TInlineAllocator<16>> Ring;
+				Ring.SetNumUninitialized(Links.Num());
+				for (int32 i = 0; i < Links.Num(); i++) { Ring[i] = TPair<double, int32>(ComputeAngle(Node, Links[i].Node), i); }
+
+				// Edge index breaks angle ties so the order doesn't depend on link order
+				Ring.Sort(
+					[&](const TPair<double, int32>& A, const TPair<double, int32>& B)
+					{
+						return A.Key < B.Key || (A.Key == B.Key && Links[A.Value].Edge < Links[B.Value].Edge);
+					});
+
+				for (int32 r = 0; r < Ring.Num(); r++)
+				{
+					const PCGExGraphs::FLink& Lk = Links[Ring[r].Value];
+					const int32 Half = Start + r;
+
+					Origin[Half] = Node;
+					Target[Half] = Lk.Node;
+					Edge[Half] = Lk.Edge;
+					RingPos[Half] = r;
+					Angle[Half] = Ring[r].Key;
+
+					const bool bIsStart = Cluster.NodeIndexLookup->Get(Cluster.GetEdge(Lk.Edge)->Start) == Node;
+					EdgeHalfEdges[Lk.Edge * 2 + (bIsStart ? 0 : 1)] = Half;
+				}
+			}, !bParallel);
+
+		// Twin and next linking, each half-edge only reads the rings built above
+		ParallelFor(
+			NumHalf, [&](const int32 Half)
+			{
+				const int32 EdgeIndex = Edge[Half];
+				const int32 TwinHalf = EdgeHalfEdges[EdgeIndex * 2] == Half ? EdgeHalfEdges[EdgeIndex * 2 + 1] : EdgeHalfEdges[EdgeIndex * 2];
+				Twin[Half] = TwinHalf;
+
+				const int32 To = Target[Half];
+				const int32 Degree = Offsets[To + 1] - Offsets[To];
+				Next[Half] = Offsets[To] + (RingPos[TwinHalf] + Degree - 1) % Degree;
+			}, !bParallel);
+	}
+
+	int32 FTestDCEL::WalkFaces(TArray<TArray<int32>>& OutFaces) const
+	{
+		const int32 NumHalf = NumHalfEdges();
+
+		OutFaces.Reset();
+		TBitArray<> Visited(false, NumHalf);
+
+		for (int32 Half = 0; Half < NumHalf; Half++)
+		{
+			if (Visited[Half]) { continue; }
+
+			TArray<int32>& Face = OutFaces.Emplace_GetRef();
+			int32 Current = Half;
+
+			do
+			{
+				Visited[Current] = true;
+				Face.Add(Current);
+				Current = Next[Current];
+			}
+			while (Current != Half && !Visited[Current]);
+		}
+
+		return OutFaces.Num();
+	}
+
+	bool FTestDCEL::BuildCell(const FTestCluster& Cluster, const PCGExClusters::FCellConstraints& Constraints, const TConstArrayView<int32> FaceHalfEdges, FTestCell& OutCell) const
+	{
+		const int32 NumHalf = FaceHalfEdges.Num();
+		const FVector Normal = GetNormal(Origin[FaceHalfEdges[0]]);
+
+		OutCell.Face = FaceHalfEdges[0];
+		OutCell.Nodes.Reset(NumHalf);
+		OutCell.bHasLeaves = false;
+		OutCell.bIsConvex = true;
+
+		// Newell normal projected on the face normal gives twice the signed area
+		FVector Newell = FVector::ZeroVector;
+
+		for (int32 i = 0; i < NumHalf; i++)
+		{
+			const int32 Half = FaceHalfEdges[i];
+			const int32 NextHalf = FaceHalfEdges[(i + 1) % NumHalf];
+
+			const FVector A = Cluster.GetPos(Origin[Half]);
+			const FVector B = Cluster.GetPos(Target[Half]);
+			const FVector C = Cluster.GetPos(Target[NextHalf]);
+
+			Newell += FVector::CrossProduct(A, B);
+
+			// U-turn at a dead end
+			if (NextHalf == Twin[Half]) { OutCell.bHasLeaves = true; }
+			if (FVector::DotProduct(FVector::CrossProduct(B - A, C - B), Normal) < -UE_KINDA_SMALL_NUMBER) { OutCell.bIsConvex = false; }
+		}
+
+		OutCell.Area = 0.5 * FVector::DotProduct(Newell, Normal);
+		OutCell.bIsWrapper = OutCell.Area <= 0;
+		OutCell.bIsConvex &= !OutCell.bHasLeaves;
+
+		if (OutCell.bIsWrapper)
+		{
+			for (const int32 Half : FaceHalfEdges) { OutCell.Nodes.Add(Origin[Half]); }
+			return true;
+		}
+
+		if (OutCell.bHasLeaves && !Constraints.bKeepCellsWithLeaves) { return false; }
+		if (Constraints.bConvexOnly && !OutCell.bIsConvex) { return false; }
+		if (Constraints.bConcaveOnly && OutCell.bIsConvex) { return false; }
+
+		if (Constraints.bDuplicateLeafPoints)
+		{
+			for (const int32 Half : FaceHalfEdges) { OutCell.Nodes.Add(Origin[Half]); }
+		}
+		else
+		{
+			// Nodes a face goes around twice (dead-end attachments) are only kept once
+			TSet<int32, DefaultKeyFuncs<int32>, TInlineSetAllocator<64>> Seen;
+			for (const int32 Half : FaceHalfEdges)
+			{
+				bool bAlreadySeen = false;
+				Seen.Add(Origin[Half], &bAlreadySeen);
+				if (!bAlreadySeen) { OutCell.Nodes.Add(Origin[Half]); }
+			}
+		}
+
+		return OutCell.Nodes.Num() <= Constraints.MaxPointCount;
+	}
+
+	int32 FTestDCEL::ExtractCells(
+		const FTestCluster& Cluster,
+		const PCGExClusters::FCellConstraints& Constraints,
+		TArray<FTestCell>& OutCells,
+		FTestCell* OutWrapper,
+		const bool bParallel) const
+	{
+		const int32 NumHalf = NumHalfEdges();
+
+		TArray<FTestCell> Cells;
+		TArray<bool> Kept;
+
+		if (bParallel)
+		{
+			// Every half-edge ends up labeled with the lowest half-edge a walk of its face started from.
+			// That walker never aborts, so exactly one starter per face keeps Label[Start] == Start.
+			TArray<int32> Label;
+			Label.Init(MAX_int32, NumHalf);
+
+			auto ClaimHalfEdge = [&Label](const int32 Half, const int32 Start)
+			{
+				volatile int32* Dest = &Label[Half];
+				int32 Current = FPlatformAtomics::AtomicRead(Dest);
+				while (Start < Current)
+				{
+					const int32 Previous = FPlatformAtomics::InterlockedCompareExchange(Dest, Start, Current);
+					if (Previous == Current) { return true; }
+					Current = Previous;
+				}
+				return false;
+			};
+
+			ParallelFor(
+				NumHalf, [&](const int32 Start)
+				{
+					// Face already walked, or being walked
+					if (FPlatformAtomics::AtomicRead(&Label[Start]) != MAX_int32) { return; }
+
+					int32 Current = Start;
+					do
+					{
+						// A lower walker owns this face
+						if (!ClaimHalfEdge(Current, Start)) { return; }
+						Current = Next[Current];
+					}
+					while (Current != Start);
+				});
+
+			TArray<int32> Owners;
+			for (int32 Half = 0; Half < NumHalf; Half++) { if (Label[Half] == Half) { Owners.Add(Half); } }
+
+			Cells.SetNum(Owners.Num());
+			Kept.SetNumZeroed(Owners.Num());
+
+			ParallelFor(
+				Owners.Num(), [&](const int32 i)
+				{
+					// Walk from the owner, then rotate so the face starts at its lowest half-edge
+					TArray<int32, TInlineAllocator<64>> Face;
+					int32 Lowest = 0;
+					int32 Current = Owners[i];
+					do
+					{
+						if (Face.IsEmpty() || Current < Face[Lowest]) { Lowest = Face.Num(); }
+						Face.Add(Current);
+						Current = Next[Current];
+					}
+					while (Current != Owners[i]);
+
+					Algo::Rotate(Face, Lowest);
+					Kept[i] = BuildCell(Cluster, Constraints, Face, Cells[i]);
+				});
+
+			// Owners aren't necessarily the lowest half-edge of their face; restore face order
+			TArray<int32> Order;
+			Order.SetNumUninitialized(Cells.Num());
+			for (int32 i = 0; i < Order.Num(); i++) { Order[i] = i; }
+			Order.Sort([&](const int32 A, const int32 B) { return Cells[A].Face < Cells[B].Face; });
+
+			TArray<FTestCell> Sorted;
+			TArray<bool> SortedKept;
+			Sorted.Reserve(Cells.Num());
+			SortedKept.Reserve(Cells.Num());
+			for (const int32 Index : Order)
+			{
+				Sorted.Add(MoveTemp(Cells[Index]));
+				SortedKept.Add(Kept[Index]);
+			}
+
+			Cells = MoveTemp(Sorted);
+			Kept = MoveTemp(SortedKept);
+		}
+		else
+		{
+			TArray<TArray<int32>> Faces;
+			WalkFaces(Faces);
+
+			Cells.SetNum(Faces.Num());
+			Kept.SetNumZeroed(Faces.Num());
+			for (int32 i = 0; i < Faces.Num(); i++) { Kept[i] = BuildCell(Cluster, Constraints, Faces[i], Cells[i]); }
+		}
+
+		OutCells.Reset();
+		int32 Wrapper = -1;
+
+		for (int32 i = 0; i < Cells.Num(); i++)
+		{
+			if (Cells[i].bIsWrapper)
+			{
+				if (Wrapper == -1 || Cells[i].Area < Cells[Wrapper].Area) { Wrapper = i; }
+				continue;
+			}
+
+			if (Kept[i]) { OutCells.Add(MoveTemp(Cells[i])); }
+		}
+
+		if (OutWrapper)
+		{
+			*OutWrapper = FTestCell();
+			if (Constraints.bBuildWrapper && Wrapper != -1) { *OutWrapper = MoveTemp(Cells[Wrapper]); }
+		}
+
+		return OutCells.Num();
+	}
+
+	bool FTestDCEL::ApplyEdits(const TArray<FTestDCELEdit>& Edits, FTestDCELEditResult& OutResult, const bool bParallel)
+	{
+		OutResult = FTestDCELEditResult();
+
+		const int32 NumDCELNodes = NumNodes();
+		const int32 NumOldHalf = NumHalfEdges();
+
+		// Angles of inserted half-edges need the projected positions
+		if (Positions2D.Num() != NumDCELNodes) { return false; }
+
+		struct FRingEntry
+		{
+			double Angle = 0;
+			int32 Edge = -1;
+			int32 Target = -1;
+			int32 OldHalf = -1;  // -1 for inserted half-edges
+			int32 Inserted = -1; // Edit index * 2 + side for inserted half-edges
+		};
+
+		// Rings of edited nodes, in CCW order
+		TMap<int32, TArray<FRingEntry>> Rings;
+		Rings.Reserve(Edits.Num() * 2);
+		auto GetRing = [&](const int32 Node) -> TArray<FRingEntry>&
+		{
+			if (TArray<FRingEntry>* Existing = Rings.Find(Node)) { return *Existing; }
+
+			TArray<FRingEntry>& Ring = Rings.Add(Node);
+			for (int32 Half = Offsets[Node]; Half < Offsets[Node + 1]; Half++) { Ring.Add({Angle[Half], Edge[Half], Target[Half], Half, -1}); }
+			return Ring;
+		};
+
+		auto FindInRing = [](const TArray<FRingEntry>& Ring, const int32 To)
+		{
+			return Ring.IndexOfByPredicate([&](const FRingEntry& Entry) { return Entry.Target == To; });
+		};
+
+		for (int32 e = 0; e < Edits.Num(); e++)
+		{
+			const FTestDCELEdit& Edit = Edits[e];
+			if (Edit.FromNode < 0 || Edit.FromNode >= NumDCELNodes || Edit.ToNode < 0 || Edit.ToNode >= NumDCELNodes || Edit.FromNode == Edit.ToNode) { return false; }
+
+			// Adding the second ring can grow the map, only take references once both exist
+			GetRing(Edit.FromNode);
+			TArray<FRingEntry>& ToRing = GetRing(Edit.ToNode);
+			TArray<FRingEntry>& FromRing = Rings.FindChecked(Edit.FromNode);
+
+			const int32 FromSlot = FindInRing(FromRing, Edit.ToNode);
+			const int32 ToSlot = FindInRing(ToRing, Edit.FromNode);
+
+			if (Edit.bRemove)
+			{
+				if (FromSlot == INDEX_NONE || ToSlot == INDEX_NONE) { return false; }
+				FromRing.RemoveAt(FromSlot);
+				ToRing.RemoveAt(ToSlot);
+				continue;
+			}
+
+			if (FromSlot != INDEX_NONE || ToSlot != INDEX_NONE) { return false; }
+
+			// Same angle and tie-break as the build's ring sort
+			auto InsertSorted = [&](TArray<FRingEntry>& Ring, const int32 From, const int32 To, const int32 Side)
+			{
+				const FVector2D Dir = Positions2D[To] - Positions2D[From];
+				const FRingEntry Entry = {FMath::Atan2(Dir.Y, Dir.X), Edit.EdgeIndex, To, -1, e * 2 + Side};
+
+				int32 Slot = 0;
+				while (Slot < Ring.Num() && (Ring[Slot].Angle < Entry.Angle || (Ring[Slot].Angle == Entry.Angle && Ring[Slot].Edge < Entry.Edge))) { Slot++; }
+				Ring.Insert(Entry, Slot);
+			};
+
+			InsertSorted(FromRing, Edit.FromNode, Edit.ToNode, 0);
+			InsertSorted(ToRing, Edit.ToNode, Edit.FromNode, 1);
+		}
+
+		// Old faces through any half-edge coming into an edited node lose their next pointers
+		{
+			TSet<int32> WalkedOld;
+			for (const TPair<int32, TArray<FRingEntry>>& Pair : Rings)
+			{
+				for (int32 Half = Offsets[Pair.Key]; Half < Offsets[Pair.Key + 1]; Half++)
+				{
+					const int32 Start = Twin[Half];
+					if (WalkedOld.Contains(Start)) { continue; }
+
+					int32 Lowest = Start;
+					int32 Current = Start;
+					do
+					{
+						WalkedOld.Add(Current);
+						Lowest = FMath::Min(Lowest, Current);
+						Current = Next[Current];
+					}
+					while (Current != Start);
+
+					OutResult.RemovedFaces.Add(Lowest);
+				}
+			}
+			OutResult.RemovedFaces.Sort();
+		}
+
+		// New layout
+		TArray<int32> NewOffsets;
+		NewOffsets.SetNumUninitialized(NumDCELNodes + 1);
+		NewOffsets[0] = 0;
+		for (int32 Node = 0; Node < NumDCELNodes; Node++)
+		{
+			const TArray<FRingEntry>* Ring = Rings.Find(Node);
+			NewOffsets[Node + 1] = NewOffsets[Node] + (Ring ? Ring->Num() : GetDegree(Node));
+		}
+
+		const int32 NumNewHalf = NewOffsets[NumDCELNodes];
+
+		TArray<int32>& Remap = OutResult.HalfEdgeRemap;
+		Remap.Init(-1, NumOldHalf);
+
+		TArray<int32> InsertedHalf;
+		InsertedHalf.Init(-1, Edits.Num() * 2);
+
+		for (const TPair<int32, TArray<FRingEntry>>& Pair : Rings)
+		{
+			for (int32 r = 0; r < Pair.Value.Num(); r++)
+			{
+				const FRingEntry& Entry = Pair.Value[r];
+				if (Entry.OldHalf != -1) { Remap[Entry.OldHalf] = NewOffsets[Pair.Key] + r; }
+				else { InsertedHalf[Entry.Inserted] = NewOffsets[Pair.Key] + r; }
+			}
+		}
+
+		// Untouched rings keep their order, shifted
+		ParallelFor(
+			NumDCELNodes, [&](const int32 Node)
+			{
+				if (Rings.Contains(Node)) { return; }
+				for (int32 r = 0; r < GetDegree(Node); r++) { Remap[Offsets[Node] + r] = NewOffsets[Node] + r; }
+			}, !bParallel);
+
+		TArray<int32> NewOrigin, NewTarget, NewEdge, NewTwin, NewRingPos;
+		TArray<double> NewAngle;
+		NewOrigin.SetNumUninitialized(NumNewHalf);
+		NewTarget.SetNumUninitialized(NumNewHalf);
+		NewEdge.SetNumUninitialized(NumNewHalf);
+		NewTwin.SetNumUninitialized(NumNewHalf);
+		NewRingPos.SetNumUninitialized(NumNewHalf);
+		NewAngle.SetNumUninitialized(NumNewHalf);
+
+		ParallelFor(
+			NumDCELNodes, [&](const int32 Node)
+			{
+				const int32 Start = NewOffsets[Node];
+
+				if (const TArray<FRingEntry>* Ring = Rings.Find(Node))
+				{
+					for (int32 r = 0; r < Ring->Num(); r++)
+					{
+						const FRingEntry& Entry = (*Ring)[r];
+						const int32 Half = Start + r;
+
+						NewOrigin[Half] = Node;
+						NewTarget[Half] = Entry.Target;
+						NewEdge[Half] = Entry.Edge;
+						NewRingPos[Half] = r;
+						NewAngle[Half] = Entry.Angle;
+
+						// Inserted half-edges pair up with the other side of the same edit
+						NewTwin[Half] = Entry.OldHalf != -1 ? Remap[Twin[Entry.OldHalf]] : InsertedHalf[Entry.Inserted ^ 1];
+					}
+					return;
+				}
+
+				const int32 OldStart = Offsets[Node];
+				for (int32 r = 0; r < GetDegree(Node); r++)
+				{
+					const int32 Half = Start + r;
+					const int32 OldHalf = OldStart + r;
+
+					NewOrigin[Half] = Node;
+					NewTarget[Half] = Target[OldHalf];
+					NewEdge[Half] = Edge[OldHalf];
+					NewRingPos[Half] = r;
+					NewAngle[Half] = Angle[OldHalf];
+					NewTwin[Half] = Remap[Twin[OldHalf]];
+				}
+			}, !bParallel);
+
+		Offsets = MoveTemp(NewOffsets);
+		Origin = MoveTemp(NewOrigin);
+		Target = MoveTemp(NewTarget);
+		Edge = MoveTemp(NewEdge);
+		Twin = MoveTemp(NewTwin);
+		RingPos = MoveTemp(NewRingPos);
+		Angle = MoveTemp(NewAngle);
+
+		// Same linking as the build; pointers into untouched rings come out identical to the remapped old ones
+		Next.SetNumUninitialized(NumNewHalf);
+		ParallelFor(
+			NumNewHalf, [&](const int32 Half)
+			{
+				const int32 To = Target[Half];
+				Next[Half] = Offsets[To] + (RingPos[Twin[Half]] + GetDegree(To) - 1) % GetDegree(To);
+			}, !bParallel);
+
+		// New faces through any half-edge coming into an edited node
+		{
+			TSet<int32> WalkedNew;
+			for (const TPair<int32, TArray<FRingEntry>>& Pair : Rings)
+			{
+				for (int32 Half = Offsets[Pair.Key]; Half < Offsets[Pair.Key + 1]; Half++)
+				{
+					const int32 Start = Twin[Half];
+					if (WalkedNew.Contains(Start)) { continue; }
+
+					TArray<int32>& Face = OutResult.AddedFaces.Emplace_GetRef();
+					int32 Lowest = 0;
+					int32 Current = Start;
+					do
+					{
+						WalkedNew.Add(Current);
+						if (Face.IsEmpty() || Current < Face[Lowest]) { Lowest = Face.Num(); }
+						Face.Add(Current);
+						Current = Next[Current];
+					}
+					while (Current != Start);
+
+					Algo::Rotate(Face, Lowest);
+				}
+			}
+
+			OutResult.AddedFaces.Sort([](const TArray<int32>& A, const TArray<int32>& B) { return A[0] < B[0]; });
+		}
+
+		return true;
+	}
+
+	void FTestDCEL::UpdateCells(
+		const FTestCluster& Cluster,
+		const PCGExClusters::FCellConstraints& Constraints,
+		const FTestDCELEditResult& EditResult,
+		TArray<FTestCell>& InOutCells) const
+	{
+		InOutCells.RemoveAll([&](const FTestCell& Cell) { return Algo::BinarySearch(EditResult.RemovedFaces, Cell.Face) != INDEX_NONE; });
+
+		// Remap preserves order, so the lowest half-edge of an untouched face stays its lowest
+		for (FTestCell& Cell : InOutCells) { Cell.Face = EditResult.HalfEdgeRemap[Cell.Face]; }
+
+		for (const TArray<int32>& Face : EditResult.AddedFaces)
+		{
+			FTestCell Cell;
+			if (BuildCell(Cluster, Constraints, Face, Cell) && !Cell.bIsWrapper) { InOutCells.Add(MoveTemp(Cell)); }
+		}
+
+		InOutCells.Sort([](const FTestCell& A, const FTestCell& B) { return A.Face < B.Face; });
+	}
+
+	bool FTestDCEL::Validate(FString* OutError) const
+	{
+		auto Fail = [&](const FString& Error)
+		{
+			if (OutError) { *OutError = Error; }
+			return false;
+		};
+
+		const int32 NumHalf = NumHalfEdges();
+		TArray<int32> Incoming;
+		Incoming.Init(0, NumHalf);
+
+		for (int32 Half = 0; Half < NumHalf; Half++)
+		{
+			const int32 TwinHalf = Twin[Half];
+			const int32 NextHalf = Next[Half];
+
+			if (!Twin.IsValidIndex(TwinHalf) || Twin[TwinHalf] != Half) { return Fail(FString::Printf(TEXT("Half-edge %d: twin isn't symmetric"), Half)); }
+			if (Edge[TwinHalf] != Edge[Half]) { return Fail(FString::Printf(TEXT("Half-edge %d: twin is on another edge"), Half)); }
+			if (Origin[TwinHalf] != Target[Half]) { return Fail(FString::Printf(TEXT("Half-edge %d: twin doesn't start at target"), Half)); }
+			if (!Next.IsValidIndex(NextHalf) || Origin[NextHalf] != Target[Half]) { return Fail(FString::Printf(TEXT("Half-edge %d: next doesn't start at target"), Half)); }
+
+			Incoming[NextHalf]++;
+		}
+
+		for (int32 Half = 0; Half < NumHalf; Half++)
+		{
+			if (Incoming[Half] != 1) { return Fail(FString::Printf(TEXT("Half-edge %d: reached by %d next pointers"), Half, Incoming[Half])); }
+		}
+
+		return true;
+	}
+
+	bool FTestDCEL::Equals(const FTestDCEL& Other) const
+	{
+		return Offsets == Other.Offsets &&
+			Origin == Other.Origin && Target == Other.Target && Edge == Other.Edge &&
+			Twin == Other.Twin && Next == Other.Next && RingPos == Other.RingPos;
+	}
+
+#pragma endregion
+
+#pragma region FCachedDCELCells
+
+	const FName FCachedDCELCells::CacheKey = FName(TEXT("PCGExTest.DCELCells"));
+
+	int64 GetCachedDataSize(const FCachedDCELCells& Data)
+	{
+		const FTestDCEL& DCEL = Data.DCEL;
+
+		int64 Size = sizeof(FCachedDCELCells);
+		Size += DCEL.Offsets.GetAllocatedSize() + DCEL.Origin.GetAllocatedSize() + DCEL.Target.GetAllocatedSize() + DCEL.Edge.GetAllocatedSize();
+		Size += DCEL.Twin.GetAllocatedSize() + DCEL.Next.GetAllocatedSize() + DCEL.RingPos.GetAllocatedSize() + DCEL.Angle.GetAllocatedSize();
+		Size += DCEL.Positions2D.GetAllocatedSize() + DCEL.NodeNormals.GetAllocatedSize();
+
+		Size += Data.Cells.GetAllocatedSize() + Data.Wrapper.Nodes.GetAllocatedSize();
+		for (const FTestCell& Cell : Data.Cells) { Size += Cell.Nodes.GetAllocatedSize(); }
+
+		return Size;
+	}
+
+	uint32 ComputeCellConstraintsHash(const PCGExClusters::FCellConstraints& Constraints)
+	{
+		const uint32 Flags =
+			(Constraints.bBuildWrapper ? 1 : 0) |
+			(Constraints.bKeepCellsWithLeaves ? 2 : 0) |
+			(Constraints.bDuplicateLeafPoints ? 4 : 0) |
+			(Constraints.bConvexOnly ? 8 : 0) |
+			(Constraints.bConcaveOnly ? 16 : 0);
+
+		return HashCombineFast(GetTypeHash(Flags), GetTypeHash(Constraints.MaxPointCount));
+	}
+
+	uint32 ComputeCellsContextHash(const FPCGExGeo2DProjectionDetails& Projection, const PCGExClusters::FCellConstraints& Constraints)
+	{
+		return HashCombineFast(PCGExClusters::FFaceEnumeratorCacheFactory::ComputeProjectionHash(Projection), ComputeCellConstraintsHash(Constraints));
+	}
+
+	TSharedPtr<FCachedDCELCells> GetOrBuildCachedCells(
+		const TSharedRef<FTestCluster>& Cluster,
+		const FPCGExGeo2DProjectionDetails& Projection,
+		const PCGExClusters::FCellConstraints& Constraints,
+		const TArray<FQuat>* NodeFrames,
+		FPersistentArtifactCache* PersistentCache,
+		bool* bOutFromPersistentCache)
+	{
+		if (bOutFromPersistentCache) { *bOutFromPersistentCache = false; }
+
+		const bool bLocalTangent = Projection.Method == EPCGExProjectionMethod::LocalTangent;
+		check(!bLocalTangent || (NodeFrames && NodeFrames->Num() == Cluster->NumNodes()));
+
+		const uint32 ContextHash = ComputeCellsContextHash(Projection, Constraints);
+
+		auto BuildCells = [&]()
+		{
+			TSharedPtr<FCachedDCELCells> Built = MakeShared<FCachedDCELCells>();
+			if (bLocalTangent) { Built->DCEL.Build(*Cluster, *NodeFrames); }
+			else { Built->DCEL.Build(*Cluster, Projection.Normal); }
+
+			Built->DCEL.ExtractCells(*Cluster, Constraints, Built->Cells, &Built->Wrapper);
+			return Built;
+		};
+
+		if (PersistentCache)
+		{
+			return FindOrBuildArtifact<FCachedDCELCells>(Cluster, FCachedDCELCells::CacheKey, ContextHash, BuildCells, *PersistentCache, bOutFromPersistentCache);
+		}
+
+		if (TSharedPtr<FCachedDCELCells> Cached = Cluster->GetCachedData<FCachedDCELCells>(FCachedDCELCells::CacheKey, ContextHash)) { return Cached; }
+
+		TSharedPtr<FCachedDCELCells> Built = BuildCells();
+		Built->ContextHash = ContextHash;
+		Cluster->SetCachedData(FCachedDCELCells::CacheKey, Built);
+		return Built;
+	}
+
+#pragma endregion
+}
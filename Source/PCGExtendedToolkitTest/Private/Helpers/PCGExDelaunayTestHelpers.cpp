@@ -0,0 +1,2612 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Helpers/PCGExDelaunayTestHelpers.h"
+#include "Helpers/PCGExEdgeDedupHelpers.h"
+#include "Helpers/PCGExPredicateHelpers.h"
+#include "Algo/Sort.h"
+#include "Algo/Unique.h"
+#include "Async/ParallelFor.h"
+#include "Math/PCGExProjectionDetails.h"
+#include "PCGExH.h"
+#include "Sorting/PCGExSortingHelpers.h"
+
+namespace PCGExTest
+{
+	namespace
+	{
+		using TestPredicates::Orient2D;
+		using TestPredicates::InCircle;
+		using TestPredicates::Orient3D;
+		using TestPredicates::InSphere;
+
+		/** Circumsphere of the tetrahedron ABCD; false if coplanar */
+		FORCEINLINE bool Circumsphere(const FVector& A, const FVector& B, const FVector& C, const FVector& D, FVector& OutCenter, double& OutRadiusSquared)
+		{
+			if (!TestPredicates::GetCircumcenter(A, B, C, D, OutCenter)) { return false; }
+			OutRadiusSquared = FVector::DistSquared(OutCenter, A);
+			return true;
+		}
+
+		FORCEINLINE uint64 SpreadBits(uint64 V)
+		{
+			V = (V | (V << 16)) & 0x0000FFFF0000FFFFull;
+			V = (V | (V << 8)) & 0x00FF00FF00FF00FFull;
+			V = (V | (V << 4)) & 0x0F0F0F0F0F0F0F0Full;
+			V = (V | (V << 2)) & 0x3333333333333333ull;
+			V = (V | (V << 1)) & 0x5555555555555555ull;
+			return V;
+		}
+
+		/** 21 low bits spread over every third bit */
+		FORCEINLINE uint64 SpreadBits3(uint64 V)
+		{
+			V &= 0x1FFFFF;
+			V = (V | (V << 32)) & 0x001F00000000FFFFull;
+			V = (V | (V << 16)) & 0x001F0000FF0000FFull;
+			V = (V | (V << 8)) & 0x100F00F00F00F00Full;
+			V = (V | (V << 4)) & 0x10C30C30C30C30C3ull;
+			V = (V | (V << 2)) & 0x1249249249249249ull;
+			return V;
+		}
+
+		/** Corners of face k (opposite corner k), ordered so that (face, corner k) is positively oriented */
+		constexpr int32 FaceCorners[4][3] = {{1, 3, 2}, {0, 2, 3}, {0, 3, 1}, {0, 1, 2}};
+
+		/** kd block of ProcessParallel: Order[Begin .. End) and the region it owns */
+		struct FKdBlock
+		{
+			int32 Begin = 0;
+			int32 End = 0;
+			FBox Region = FBox(FVector(-UE_BIG_NUMBER), FVector(UE_BIG_NUMBER));
+		};
+
+		/** Circumsphere of a tetrahedron, from its vertices sorted by index so every block computes the same one */
+		FORCEINLINE bool SortedCircumsphere(FIntVector4 Tetrahedron, const TConstArrayView<FVector> Positions, FVector& OutCenter, double& OutRadiusSquared)
+		{
+			int32* Corners = &Tetrahedron.X;
+			Algo::Sort(TArrayView<int32>(Corners, 4));
+			return Circumsphere(Positions[Corners[0]], Positions[Corners[1]], Positions[Corners[2]], Positions[Corners[3]], OutCenter, OutRadiusSquared);
+		}
+
+		/** Circumsphere strictly inside the region, so no point outside the region can be in it */
+		FORCEINLINE bool IsFinal(const FIntVector4& Tetrahedron, const TConstArrayView<FVector> Positions, const FBox& Region, const double Tolerance)
+		{
+			FVector Center;
+			double RadiusSquared;
+			if (!SortedCircumsphere(Tetrahedron, Positions, Center, RadiusSquared)) { return false; }
+
+			const double Radius = FMath::Sqrt(RadiusSquared) + Tolerance;
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				if (Center[Axis] - Radius <= Region.Min[Axis] || Center[Axis] + Radius >= Region.Max[Axis]) { return false; }
+			}
+
+			return true;
+		}
+
+		/** Uniform grid over a subset of points: the settled points of ProcessParallel, or every vertex for ValidateSites */
+		struct FPointGrid
+		{
+			FVector Origin = FVector::ZeroVector;
+			double InvCellSize = 0;
+			FIntVector Dims = FIntVector(0);
+			TArray<int32> CellOffsets;
+			TArray<int32> CellPoints;
+
+			void Build(const TConstArrayView<FVector> Positions, const TConstArrayView<int32> Points)
+			{
+				if (Points.IsEmpty()) { return; }
+
+				FBox Bounds(ForceInit);
+				for (const int32 Point : Points) { Bounds += Positions[Point]; }
+
+				// About two points per cell
+				const FVector Size = Bounds.GetSize();
+				const double CellSize = FMath::Max3(
+					FMath::Pow(FMath::Max(Size.X * Size.Y * Size.Z, UE_DOUBLE_SMALL_NUMBER) / FMath::Max(1, Points.Num() / 2), 1.0 / 3.0),
+					Size.GetMax() / 1024,
+					UE_DOUBLE_KINDA_SMALL_NUMBER);
+
+				Origin = Bounds.Min;
+				InvCellSize = 1 / CellSize;
+				Dims = FIntVector(
+					FMath::Clamp(FMath::CeilToInt(Size.X * InvCellSize), 1, 1024),
+					FMath::Clamp(FMath::CeilToInt(Size.Y * InvCellSize), 1, 1024),
+					FMath::Clamp(FMath::CeilToInt(Size.Z * InvCellSize), 1, 1024));
+
+				const int32 NumCells = Dims.X * Dims.Y * Dims.Z;
+				CellOffsets.SetNumZeroed(NumCells + 1);
+
+				TArray<int32> PointCells;
+				PointCells.SetNumUninitialized(Points.Num());
+				for (int32 i = 0; i < Points.Num(); i++)
+				{
+					const FIntVector Cell = GetCell(Positions[Points[i]]);
+					PointCells[i] = (Cell.Z * Dims.Y + Cell.Y) * Dims.X + Cell.X;
+					CellOffsets[PointCells[i] + 1]++;
+				}
+				for (int32 i = 0; i < NumCells; i++) { CellOffsets[i + 1] += CellOffsets[i]; }
+
+				TArray<int32> Cursor(CellOffsets.GetData(), NumCells);
+				CellPoints.SetNumUninitialized(Points.Num());
+				for (int32 i = 0; i < Points.Num(); i++) { CellPoints[Cursor[PointCells[i]]++] = Points[i]; }
+			}
+
+			FORCEINLINE FIntVector GetCell(const FVector& Position) const
+			{
+				const FVector Local = (Position - Origin) * InvCellSize;
+				return FIntVector(
+					FMath::Clamp(FMath::FloorToInt(Local.X), 0, Dims.X - 1),
+					FMath::Clamp(FMath::FloorToInt(Local.Y), 0, Dims.Y - 1),
+					FMath::Clamp(FMath::FloorToInt(Local.Z), 0, Dims.Z - 1));
+			}
+
+			FORCEINLINE bool AnyInCell(const int32 X, const int32 Y, const int32 Z, const TConstArrayView<FVector> Positions, const FIntVector4& Tetrahedron) const
+			{
+				const FVector& A = Positions[Tetrahedron.X];
+				const FVector& B = Positions[Tetrahedron.Y];
+				const FVector& C = Positions[Tetrahedron.Z];
+				const FVector& D = Positions[Tetrahedron.W];
+
+				const int32 Cell = (Z * Dims.Y + Y) * Dims.X + X;
+				for (int32 i = CellOffsets[Cell]; i < CellOffsets[Cell + 1]; i++)
+				{
+					if (InSphere(A, B, C, D, Positions[CellPoints[i]]) > 0) { return true; }
+				}
+				return false;
+			}
+
+			/**
+			 * @param Tetrahedron Positively oriented, as in the mesh it comes from
+			 * @param Center, RadiusSquared Its floating circumsphere, only used to pick the cells to test;
+			 * Tolerance pads it so points the exact test puts inside aren't missed
+			 * @return true if any grid point is strictly inside the circumsphere, by the exact predicate
+			 */
+			bool AnyInside(const TConstArrayView<FVector> Positions, const FIntVector4& Tetrahedron, const FVector& Center, const double RadiusSquared, const double Tolerance) const
+			{
+				if (CellPoints.IsEmpty()) { return false; }
+
+				// Cell nearest to the center first, where an offending point most likely is
+				const FIntVector Nearest = GetCell(Center);
+				if (AnyInCell(Nearest.X, Nearest.Y, Nearest.Z, Positions, Tetrahedron)) { return true; }
+
+				const double Radius = FMath::Sqrt(RadiusSquared) + Tolerance;
+				const FIntVector Min = GetCell(Center - FVector(Radius));
+				const FIntVector Max = GetCell(Center + FVector(Radius));
+
+				for (int32 Z = Min.Z; Z <= Max.Z; Z++)
+				{
+					for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+					{
+						for (int32 X = Min.X; X <= Max.X; X++)
+						{
+							if ((X != Nearest.X || Y != Nearest.Y || Z != Nearest.Z) && AnyInCell(X, Y, Z, Positions, Tetrahedron)) { return true; }
+						}
+					}
+				}
+
+				return false;
+			}
+		};
+	}
+
+#pragma region FTestDelaunay2
+
+	bool FTestDelaunay2::Process(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails)
+	{
+		TArray<FVector2D> Projected;
+		Projected.SetNumUninitialized(Positions.Num());
+		for (int32 i = 0; i < Positions.Num(); i++)
+		{
+			const FVector P = ProjectionDetails.Project(Positions[i]);
+			Projected[i] = FVector2D(P.X, P.Y);
+		}
+
+		return Process(Projected);
+	}
+
+	bool FTestDelaunay2::Process(const TConstArrayView<FVector2D> Positions)
+	{
+		Reset();
+
+		if (!Triangulate(Positions))
+		{
+			Reset();
+			return false;
+		}
+
+		BuildOutput();
+		IsValid = true;
+		return true;
+	}
+
+	bool FTestDelaunay2::Triangulate(const TConstArrayView<FVector2D> Positions)
+	{
+		const int32 NumVertices = Positions.Num();
+		if (NumVertices < 3) { return false; }
+
+		Vertices.Append(Positions.GetData(), NumVertices);
+
+		// Morton order over a square around the bounds, so both axes get the same resolution
+		FBox2D Bounds(ForceInit);
+		for (const FVector2D& P : Vertices) { Bounds += P; }
+
+		const double Extent = FMath::Max(Bounds.Max.X - Bounds.Min.X, Bounds.Max.Y - Bounds.Min.Y);
+		const double Scale = Extent > 0 ? static_cast<double>(MAX_uint32) / Extent : 0;
+
+		TArray<PCGEx::FIndexKey> Keys;
+		Keys.SetNumUninitialized(NumVertices);
+		ParallelFor(
+			NumVertices, [&](const int32 i)
+			{
+				const uint64 X = static_cast<uint32>(FMath::Min((Vertices[i].X - Bounds.Min.X) * Scale, static_cast<double>(MAX_uint32)));
+				const uint64 Y = static_cast<uint32>(FMath::Min((Vertices[i].Y - Bounds.Min.Y) * Scale, static_cast<double>(MAX_uint32)));
+				Keys[i] = {i, SpreadBits(X) | (SpreadBits(Y) << 1)};
+			});
+
+		PCGExSortingHelpers::RadixSort(Keys);
+
+		TArray<int32> Order;
+		Order.SetNumUninitialized(NumVertices);
+		for (int32 i = 0; i < NumVertices; i++) { Order[i] = Keys[i].Index; }
+		Keys.Empty();
+
+		int32 Seeds[3];
+		if (!InitializeFirstTriangle(Order, Seeds)) { return false; }
+
+		FanSlot.Init(-1, NumVertices);
+
+		for (const int32 Vertex : Order)
+		{
+			if (Vertex == Seeds[0] || Vertex == Seeds[1] || Vertex == Seeds[2]) { continue; }
+			if (!InsertVertex(Vertex)) { Duplicates++; }
+		}
+
+		return true;
+	}
+
+	void FTestDelaunay2::Reset()
+	{
+		Sites.Reset();
+		DelaunayEdges.Reset();
+		DelaunayHull.Reset();
+		Flat.Reset();
+		IsValid = false;
+
+		Vertices.Reset();
+		HalfEdgeVtx.Reset();
+		HalfEdgeTwin.Reset();
+		FreeTriangles.Reset();
+		TriangleStamp.Reset();
+		FanSlot.Reset();
+
+		LastTriangle = 0;
+		Duplicates = 0;
+		CurrentStamp = 0;
+
+		bStreaming = false;
+		bStreamSeeded = false;
+		StreamedPoints = 0;
+		EmittedSites = 0;
+		PeakLiveTriangles = 0;
+		LastGhost = INDEX_NONE;
+		SweepFront = 0;
+		StreamIds.Reset();
+		OnSiteFinalized = nullptr;
+		OnEdgeFinalized = nullptr;
+
+		TriangleSite.Reset();
+		SiteTriangle.Reset();
+
+		ConstrainedEdges.Reset();
+		SkippedConstraints.Reset();
+		bConstrained = false;
+		ExteriorTriangles.Reset();
+		VertexHalfEdge.Reset();
+	}
+
+	bool FTestDelaunay2::InitializeFirstTriangle(const TConstArrayView<int32> Order, int32 (&OutSeeds)[3])
+	{
+		const int32 A = Order[0];
+		int32 B = INDEX_NONE;
+		int32 C = INDEX_NONE;
+
+		for (const int32 Vertex : Order)
+		{
+			if (Vertices[Vertex] != Vertices[A])
+			{
+				B = Vertex;
+				break;
+			}
+		}
+
+		if (B == INDEX_NONE) { return false; }
+
+		for (const int32 Vertex : Order)
+		{
+			if (Orient2D(Vertices[A], Vertices[B], Vertices[Vertex]) != 0)
+			{
+				C = Vertex;
+				break;
+			}
+		}
+
+		if (C == INDEX_NONE) { return false; }
+		if (Orient2D(Vertices[A], Vertices[B], Vertices[C]) < 0) { Swap(B, C); }
+
+		const int32 ExpectedTriangles = 2 * Vertices.Num() + 2;
+		HalfEdgeVtx.Reserve(ExpectedTriangles * 3);
+		HalfEdgeTwin.Reserve(ExpectedTriangles * 3);
+		TriangleStamp.Reserve(ExpectedTriangles);
+
+		const int32 V[3] = {A, B, C};
+
+		// Triangle 0 is real, ghost k + 1 sits across its edge V[k] -> V[k + 1]
+		SetTriangle(AllocateTriangle(), A, B, C);
+		for (int32 k = 0; k < 3; k++)
+		{
+			const int32 Ghost = AllocateTriangle();
+			SetTriangle(Ghost, V[(k + 1) % 3], V[k], GhostVertex);
+			Link(k, Ghost * 3);
+		}
+
+		// Ghost (u, v, inf): v -> inf faces inf -> v of the ghost starting at v
+		for (int32 k = 0; k < 3; k++) { Link((k + 1) * 3 + 1, (((k + 2) % 3) + 1) * 3 + 2); }
+		LastGhost = 1;
+
+		OutSeeds[0] = A;
+		OutSeeds[1] = B;
+		OutSeeds[2] = C;
+
+		LastTriangle = 0;
+		return true;
+	}
+
+	int32 FTestDelaunay2::Locate(const FVector2D& P, int32 StartTriangle)
+	{
+		if (!HalfEdgeVtx.IsValidIndex(StartTriangle * 3) || IsFree(StartTriangle)) { StartTriangle = 0; }
+
+		int32 Triangle = StartTriangle;
+		if (IsGhost(Triangle))
+		{
+			const int32 Base = Triangle * 3;
+			const int32 K = HalfEdgeVtx[Base] == GhostVertex ? 0 : HalfEdgeVtx[Base + 1] == GhostVertex ? 1 : 2;
+			const int32 Twin = HalfEdgeTwin[Base + (K + 1) % 3];
+			Triangle = Twin == INDEX_NONE ? INDEX_NONE : Twin / 3;
+		}
+
+		// Visibility walk, starting each step on a random edge so it can't cycle. Open edges are walls.
+		const int32 MaxSteps = Triangle == INDEX_NONE ? 0 : NumTriangleSlots() + 3;
+		for (int32 Step = 0; Step < MaxSteps; Step++)
+		{
+			const int32 Base = Triangle * 3;
+
+			WalkSeed ^= WalkSeed << 13;
+			WalkSeed ^= WalkSeed >> 17;
+			WalkSeed ^= WalkSeed << 5;
+			const int32 Offset = WalkSeed % 3;
+
+			bool bMoved = false;
+			for (int32 k = 0; k < 3; k++)
+			{
+				const int32 HalfEdge = Base + (Offset + k) % 3;
+				if (HalfEdgeTwin[HalfEdge] != INDEX_NONE && Orient2D(Vertices[HalfEdgeVtx[HalfEdge]], Vertices[HalfEdgeVtx[Next(HalfEdge)]], P) < 0)
+				{
+					Triangle = HalfEdgeTwin[HalfEdge] / 3;
+					bMoved = true;
+					break;
+				}
+			}
+
+			if (!bMoved || IsGhost(Triangle)) { return Triangle; }
+		}
+
+		// Inconsistent orientations, fall back to any triangle in conflict
+		for (int32 i = 0; i < NumTriangleSlots(); i++)
+		{
+			if (!IsFree(i) && IsInConflict(i, P)) { return i; }
+		}
+
+		return INDEX_NONE;
+	}
+
+	bool FTestDelaunay2::IsInConflict(const int32 Triangle, const FVector2D& P) const
+	{
+		const int32 Base = Triangle * 3;
+		const int32 A = HalfEdgeVtx[Base];
+		const int32 B = HalfEdgeVtx[Base + 1];
+		const int32 C = HalfEdgeVtx[Base + 2];
+
+		if (A != GhostVertex && B != GhostVertex && C != GhostVertex)
+		{
+			return InCircle(Vertices[A], Vertices[B], Vertices[C], P) > 0;
+		}
+
+		// Ghost: conflict if P is strictly outside its hull edge U -> V, or strictly inside the edge itself
+		const int32 U = A == GhostVertex ? B : B == GhostVertex ? C : A;
+		const int32 V = A == GhostVertex ? C : B == GhostVertex ? A : B;
+
+		const FVector2D& PU = Vertices[U];
+		const FVector2D& PV = Vertices[V];
+
+		const double Orientation = Orient2D(PU, PV, P);
+		if (Orientation != 0) { return Orientation > 0; }
+
+		return FVector2D::DotProduct(P - PU, PV - PU) > 0 && FVector2D::DotProduct(P - PV, PU - PV) > 0;
+	}
+
+	bool FTestDelaunay2::InsertVertex(const int32 Vertex)
+	{
+		return InsertVertexAt(Vertex, Locate(Vertices[Vertex], LastTriangle));
+	}
+
+	bool FTestDelaunay2::InsertVertexAt(const int32 Vertex, const int32 Start)
+	{
+		if (!CollectCavity(Vertex, Start)) { return false; }
+		FillCavity(Vertex);
+		return true;
+	}
+
+	bool FTestDelaunay2::CollectCavity(const int32 Vertex, int32 Start)
+	{
+		const FVector2D& P = Vertices[Vertex];
+		if (Start == INDEX_NONE) { return false; }
+
+		for (int32 k = 0; k < 3; k++)
+		{
+			const int32 Other = HalfEdgeVtx[Start * 3 + k];
+			if (Other != GhostVertex && Vertices[Other] == P) { return false; }
+		}
+
+		if (!IsInConflict(Start, P))
+		{
+			Start = INDEX_NONE;
+			for (int32 i = 0; i < NumTriangleSlots(); i++)
+			{
+				if (!IsFree(i) && IsInConflict(i, P))
+				{
+					Start = i;
+					break;
+				}
+			}
+
+			if (Start == INDEX_NONE) { return false; }
+		}
+
+		// Cavity: every triangle in conflict, grown from the one containing P
+		CurrentStamp++;
+		CavityTriangles.Reset();
+		CavityStack.Reset();
+		BoundaryEdges.Reset();
+
+		TriangleStamp[Start] = CurrentStamp;
+		CavityStack.Add(Start);
+
+		while (!CavityStack.IsEmpty())
+		{
+			const int32 Triangle = CavityStack.Pop(EAllowShrinking::No);
+			CavityTriangles.Add(Triangle);
+
+			for (int32 k = 0; k < 3; k++)
+			{
+				const int32 HalfEdge = Triangle * 3 + k;
+				const int32 Twin = HalfEdgeTwin[HalfEdge];
+				const int32 Neighbor = Twin == INDEX_NONE ? INDEX_NONE : Twin / 3;
+				if (Neighbor != INDEX_NONE && TriangleStamp[Neighbor] == CurrentStamp) { continue; }
+
+				if (Neighbor != INDEX_NONE && IsInConflict(Neighbor, P))
+				{
+					TriangleStamp[Neighbor] = CurrentStamp;
+					CavityStack.Add(Neighbor);
+				}
+				else
+				{
+					// Boundary edge: origin, end, twin on the outside
+					BoundaryEdges.Add(HalfEdgeVtx[HalfEdge]);
+					BoundaryEdges.Add(HalfEdgeVtx[Next(HalfEdge)]);
+					BoundaryEdges.Add(HalfEdgeTwin[HalfEdge]);
+				}
+			}
+		}
+
+		return true;
+	}
+
+	void FTestDelaunay2::FillCavity(const int32 Vertex)
+	{
+		// Fan around P, one triangle per boundary edge, reusing the cavity slots
+		const int32 NumBoundary = BoundaryEdges.Num() / 3;
+
+		NewTriangles.Reset();
+		for (int32 i = 0; i < NumBoundary; i++) { NewTriangles.Add(i < CavityTriangles.Num() ? CavityTriangles[i] : AllocateTriangle()); }
+		for (int32 i = NumBoundary; i < CavityTriangles.Num(); i++) { FreeTriangle(CavityTriangles[i]); }
+
+		int32 GhostSlot = INDEX_NONE;
+		for (int32 i = 0; i < NumBoundary; i++)
+		{
+			const int32 Triangle = NewTriangles[i];
+			const int32 A = BoundaryEdges[i * 3];
+
+			SetTriangle(Triangle, A, BoundaryEdges[i * 3 + 1], Vertex);
+			Link(Triangle * 3, BoundaryEdges[i * 3 + 2]);
+
+			if (A == GhostVertex) { GhostSlot = i; }
+			else { FanSlot[A] = i; }
+		}
+
+		// B -> P faces P -> B of the fan triangle starting at B
+		for (int32 i = 0; i < NumBoundary; i++)
+		{
+			const int32 B = BoundaryEdges[i * 3 + 1];
+			const int32 Other = B == GhostVertex ? GhostSlot : FanSlot[B];
+			Link(NewTriangles[i] * 3 + 1, NewTriangles[Other] * 3 + 2);
+		}
+
+		LastTriangle = NewTriangles[0];
+		for (const int32 Triangle : NewTriangles)
+		{
+			if (!IsGhost(Triangle))
+			{
+				LastTriangle = Triangle;
+				break;
+			}
+		}
+
+		for (const int32 Triangle : NewTriangles)
+		{
+			if (IsGhost(Triangle))
+			{
+				LastGhost = Triangle;
+				break;
+			}
+		}
+	}
+
+	int32 FTestDelaunay2::LocateOnHull(const FVector2D& P) const
+	{
+		if (!HalfEdgeVtx.IsValidIndex(LastGhost * 3) || !IsGhost(LastGhost)) { return INDEX_NONE; }
+
+		// Ghost (u, v, inf) reaches the next ghost through v -> inf, the previous one through inf -> u
+		auto Step = [&](const int32 Ghost, const bool bForward)
+		{
+			const int32 Base = Ghost * 3;
+			const int32 K = HalfEdgeVtx[Base] == GhostVertex ? 0 : HalfEdgeVtx[Base + 1] == GhostVertex ? 1 : 2;
+			return HalfEdgeTwin[Base + (bForward ? (K + 2) % 3 : K)] / 3;
+		};
+
+		int32 Forward = LastGhost;
+		int32 Backward = LastGhost;
+		for (int32 i = 0; i < NumTriangleSlots(); i++)
+		{
+			if (IsInConflict(Forward, P)) { return Forward; }
+			if (IsInConflict(Backward, P)) { return Backward; }
+
+			Forward = Step(Forward, true);
+			Backward = Step(Backward, false);
+			if (Forward == LastGhost) { break; }
+		}
+
+		return INDEX_NONE;
+	}
+
+	int32 FTestDelaunay2::AllocateTriangle()
+	{
+		if (!FreeTriangles.IsEmpty()) { return FreeTriangles.Pop(EAllowShrinking::No); }
+
+		const int32 Triangle = NumTriangleSlots();
+		HalfEdgeVtx.AddUninitialized(3);
+		HalfEdgeTwin.AddUninitialized(3);
+		TriangleStamp.Add(0);
+		return Triangle;
+	}
+
+	void FTestDelaunay2::FreeTriangle(const int32 Triangle)
+	{
+		const int32 Base = Triangle * 3;
+		HalfEdgeVtx[Base] = HalfEdgeVtx[Base + 1] = HalfEdgeVtx[Base + 2] = FreeVertex;
+		HalfEdgeTwin[Base] = HalfEdgeTwin[Base + 1] = HalfEdgeTwin[Base + 2] = INDEX_NONE;
+		FreeTriangles.Add(Triangle);
+	}
+
+	void FTestDelaunay2::SetTriangle(const int32 Triangle, const int32 A, const int32 B, const int32 C)
+	{
+		const int32 Base = Triangle * 3;
+		HalfEdgeVtx[Base] = A;
+		HalfEdgeVtx[Base + 1] = B;
+		HalfEdgeVtx[Base + 2] = C;
+	}
+
+	void FTestDelaunay2::BuildOutput()
+	{
+		Sites.Reset();
+		DelaunayEdges.Reset();
+		DelaunayHull.Reset();
+		Flat.Reset();
+
+		const int32 NumSlots = NumTriangleSlots();
+
+		TriangleSite.Init(INDEX_NONE, NumSlots);
+		SiteTriangle.Reset();
+
+		// Culled exterior triangles are left out like ghosts
+		int32 NumSites = 0;
+		int32 NumHullEdges = 0;
+		for (int32 t = 0; t < NumSlots; t++)
+		{
+			if (IsFree(t)) { continue; }
+			if (IsGhost(t)) { NumHullEdges++; }
+			else if (ExteriorTriangles.IsEmpty() || !ExteriorTriangles[t])
+			{
+				TriangleSite[t] = NumSites++;
+				SiteTriangle.Add(t);
+			}
+		}
+
+		if (bFlatOutput)
+		{
+			BuildFlatOutput();
+			return;
+		}
+
+		Sites.Reserve(NumSites);
+		DelaunayEdges.Reserve((NumSites * 3 + NumHullEdges) / 2);
+		DelaunayHull.Reserve(NumHullEdges);
+
+		for (int32 t = 0; t < NumSlots; t++)
+		{
+			const int32 Base = t * 3;
+			if (TriangleSite[t] == INDEX_NONE) { continue; }
+
+			PCGExMath::Geo::FDelaunaySite2& Site = Sites.Emplace_GetRef(HalfEdgeVtx[Base], HalfEdgeVtx[Base + 1], HalfEdgeVtx[Base + 2], TriangleSite[t]);
+
+			for (int32 k = 0; k < 3; k++)
+			{
+				const int32 HalfEdge = Base + k;
+				const int32 Neighbor = TriangleSite[HalfEdgeTwin[HalfEdge] / 3];
+				Site.Neighbors[k] = Neighbor;
+
+				// Each edge once: from its lowest vertex, or from the only side kept on the boundary
+				const int32 A = HalfEdgeVtx[HalfEdge];
+				const int32 B = HalfEdgeVtx[Next(HalfEdge)];
+				if (A < B || Neighbor == INDEX_NONE) { DelaunayEdges.Add(PCGEx::H64U(A, B)); }
+
+				if (Neighbor == INDEX_NONE)
+				{
+					DelaunayHull.Add(A);
+					DelaunayHull.Add(B);
+				}
+			}
+		}
+	}
+
+	void FTestDelaunay2::BuildFlatOutput()
+	{
+		const int32 NumSites = SiteTriangle.Num();
+
+		Flat.SiteVtx.SetNumUninitialized(NumSites * 3);
+		Flat.SiteNeighbors.SetNumUninitialized(NumSites * 3);
+
+		// One key per half-edge; the side that doesn't own the edge writes a self-loop, which the dedup drops
+		TArray<uint64> EdgeKeys;
+		EdgeKeys.SetNumUninitialized(NumSites * 3);
+
+		ParallelFor(
+			NumSites, [&](const int32 s)
+			{
+				const int32 Base = SiteTriangle[s] * 3;
+				for (int32 k = 0; k < 3; k++)
+				{
+					const int32 HalfEdge = Base + k;
+					const int32 A = HalfEdgeVtx[HalfEdge];
+					const int32 B = HalfEdgeVtx[Next(HalfEdge)];
+					const int32 Neighbor = TriangleSite[HalfEdgeTwin[HalfEdge] / 3];
+
+					Flat.SiteVtx[s * 3 + k] = A;
+					Flat.SiteNeighbors[s * 3 + k] = Neighbor;
+					EdgeKeys[s * 3 + k] = A < B || Neighbor == INDEX_NONE ? PCGEx::H64U(A, B) : PCGEx::H64U(A, A);
+				}
+			});
+
+		TestEdgeDedup::DedupSorted(EdgeKeys, Flat.Edges);
+
+		// Boundary edges have no site on the other side; without culling each hull vertex starts exactly one
+		for (int32 i = 0; i < Flat.SiteNeighbors.Num(); i++)
+		{
+			if (Flat.SiteNeighbors[i] == INDEX_NONE) { Flat.Hull.Add(Flat.SiteVtx[i]); }
+		}
+
+		Algo::Sort(Flat.Hull);
+		if (!ExteriorTriangles.IsEmpty()) { Flat.Hull.SetNum(Algo::Unique(Flat.Hull)); }
+	}
+
+	bool FTestDelaunay2::ProcessConstrained(
+		const TArrayView<FVector>& Positions, const TConstArrayView<uint64> Constraints,
+		const FPCGExGeo2DProjectionDetails& ProjectionDetails, const bool bInteriorOnly)
+	{
+		TArray<FVector2D> Projected;
+		Projected.SetNumUninitialized(Positions.Num());
+		for (int32 i = 0; i < Positions.Num(); i++)
+		{
+			const FVector P = ProjectionDetails.Project(Positions[i]);
+			Projected[i] = FVector2D(P.X, P.Y);
+		}
+
+		return ProcessConstrained(Projected, Constraints, bInteriorOnly);
+	}
+
+	bool FTestDelaunay2::ProcessConstrained(const TConstArrayView<FVector2D> Positions, const TConstArrayView<uint64> Constraints, const bool bInteriorOnly)
+	{
+		Reset();
+
+		if (!Triangulate(Positions))
+		{
+			Reset();
+			return false;
+		}
+
+		bConstrained = true;
+
+		VertexHalfEdge.Init(INDEX_NONE, Vertices.Num());
+		for (int32 HalfEdge = 0; HalfEdge < HalfEdgeVtx.Num(); HalfEdge++)
+		{
+			if (HalfEdgeVtx[HalfEdge] >= 0) { VertexHalfEdge[HalfEdgeVtx[HalfEdge]] = HalfEdge; }
+		}
+
+		ConstrainedEdges.Reserve(Constraints.Num());
+		for (const uint64 Constraint : Constraints)
+		{
+			const int32 A = ResolveConstraintVertex(PCGEx::H64A(Constraint));
+			const int32 B = ResolveConstraintVertex(PCGEx::H64B(Constraint));
+			if (A == INDEX_NONE || B == INDEX_NONE || A == B || !InsertConstraint(A, B)) { SkippedConstraints.Add(Constraint); }
+		}
+
+		VertexHalfEdge.Empty();
+		ConstraintCrossings.Empty();
+		FlipStack.Empty();
+
+		if (bInteriorOnly) { MarkExterior(); }
+
+		BuildOutput();
+		IsValid = true;
+		return true;
+	}
+
+	int32 FTestDelaunay2::ResolveConstraintVertex(const int32 Vertex)
+	{
+		if (!VertexHalfEdge.IsValidIndex(Vertex)) { return INDEX_NONE; }
+		if (VertexHalfEdge[Vertex] != INDEX_NONE) { return Vertex; }
+
+		// Duplicate: the connected vertex at the same position is a corner of the triangle it falls in
+		const int32 Triangle = Locate(Vertices[Vertex], LastTriangle);
+		if (Triangle == INDEX_NONE) { return INDEX_NONE; }
+
+		for (int32 k = 0; k < 3; k++)
+		{
+			const int32 Corner = HalfEdgeVtx[Triangle * 3 + k];
+			if (Corner != GhostVertex && Vertices[Corner] == Vertices[Vertex]) { return Corner; }
+		}
+
+		return INDEX_NONE;
+	}
+
+	int32 FTestDelaunay2::FindHalfEdge(const int32 From, const int32 To) const
+	{
+		const int32 First = VertexHalfEdge[From];
+		int32 HalfEdge = First;
+		do
+		{
+			if (HalfEdgeVtx[Next(HalfEdge)] == To) { return HalfEdge; }
+			HalfEdge = HalfEdgeTwin[Prev(HalfEdge)];
+		}
+		while (HalfEdge != First);
+
+		return INDEX_NONE;
+	}
+
+	bool FTestDelaunay2::InsertConstraint(const int32 From, const int32 To)
+	{
+		const FVector2D& PTo = Vertices[To];
+
+		int32 A = From;
+		while (A != To)
+		{
+			const FVector2D& PA = Vertices[A];
+
+			// Around A: the edge to To, a vertex on the way, or the triangle the segment leaves A through
+			int32 Through = INDEX_NONE;
+			int32 Crossed = INDEX_NONE;
+
+			const int32 First = VertexHalfEdge[A];
+			int32 HalfEdge = First;
+			do
+			{
+				const int32 V1 = HalfEdgeVtx[Next(HalfEdge)];
+				const int32 V2 = HalfEdgeVtx[Prev(HalfEdge)];
+
+				if (V1 == To || (V1 != GhostVertex && Orient2D(PA, PTo, Vertices[V1]) == 0 && FVector2D::DotProduct(Vertices[V1] - PA, PTo - PA) > 0))
+				{
+					Through = V1;
+					break;
+				}
+
+				if (V1 != GhostVertex && V2 != GhostVertex && Orient2D(PA, Vertices[V1], PTo) > 0 && Orient2D(PA, Vertices[V2], PTo) < 0)
+				{
+					Crossed = Next(HalfEdge);
+					break;
+				}
+
+				HalfEdge = HalfEdgeTwin[Prev(HalfEdge)];
+			}
+			while (HalfEdge != First);
+
+			if (Through != INDEX_NONE)
+			{
+				ConstrainedEdges.Add(PCGEx::H64U(A, Through));
+				A = Through;
+				continue;
+			}
+
+			if (Crossed == INDEX_NONE) { return false; }
+
+			// Walk the crossed edges, right vertex first, up to To or the next vertex on the segment
+			ConstraintCrossings.Reset();
+
+			int32 End = INDEX_NONE;
+			HalfEdge = Crossed;
+			while (End == INDEX_NONE)
+			{
+				const int32 Right = HalfEdgeVtx[HalfEdge];
+				const int32 Left = HalfEdgeVtx[Next(HalfEdge)];
+
+				const uint64 Edge = PCGEx::H64U(Right, Left);
+				if (ConstrainedEdges.Contains(Edge)) { return false; }
+				ConstraintCrossings.Add(Edge);
+
+				const int32 Twin = HalfEdgeTwin[HalfEdge];
+				const int32 Opposite = HalfEdgeVtx[Prev(Twin)];
+
+				const double Side = Opposite == To ? 0 : Orient2D(PA, PTo, Vertices[Opposite]);
+				if (Side == 0) { End = Opposite; }
+				else { HalfEdge = Side > 0 ? Next(Twin) : Prev(Twin); }
+			}
+
+			// Flip the crossed edges away. One whose quad isn't strictly convex yet goes back in the queue,
+			// the flips around it eventually make it convex.
+			const FVector2D& PEnd = Vertices[End];
+			FlipStack.Reset();
+
+			for (int32 i = 0; i < ConstraintCrossings.Num(); i++)
+			{
+				const uint64 Edge = ConstraintCrossings[i];
+				const int32 Flipped = FindHalfEdge(PCGEx::H64A(Edge), PCGEx::H64B(Edge));
+
+				const int32 P = HalfEdgeVtx[Flipped];
+				const int32 Q = HalfEdgeVtx[Next(Flipped)];
+				const int32 R = HalfEdgeVtx[Prev(Flipped)];
+				const int32 S = HalfEdgeVtx[Prev(HalfEdgeTwin[Flipped])];
+
+				const double SideP = Orient2D(Vertices[R], Vertices[S], Vertices[P]);
+				const double SideQ = Orient2D(Vertices[R], Vertices[S], Vertices[Q]);
+				if (!((SideP > 0 && SideQ < 0) || (SideP < 0 && SideQ > 0)))
+				{
+					ConstraintCrossings.Add(Edge);
+					continue;
+				}
+
+				FlipEdge(Flipped);
+
+				const double SideR = Orient2D(PA, PEnd, Vertices[R]);
+				const double SideS = Orient2D(PA, PEnd, Vertices[S]);
+				if ((SideR > 0 && SideS < 0) || (SideR < 0 && SideS > 0)) { ConstraintCrossings.Add(PCGEx::H64U(R, S)); }
+				else { FlipStack.Add(PCGEx::H64U(R, S)); }
+			}
+
+			ConstrainedEdges.Add(PCGEx::H64U(A, End));
+			RestoreDelaunay();
+
+			A = End;
+		}
+
+		return true;
+	}
+
+	void FTestDelaunay2::FlipEdge(const int32 HalfEdge)
+	{
+		// HalfEdge is A -> B in (A, B, C), its twin B -> A in (B, A, D); they become (D, B, C) and (C, A, D)
+		const int32 Twin = HalfEdgeTwin[HalfEdge];
+		const int32 T = HalfEdge / 3;
+		const int32 U = Twin / 3;
+
+		const int32 A = HalfEdgeVtx[HalfEdge];
+		const int32 B = HalfEdgeVtx[Next(HalfEdge)];
+		const int32 C = HalfEdgeVtx[Prev(HalfEdge)];
+		const int32 D = HalfEdgeVtx[Prev(Twin)];
+
+		const int32 OutBC = HalfEdgeTwin[Next(HalfEdge)];
+		const int32 OutCA = HalfEdgeTwin[Prev(HalfEdge)];
+		const int32 OutAD = HalfEdgeTwin[Next(Twin)];
+		const int32 OutDB = HalfEdgeTwin[Prev(Twin)];
+
+		SetTriangle(T, D, B, C);
+		SetTriangle(U, C, A, D);
+
+		Link(T * 3, OutDB);
+		Link(T * 3 + 1, OutBC);
+		Link(T * 3 + 2, U * 3 + 2);
+		Link(U * 3, OutCA);
+		Link(U * 3 + 1, OutAD);
+
+		VertexHalfEdge[A] = U * 3 + 1;
+		VertexHalfEdge[B] = T * 3 + 1;
+		VertexHalfEdge[C] = T * 3 + 2;
+		VertexHalfEdge[D] = T * 3;
+	}
+
+	void FTestDelaunay2::RestoreDelaunay()
+	{
+		while (!FlipStack.IsEmpty())
+		{
+			const uint64 Edge = FlipStack.Pop(EAllowShrinking::No);
+			if (ConstrainedEdges.Contains(Edge)) { continue; }
+
+			// Already flipped away by an earlier entry
+			const int32 HalfEdge = FindHalfEdge(PCGEx::H64A(Edge), PCGEx::H64B(Edge));
+			if (HalfEdge == INDEX_NONE) { continue; }
+
+			const int32 Twin = HalfEdgeTwin[HalfEdge];
+			if (IsGhost(HalfEdge / 3) || IsGhost(Twin / 3)) { continue; }
+
+			const int32 A = HalfEdgeVtx[HalfEdge];
+			const int32 B = HalfEdgeVtx[Next(HalfEdge)];
+			const int32 C = HalfEdgeVtx[Prev(HalfEdge)];
+			const int32 D = HalfEdgeVtx[Prev(Twin)];
+
+			// D inside the circumcircle of (A, B, C) also means the quad is convex
+			if (InCircle(Vertices[A], Vertices[B], Vertices[C], Vertices[D]) <= 0) { continue; }
+
+			FlipEdge(HalfEdge);
+
+			FlipStack.Add(PCGEx::H64U(A, D));
+			FlipStack.Add(PCGEx::H64U(D, B));
+			FlipStack.Add(PCGEx::H64U(B, C));
+			FlipStack.Add(PCGEx::H64U(C, A));
+		}
+	}
+
+	void FTestDelaunay2::MarkExterior()
+	{
+		const int32 NumSlots = NumTriangleSlots();
+
+		// Breadth-first by number of constraints crossed: flood each layer, its constrained borders seed the next
+		TArray<int32> Depth;
+		Depth.Init(INDEX_NONE, NumSlots);
+
+		TArray<int32> Layer;
+		TArray<int32> NextLayer;
+		for (int32 t = 0; t < NumSlots; t++)
+		{
+			if (!IsFree(t) && IsGhost(t))
+			{
+				Depth[t] = 0;
+				Layer.Add(t);
+			}
+		}
+
+		int32 Crossed = 0;
+		while (!Layer.IsEmpty())
+		{
+			for (int32 i = 0; i < Layer.Num(); i++)
+			{
+				const int32 Base = Layer[i] * 3;
+				for (int32 k = 0; k < 3; k++)
+				{
+					const int32 Neighbor = HalfEdgeTwin[Base + k] / 3;
+					if (Depth[Neighbor] != INDEX_NONE) { continue; }
+
+					const int32 A = HalfEdgeVtx[Base + k];
+					const int32 B = HalfEdgeVtx[Next(Base + k)];
+					if (A != GhostVertex && B != GhostVertex && ConstrainedEdges.Contains(PCGEx::H64U(A, B))) { NextLayer.Add(Neighbor); }
+					else
+					{
+						Depth[Neighbor] = Crossed;
+						Layer.Add(Neighbor);
+					}
+				}
+			}
+
+			Crossed++;
+			Layer.Reset();
+
+			for (const int32 Triangle : NextLayer)
+			{
+				if (Depth[Triangle] != INDEX_NONE) { continue; }
+				Depth[Triangle] = Crossed;
+				Layer.Add(Triangle);
+			}
+
+			NextLayer.Reset();
+		}
+
+		ExteriorTriangles.Init(false, NumSlots);
+		for (int32 t = 0; t < NumSlots; t++) { ExteriorTriangles[t] = Depth[t] % 2 == 0; }
+	}
+
+	int32 FTestDelaunay2::InsertPoint(const FVector2D& Position, FUpdate* OutUpdate)
+	{
+		if (!IsValid || bStreaming || bConstrained || Sites.IsEmpty()) { return INDEX_NONE; }
+
+		const int32 Vertex = Vertices.Add(Position);
+		FanSlot.Add(-1);
+
+		if (!CollectCavity(Vertex, Locate(Position, LastTriangle)))
+		{
+			Vertices.Pop(EAllowShrinking::No);
+			FanSlot.Pop(EAllowShrinking::No);
+			return INDEX_NONE;
+		}
+
+		BeginLocalUpdate(CavityTriangles);
+		FillCavity(Vertex);
+		EndLocalUpdate(NewTriangles, OutUpdate);
+
+		return Vertex;
+	}
+
+	bool FTestDelaunay2::RemovePoint(const int32 Vertex, FUpdate* OutUpdate)
+	{
+		if (!IsValid || bStreaming || bConstrained || Sites.IsEmpty() || !Vertices.IsValidIndex(Vertex)) { return false; }
+
+		const int32 First = FindOutgoing(Vertex);
+		if (First == INDEX_NONE) { return false; }
+
+		// Star of the vertex, counter-clockwise: triangle j is (Vertex, Ring[j], Ring[j + 1])
+		TArray<int32, TInlineAllocator<16>> Star;
+		TArray<int32, TInlineAllocator<16>> Ring;
+		int32 HalfEdge = First;
+		do
+		{
+			Star.Add(HalfEdge);
+			Ring.Add(HalfEdgeVtx[Next(HalfEdge)]);
+			HalfEdge = HalfEdgeTwin[Prev(HalfEdge)];
+		}
+		while (HalfEdge != First && Star.Num() <= NumTriangleSlots());
+
+		const int32 Degree = Star.Num();
+		const int32 GhostIndex = Ring.IndexOfByKey(GhostVertex);
+		const bool bOnHull = GhostIndex != INDEX_NONE;
+
+		// Hole polygon, counter-clockwise. Edge i goes from Polygon[i] to Polygon[i + 1], Outside[i] is its twin beyond the star.
+		// A hull vertex leaves an open chain, starting right after the ghost.
+		TArray<int32, TInlineAllocator<16>> Polygon;
+		TArray<int32, TInlineAllocator<16>> Outside;
+		for (int32 i = 0; i < Degree; i++)
+		{
+			const int32 j = bOnHull ? (GhostIndex + 1 + i) % Degree : i;
+			if (Ring[j] == GhostVertex) { continue; }
+			Polygon.Add(Ring[j]);
+			Outside.Add(HalfEdgeTwin[Next(Star[j])]);
+		}
+
+		const int32 StartTwin = bOnHull ? HalfEdgeTwin[Next(Star[GhostIndex])] : INDEX_NONE;
+		const int32 EndTwin = bOnHull ? Outside.Pop(EAllowShrinking::No) : INDEX_NONE;
+
+		// Plan the ears first so a removal that can't be done leaves the mesh untouched
+		auto IsEar = [&](const TConstArrayView<int32> Remaining, const int32 i)
+		{
+			const int32 Count = Remaining.Num();
+			const int32 A = Remaining[(i + Count - 1) % Count];
+			const int32 B = Remaining[i];
+			const int32 C = Remaining[(i + 1) % Count];
+			if (Orient2D(Vertices[A], Vertices[B], Vertices[C]) <= 0) { return false; }
+
+			// Against the whole link: the hole triangles are triangles of the link's own Delaunay triangulation
+			for (const int32 Other : Polygon)
+			{
+				if (Other != A && Other != B && Other != C && InCircle(Vertices[A], Vertices[B], Vertices[C], Vertices[Other]) > 0) { return false; }
+			}
+
+			return true;
+		};
+
+		TArray<int32, TInlineAllocator<16>> Remaining = Polygon;
+		TArray<int32, TInlineAllocator<16>> Ears;
+		while (Remaining.Num() > (bOnHull ? 2 : 3))
+		{
+			int32 Ear = INDEX_NONE;
+			for (int32 i = bOnHull ? 1 : 0; i < (bOnHull ? Remaining.Num() - 1 : Remaining.Num()); i++)
+			{
+				if (IsEar(Remaining, i))
+				{
+					Ear = i;
+					break;
+				}
+			}
+
+			if (Ear == INDEX_NONE) { break; }
+			Ears.Add(Ear);
+			Remaining.RemoveAt(Ear);
+		}
+
+		if (bOnHull)
+		{
+			// What's left must be convex from the outside, and something must remain
+			for (int32 i = 1; i < Remaining.Num() - 1; i++)
+			{
+				if (Orient2D(Vertices[Remaining[i - 1]], Vertices[Remaining[i]], Vertices[Remaining[i + 1]]) > 0) { return false; }
+			}
+
+			if (Ears.IsEmpty() && Sites.Num() == Degree - 2) { return false; }
+		}
+		else if (Remaining.Num() != 3 || Orient2D(Vertices[Remaining[0]], Vertices[Remaining[1]], Vertices[Remaining[2]]) <= 0)
+		{
+			return false;
+		}
+
+		// Degree - 2 new triangles either way: ears plus the last one, or ears plus one ghost per chain edge left
+		TArray<int32, TInlineAllocator<16>> Replaced;
+		for (const int32 StarEdge : Star) { Replaced.Add(StarEdge / 3); }
+
+		BeginLocalUpdate(Replaced);
+
+		NewTriangles.Reset();
+		for (int32 i = 0; i < Degree - 2; i++) { NewTriangles.Add(Replaced[i]); }
+		for (int32 i = Degree - 2; i < Degree; i++) { FreeTriangle(Replaced[i]); }
+
+		int32 NextSlot = 0;
+		for (const int32 Ear : Ears)
+		{
+			const int32 Count = Polygon.Num();
+			const int32 Before = (Ear + Count - 1) % Count;
+			const int32 After = (Ear + 1) % Count;
+
+			const int32 Triangle = NewTriangles[NextSlot++];
+			SetTriangle(Triangle, Polygon[Before], Polygon[Ear], Polygon[After]);
+			Link(Triangle * 3, Outside[Before]);
+			Link(Triangle * 3 + 1, Outside[Ear]);
+
+			// The new edge Before -> After has the ear on its outside
+			Outside[Before] = Triangle * 3 + 2;
+			Polygon.RemoveAt(Ear);
+			Outside.RemoveAt(Ear);
+		}
+
+		if (!bOnHull)
+		{
+			const int32 Triangle = NewTriangles[NextSlot++];
+			SetTriangle(Triangle, Polygon[0], Polygon[1], Polygon[2]);
+			for (int32 k = 0; k < 3; k++) { Link(Triangle * 3 + k, Outside[k]); }
+		}
+		else
+		{
+			// One ghost per chain edge left, chained to each other and to the ghosts beyond the star
+			int32 Previous = StartTwin;
+			for (int32 i = 0; i < Polygon.Num() - 1; i++)
+			{
+				const int32 Ghost = NewTriangles[NextSlot++];
+				SetTriangle(Ghost, Polygon[i], Polygon[i + 1], GhostVertex);
+				Link(Ghost * 3, Outside[i]);
+				Link(Ghost * 3 + 2, Previous);
+				Previous = Ghost * 3 + 1;
+			}
+			Link(Previous, EndTwin);
+
+			LastGhost = StartTwin / 3;
+		}
+
+		check(NextSlot == NewTriangles.Num());
+
+		LastTriangle = NewTriangles[0];
+		EndLocalUpdate(NewTriangles, OutUpdate);
+
+		return true;
+	}
+
+	int32 FTestDelaunay2::FindOutgoing(const int32 Vertex)
+	{
+		auto FindIn = [&](const int32 Triangle)
+		{
+			for (int32 k = 0; k < 3; k++) { if (HalfEdgeVtx[Triangle * 3 + k] == Vertex) { return Triangle * 3 + k; } }
+			return INDEX_NONE;
+		};
+
+		const FVector2D& P = Vertices[Vertex];
+		const int32 Located = Locate(P, LastTriangle);
+		if (Located != INDEX_NONE)
+		{
+			const int32 HalfEdge = FindIn(Located);
+			if (HalfEdge != INDEX_NONE) { return HalfEdge; }
+
+			// Another vertex holds this position, this one is a duplicate
+			for (int32 k = 0; k < 3; k++)
+			{
+				const int32 Other = HalfEdgeVtx[Located * 3 + k];
+				if (Other != GhostVertex && Vertices[Other] == P) { return INDEX_NONE; }
+			}
+		}
+
+		for (int32 t = 0; t < NumTriangleSlots(); t++)
+		{
+			const int32 HalfEdge = IsFree(t) ? INDEX_NONE : FindIn(t);
+			if (HalfEdge != INDEX_NONE) { return HalfEdge; }
+		}
+
+		return INDEX_NONE;
+	}
+
+	void FTestDelaunay2::BeginLocalUpdate(const TConstArrayView<int32> Triangles)
+	{
+		ReleasedSites.Reset();
+		ReplacedEdges.Reset();
+		ReplacedHullRefs.Reset();
+
+		for (const int32 Triangle : Triangles)
+		{
+			const int32 Base = Triangle * 3;
+			for (int32 k = 0; k < 3; k++)
+			{
+				const int32 A = HalfEdgeVtx[Base + k];
+				const int32 B = HalfEdgeVtx[Base + (k + 1) % 3];
+				if (A == GhostVertex || B == GhostVertex) { continue; }
+				ReplacedEdges.Add(PCGEx::H64U(A, B));
+			}
+
+			if (TriangleSite[Triangle] != INDEX_NONE)
+			{
+				ReleasedSites.Add(TriangleSite[Triangle]);
+				TriangleSite[Triangle] = INDEX_NONE;
+			}
+			else
+			{
+				for (int32 k = 0; k < 3; k++) { if (HalfEdgeVtx[Base + k] != GhostVertex) { ReplacedHullRefs.Add(HalfEdgeVtx[Base + k]); } }
+			}
+		}
+	}
+
+	void FTestDelaunay2::EndLocalUpdate(const TConstArrayView<int32> Triangles, FUpdate* OutUpdate)
+	{
+		const int32 PreviousNumSites = Sites.Num();
+		while (TriangleSite.Num() < NumTriangleSlots()) { TriangleSite.Add(INDEX_NONE); }
+
+		TArray<uint64> AddedEdges;
+		TArray<int32> AddedHullRefs;
+		TArray<int32> Touched(Triangles.GetData(), Triangles.Num());
+
+		// New real triangles take the lowest released Ids first
+		ReleasedSites.Sort(TGreater<int32>());
+		for (const int32 Triangle : Triangles)
+		{
+			const int32 Base = Triangle * 3;
+			for (int32 k = 0; k < 3; k++)
+			{
+				const int32 A = HalfEdgeVtx[Base + k];
+				const int32 B = HalfEdgeVtx[Base + (k + 1) % 3];
+				if (A == GhostVertex || B == GhostVertex) { continue; }
+				AddedEdges.Add(PCGEx::H64U(A, B));
+			}
+
+			if (IsGhost(Triangle))
+			{
+				for (int32 k = 0; k < 3; k++) { if (HalfEdgeVtx[Base + k] != GhostVertex) { AddedHullRefs.Add(HalfEdgeVtx[Base + k]); } }
+				continue;
+			}
+
+			int32 Id;
+			if (!ReleasedSites.IsEmpty()) { Id = ReleasedSites.Pop(EAllowShrinking::No); }
+			else
+			{
+				Id = Sites.Emplace(0, 0, 0, Sites.Num());
+				SiteTriangle.Add(INDEX_NONE);
+			}
+
+			TriangleSite[Triangle] = Id;
+			SiteTriangle[Id] = Triangle;
+		}
+
+		// Fill the Ids left over with the last sites
+		ReleasedSites.Sort();
+		while (!ReleasedSites.IsEmpty())
+		{
+			const int32 Last = Sites.Num() - 1;
+			if (ReleasedSites.Last() == Last) { ReleasedSites.Pop(EAllowShrinking::No); }
+			else
+			{
+				const int32 Hole = ReleasedSites[0];
+				ReleasedSites.RemoveAt(0);
+
+				const int32 Moved = SiteTriangle[Last];
+				TriangleSite[Moved] = Hole;
+				SiteTriangle[Hole] = Moved;
+				Touched.Add(Moved);
+			}
+
+			Sites.Pop(EAllowShrinking::No);
+			SiteTriangle.Pop(EAllowShrinking::No);
+		}
+
+		// Rewrite touched sites and their neighbors, including those now facing a ghost
+		CurrentStamp++;
+		TArray<int32> Dirty;
+		auto MarkDirty = [&](const int32 Triangle)
+		{
+			if (TriangleSite[Triangle] == INDEX_NONE || TriangleStamp[Triangle] == CurrentStamp) { return; }
+			TriangleStamp[Triangle] = CurrentStamp;
+			Dirty.Add(Triangle);
+		};
+
+		for (const int32 Triangle : Touched)
+		{
+			MarkDirty(Triangle);
+			for (int32 k = 0; k < 3; k++) { MarkDirty(HalfEdgeTwin[Triangle * 3 + k] / 3); }
+		}
+
+		for (const int32 Triangle : Dirty)
+		{
+			const int32 Base = Triangle * 3;
+			const int32 Id = TriangleSite[Triangle];
+
+			PCGExMath::Geo::FDelaunaySite2& Site = Sites[Id];
+			Site = PCGExMath::Geo::FDelaunaySite2(HalfEdgeVtx[Base], HalfEdgeVtx[Base + 1], HalfEdgeVtx[Base + 2], Id);
+			for (int32 k = 0; k < 3; k++) { Site.Neighbors[k] = TriangleSite[HalfEdgeTwin[Base + k] / 3]; }
+		}
+
+		// Edges on the rim of the replaced region appear on both sides and cancel out
+		ReplacedEdges.Sort();
+		AddedEdges.Sort();
+
+		TArray<uint64> RemovedEdges;
+		TArray<uint64> NewEdges;
+		int32 i = 0;
+		int32 j = 0;
+		while (i < ReplacedEdges.Num() || j < AddedEdges.Num())
+		{
+			if (j == AddedEdges.Num() || (i < ReplacedEdges.Num() && ReplacedEdges[i] < AddedEdges[j]))
+			{
+				const uint64 Edge = ReplacedEdges[i];
+				while (i < ReplacedEdges.Num() && ReplacedEdges[i] == Edge) { i++; }
+				RemovedEdges.Add(Edge);
+			}
+			else if (i == ReplacedEdges.Num() || AddedEdges[j] < ReplacedEdges[i])
+			{
+				const uint64 Edge = AddedEdges[j];
+				while (j < AddedEdges.Num() && AddedEdges[j] == Edge) { j++; }
+				NewEdges.Add(Edge);
+			}
+			else
+			{
+				const uint64 Edge = ReplacedEdges[i];
+				while (i < ReplacedEdges.Num() && ReplacedEdges[i] == Edge) { i++; }
+				while (j < AddedEdges.Num() && AddedEdges[j] == Edge) { j++; }
+			}
+		}
+
+		for (const uint64 Edge : RemovedEdges) { DelaunayEdges.Remove(Edge); }
+		for (const uint64 Edge : NewEdges) { DelaunayEdges.Add(Edge); }
+
+		// A hull vertex sits on exactly two ghosts; count how many it keeps
+		TMap<int32, int32> HullRefs;
+		for (const int32 Vertex : ReplacedHullRefs) { HullRefs.FindOrAdd(Vertex, 2)--; }
+		for (const int32 Vertex : AddedHullRefs) { HullRefs.FindOrAdd(Vertex, DelaunayHull.Contains(Vertex) ? 2 : 0)++; }
+		for (const TPair<int32, int32>& Ref : HullRefs)
+		{
+			if (Ref.Value > 0) { DelaunayHull.Add(Ref.Key); }
+			else { DelaunayHull.Remove(Ref.Key); }
+		}
+
+		for (const int32 Triangle : Triangles)
+		{
+			if (!IsGhost(Triangle))
+			{
+				LastTriangle = Triangle;
+				break;
+			}
+		}
+
+		if (OutUpdate)
+		{
+			OutUpdate->DirtySites.Reset(Dirty.Num());
+			for (const int32 Triangle : Dirty) { OutUpdate->DirtySites.Add(TriangleSite[Triangle]); }
+			OutUpdate->DirtySites.Sort();
+
+			OutUpdate->PreviousNumSites = PreviousNumSites;
+			OutUpdate->AddedEdges = MoveTemp(NewEdges);
+			OutUpdate->RemovedEdges = MoveTemp(RemovedEdges);
+		}
+	}
+
+	bool FTestDelaunay2::Validate(FString* OutError, const bool bCheckEmptyCircles) const
+	{
+		auto Fail = [&](const FString& Error)
+		{
+			if (OutError) { *OutError = Error; }
+			return false;
+		};
+
+		const int32 NumSlots = NumTriangleSlots();
+
+		// Removed points stay in Vertices, only test against the connected ones
+		TBitArray<> Connected(false, Vertices.Num());
+		for (const int32 Vertex : HalfEdgeVtx) { if (Vertex >= 0) { Connected[Vertex] = true; } }
+
+		for (int32 t = 0; t < NumSlots; t++)
+		{
+			if (IsFree(t)) { continue; }
+
+			for (int32 k = 0; k < 3; k++)
+			{
+				const int32 HalfEdge = t * 3 + k;
+				const int32 Twin = HalfEdgeTwin[HalfEdge];
+
+				if (!HalfEdgeTwin.IsValidIndex(Twin) || IsFree(Twin / 3)) { return Fail(FString::Printf(TEXT("Half-edge %d has no twin"), HalfEdge)); }
+				if (HalfEdgeTwin[Twin] != HalfEdge) { return Fail(FString::Printf(TEXT("Half-edge %d twin is not symmetric"), HalfEdge)); }
+				if (HalfEdgeVtx[Twin] != HalfEdgeVtx[Next(HalfEdge)] || HalfEdgeVtx[Next(Twin)] != HalfEdgeVtx[HalfEdge])
+				{
+					return Fail(FString::Printf(TEXT("Half-edge %d twin has mismatched endpoints"), HalfEdge));
+				}
+			}
+
+			if (IsGhost(t)) { continue; }
+
+			const FVector2D& A = Vertices[HalfEdgeVtx[t * 3]];
+			const FVector2D& B = Vertices[HalfEdgeVtx[t * 3 + 1]];
+			const FVector2D& C = Vertices[HalfEdgeVtx[t * 3 + 2]];
+
+			if (Orient2D(A, B, C) <= 0) { return Fail(FString::Printf(TEXT("Triangle %d is not counter-clockwise"), t)); }
+			if (!bCheckEmptyCircles) { continue; }
+
+			// Constraints block visibility, so only the vertex across each free edge matters
+			if (bConstrained)
+			{
+				for (int32 k = 0; k < 3; k++)
+				{
+					const int32 HalfEdge = t * 3 + k;
+					const int32 Twin = HalfEdgeTwin[HalfEdge];
+					if (IsGhost(Twin / 3) || ConstrainedEdges.Contains(PCGEx::H64U(HalfEdgeVtx[HalfEdge], HalfEdgeVtx[Next(HalfEdge)]))) { continue; }
+
+					if (InCircle(A, B, C, Vertices[HalfEdgeVtx[Prev(Twin)]]) > 0)
+					{
+						return Fail(FString::Printf(TEXT("Edge %d of triangle %d is not locally Delaunay"), k, t));
+					}
+				}
+
+				continue;
+			}
+
+			// Exact predicate, so cocircular vertices pass and nothing else does
+			for (int32 v = 0; v < Vertices.Num(); v++)
+			{
+				if (Connected[v] && InCircle(A, B, C, Vertices[v]) > 0)
+				{
+					return Fail(FString::Printf(TEXT("Vertex %d is inside the circumcircle of triangle %d"), v, t));
+				}
+			}
+		}
+
+		return true;
+	}
+
+	void FTestDelaunay2::BeginStream(FOnSiteFinalized&& OnSite, FOnEdgeFinalized&& OnEdge)
+	{
+		Reset();
+
+		OnSiteFinalized = MoveTemp(OnSite);
+		OnEdgeFinalized = MoveTemp(OnEdge);
+		bStreaming = true;
+	}
+
+	bool FTestDelaunay2::AddChunk(const TConstArrayView<FVector2D> Positions)
+	{
+		check(bStreaming);
+
+		if (Positions.IsEmpty()) { return true; }
+
+		double ChunkMin = TNumericLimits<double>::Max();
+		double ChunkMax = TNumericLimits<double>::Lowest();
+		for (const FVector2D& P : Positions)
+		{
+			ChunkMin = FMath::Min(ChunkMin, P.X);
+			ChunkMax = FMath::Max(ChunkMax, P.X);
+		}
+
+		if (StreamedPoints > 0 && ChunkMin < SweepFront) { return false; }
+
+		const int32 FirstVertex = Vertices.Num();
+		Vertices.Append(Positions.GetData(), Positions.Num());
+		for (int32 i = 0; i < Positions.Num(); i++) { StreamIds.Add(StreamedPoints + i); }
+		StreamedPoints += Positions.Num();
+		SweepFront = ChunkMax;
+
+		FanSlot.SetNumUninitialized(Vertices.Num());
+
+		// Insert along the sweep: each point is then outside, or on, the current hull
+		auto SortByX = [&](TArray<int32>& Order)
+		{
+			Order.Sort([&](const int32 A, const int32 B) { return Vertices[A].X < Vertices[B].X || (Vertices[A].X == Vertices[B].X && A < B); });
+		};
+
+		TArray<int32> Order;
+		if (!bStreamSeeded)
+		{
+			// Everything so far may be collinear, keep buffering until a triangle exists
+			Order.SetNumUninitialized(Vertices.Num());
+			for (int32 i = 0; i < Vertices.Num(); i++) { Order[i] = i; }
+			SortByX(Order);
+
+			int32 Seeds[3];
+			if (!InitializeFirstTriangle(Order, Seeds)) { return true; }
+
+			bStreamSeeded = true;
+			Order.RemoveAll([&](const int32 Vertex) { return Vertex == Seeds[0] || Vertex == Seeds[1] || Vertex == Seeds[2]; });
+		}
+		else
+		{
+			Order.SetNumUninitialized(Positions.Num());
+			for (int32 i = 0; i < Positions.Num(); i++) { Order[i] = FirstVertex + i; }
+			SortByX(Order);
+		}
+
+		for (const int32 Vertex : Order)
+		{
+			int32 Start = LocateOnHull(Vertices[Vertex]);
+			if (Start == INDEX_NONE) { Start = Locate(Vertices[Vertex], LastTriangle); }
+			if (!InsertVertexAt(Vertex, Start)) { Duplicates++; }
+		}
+
+		PeakLiveTriangles = FMath::Max(PeakLiveTriangles, NumTriangleSlots());
+		FinalizeBehind(SweepFront);
+
+		return true;
+	}
+
+	bool FTestDelaunay2::EndStream()
+	{
+		check(bStreaming);
+
+		if (!bStreamSeeded)
+		{
+			Reset();
+			return false;
+		}
+
+		FinalizeBehind(TNumericLimits<double>::Max());
+
+		// Only ghosts are left, their real vertices are the hull
+		DelaunayHull.Reserve(NumTriangleSlots());
+		for (int32 i = 0; i < HalfEdgeVtx.Num(); i++)
+		{
+			if (HalfEdgeVtx[i] != GhostVertex) { DelaunayHull.Add(StreamIds[HalfEdgeVtx[i]]); }
+		}
+
+		const int32 NumDuplicates = Duplicates;
+		TSet<int32> Hull = MoveTemp(DelaunayHull);
+		Reset();
+
+		DelaunayHull = MoveTemp(Hull);
+		Duplicates = NumDuplicates;
+		IsValid = true;
+		return true;
+	}
+
+	void FTestDelaunay2::FinalizeBehind(const double Front)
+	{
+		const int32 NumSlots = NumTriangleSlots();
+
+		bool bAnyFinalized = false;
+		for (int32 t = 0; t < NumSlots; t++)
+		{
+			if (IsFree(t) || IsGhost(t)) { continue; }
+
+			const int32 Base = t * 3;
+			const FVector2D& A = Vertices[HalfEdgeVtx[Base]];
+
+			FVector2D Center;
+			TestPredicates::GetCircumcenter(A, Vertices[HalfEdgeVtx[Base + 1]], Vertices[HalfEdgeVtx[Base + 2]], Center);
+
+			// Padded, so a point on the front can never be cocircular with a finalized triangle
+			if (Center.X + FVector2D::Distance(Center, A) * (1 + 1e-9) >= Front) { continue; }
+
+			if (OnSiteFinalized)
+			{
+				OnSiteFinalized(PCGExMath::Geo::FDelaunaySite2(StreamIds[HalfEdgeVtx[Base]], StreamIds[HalfEdgeVtx[Base + 1]], StreamIds[HalfEdgeVtx[Base + 2]], EmittedSites));
+			}
+			EmittedSites++;
+
+			// The first side to go emits the edge; the other side, real or ghost, is left with an open edge
+			for (int32 k = 0; k < 3; k++)
+			{
+				const int32 Twin = HalfEdgeTwin[Base + k];
+				if (Twin == INDEX_NONE) { continue; }
+
+				if (OnEdgeFinalized) { OnEdgeFinalized(PCGEx::H64U(StreamIds[HalfEdgeVtx[Base + k]], StreamIds[HalfEdgeVtx[Next(Base + k)]])); }
+				HalfEdgeTwin[Twin] = INDEX_NONE;
+			}
+
+			HalfEdgeVtx[Base] = HalfEdgeVtx[Base + 1] = HalfEdgeVtx[Base + 2] = FreeVertex;
+			bAnyFinalized = true;
+		}
+
+		if (!bAnyFinalized) { return; }
+
+		// Compact the live triangles and the vertices they still reference
+		TArray<int32> TriangleRemap;
+		TArray<int32> VertexRemap;
+		TriangleRemap.Init(INDEX_NONE, NumSlots);
+		VertexRemap.Init(INDEX_NONE, Vertices.Num());
+
+		int32 NumLive = 0;
+		for (int32 t = 0; t < NumSlots; t++)
+		{
+			if (IsFree(t)) { continue; }
+
+			TriangleRemap[t] = NumLive++;
+			for (int32 k = 0; k < 3; k++)
+			{
+				const int32 Vertex = HalfEdgeVtx[t * 3 + k];
+				if (Vertex != GhostVertex) { VertexRemap[Vertex] = 0; }
+			}
+		}
+
+		int32 NumVertices = 0;
+		for (int32 v = 0; v < Vertices.Num(); v++)
+		{
+			if (VertexRemap[v] == INDEX_NONE) { continue; }
+
+			VertexRemap[v] = NumVertices;
+			Vertices[NumVertices] = Vertices[v];
+			StreamIds[NumVertices] = StreamIds[v];
+			NumVertices++;
+		}
+
+		Vertices.SetNum(NumVertices, EAllowShrinking::No);
+		StreamIds.SetNum(NumVertices, EAllowShrinking::No);
+
+		for (int32 t = 0; t < NumSlots; t++)
+		{
+			const int32 Target = TriangleRemap[t];
+			if (Target == INDEX_NONE) { continue; }
+
+			for (int32 k = 0; k < 3; k++)
+			{
+				const int32 Vertex = HalfEdgeVtx[t * 3 + k];
+				const int32 Twin = HalfEdgeTwin[t * 3 + k];
+				HalfEdgeVtx[Target * 3 + k] = Vertex == GhostVertex ? GhostVertex : VertexRemap[Vertex];
+				HalfEdgeTwin[Target * 3 + k] = Twin == INDEX_NONE ? INDEX_NONE : TriangleRemap[Twin / 3] * 3 + Twin % 3;
+			}
+		}
+
+		HalfEdgeVtx.SetNum(NumLive * 3, EAllowShrinking::No);
+		HalfEdgeTwin.SetNum(NumLive * 3, EAllowShrinking::No);
+		TriangleStamp.Init(0, NumLive);
+		FreeTriangles.Reset();
+		CurrentStamp = 0;
+
+		FanSlot.SetNumUninitialized(NumVertices);
+
+		LastTriangle = TriangleRemap.IsValidIndex(LastTriangle) && TriangleRemap[LastTriangle] != INDEX_NONE ? TriangleRemap[LastTriangle] : 0;
+		LastGhost = TriangleRemap.IsValidIndex(LastGhost) ? TriangleRemap[LastGhost] : INDEX_NONE;
+	}
+
+#pragma endregion
+
+#pragma region FTestDelaunay3
+
+	bool FTestDelaunay3::Process(const TConstArrayView<FVector> Positions)
+	{
+		Reset();
+
+		if (!Tetrahedralize(Positions))
+		{
+			Reset();
+			return false;
+		}
+
+		TArray<FIntVector4> Tetrahedra;
+		TArray<int32> Hull;
+		GatherTetrahedra(Tetrahedra);
+		GatherHull(Hull);
+		BuildOutput(Tetrahedra, Hull);
+
+		IsValid = true;
+		return true;
+	}
+
+	bool FTestDelaunay3::ProcessParallel(const TConstArrayView<FVector> Positions, const int32 NumBlocks)
+	{
+		// Below this, the border set is most of the block and splitting doesn't pay off
+		constexpr int32 MinBlockPoints = 1024;
+
+		const int32 NumPoints = Positions.Num();
+
+		int32 NumLevels = NumBlocks >= 2 ? FMath::FloorLog2(static_cast<uint32>(NumBlocks)) : 0;
+		while (NumLevels > 0 && (NumPoints >> NumLevels) < MinBlockPoints) { NumLevels--; }
+
+		if (NumLevels == 0) { return Process(Positions); }
+
+		Reset();
+
+		FBox Bounds(ForceInit);
+		for (const FVector& P : Positions) { Bounds += P; }
+		const double Tolerance = Bounds.GetSize().GetMax() * 1e-9;
+
+		// kd split at the median of the longest axis. Points on a split plane may land on either side:
+		// final circumspheres stay strictly inside their region, so they can't reach them.
+		TArray<int32> Order;
+		Order.SetNumUninitialized(NumPoints);
+		for (int32 i = 0; i < NumPoints; i++) { Order[i] = i; }
+
+		TArray<FKdBlock> Blocks;
+		Blocks.Add({0, NumPoints});
+
+		for (int32 Level = 0; Level < NumLevels; Level++)
+		{
+			TArray<FKdBlock> Children;
+			Children.SetNum(Blocks.Num() * 2);
+
+			ParallelFor(
+				Blocks.Num(), [&](const int32 i)
+				{
+					const FKdBlock& Block = Blocks[i];
+
+					FBox BlockBounds(ForceInit);
+					for (int32 j = Block.Begin; j < Block.End; j++) { BlockBounds += Positions[Order[j]]; }
+
+					const FVector Size = BlockBounds.GetSize();
+					const int32 Axis = Size.X >= Size.Y && Size.X >= Size.Z ? 0 : Size.Y >= Size.Z ? 1 : 2;
+
+					Algo::Sort(
+						TArrayView<int32>(Order.GetData() + Block.Begin, Block.End - Block.Begin),
+						[&](const int32 A, const int32 B) { return Positions[A][Axis] < Positions[B][Axis]; });
+
+					const int32 Mid = Block.Begin + (Block.End - Block.Begin) / 2;
+					const double Split = Positions[Order[Mid]][Axis];
+
+					FKdBlock& Lower = Children[i * 2];
+					Lower = {Block.Begin, Mid, Block.Region};
+					Lower.Region.Max[Axis] = Split;
+
+					FKdBlock& Upper = Children[i * 2 + 1];
+					Upper = {Mid, Block.End, Block.Region};
+					Upper.Region.Min[Axis] = Split;
+				});
+
+			Blocks = MoveTemp(Children);
+		}
+
+		// Tetrahedralize each block, keep its final tetrahedra and flag the points they don't fully surround
+		enum EPointState : uint8 { Unconnected = 0, Settled = 1, Border = 2 };
+
+		TArray<uint8> PointState;
+		PointState.SetNumZeroed(NumPoints);
+
+		TArray<int32> PointBlock;
+		PointBlock.SetNumUninitialized(NumPoints);
+
+		TArray<TArray<FIntVector4>> BlockTetrahedra;
+		BlockTetrahedra.SetNum(Blocks.Num());
+
+		TArray<int32> BlockDuplicates;
+		BlockDuplicates.SetNumZeroed(Blocks.Num());
+
+		ParallelFor(
+			Blocks.Num(), [&](const int32 b)
+			{
+				const FKdBlock& Block = Blocks[b];
+
+				// Input order within the block, so the same copy of a duplicate position is kept as in Process
+				const TArrayView<int32> BlockPoints(Order.GetData() + Block.Begin, Block.End - Block.Begin);
+				Algo::Sort(BlockPoints);
+
+				TArray<FVector> LocalPositions;
+				LocalPositions.SetNumUninitialized(BlockPoints.Num());
+				for (int32 i = 0; i < BlockPoints.Num(); i++)
+				{
+					PointBlock[BlockPoints[i]] = b;
+					LocalPositions[i] = Positions[BlockPoints[i]];
+				}
+
+				FTestDelaunay3 Local;
+				if (!Local.Tetrahedralize(LocalPositions))
+				{
+					for (const int32 Point : BlockPoints) { PointState[Point] = Border; }
+					return;
+				}
+
+				BlockDuplicates[b] = Local.Duplicates;
+
+				TArray<FIntVector4>& Final = BlockTetrahedra[b];
+				for (int32 t = 0; t < Local.NumTetrahedronSlots(); t++)
+				{
+					if (Local.IsFree(t)) { continue; }
+
+					const int32* Corners = &Local.TetVtx[t * 4];
+					if (Local.IsGhost(t))
+					{
+						for (int32 k = 0; k < 4; k++) { if (Corners[k] != GhostVertex) { PointState[BlockPoints[Corners[k]]] = Border; } }
+						continue;
+					}
+
+					const FIntVector4 Tetrahedron(BlockPoints[Corners[0]], BlockPoints[Corners[1]], BlockPoints[Corners[2]], BlockPoints[Corners[3]]);
+					const bool bFinal = IsFinal(Tetrahedron, Positions, Block.Region, Tolerance);
+					if (bFinal) { Final.Add(Tetrahedron); }
+
+					for (int32 k = 0; k < 4; k++)
+					{
+						uint8& State = PointState[BlockPoints[Corners[k]]];
+						if (!bFinal) { State = Border; }
+						else if (State == Unconnected) { State = Settled; }
+					}
+				}
+			});
+
+		for (const int32 Count : BlockDuplicates) { Duplicates += Count; }
+
+		// Every tetrahedron that isn't final only has border vertices, so tetrahedralizing the border
+		// set finds it. What that also creates across the settled interiors has a settled point in its circumsphere.
+		TArray<int32> BorderMap;
+		TArray<int32> SettledPoints;
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			if (PointState[i] == Border) { BorderMap.Add(i); }
+			else if (PointState[i] == Settled) { SettledPoints.Add(i); }
+		}
+
+		BorderPoints = BorderMap.Num();
+
+		TArray<FVector> BorderPositions;
+		BorderPositions.SetNumUninitialized(BorderMap.Num());
+		for (int32 i = 0; i < BorderMap.Num(); i++) { BorderPositions[i] = Positions[BorderMap[i]]; }
+
+		FTestDelaunay3 BorderDelaunay;
+		if (!BorderDelaunay.Tetrahedralize(BorderPositions)) { return Process(Positions); }
+
+		// Copies on a split plane can land in different blocks, then only the border set sees them together
+		Duplicates += BorderDelaunay.Duplicates;
+
+		FPointGrid SettledGrid;
+		SettledGrid.Build(Positions, SettledPoints);
+
+		TArray<FIntVector4> BorderTetrahedra;
+		BorderTetrahedra.SetNumUninitialized(BorderDelaunay.NumTetrahedronSlots());
+
+		TArray<int8> Keep;
+		Keep.SetNumZeroed(BorderDelaunay.NumTetrahedronSlots());
+
+		ParallelFor(
+			BorderDelaunay.NumTetrahedronSlots(), [&](const int32 t)
+			{
+				if (BorderDelaunay.IsFree(t) || BorderDelaunay.IsGhost(t)) { return; }
+
+				const int32* Corners = &BorderDelaunay.TetVtx[t * 4];
+				const FIntVector4 Tetrahedron(BorderMap[Corners[0]], BorderMap[Corners[1]], BorderMap[Corners[2]], BorderMap[Corners[3]]);
+
+				// Already emitted by its block
+				const int32 Block = PointBlock[Tetrahedron.X];
+				if (PointBlock[Tetrahedron.Y] == Block && PointBlock[Tetrahedron.Z] == Block && PointBlock[Tetrahedron.W] == Block
+					&& IsFinal(Tetrahedron, Positions, Blocks[Block].Region, Tolerance))
+				{
+					return;
+				}
+
+				FVector Center;
+				double RadiusSquared;
+				if (!SortedCircumsphere(Tetrahedron, Positions, Center, RadiusSquared)) { return; }
+				if (SettledGrid.AnyInside(Positions, Tetrahedron, Center, RadiusSquared, Tolerance)) { return; }
+
+				BorderTetrahedra[t] = Tetrahedron;
+				Keep[t] = 1;
+			});
+
+		TArray<FIntVector4> Tetrahedra;
+		for (TArray<FIntVector4>& Final : BlockTetrahedra) { Tetrahedra.Append(Final); }
+		for (int32 t = 0; t < Keep.Num(); t++) { if (Keep[t]) { Tetrahedra.Add(BorderTetrahedra[t]); } }
+
+		// Extreme points are hull vertices of their block too, so they are all in the border set
+		TArray<int32> Hull;
+		BorderDelaunay.GatherHull(Hull, BorderMap);
+		BuildOutput(Tetrahedra, Hull);
+
+		// No mesh of its own, but the positions back GetVertices
+		Vertices.Append(Positions.GetData(), NumPoints);
+
+		IsValid = true;
+		return true;
+	}
+
+	void FTestDelaunay3::Reset()
+	{
+		Sites.Reset();
+		DelaunayEdges.Reset();
+		DelaunayHull.Reset();
+		Flat.Reset();
+		IsValid = false;
+
+		Vertices.Reset();
+		TetVtx.Reset();
+		TetAdjacency.Reset();
+		FreeTetrahedra.Reset();
+		TetStamp.Reset();
+
+		LastTetrahedron = 0;
+		Duplicates = 0;
+		BorderPoints = 0;
+		CurrentStamp = 0;
+	}
+
+	bool FTestDelaunay3::Tetrahedralize(const TConstArrayView<FVector> Positions)
+	{
+		const int32 NumVertices = Positions.Num();
+		if (NumVertices < 4) { return false; }
+
+		Vertices.Append(Positions.GetData(), NumVertices);
+
+		// Morton order over a cube around the bounds
+		FBox Bounds(ForceInit);
+		for (const FVector& P : Vertices) { Bounds += P; }
+
+		constexpr double MaxCoord = (1 << 21) - 1;
+		const double Extent = Bounds.GetSize().GetMax();
+		const double Scale = Extent > 0 ? MaxCoord / Extent : 0;
+
+		TArray<PCGEx::FIndexKey> Keys;
+		Keys.SetNumUninitialized(NumVertices);
+		ParallelFor(
+			NumVertices, [&](const int32 i)
+			{
+				const FVector Local = (Vertices[i] - Bounds.Min) * Scale;
+				Keys[i] = {
+					i,
+					SpreadBits3(static_cast<uint64>(FMath::Min(Local.X, MaxCoord)))
+					| (SpreadBits3(static_cast<uint64>(FMath::Min(Local.Y, MaxCoord))) << 1)
+					| (SpreadBits3(static_cast<uint64>(FMath::Min(Local.Z, MaxCoord))) << 2)
+				};
+			});
+
+		PCGExSortingHelpers::RadixSort(Keys);
+
+		TArray<int32> Order;
+		Order.SetNumUninitialized(NumVertices);
+		for (int32 i = 0; i < NumVertices; i++) { Order[i] = Keys[i].Index; }
+		Keys.Empty();
+
+		int32 Seeds[4];
+		if (!InitializeFirstTetrahedron(Order, Seeds)) { return false; }
+
+		for (const int32 Vertex : Order)
+		{
+			if (Vertex == Seeds[0] || Vertex == Seeds[1] || Vertex == Seeds[2] || Vertex == Seeds[3]) { continue; }
+			if (!InsertVertex(Vertex)) { Duplicates++; }
+		}
+
+		return true;
+	}
+
+	bool FTestDelaunay3::InitializeFirstTetrahedron(const TConstArrayView<int32> Order, int32 (&OutSeeds)[4])
+	{
+		const int32 A = Order[0];
+		int32 B = INDEX_NONE;
+		int32 C = INDEX_NONE;
+		int32 D = INDEX_NONE;
+
+		for (const int32 Vertex : Order)
+		{
+			if (Vertices[Vertex] != Vertices[A])
+			{
+				B = Vertex;
+				break;
+			}
+		}
+
+		if (B == INDEX_NONE) { return false; }
+
+		for (const int32 Vertex : Order)
+		{
+			if (!FVector::CrossProduct(Vertices[B] - Vertices[A], Vertices[Vertex] - Vertices[A]).IsZero())
+			{
+				C = Vertex;
+				break;
+			}
+		}
+
+		if (C == INDEX_NONE) { return false; }
+
+		for (const int32 Vertex : Order)
+		{
+			// The triple product of A, B, C with one of them is not exactly zero in floating point
+			if (Vertex != A && Vertex != B && Vertex != C && Orient3D(Vertices[A], Vertices[B], Vertices[C], Vertices[Vertex]) != 0)
+			{
+				D = Vertex;
+				break;
+			}
+		}
+
+		if (D == INDEX_NONE) { return false; }
+		if (Orient3D(Vertices[A], Vertices[B], Vertices[C], Vertices[D]) < 0) { Swap(B, C); }
+
+		const int32 ExpectedTetrahedra = 7 * Vertices.Num() + 8;
+		TetVtx.Reserve(ExpectedTetrahedra * 4);
+		TetAdjacency.Reserve(ExpectedTetrahedra * 4);
+		TetStamp.Reserve(ExpectedTetrahedra);
+
+		const int32 V[4] = {A, B, C, D};
+
+		const int32 First = AllocateTetrahedron();
+		for (int32 k = 0; k < 4; k++) { TetVtx[First * 4 + k] = V[k]; }
+
+		// Ghost k sits across face k, with the face reversed so the vertex at infinity is on its positive side
+		NewTetrahedra.Reset();
+		for (int32 k = 0; k < 4; k++)
+		{
+			const int32 Ghost = AllocateTetrahedron();
+			TetVtx[Ghost * 4] = V[FaceCorners[k][0]];
+			TetVtx[Ghost * 4 + 1] = V[FaceCorners[k][2]];
+			TetVtx[Ghost * 4 + 2] = V[FaceCorners[k][1]];
+			TetVtx[Ghost * 4 + 3] = GhostVertex;
+			Link(First * 4 + k, Ghost * 4 + 3);
+			NewTetrahedra.Add(Ghost);
+		}
+
+		LinkFan(NewTetrahedra);
+
+		OutSeeds[0] = A;
+		OutSeeds[1] = B;
+		OutSeeds[2] = C;
+		OutSeeds[3] = D;
+
+		LastTetrahedron = First;
+		return true;
+	}
+
+	int32 FTestDelaunay3::Locate(const FVector& P, int32 StartTetrahedron)
+	{
+		if (!TetVtx.IsValidIndex(StartTetrahedron * 4) || IsFree(StartTetrahedron)) { StartTetrahedron = 0; }
+
+		int32 Tetrahedron = StartTetrahedron;
+		if (const int32 Ghost = GetGhostCorner(Tetrahedron); Ghost != INDEX_NONE) { Tetrahedron = TetAdjacency[Tetrahedron * 4 + Ghost] / 4; }
+
+		// Visibility walk, starting each step on a random face so it can't cycle
+		const int32 MaxSteps = NumTetrahedronSlots() + 4;
+		for (int32 Step = 0; Step < MaxSteps; Step++)
+		{
+			const int32* Corners = &TetVtx[Tetrahedron * 4];
+
+			WalkSeed ^= WalkSeed << 13;
+			WalkSeed ^= WalkSeed >> 17;
+			WalkSeed ^= WalkSeed << 5;
+			const int32 Offset = WalkSeed % 4;
+
+			bool bMoved = false;
+			for (int32 k = 0; k < 4; k++)
+			{
+				const int32 Face = (Offset + k) % 4;
+				const int32* Face3 = FaceCorners[Face];
+				if (Orient3D(Vertices[Corners[Face3[0]]], Vertices[Corners[Face3[1]]], Vertices[Corners[Face3[2]]], P) < 0)
+				{
+					Tetrahedron = TetAdjacency[Tetrahedron * 4 + Face] / 4;
+					bMoved = true;
+					break;
+				}
+			}
+
+			if (!bMoved || IsGhost(Tetrahedron)) { return Tetrahedron; }
+		}
+
+		// Inconsistent orientations, fall back to any tetrahedron in conflict
+		for (int32 i = 0; i < NumTetrahedronSlots(); i++)
+		{
+			if (!IsFree(i) && IsInConflict(i, P)) { return i; }
+		}
+
+		return INDEX_NONE;
+	}
+
+	bool FTestDelaunay3::IsInConflict(const int32 Tetrahedron, const FVector& P) const
+	{
+		const int32* Corners = &TetVtx[Tetrahedron * 4];
+
+		const int32 Ghost = GetGhostCorner(Tetrahedron);
+		if (Ghost == INDEX_NONE)
+		{
+			return InSphere(Vertices[Corners[0]], Vertices[Corners[1]], Vertices[Corners[2]], Vertices[Corners[3]], P) > 0;
+		}
+
+		// Ghost: conflict if P is strictly outside its hull face. In the face plane, the circumcircle of the face
+		// is where the circumsphere of the real neighbor cuts the plane, so defer to that neighbor.
+		const double Orientation = Orient3D(
+			Vertices[Corners[FaceCorners[Ghost][0]]],
+			Vertices[Corners[FaceCorners[Ghost][1]]],
+			Vertices[Corners[FaceCorners[Ghost][2]]], P);
+
+		if (Orientation != 0) { return Orientation > 0; }
+		return IsInConflict(TetAdjacency[Tetrahedron * 4 + Ghost] / 4, P);
+	}
+
+	bool FTestDelaunay3::InsertVertex(const int32 Vertex)
+	{
+		const FVector& P = Vertices[Vertex];
+
+		int32 Start = Locate(P, LastTetrahedron);
+		if (Start == INDEX_NONE) { return false; }
+
+		for (int32 k = 0; k < 4; k++)
+		{
+			const int32 Other = TetVtx[Start * 4 + k];
+			if (Other != GhostVertex && Vertices[Other] == P) { return false; }
+		}
+
+		if (!IsInConflict(Start, P))
+		{
+			Start = INDEX_NONE;
+			for (int32 i = 0; i < NumTetrahedronSlots(); i++)
+			{
+				if (!IsFree(i) && IsInConflict(i, P))
+				{
+					Start = i;
+					break;
+				}
+			}
+
+			if (Start == INDEX_NONE) { return false; }
+		}
+
+		// Cavity: every tetrahedron in conflict, grown from the one containing P
+		CurrentStamp++;
+		CavityTetrahedra.Reset();
+		CavityStack.Reset();
+		BoundaryFaces.Reset();
+
+		TetStamp[Start] = CurrentStamp;
+		CavityStack.Add(Start);
+
+		while (!CavityStack.IsEmpty())
+		{
+			const int32 Tetrahedron = CavityStack.Pop(EAllowShrinking::No);
+			CavityTetrahedra.Add(Tetrahedron);
+
+			for (int32 k = 0; k < 4; k++)
+			{
+				const int32 Outside = TetAdjacency[Tetrahedron * 4 + k];
+				const int32 Neighbor = Outside / 4;
+				if (TetStamp[Neighbor] == CurrentStamp) { continue; }
+
+				if (IsInConflict(Neighbor, P))
+				{
+					TetStamp[Neighbor] = CurrentStamp;
+					CavityStack.Add(Neighbor);
+				}
+				else
+				{
+					// Boundary face: three corners, face on the outside
+					const int32* Corners = &TetVtx[Tetrahedron * 4];
+					BoundaryFaces.Add(Corners[FaceCorners[k][0]]);
+					BoundaryFaces.Add(Corners[FaceCorners[k][1]]);
+					BoundaryFaces.Add(Corners[FaceCorners[k][2]]);
+					BoundaryFaces.Add(Outside);
+				}
+			}
+		}
+
+		// Fan around P, one tetrahedron per boundary face, reusing the cavity slots
+		const int32 NumBoundary = BoundaryFaces.Num() / 4;
+
+		NewTetrahedra.Reset();
+		for (int32 i = 0; i < NumBoundary; i++) { NewTetrahedra.Add(i < CavityTetrahedra.Num() ? CavityTetrahedra[i] : AllocateTetrahedron()); }
+		for (int32 i = NumBoundary; i < CavityTetrahedra.Num(); i++) { FreeTetrahedron(CavityTetrahedra[i]); }
+
+		for (int32 i = 0; i < NumBoundary; i++)
+		{
+			const int32 Base = NewTetrahedra[i] * 4;
+			TetVtx[Base] = BoundaryFaces[i * 4];
+			TetVtx[Base + 1] = BoundaryFaces[i * 4 + 1];
+			TetVtx[Base + 2] = BoundaryFaces[i * 4 + 2];
+			TetVtx[Base + 3] = Vertex;
+			Link(Base + 3, BoundaryFaces[i * 4 + 3]);
+		}
+
+		LinkFan(NewTetrahedra);
+
+		LastTetrahedron = NewTetrahedra[0];
+		for (const int32 Tetrahedron : NewTetrahedra)
+		{
+			if (!IsGhost(Tetrahedron))
+			{
+				LastTetrahedron = Tetrahedron;
+				break;
+			}
+		}
+
+		return true;
+	}
+
+	int32 FTestDelaunay3::AllocateTetrahedron()
+	{
+		if (!FreeTetrahedra.IsEmpty()) { return FreeTetrahedra.Pop(EAllowShrinking::No); }
+
+		const int32 Tetrahedron = NumTetrahedronSlots();
+		TetVtx.AddUninitialized(4);
+		TetAdjacency.AddUninitialized(4);
+		TetStamp.Add(0);
+		return Tetrahedron;
+	}
+
+	void FTestDelaunay3::FreeTetrahedron(const int32 Tetrahedron)
+	{
+		for (int32 k = 0; k < 4; k++)
+		{
+			TetVtx[Tetrahedron * 4 + k] = FreeVertex;
+			TetAdjacency[Tetrahedron * 4 + k] = INDEX_NONE;
+		}
+		FreeTetrahedra.Add(Tetrahedron);
+	}
+
+	void FTestDelaunay3::LinkFan(const TConstArrayView<int32> Fan)
+	{
+		// Face k < 3 holds the apex and the edge between the two other base corners; each edge is shared by two fan members
+		FanFaces.Reset();
+		for (const int32 Tetrahedron : Fan)
+		{
+			const int32 Base = Tetrahedron * 4;
+			for (int32 k = 0; k < 3; k++)
+			{
+				const uint64 Edge = PCGEx::H64U(static_cast<uint32>(TetVtx[Base + (k + 1) % 3]), static_cast<uint32>(TetVtx[Base + (k + 2) % 3]));
+				if (const int32* Other = FanFaces.Find(Edge))
+				{
+					Link(Base + k, *Other);
+					FanFaces.Remove(Edge);
+				}
+				else
+				{
+					FanFaces.Add(Edge, Base + k);
+				}
+			}
+		}
+	}
+
+	void FTestDelaunay3::GatherTetrahedra(TArray<FIntVector4>& OutTetrahedra, const TConstArrayView<int32> VertexMap) const
+	{
+		auto Map = [&](const int32 Vertex) { return VertexMap.IsEmpty() ? Vertex : VertexMap[Vertex]; };
+
+		OutTetrahedra.Reset();
+		OutTetrahedra.Reserve(NumTetrahedronSlots());
+		for (int32 t = 0; t < NumTetrahedronSlots(); t++)
+		{
+			if (IsFree(t) || IsGhost(t)) { continue; }
+
+			const int32* Corners = &TetVtx[t * 4];
+			OutTetrahedra.Emplace(Map(Corners[0]), Map(Corners[1]), Map(Corners[2]), Map(Corners[3]));
+		}
+	}
+
+	void FTestDelaunay3::GatherHull(TArray<int32>& OutHull, const TConstArrayView<int32> VertexMap) const
+	{
+		for (int32 t = 0; t < NumTetrahedronSlots(); t++)
+		{
+			if (IsFree(t) || !IsGhost(t)) { continue; }
+
+			for (int32 k = 0; k < 4; k++)
+			{
+				const int32 Vertex = TetVtx[t * 4 + k];
+				if (Vertex != GhostVertex) { OutHull.Add(VertexMap.IsEmpty() ? Vertex : VertexMap[Vertex]); }
+			}
+		}
+	}
+
+	void FTestDelaunay3::BuildOutput(const TConstArrayView<FIntVector4> Tetrahedra, TArray<int32>& Hull)
+	{
+		const int32 NumSites = Tetrahedra.Num();
+
+		auto WriteEdgeKeys = [](const int32* Vtx, uint64* OutKeys)
+		{
+			int32 Count = 0;
+			for (int32 a = 0; a < 3; a++)
+			{
+				for (int32 b = a + 1; b < 4; b++) { OutKeys[Count++] = PCGEx::H64U(Vtx[a], Vtx[b]); }
+			}
+		};
+
+		TArray<uint64> EdgeKeys;
+		EdgeKeys.SetNumUninitialized(NumSites * 6);
+
+		if (bFlatOutput)
+		{
+			Flat.Reset();
+			Flat.SiteVtx.SetNumUninitialized(NumSites * 4);
+
+			ParallelFor(
+				NumSites, [&](const int32 i)
+				{
+					int32* Vtx = Flat.SiteVtx.GetData() + i * 4;
+					Vtx[0] = Tetrahedra[i].X;
+					Vtx[1] = Tetrahedra[i].Y;
+					Vtx[2] = Tetrahedra[i].Z;
+					Vtx[3] = Tetrahedra[i].W;
+					Algo::Sort(TArrayView<int32>(Vtx, 4));
+
+					WriteEdgeKeys(Vtx, EdgeKeys.GetData() + i * 6);
+				});
+
+			TestEdgeDedup::DedupSorted(EdgeKeys, Flat.Edges);
+
+			Algo::Sort(Hull);
+			Hull.SetNum(Algo::Unique(Hull));
+			Flat.Hull = MoveTemp(Hull);
+			return;
+		}
+
+		Sites.Reset(NumSites);
+
+		for (int32 i = 0; i < NumSites; i++)
+		{
+			const PCGExMath::Geo::FDelaunaySite3& Site = Sites.Emplace_GetRef(Tetrahedra[i], i);
+			WriteEdgeKeys(Site.Vtx, EdgeKeys.GetData() + i * 6);
+		}
+
+		TArray<uint64> UniqueEdges;
+		TestEdgeDedup::DedupSorted(EdgeKeys, UniqueEdges);
+
+		DelaunayEdges.Reset();
+		DelaunayEdges.Reserve(UniqueEdges.Num());
+		DelaunayEdges.Append(UniqueEdges);
+
+		DelaunayHull.Reset();
+		DelaunayHull.Append(Hull);
+	}
+
+	bool FTestDelaunay3::Validate(FString* OutError, const bool bCheckEmptySpheres) const
+	{
+		auto Fail = [&](const FString& Error)
+		{
+			if (OutError) { *OutError = Error; }
+			return false;
+		};
+
+		auto SortedFace = [&](const int32 Tetrahedron, const int32 Face)
+		{
+			FIntVector Corners(
+				TetVtx[Tetrahedron * 4 + FaceCorners[Face][0]],
+				TetVtx[Tetrahedron * 4 + FaceCorners[Face][1]],
+				TetVtx[Tetrahedron * 4 + FaceCorners[Face][2]]);
+			Algo::Sort(TArrayView<int32>(&Corners.X, 3));
+			return Corners;
+		};
+
+		const int32 NumSlots = NumTetrahedronSlots();
+		if (NumSlots == 0 && IsValid) { return Fail(TEXT("No tetrahedral mesh, ProcessParallel output is checked by ValidateSites")); }
+
+		for (int32 t = 0; t < NumSlots; t++)
+		{
+			if (IsFree(t)) { continue; }
+
+			for (int32 k = 0; k < 4; k++)
+			{
+				const int32 Face = t * 4 + k;
+				const int32 Other = TetAdjacency[Face];
+
+				if (!TetAdjacency.IsValidIndex(Other) || IsFree(Other / 4)) { return Fail(FString::Printf(TEXT("Face %d has no neighbor"), Face)); }
+				if (TetAdjacency[Other] != Face) { return Fail(FString::Printf(TEXT("Face %d adjacency is not symmetric"), Face)); }
+				if (SortedFace(t, k) != SortedFace(Other / 4, Other % 4)) { return Fail(FString::Printf(TEXT("Face %d neighbor has mismatched corners"), Face)); }
+			}
+
+			if (IsGhost(t)) { continue; }
+
+			const FVector& A = Vertices[TetVtx[t * 4]];
+			const FVector& B = Vertices[TetVtx[t * 4 + 1]];
+			const FVector& C = Vertices[TetVtx[t * 4 + 2]];
+			const FVector& D = Vertices[TetVtx[t * 4 + 3]];
+
+			if (Orient3D(A, B, C, D) <= 0) { return Fail(FString::Printf(TEXT("Tetrahedron %d is not positively oriented"), t)); }
+			if (!bCheckEmptySpheres) { continue; }
+
+			for (int32 v = 0; v < Vertices.Num(); v++)
+			{
+				if (InSphere(A, B, C, D, Vertices[v]) > 0)
+				{
+					return Fail(FString::Printf(TEXT("Vertex %d is inside the circumsphere of tetrahedron %d"), v, t));
+				}
+			}
+		}
+
+		return true;
+	}
+
+	bool FTestDelaunay3::ValidateSites(FString* OutError, const bool bCheckEmptySpheres) const
+	{
+		auto Fail = [&](const FString& Error)
+		{
+			if (OutError) { *OutError = Error; }
+			return false;
+		};
+
+		const int32 NumVertices = Vertices.Num();
+		const int32 NumSites = bFlatOutput ? Flat.NumSites() : Sites.Num();
+
+		// Positively oriented quads, from either output
+		TArray<FIntVector4> Tetrahedra;
+		Tetrahedra.SetNumUninitialized(NumSites);
+
+		TArray<bool> Used;
+		Used.Init(false, NumVertices);
+
+		for (int32 s = 0; s < NumSites; s++)
+		{
+			const int32* Vtx = bFlatOutput ? Flat.SiteVtx.GetData() + s * 4 : Sites[s].Vtx;
+			FIntVector4& Tetrahedron = Tetrahedra[s];
+			Tetrahedron = FIntVector4(Vtx[0], Vtx[1], Vtx[2], Vtx[3]);
+
+			for (int32 k = 0; k < 4; k++)
+			{
+				if (!Vertices.IsValidIndex(Vtx[k])) { return Fail(FString::Printf(TEXT("Site %d has an invalid vertex"), s)); }
+				Used[Vtx[k]] = true;
+			}
+
+			const double Orientation = Orient3D(Vertices[Tetrahedron.X], Vertices[Tetrahedron.Y], Vertices[Tetrahedron.Z], Vertices[Tetrahedron.W]);
+			if (Orientation == 0) { return Fail(FString::Printf(TEXT("Site %d is flat"), s)); }
+			if (Orientation < 0) { Swap(Tetrahedron.Y, Tetrahedron.Z); }
+		}
+
+		int32 NumUsed = 0;
+		for (const bool bUsed : Used) { NumUsed += bUsed; }
+		if (NumUsed + Duplicates != NumVertices) { return Fail(FString::Printf(TEXT("%d input points are neither vertices nor duplicates"), NumVertices - Duplicates - NumUsed)); }
+
+		// Every face of every site, keyed by its sorted corners
+		struct FFaceEntry
+		{
+			FIntVector Key;
+			int32 Site;
+			int32 Corner;
+		};
+
+		TArray<FFaceEntry> Faces;
+		Faces.SetNumUninitialized(NumSites * 4);
+
+		for (int32 s = 0; s < NumSites; s++)
+		{
+			const int32* Corners = &Tetrahedra[s].X;
+			for (int32 k = 0; k < 4; k++)
+			{
+				FFaceEntry& Entry = Faces[s * 4 + k];
+				Entry.Key = FIntVector(Corners[FaceCorners[k][0]], Corners[FaceCorners[k][1]], Corners[FaceCorners[k][2]]);
+				Algo::Sort(TArrayView<int32>(&Entry.Key.X, 3));
+				Entry.Site = s;
+				Entry.Corner = k;
+			}
+		}
+
+		Algo::Sort(
+			Faces, [](const FFaceEntry& A, const FFaceEntry& B)
+			{
+				if (A.Key.X != B.Key.X) { return A.Key.X < B.Key.X; }
+				if (A.Key.Y != B.Key.Y) { return A.Key.Y < B.Key.Y; }
+				return A.Key.Z < B.Key.Z;
+			});
+
+		auto GetFace = [&](const FFaceEntry& Entry, const FVector*& OutA, const FVector*& OutB, const FVector*& OutC)
+		{
+			const int32* Corners = &Tetrahedra[Entry.Site].X;
+			OutA = &Vertices[Corners[FaceCorners[Entry.Corner][0]]];
+			OutB = &Vertices[Corners[FaceCorners[Entry.Corner][1]]];
+			OutC = &Vertices[Corners[FaceCorners[Entry.Corner][2]]];
+		};
+
+		// Interior faces separate exactly two sites; boundary faces must be hull facets, with no point
+		// beyond them, and enclose the hull volume the sites must fill
+		TArray<int32> BoundaryFaces;
+
+		for (int32 i = 0; i < Faces.Num();)
+		{
+			int32 End = i + 1;
+			while (End < Faces.Num() && Faces[End].Key == Faces[i].Key) { End++; }
+
+			const FIntVector& Key = Faces[i].Key;
+			if (End - i > 2) { return Fail(FString::Printf(TEXT("Face (%d, %d, %d) is shared by %d sites"), Key.X, Key.Y, Key.Z, End - i)); }
+
+			if (End - i == 2)
+			{
+				const FVector *A, *B, *C;
+				GetFace(Faces[i], A, B, C);
+
+				const FFaceEntry& Other = Faces[i + 1];
+				const int32 Opposite = (&Tetrahedra[Other.Site].X)[Other.Corner];
+				if (Orient3D(*A, *B, *C, Vertices[Opposite]) >= 0)
+				{
+					return Fail(FString::Printf(TEXT("Sites %d and %d overlap across face (%d, %d, %d)"), Faces[i].Site, Other.Site, Key.X, Key.Y, Key.Z));
+				}
+			}
+			else { BoundaryFaces.Add(i); }
+
+			i = End;
+		}
+
+		TArray<int32> Beyond;
+		Beyond.Init(INDEX_NONE, BoundaryFaces.Num());
+
+		ParallelFor(
+			BoundaryFaces.Num(), [&](const int32 f)
+			{
+				const FVector *A, *B, *C;
+				GetFace(Faces[BoundaryFaces[f]], A, B, C);
+
+				for (int32 v = 0; v < NumVertices; v++)
+				{
+					if (Orient3D(*A, *B, *C, Vertices[v]) < 0)
+					{
+						Beyond[f] = v;
+						return;
+					}
+				}
+			});
+
+		const FVector& Inside = Vertices[Tetrahedra.IsEmpty() ? 0 : Tetrahedra[0].X];
+		double HullVolume = 0;
+
+		for (int32 f = 0; f < BoundaryFaces.Num(); f++)
+		{
+			const FIntVector& Key = Faces[BoundaryFaces[f]].Key;
+			if (Beyond[f] != INDEX_NONE) { return Fail(FString::Printf(TEXT("Boundary face (%d, %d, %d) is not on the hull, vertex %d is beyond it"), Key.X, Key.Y, Key.Z, Beyond[f])); }
+
+			const FVector *A, *B, *C;
+			GetFace(Faces[BoundaryFaces[f]], A, B, C);
+			HullVolume += Orient3D(*A, *B, *C, Inside);
+		}
+
+		double Volume = 0;
+		for (const FIntVector4& Tetrahedron : Tetrahedra)
+		{
+			Volume += Orient3D(Vertices[Tetrahedron.X], Vertices[Tetrahedron.Y], Vertices[Tetrahedron.Z], Vertices[Tetrahedron.W]);
+		}
+
+		if (FMath::Abs(Volume - HullVolume) > HullVolume * 1e-9)
+		{
+			return Fail(FString::Printf(TEXT("Sites fill a volume of %f, the hull holds %f"), Volume / 6, HullVolume / 6));
+		}
+
+		if (!bCheckEmptySpheres) { return true; }
+
+		// Exact in-sphere against every vertex; the grid only skips cells outside the padded floating circumsphere
+		TArray<int32> AllPoints;
+		AllPoints.SetNumUninitialized(NumVertices);
+		for (int32 v = 0; v < NumVertices; v++) { AllPoints[v] = v; }
+
+		FPointGrid Grid;
+		Grid.Build(Vertices, AllPoints);
+
+		FBox Bounds(ForceInit);
+		for (const FVector& P : Vertices) { Bounds += P; }
+		const double Tolerance = Bounds.GetSize().GetMax() * 1e-9;
+
+		TArray<int8> NotEmpty;
+		NotEmpty.SetNumZeroed(NumSites);
+
+		ParallelFor(
+			NumSites, [&](const int32 s)
+			{
+				const FIntVector4& Tetrahedron = Tetrahedra[s];
+
+				FVector Center;
+				double RadiusSquared;
+				if (Circumsphere(Vertices[Tetrahedron.X], Vertices[Tetrahedron.Y], Vertices[Tetrahedron.Z], Vertices[Tetrahedron.W], Center, RadiusSquared))
+				{
+					NotEmpty[s] = Grid.AnyInside(Vertices, Tetrahedron, Center, RadiusSquared, Tolerance);
+					return;
+				}
+
+				// Too flat for a floating circumsphere, test every vertex
+				for (int32 v = 0; v < NumVertices; v++)
+				{
+					if (InSphere(Vertices[Tetrahedron.X], Vertices[Tetrahedron.Y], Vertices[Tetrahedron.Z], Vertices[Tetrahedron.W], Vertices[v]) > 0)
+					{
+						NotEmpty[s] = 1;
+						return;
+					}
+				}
+			});
+
+		for (int32 s = 0; s < NumSites; s++)
+		{
+			if (NotEmpty[s]) { return Fail(FString::Printf(TEXT("A vertex is inside the circumsphere of site %d"), s)); }
+		}
+
+		return true;
+	}
+
+#pragma endregion
+}
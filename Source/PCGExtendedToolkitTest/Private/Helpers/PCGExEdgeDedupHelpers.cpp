@@ -0,0 +1,86 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Helpers/PCGExEdgeDedupHelpers.h"
+#include "PCGExH.h"
+#include "Sorting/PCGExSortingHelpers.h"
+
+namespace PCGExTest::TestEdgeDedup
+{
+	namespace
+	{
+		FORCEINLINE bool IsSelfLoop(const uint64 Key) { return PCGEx::H64A(Key) == PCGEx::H64B(Key); }
+	}
+
+	int32 DedupSorted(const TConstArrayView<uint64> Keys, TArray<uint64>& OutUniqueKeys, TArray<int32>* OutFirstIndex)
+	{
+		OutUniqueKeys.Reset();
+		if (OutFirstIndex) { OutFirstIndex->Reset(); }
+
+		TArray<PCGEx::FIndexKey> Sorted;
+		Sorted.SetNumUninitialized(Keys.Num());
+		for (int32 i = 0; i < Keys.Num(); i++) { Sorted[i] = {i, Keys[i]}; }
+
+		// Stable, so the first entry of each run is the first occurrence
+		PCGExSortingHelpers::RadixSort(Sorted);
+
+		OutUniqueKeys.Reserve(Keys.Num());
+		if (OutFirstIndex) { OutFirstIndex->Reserve(Keys.Num()); }
+
+		for (int32 i = 0; i < Sorted.Num(); i++)
+		{
+			const uint64 Key = Sorted[i].Key;
+			if ((i > 0 && Sorted[i - 1].Key == Key) || IsSelfLoop(Key)) { continue; }
+
+			OutUniqueKeys.Add(Key);
+			if (OutFirstIndex) { OutFirstIndex->Add(Sorted[i].Index); }
+		}
+
+		return OutUniqueKeys.Num();
+	}
+
+	int32 DedupHashed(const TConstArrayView<uint64> Keys, TArray<uint64>& OutUniqueKeys)
+	{
+		OutUniqueKeys.Reset();
+
+		TSet<uint64> Seen;
+		Seen.Reserve(Keys.Num());
+
+		for (const uint64 Key : Keys)
+		{
+			if (IsSelfLoop(Key)) { continue; }
+
+			bool bAlreadySet = false;
+			Seen.Add(Key, &bAlreadySet);
+			if (!bAlreadySet) { OutUniqueKeys.Add(Key); }
+		}
+
+		return OutUniqueKeys.Num();
+	}
+
+	void BuildAdjacency(const int32 NumNodes, const TConstArrayView<uint64> UniqueKeys, TArray<int32>& OutOffsets, TArray<PCGExGraphs::FLink>& OutLinks)
+	{
+		const int32 NumEdges = UniqueKeys.Num();
+
+		// Degrees, then exclusive prefix sum
+		OutOffsets.SetNumZeroed(NumNodes + 1);
+		for (const uint64 Key : UniqueKeys)
+		{
+			OutOffsets[PCGEx::H64A(Key) + 1]++;
+			OutOffsets[PCGEx::H64B(Key) + 1]++;
+		}
+		for (int32 i = 0; i < NumNodes; i++) { OutOffsets[i + 1] += OutOffsets[i]; }
+
+		// Scatter in edge order
+		TArray<int32> Cursor(OutOffsets.GetData(), NumNodes);
+		OutLinks.SetNumUninitialized(NumEdges * 2);
+
+		for (int32 Edge = 0; Edge < NumEdges; Edge++)
+		{
+			const int32 A = static_cast<int32>(PCGEx::H64A(UniqueKeys[Edge]));
+			const int32 B = static_cast<int32>(PCGEx::H64B(UniqueKeys[Edge]));
+			OutLinks[Cursor[A]++] = PCGExGraphs::FLink(B, Edge);
+			OutLinks[Cursor[B]++] = PCGExGraphs::FLink(A, Edge);
+		}
+	}
+}
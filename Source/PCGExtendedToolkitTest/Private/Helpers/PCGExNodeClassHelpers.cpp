@@ -0,0 +1,98 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Helpers/PCGExNodeClassHelpers.h"
+#include "Async/ParallelFor.h"
+
+namespace PCGExTest
+{
+#pragma region FCachedNodeClasses
+
+	const FName FCachedNodeClasses::CacheKey = FName(TEXT("PCGExTest.NodeClasses"));
+
+	void FCachedNodeClasses::Build(const FTestCluster& Cluster, const bool bParallel)
+	{
+		const int32 NumNodes = FMath::Max(0, Cluster.NumNodes());
+		NumLinks = NumNodes > 0 ? Cluster.AdjacencyOffsets[NumNodes] : 0;
+		TopologyVersion = Cluster.GetTopologyVersion();
+
+		Classes.SetNumUninitialized(NumNodes);
+		ClassNodes.SetNumUninitialized(NumNodes);
+
+		// Classify and count per chunk, then scatter each chunk at its per-class offsets,
+		// which keeps nodes in ascending order within a class
+		constexpr int32 ChunkSize = 4096;
+		const int32 NumChunks = FMath::DivideAndRoundUp(NumNodes, ChunkSize);
+
+		TArray<int32> ChunkCounts;
+		ChunkCounts.SetNumZeroed(NumChunks * NumClasses);
+
+		const int32* Offsets = Cluster.AdjacencyOffsets.GetData();
+
+		ParallelFor(
+			NumChunks, [&](const int32 Chunk)
+			{
+				int32* Counts = ChunkCounts.GetData() + Chunk * NumClasses;
+				const int32 End = FMath::Min(NumNodes, (Chunk + 1) * ChunkSize);
+				for (int32 i = Chunk * ChunkSize; i < End; i++)
+				{
+					const uint8 Class = FMath::Min(Offsets[i + 1] - Offsets[i], 3);
+					Classes[i] = Class;
+					Counts[Class]++;
+				}
+			}, !bParallel);
+
+		// Exclusive prefix sum, class-major then chunk
+		int32 Total = 0;
+		for (int32 Class = 0; Class < NumClasses; Class++)
+		{
+			ClassOffsets[Class] = Total;
+			for (int32 Chunk = 0; Chunk < NumChunks; Chunk++)
+			{
+				int32& Count = ChunkCounts[Chunk * NumClasses + Class];
+				const int32 ChunkTotal = Count;
+				Count = Total;
+				Total += ChunkTotal;
+			}
+		}
+		ClassOffsets[NumClasses] = Total;
+
+		ParallelFor(
+			NumChunks, [&](const int32 Chunk)
+			{
+				int32* Cursors = ChunkCounts.GetData() + Chunk * NumClasses;
+				const int32 End = FMath::Min(NumNodes, (Chunk + 1) * ChunkSize);
+				for (int32 i = Chunk * ChunkSize; i < End; i++) { ClassNodes[Cursors[Classes[i]]++] = i; }
+			}, !bParallel);
+	}
+
+	bool FCachedNodeClasses::IsUpToDate(const FTestCluster& Cluster) const
+	{
+		return TopologyVersion == Cluster.GetTopologyVersion();
+	}
+
+	int64 GetCachedDataSize(const FCachedNodeClasses& Data)
+	{
+		return sizeof(FCachedNodeClasses) + Data.Classes.GetAllocatedSize() + Data.ClassNodes.GetAllocatedSize();
+	}
+
+#pragma endregion
+
+#pragma region TestNodeClasses
+
+	namespace TestNodeClasses
+	{
+		TSharedPtr<FCachedNodeClasses> GetOrBuildNodeClasses(const TSharedRef<FTestCluster>& Cluster, const bool bStore)
+		{
+			TSharedPtr<FCachedNodeClasses> Cached = Cluster->GetCachedData<FCachedNodeClasses>(FCachedNodeClasses::CacheKey);
+			if (Cached && Cached->IsUpToDate(*Cluster)) { return Cached; }
+
+			Cached = MakeShared<FCachedNodeClasses>();
+			Cached->Build(*Cluster);
+			if (bStore) { Cluster->SetCachedData(FCachedNodeClasses::CacheKey, Cached); }
+			return Cached;
+		}
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,593 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Helpers/PCGExPersistentCacheHelpers.h"
+#include "Hash/CityHash.h"
+#include "Helpers/PCGExChainTestHelpers.h"
+#include "Helpers/PCGExDCELTestHelpers.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace PCGExTest
+{
+	const FName TangentFramesArtifact = FName(TEXT("PCGExTest.TangentFrames"));
+
+	namespace PersistentCacheLocal
+	{
+		constexpr uint32 FileMagic = 0x43415850; // 'PXAC'
+		constexpr int32 FileVersion = 1;
+
+		// Smallest encoded records: entry (hashes, empty name, empty blob), chain without links, link, frame, cell without nodes
+		constexpr int64 MinEntryBytes = sizeof(uint64) + sizeof(uint32) + sizeof(int32) + sizeof(int32);
+		constexpr int64 MinChainBytes = 2 * sizeof(int32) + sizeof(int32) + sizeof(uint8) + sizeof(uint64) + sizeof(int32);
+		constexpr int64 LinkBytes = 2 * sizeof(int32);
+		constexpr int64 FrameBytes = sizeof(FQuat4f);
+		constexpr int64 MinCellBytes = sizeof(int32) + sizeof(double) + sizeof(uint8) + sizeof(int32);
+
+		/** Rejects counts the remaining bytes can't hold, before anything is reserved for them */
+		FORCEINLINE bool CanHold(FArchive& Ar, const int32 Count, const int64 RecordBytes)
+		{
+			return !Ar.IsError() && Count >= 0 && Count <= (Ar.TotalSize() - Ar.Tell()) / RecordBytes;
+		}
+
+		template <typename T>
+		void WriteArray(FArchive& Ar, const TArray<T>& Array)
+		{
+			int32 Num = Array.Num();
+			Ar << Num;
+			for (T Value : Array) { Ar << Value; }
+		}
+
+		/** Counterpart of WriteArray, rejecting more than MaxNum values */
+		template <typename T>
+		bool ReadArray(FArchive& Ar, TArray<T>& Array, const int32 MaxNum)
+		{
+			int32 Num = 0;
+			Ar << Num;
+			if (Num > MaxNum || !CanHold(Ar, Num, sizeof(T))) { return false; }
+
+			Array.SetNumUninitialized(Num);
+			for (T& Value : Array) { Ar << Value; }
+			return !Ar.IsError();
+		}
+
+		/** Streams values through CityHash in fixed-size chunks, so hashing doesn't allocate per cluster size */
+		class FHashStream
+		{
+		public:
+			FHashStream() { Buffer.Reserve(ChunkSize); }
+
+			FORCEINLINE void Add(const int64 Value)
+			{
+				Buffer.Add(Value);
+				if (Buffer.Num() == ChunkSize) { Flush(); }
+			}
+
+			uint64 Finalize()
+			{
+				Flush();
+				return Hash;
+			}
+
+		private:
+			static constexpr int32 ChunkSize = 4096;
+
+			void Flush()
+			{
+				if (Buffer.IsEmpty()) { return; }
+				Hash = CityHash64WithSeed(reinterpret_cast<const char*>(Buffer.GetData()), Buffer.Num() * sizeof(int64), Hash);
+				Buffer.Reset();
+			}
+
+			TArray<int64> Buffer;
+			uint64 Hash = 0;
+		};
+
+		void EncodeTangentFrames(const PCGExClusters::ICachedClusterData& Data, FArchive& Ar)
+		{
+			const PCGExClusters::FCachedTangentFrames& Frames = static_cast<const PCGExClusters::FCachedTangentFrames&>(Data);
+
+			int32 NumFrames = Frames.NodeTangentFrames ? Frames.NodeTangentFrames->Num() : 0;
+			Ar << NumFrames;
+
+			// Single precision is plenty for orientation frames and halves the footprint
+			for (int32 i = 0; i < NumFrames; i++)
+			{
+				FQuat4f Frame((*Frames.NodeTangentFrames)[i]);
+				Ar << Frame;
+			}
+		}
+
+		TSharedPtr<PCGExClusters::ICachedClusterData> DecodeTangentFrames(FArchive& Ar, const TSharedRef<FTestCluster>& Cluster)
+		{
+			int32 NumFrames = 0;
+			Ar << NumFrames;
+			if (NumFrames != Cluster->NumNodes() || !CanHold(Ar, NumFrames, FrameBytes)) { return nullptr; }
+
+			TSharedPtr<TArray<FQuat>> NodeFrames = MakeShared<TArray<FQuat>>();
+			NodeFrames->SetNumUninitialized(NumFrames);
+
+			for (int32 i = 0; i < NumFrames; i++)
+			{
+				FQuat4f Frame;
+				Ar << Frame;
+				(*NodeFrames)[i] = FQuat(Frame);
+			}
+
+			if (Ar.IsError()) { return nullptr; }
+
+			TSharedPtr<PCGExClusters::FCachedTangentFrames> Frames = MakeShared<PCGExClusters::FCachedTangentFrames>();
+			Frames->NodeTangentFrames = NodeFrames;
+			return Frames;
+		}
+
+		void SerializeLink(FArchive& Ar, PCGExGraphs::FLink& Link)
+		{
+			int32 Node = Link.Node;
+			int32 Edge = Link.Edge;
+			Ar << Node;
+			Ar << Edge;
+			Link = PCGExGraphs::FLink(Node, Edge);
+		}
+
+		void EncodeChains(const PCGExClusters::ICachedClusterData& Data, FArchive& Ar)
+		{
+			const FCachedChainData& Cached = static_cast<const FCachedChainData&>(Data);
+
+			// Only unsplit chains are stored; the point index and splits are rebuilt on decode
+			int32 NumChains = Cached.BaseChains.Num();
+			Ar << NumChains;
+
+			for (const TSharedPtr<FTestChain>& Chain : Cached.BaseChains)
+			{
+				PCGExGraphs::FLink Seed = Chain->Seed;
+				SerializeLink(Ar, Seed);
+
+				int32 SingleEdge = Chain->SingleEdge;
+				uint8 Flags = (Chain->bIsClosedLoop ? 1 : 0) | (Chain->bIsLeaf ? 2 : 0);
+				uint64 UniqueHash = Chain->UniqueHash;
+				Ar << SingleEdge;
+				Ar << Flags;
+				Ar << UniqueHash;
+
+				int32 NumLinks = Chain->Links.Num();
+				Ar << NumLinks;
+				for (PCGExGraphs::FLink Link : Chain->Links) { SerializeLink(Ar, Link); }
+			}
+		}
+
+		TSharedPtr<PCGExClusters::ICachedClusterData> DecodeChains(FArchive& Ar, const TSharedRef<FTestCluster>& Cluster)
+		{
+			int32 NumChains = 0;
+			Ar << NumChains;
+			if (!CanHold(Ar, NumChains, MinChainBytes)) { return nullptr; }
+
+			TSharedPtr<FCachedChainData> Cached = MakeShared<FCachedChainData>();
+			Cached->BaseChains.Reserve(NumChains);
+
+			const int32 NumNodes = Cluster->NumNodes();
+			const int32 NumEdges = Cluster->Edges ? Cluster->Edges->Num() : 0;
+			auto IsValidLink = [&](const PCGExGraphs::FLink& Link)
+			{
+				return Link.Node >= 0 && Link.Node < NumNodes && Link.Edge >= 0 && Link.Edge < NumEdges;
+			};
+
+			for (int32 c = 0; c < NumChains; c++)
+			{
+				PCGExGraphs::FLink Seed;
+				SerializeLink(Ar, Seed);
+
+				TSharedPtr<FTestChain> Chain = MakeShared<FTestChain>(Seed);
+
+				uint8 Flags = 0;
+				Ar << Chain->SingleEdge;
+				Ar << Flags;
+				Ar << Chain->UniqueHash;
+				Chain->bIsClosedLoop = (Flags & 1) != 0;
+				Chain->bIsLeaf = (Flags & 2) != 0;
+
+				int32 NumLinks = 0;
+				Ar << NumLinks;
+				if (NumLinks > NumNodes || !CanHold(Ar, NumLinks, LinkBytes)) { return nullptr; }
+
+				Chain->Links.SetNumUninitialized(NumLinks);
+				for (PCGExGraphs::FLink& Link : Chain->Links)
+				{
+					SerializeLink(Ar, Link);
+					if (!IsValidLink(Link)) { return nullptr; }
+				}
+
+				if (!IsValidLink(Seed)) { return nullptr; }
+				if (Chain->SingleEdge != -1 && (Chain->SingleEdge < 0 || Chain->SingleEdge >= NumEdges)) { return nullptr; }
+				Cached->BaseChains.Add(Chain);
+			}
+
+			if (Ar.IsError()) { return nullptr; }
+
+			Cached->BuildFromBaseChains(Cluster, nullptr);
+			return Cached;
+		}
+
+		void EncodeCell(FArchive& Ar, const FTestCell& Cell)
+		{
+			int32 Face = Cell.Face;
+			double Area = Cell.Area;
+			uint8 Flags = (Cell.bIsConvex ? 1 : 0) | (Cell.bHasLeaves ? 2 : 0) | (Cell.bIsWrapper ? 4 : 0);
+			Ar << Face;
+			Ar << Area;
+			Ar << Flags;
+			WriteArray(Ar, Cell.Nodes);
+		}
+
+		bool DecodeCell(FArchive& Ar, FTestCell& Cell, const int32 NumHalf, const int32 NumNodes)
+		{
+			uint8 Flags = 0;
+			Ar << Cell.Face;
+			Ar << Cell.Area;
+			Ar << Flags;
+			Cell.bIsConvex = (Flags & 1) != 0;
+			Cell.bHasLeaves = (Flags & 2) != 0;
+			Cell.bIsWrapper = (Flags & 4) != 0;
+
+			// A face goes through each half-edge at most once
+			if (!ReadArray(Ar, Cell.Nodes, NumHalf) || Cell.Face < -1 || Cell.Face >= NumHalf) { return false; }
+			for (const int32 Node : Cell.Nodes) { if (Node < 0 || Node >= NumNodes) { return false; } }
+			return true;
+		}
+
+		void EncodeDCELCells(const PCGExClusters::ICachedClusterData& Data, FArchive& Ar)
+		{
+			const FCachedDCELCells& Cached = static_cast<const FCachedDCELCells&>(Data);
+			const FTestDCEL& DCEL = Cached.DCEL;
+
+			// Offsets, origins and ring positions are the cluster's adjacency layout, targets follow from twins
+			FVector ProjectionNormal = DCEL.ProjectionNormal;
+			Ar << ProjectionNormal;
+			WriteArray(Ar, DCEL.NodeNormals);
+			WriteArray(Ar, DCEL.Positions2D);
+			WriteArray(Ar, DCEL.Edge);
+			WriteArray(Ar, DCEL.Twin);
+			WriteArray(Ar, DCEL.Next);
+			WriteArray(Ar, DCEL.Angle);
+
+			int32 NumCells = Cached.Cells.Num();
+			Ar << NumCells;
+			for (const FTestCell& Cell : Cached.Cells) { EncodeCell(Ar, Cell); }
+			EncodeCell(Ar, Cached.Wrapper);
+		}
+
+		TSharedPtr<PCGExClusters::ICachedClusterData> DecodeDCELCells(FArchive& Ar, const TSharedRef<FTestCluster>& Cluster)
+		{
+			const int32 NumNodes = Cluster->NumNodes();
+			const int32 NumEdges = Cluster->Edges ? Cluster->Edges->Num() : 0;
+			if (!Cluster->AdjacencyOffsets.IsValidIndex(NumNodes)) { return nullptr; }
+
+			const int32 NumHalf = Cluster->AdjacencyOffsets[NumNodes];
+
+			TSharedPtr<FCachedDCELCells> Cached = MakeShared<FCachedDCELCells>();
+			FTestDCEL& DCEL = Cached->DCEL;
+
+			Ar << DCEL.ProjectionNormal;
+			if (!ReadArray(Ar, DCEL.NodeNormals, NumNodes) || !ReadArray(Ar, DCEL.Positions2D, NumNodes)) { return nullptr; }
+			if (!ReadArray(Ar, DCEL.Edge, NumHalf) || !ReadArray(Ar, DCEL.Twin, NumHalf) || !ReadArray(Ar, DCEL.Next, NumHalf) || !ReadArray(Ar, DCEL.Angle, NumHalf)) { return nullptr; }
+
+			if (!DCEL.NodeNormals.IsEmpty() && DCEL.NodeNormals.Num() != NumNodes) { return nullptr; }
+			if (!DCEL.Positions2D.IsEmpty() && DCEL.Positions2D.Num() != NumNodes) { return nullptr; }
+			if (DCEL.Edge.Num() != NumHalf || DCEL.Twin.Num() != NumHalf || DCEL.Next.Num() != NumHalf || DCEL.Angle.Num() != NumHalf) { return nullptr; }
+
+			DCEL.Offsets = Cluster->AdjacencyOffsets;
+			DCEL.Origin.SetNumUninitialized(NumHalf);
+			DCEL.RingPos.SetNumUninitialized(NumHalf);
+			DCEL.Target.SetNumUninitialized(NumHalf);
+
+			for (int32 Node = 0; Node < NumNodes; Node++)
+			{
+				for (int32 Half = DCEL.Offsets[Node]; Half < DCEL.Offsets[Node + 1]; Half++)
+				{
+					DCEL.Origin[Half] = Node;
+					DCEL.RingPos[Half] = Half - DCEL.Offsets[Node];
+				}
+			}
+
+			for (int32 Half = 0; Half < NumHalf; Half++)
+			{
+				const int32 TwinHalf = DCEL.Twin[Half];
+				const int32 EdgeIndex = DCEL.Edge[Half];
+				if (!DCEL.Twin.IsValidIndex(TwinHalf) || EdgeIndex < 0 || EdgeIndex >= NumEdges) { return nullptr; }
+
+				DCEL.Target[Half] = DCEL.Origin[TwinHalf];
+
+				// Each half-edge runs along the cluster edge it names
+				const PCGExGraphs::FEdge* ClusterEdge = Cluster->GetEdge(EdgeIndex);
+				const int32 Start = Cluster->NodeIndexLookup->Get(ClusterEdge->Start);
+				const int32 End = Cluster->NodeIndexLookup->Get(ClusterEdge->End);
+				const int32 From = DCEL.Origin[Half];
+				const int32 To = DCEL.Target[Half];
+				if (!((Start == From && End == To) || (Start == To && End == From))) { return nullptr; }
+			}
+
+			if (!DCEL.Validate()) { return nullptr; }
+
+			int32 NumCells = 0;
+			Ar << NumCells;
+			if (NumCells > NumHalf || !CanHold(Ar, NumCells, MinCellBytes)) { return nullptr; }
+
+			Cached->Cells.SetNum(NumCells);
+			for (FTestCell& Cell : Cached->Cells)
+			{
+				if (!DecodeCell(Ar, Cell, NumHalf, NumNodes) || Cell.Face == -1) { return nullptr; }
+			}
+
+			if (!DecodeCell(Ar, Cached->Wrapper, NumHalf, NumNodes) || Ar.IsError()) { return nullptr; }
+
+			return Cached;
+		}
+	}
+
+#pragma region Content Hash
+
+	uint64 ComputeClusterContentHash(const FTestCluster& Cluster, const double PositionTolerance)
+	{
+		PersistentCacheLocal::FHashStream Stream;
+
+		const int32 NumNodes = Cluster.NumNodes();
+		const double InvTolerance = 1.0 / FMath::Max(PositionTolerance, UE_DOUBLE_SMALL_NUMBER);
+
+		Stream.Add(NumNodes);
+		Stream.Add(Cluster.Edges ? Cluster.Edges->Num() : 0);
+
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			const FVector Pos = Cluster.GetPos(i);
+			Stream.Add(Cluster.GetNodePointIndex(i));
+			Stream.Add(FMath::RoundToInt64(Pos.X * InvTolerance));
+			Stream.Add(FMath::RoundToInt64(Pos.Y * InvTolerance));
+			Stream.Add(FMath::RoundToInt64(Pos.Z * InvTolerance));
+		}
+
+		// Link order matters to artifacts that store link-relative data
+		for (int32 i = 0; i <= NumNodes; i++) { Stream.Add(Cluster.AdjacencyOffsets[i]); }
+		for (const PCGExGraphs::FLink& Link : Cluster.AdjacencyLinks)
+		{
+			Stream.Add(Link.Node);
+			Stream.Add(Link.Edge);
+		}
+
+		if (Cluster.Edges)
+		{
+			for (const PCGExGraphs::FEdge& Edge : *Cluster.Edges)
+			{
+				Stream.Add(Edge.Start);
+				Stream.Add(Edge.End);
+			}
+		}
+
+		return Stream.Finalize();
+	}
+
+#pragma endregion
+
+#pragma region FPersistentArtifactCache
+
+	FString FPersistentArtifactCacheStats::ToString() const
+	{
+		return FString::Printf(
+			TEXT("%d entries, %lld bytes, %lld hits / %lld misses, %lld stores, %lld decode failures"),
+			NumEntries, BytesStored, Hits, Misses, Stores, DecodeFailures);
+	}
+
+	FPersistentArtifactCache::FPersistentArtifactCache()
+	{
+		RegisterCodec(TangentFramesArtifact, FArtifactCodec{&PersistentCacheLocal::EncodeTangentFrames, &PersistentCacheLocal::DecodeTangentFrames});
+		RegisterCodec(FCachedChainData::CacheKey, FArtifactCodec{&PersistentCacheLocal::EncodeChains, &PersistentCacheLocal::DecodeChains});
+		RegisterCodec(FCachedDCELCells::CacheKey, FArtifactCodec{&PersistentCacheLocal::EncodeDCELCells, &PersistentCacheLocal::DecodeDCELCells});
+	}
+
+	FPersistentArtifactCache& FPersistentArtifactCache::Get()
+	{
+		static FPersistentArtifactCache Instance;
+		return Instance;
+	}
+
+	void FPersistentArtifactCache::RegisterCodec(const FName Artifact, const FArtifactCodec& Codec)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		Codecs.Add(Artifact, Codec);
+	}
+
+	bool FPersistentArtifactCache::HasCodec(const FName Artifact) const
+	{
+		FReadScopeLock ReadLock(Lock);
+		return Codecs.Contains(Artifact);
+	}
+
+	TSharedPtr<PCGExClusters::ICachedClusterData> FPersistentArtifactCache::Find(const FClusterArtifactKey& Key, const TSharedRef<FTestCluster>& Cluster)
+	{
+		TSharedPtr<PCGExClusters::ICachedClusterData> Data;
+
+		{
+			// Decoding only reads the blob, concurrent lookups can share the lock
+			FReadScopeLock ReadLock(Lock);
+			const TArray<uint8>* Found = Blobs.Find(Key);
+			const FArtifactCodec* Codec = Codecs.Find(Key.Artifact);
+			if (!Found || !Codec)
+			{
+				Misses.fetch_add(1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			FMemoryReader Reader(*Found);
+			Data = Codec->Decode(Reader, Cluster);
+		}
+
+		if (!Data)
+		{
+			{
+				FWriteScopeLock WriteLock(Lock);
+				if (const TArray<uint8>* Current = Blobs.Find(Key))
+				{
+					BytesStored -= Current->Num();
+					Blobs.Remove(Key);
+				}
+			}
+
+			DecodeFailures.fetch_add(1, std::memory_order_relaxed);
+			Misses.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		Data->ContextHash = Key.ContextHash;
+		Hits.fetch_add(1, std::memory_order_relaxed);
+		return Data;
+	}
+
+	bool FPersistentArtifactCache::Add(const FClusterArtifactKey& Key, const PCGExClusters::ICachedClusterData& Data)
+	{
+		FArtifactCodec Codec;
+
+		{
+			FReadScopeLock ReadLock(Lock);
+			const FArtifactCodec* FoundCodec = Codecs.Find(Key.Artifact);
+			if (!FoundCodec) { return false; }
+			Codec = *FoundCodec;
+		}
+
+		TArray<uint8> Blob;
+		FMemoryWriter Writer(Blob);
+		Codec.Encode(Data, Writer);
+
+		{
+			FWriteScopeLock WriteLock(Lock);
+			if (const TArray<uint8>* Previous = Blobs.Find(Key)) { BytesStored -= Previous->Num(); }
+			BytesStored += Blob.Num();
+			Blobs.Add(Key, MoveTemp(Blob));
+		}
+
+		Stores.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	bool FPersistentArtifactCache::Contains(const FClusterArtifactKey& Key) const
+	{
+		FReadScopeLock ReadLock(Lock);
+		return Blobs.Contains(Key);
+	}
+
+	void FPersistentArtifactCache::Empty()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		Blobs.Empty();
+		BytesStored = 0;
+	}
+
+	bool FPersistentArtifactCache::SaveToFile(const FString& Path) const
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+
+		uint32 Magic = PersistentCacheLocal::FileMagic;
+		int32 Version = PersistentCacheLocal::FileVersion;
+		Writer << Magic;
+		Writer << Version;
+
+		{
+			FReadScopeLock ReadLock(Lock);
+
+			int32 NumEntries = Blobs.Num();
+			Writer << NumEntries;
+
+			for (const TPair<FClusterArtifactKey, TArray<uint8>>& Pair : Blobs)
+			{
+				uint64 ContentHash = Pair.Key.ContentHash;
+				uint32 ContextHash = Pair.Key.ContextHash;
+				FString Artifact = Pair.Key.Artifact.ToString();
+				Writer << ContentHash;
+				Writer << ContextHash;
+				Writer << Artifact;
+				Writer << const_cast<TArray<uint8>&>(Pair.Value);
+			}
+		}
+
+		return FFileHelper::SaveArrayToFile(Bytes, *Path);
+	}
+
+	int32 FPersistentArtifactCache::LoadFromFile(const FString& Path)
+	{
+		TArray<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent)) { return -1; }
+
+		FMemoryReader Reader(Bytes);
+
+		uint32 Magic = 0;
+		int32 Version = 0;
+		int32 NumEntries = 0;
+		Reader << Magic;
+		Reader << Version;
+		Reader << NumEntries;
+
+		if (Magic != PersistentCacheLocal::FileMagic || Version != PersistentCacheLocal::FileVersion) { return -1; }
+		if (!PersistentCacheLocal::CanHold(Reader, NumEntries, PersistentCacheLocal::MinEntryBytes)) { return -1; }
+
+		TArray<TPair<FClusterArtifactKey, TArray<uint8>>> Loaded;
+		Loaded.Reserve(NumEntries);
+
+		for (int32 i = 0; i < NumEntries; i++)
+		{
+			uint64 ContentHash = 0;
+			uint32 ContextHash = 0;
+			FString Artifact;
+			int32 BlobSize = 0;
+
+			Reader << ContentHash;
+			Reader << ContextHash;
+			Reader << Artifact;
+
+			// Same layout as TArray<uint8> serialization, with the size checked before allocating
+			Reader << BlobSize;
+			if (!PersistentCacheLocal::CanHold(Reader, BlobSize, 1)) { return -1; }
+
+			TArray<uint8> Blob;
+			Blob.SetNumUninitialized(BlobSize);
+			Reader.Serialize(Blob.GetData(), BlobSize);
+
+			if (Reader.IsError()) { return -1; }
+
+			Loaded.Emplace(FClusterArtifactKey(ContentHash, ContextHash, FName(*Artifact)), MoveTemp(Blob));
+		}
+
+		FWriteScopeLock WriteLock(Lock);
+		for (TPair<FClusterArtifactKey, TArray<uint8>>& Pair : Loaded)
+		{
+			if (const TArray<uint8>* Previous = Blobs.Find(Pair.Key)) { BytesStored -= Previous->Num(); }
+			BytesStored += Pair.Value.Num();
+			Blobs.Add(Pair.Key, MoveTemp(Pair.Value));
+		}
+
+		return Loaded.Num();
+	}
+
+	FPersistentArtifactCacheStats FPersistentArtifactCache::GetStats() const
+	{
+		FPersistentArtifactCacheStats Stats;
+		Stats.Hits = Hits.load(std::memory_order_relaxed);
+		Stats.Misses = Misses.load(std::memory_order_relaxed);
+		Stats.Stores = Stores.load(std::memory_order_relaxed);
+		Stats.DecodeFailures = DecodeFailures.load(std::memory_order_relaxed);
+
+		FReadScopeLock ReadLock(Lock);
+		Stats.BytesStored = BytesStored;
+		Stats.NumEntries = Blobs.Num();
+		return Stats;
+	}
+
+	void FPersistentArtifactCache::ResetStats()
+	{
+		Hits.store(0, std::memory_order_relaxed);
+		Misses.store(0, std::memory_order_relaxed);
+		Stores.store(0, std::memory_order_relaxed);
+		DecodeFailures.store(0, std::memory_order_relaxed);
+	}
+
+#pragma endregion
+}
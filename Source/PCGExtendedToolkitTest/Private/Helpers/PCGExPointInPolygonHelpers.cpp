@@ -0,0 +1,248 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Helpers/PCGExPointInPolygonHelpers.h"
+#include "Async/ParallelFor.h"
+
+namespace PCGExTest
+{
+	namespace
+	{
+		/** Edges the horizontal ray from (X, Y) towards +X crosses */
+		FORCEINLINE int32 CountCrossings(
+			const double X, const double Y,
+			const double* RESTRICT Xi, const double* RESTRICT Yi,
+			const double* RESTRICT Xj, const double* RESTRICT Yj,
+			const int32 NumEdges)
+		{
+			int32 Crossings = 0;
+			for (int32 e = 0; e < NumEdges; e++)
+			{
+				// Same expression as the scalar test; the division by zero of a non-spanning edge is masked out
+				Crossings += ((Yi[e] > Y) != (Yj[e] > Y)) & (X < (Xj[e] - Xi[e]) * (Y - Yi[e]) / (Yj[e] - Yi[e]) + Xi[e]);
+			}
+			return Crossings;
+		}
+
+		/** Classify 32 points per output word, one word per task */
+		template <typename PointType, typename FuncType>
+		void ClassifyWords(const TConstArrayView<PointType> Points, TBitArray<>& OutInside, FuncType&& IsInside)
+		{
+			const int32 NumPoints = Points.Num();
+			OutInside.Init(false, NumPoints);
+			if (NumPoints == 0) { return; }
+
+			uint32* Words = OutInside.GetData();
+			ParallelFor(
+				FMath::DivideAndRoundUp(NumPoints, 32), [&](const int32 Word)
+				{
+					const int32 First = Word * 32;
+					const int32 Count = FMath::Min(32, NumPoints - First);
+
+					// Bits past the last point stay zero
+					uint32 Mask = 0;
+					for (int32 i = 0; i < Count; i++)
+					{
+						const PointType& P = Points[First + i];
+						Mask |= static_cast<uint32>(IsInside(P.X, P.Y)) << i;
+					}
+
+					Words[Word] = Mask;
+				});
+		}
+
+		/** Flat edge arrays of a whole polygon, vertex i to vertex i - 1 */
+		struct FPolygonEdges
+		{
+			TArray<double> Xi;
+			TArray<double> Yi;
+			TArray<double> Xj;
+			TArray<double> Yj;
+
+			explicit FPolygonEdges(const TConstArrayView<FVector2D> Polygon)
+			{
+				const int32 Num = Polygon.Num();
+				Xi.SetNumUninitialized(Num);
+				Yi.SetNumUninitialized(Num);
+				Xj.SetNumUninitialized(Num);
+				Yj.SetNumUninitialized(Num);
+
+				for (int32 i = 0, j = Num - 1; i < Num; j = i++)
+				{
+					Xi[i] = Polygon[i].X;
+					Yi[i] = Polygon[i].Y;
+					Xj[i] = Polygon[j].X;
+					Yj[i] = Polygon[j].Y;
+				}
+			}
+
+			FORCEINLINE bool IsInside(const double X, const double Y) const
+			{
+				return CountCrossings(X, Y, Xi.GetData(), Yi.GetData(), Xj.GetData(), Yj.GetData(), Xi.Num()) & 1;
+			}
+		};
+
+		/** Signed edge functions of the three edges, precomputed once per triangle */
+		struct FTriangleEdges
+		{
+			double AX, AY, BX, BY, CX, CY;
+			double ABX, ABY, BCX, BCY, CAX, CAY;
+
+			FTriangleEdges(const double InAX, const double InAY, const double InBX, const double InBY, const double InCX, const double InCY)
+				: AX(InAX), AY(InAY), BX(InBX), BY(InBY), CX(InCX), CY(InCY),
+				  ABX(InBX - InAX), ABY(InBY - InAY), BCX(InCX - InBX), BCY(InCY - InBY), CAX(InAX - InCX), CAY(InAY - InCY)
+			{
+			}
+
+			FORCEINLINE bool IsInside(const double X, const double Y) const
+			{
+				const double D1 = ABX * (Y - AY) - ABY * (X - AX);
+				const double D2 = BCX * (Y - BY) - BCY * (X - BX);
+				const double D3 = CAX * (Y - CY) - CAY * (X - CX);
+
+				// Inside when no two edges see the point on opposite sides
+				const bool bNegative = (D1 < 0) | (D2 < 0) | (D3 < 0);
+				const bool bPositive = (D1 > 0) | (D2 > 0) | (D3 > 0);
+				return !(bNegative & bPositive);
+			}
+		};
+	}
+
+#pragma region TestPointInPolygon
+
+	namespace TestPointInPolygon
+	{
+		bool IsInside(const FVector2D& Point, const TConstArrayView<FVector2D> Polygon)
+		{
+			bool bInside = false;
+			for (int32 i = 0, j = Polygon.Num() - 1; i < Polygon.Num(); j = i++)
+			{
+				const FVector2D& Pi = Polygon[i];
+				const FVector2D& Pj = Polygon[j];
+				if (((Pi.Y > Point.Y) != (Pj.Y > Point.Y)) && (Point.X < (Pj.X - Pi.X) * (Point.Y - Pi.Y) / (Pj.Y - Pi.Y) + Pi.X)) { bInside = !bInside; }
+			}
+			return bInside;
+		}
+
+		void ClassifyPoints(const TConstArrayView<FVector2D> Points, const TConstArrayView<FVector2D> Polygon, TBitArray<>& OutInside)
+		{
+			const FPolygonEdges Edges(Polygon);
+			ClassifyWords(Points, OutInside, [&](const double X, const double Y) { return Edges.IsInside(X, Y); });
+		}
+
+		void ClassifyPoints(const TConstArrayView<FVector> Points, const TConstArrayView<FVector2D> Polygon, TBitArray<>& OutInside)
+		{
+			const FPolygonEdges Edges(Polygon);
+			ClassifyWords(Points, OutInside, [&](const double X, const double Y) { return Edges.IsInside(X, Y); });
+		}
+
+		bool IsInTriangle(const FVector2D& Point, const FVector2D& A, const FVector2D& B, const FVector2D& C)
+		{
+			return FTriangleEdges(A.X, A.Y, B.X, B.Y, C.X, C.Y).IsInside(Point.X, Point.Y);
+		}
+
+		void ClassifyPoints(
+			const TConstArrayView<FVector2D> Points,
+			const FVector2D& A, const FVector2D& B, const FVector2D& C,
+			TBitArray<>& OutInside)
+		{
+			const FTriangleEdges Triangle(A.X, A.Y, B.X, B.Y, C.X, C.Y);
+			ClassifyWords(Points, OutInside, [&](const double X, const double Y) { return Triangle.IsInside(X, Y); });
+		}
+
+		void ClassifyPoints(
+			const TConstArrayView<FVector> Points,
+			const FVector& A, const FVector& B, const FVector& C,
+			TBitArray<>& OutInside)
+		{
+			const FTriangleEdges Triangle(A.X, A.Y, B.X, B.Y, C.X, C.Y);
+			ClassifyWords(Points, OutInside, [&](const double X, const double Y) { return Triangle.IsInside(X, Y); });
+		}
+	}
+
+#pragma endregion
+
+#pragma region FTestPolygon2
+
+	FTestPolygon2::FTestPolygon2(const TConstArrayView<FVector2D> Polygon, const int32 InNumBands)
+	{
+		Build(Polygon, InNumBands);
+	}
+
+	void FTestPolygon2::Build(const TConstArrayView<FVector2D> Polygon, const int32 InNumBands)
+	{
+		NumPolygonEdges = Polygon.Num();
+		Bounds = FBox2D(ForceInit);
+		for (const FVector2D& P : Polygon) { Bounds += P; }
+
+		const int32 NumBandsToBuild = FMath::Max(1, InNumBands > 0 ? InNumBands : NumPolygonEdges);
+		const double Height = NumPolygonEdges > 0 ? Bounds.Max.Y - Bounds.Min.Y : 0;
+		InvBandHeight = Height > 0 ? NumBandsToBuild / Height : 0;
+
+		BandOffsets.Init(0, NumBandsToBuild + 1);
+
+		// Count per band, prefix sum, then fill
+		for (int32 i = 0, j = NumPolygonEdges - 1; i < NumPolygonEdges; j = i++)
+		{
+			const double Yi = Polygon[i].Y;
+			const double Yj = Polygon[j].Y;
+			if (Yi == Yj) { continue; }
+
+			const int32 Last = GetBand(FMath::Max(Yi, Yj));
+			for (int32 b = GetBand(FMath::Min(Yi, Yj)); b <= Last; b++) { BandOffsets[b + 1]++; }
+		}
+
+		for (int32 b = 0; b < NumBandsToBuild; b++) { BandOffsets[b + 1] += BandOffsets[b]; }
+
+		const int32 NumEntries = BandOffsets.Last();
+		EdgeXi.SetNumUninitialized(NumEntries);
+		EdgeYi.SetNumUninitialized(NumEntries);
+		EdgeXj.SetNumUninitialized(NumEntries);
+		EdgeYj.SetNumUninitialized(NumEntries);
+
+		TArray<int32> Cursors(BandOffsets.GetData(), NumBandsToBuild);
+		for (int32 i = 0, j = NumPolygonEdges - 1; i < NumPolygonEdges; j = i++)
+		{
+			const FVector2D& Pi = Polygon[i];
+			const FVector2D& Pj = Polygon[j];
+			if (Pi.Y == Pj.Y) { continue; }
+
+			const int32 Last = GetBand(FMath::Max(Pi.Y, Pj.Y));
+			for (int32 b = GetBand(FMath::Min(Pi.Y, Pj.Y)); b <= Last; b++)
+			{
+				const int32 Entry = Cursors[b]++;
+				EdgeXi[Entry] = Pi.X;
+				EdgeYi[Entry] = Pi.Y;
+				EdgeXj[Entry] = Pj.X;
+				EdgeYj[Entry] = Pj.Y;
+			}
+		}
+	}
+
+	bool FTestPolygon2::IsInside(const FVector2D& Point) const
+	{
+		// No edge spans a Y outside the bounds; also rejects NaN
+		if (NumPolygonEdges == 0 || !(Point.Y >= Bounds.Min.Y && Point.Y < Bounds.Max.Y)) { return false; }
+
+		const int32 Band = GetBand(Point.Y);
+		const int32 First = BandOffsets[Band];
+
+		return CountCrossings(
+			Point.X, Point.Y,
+			EdgeXi.GetData() + First, EdgeYi.GetData() + First,
+			EdgeXj.GetData() + First, EdgeYj.GetData() + First,
+			BandOffsets[Band + 1] - First) & 1;
+	}
+
+	void FTestPolygon2::ClassifyPoints(const TConstArrayView<FVector2D> Points, TBitArray<>& OutInside) const
+	{
+		ClassifyWords(Points, OutInside, [&](const double X, const double Y) { return IsInside(FVector2D(X, Y)); });
+	}
+
+	void FTestPolygon2::ClassifyPoints(const TConstArrayView<FVector> Points, TBitArray<>& OutInside) const
+	{
+		ClassifyWords(Points, OutInside, [&](const double X, const double Y) { return IsInside(FVector2D(X, Y)); });
+	}
+
+#pragma endregion
+}
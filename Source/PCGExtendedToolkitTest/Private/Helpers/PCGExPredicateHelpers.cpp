@@ -0,0 +1,292 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Helpers/PCGExPredicateHelpers.h"
+
+namespace PCGExTest
+{
+	namespace
+	{
+		/**
+		 * Floating-point expansion: a sum of non-overlapping doubles in increasing magnitude, representing a value
+		 * exactly. Never empty; zero is a single 0 component.
+		 */
+		using FExpansion = TArray<double, TInlineAllocator<32>>;
+
+		// 2^27 + 1, splits a double into two 26-bit halves
+		constexpr double Splitter = 134217729.0;
+
+		FORCEINLINE void Split(const double A, double& OutHi, double& OutLo)
+		{
+			const double C = Splitter * A;
+			const double Big = C - A;
+			OutHi = C - Big;
+			OutLo = A - OutHi;
+		}
+
+		FORCEINLINE void TwoSum(const double A, const double B, double& OutX, double& OutY)
+		{
+			OutX = A + B;
+			const double BVirt = OutX - A;
+			const double AVirt = OutX - BVirt;
+			OutY = (A - AVirt) + (B - BVirt);
+		}
+
+		/** Requires |A| >= |B| */
+		FORCEINLINE void FastTwoSum(const double A, const double B, double& OutX, double& OutY)
+		{
+			OutX = A + B;
+			OutY = B - (OutX - A);
+		}
+
+		FORCEINLINE void TwoProduct(const double A, const double B, double& OutX, double& OutY)
+		{
+			OutX = A * B;
+
+			double AHi, ALo, BHi, BLo;
+			Split(A, AHi, ALo);
+			Split(B, BHi, BLo);
+
+			const double Err1 = OutX - AHi * BHi;
+			const double Err2 = Err1 - ALo * BHi;
+			const double Err3 = Err2 - AHi * BLo;
+			OutY = ALo * BLo - Err3;
+		}
+
+		/** A - B, exactly */
+		FORCEINLINE FExpansion Diff(const double A, const double B)
+		{
+			const double X = A - B;
+			const double BVirt = A - X;
+			const double AVirt = X + BVirt;
+			const double Y = (A - AVirt) + (BVirt - B);
+
+			FExpansion Result;
+			if (Y != 0) { Result.Add(Y); }
+			Result.Add(X);
+			return Result;
+		}
+
+		/** E + F, merging by magnitude then sweeping once (Shewchuk's fast expansion sum, zero-eliminating) */
+		FExpansion Sum(const FExpansion& E, const FExpansion& F)
+		{
+			FExpansion H;
+			H.Reserve(E.Num() + F.Num());
+
+			int32 EIndex = 0;
+			int32 FIndex = 0;
+			auto TakeE = [&]() { return FIndex >= F.Num() || (EIndex < E.Num() && (F[FIndex] > E[EIndex]) == (F[FIndex] > -E[EIndex])); };
+
+			double Q = TakeE() ? E[EIndex++] : F[FIndex++];
+			double QNew;
+			double HH;
+
+			if (EIndex < E.Num() && FIndex < F.Num())
+			{
+				if (TakeE()) { FastTwoSum(E[EIndex++], Q, QNew, HH); }
+				else { FastTwoSum(F[FIndex++], Q, QNew, HH); }
+
+				Q = QNew;
+				if (HH != 0) { H.Add(HH); }
+			}
+
+			while (EIndex < E.Num() || FIndex < F.Num())
+			{
+				if (TakeE()) { TwoSum(Q, E[EIndex++], QNew, HH); }
+				else { TwoSum(Q, F[FIndex++], QNew, HH); }
+
+				Q = QNew;
+				if (HH != 0) { H.Add(HH); }
+			}
+
+			if (Q != 0 || H.IsEmpty()) { H.Add(Q); }
+			return H;
+		}
+
+		/** E * B, for a single double B */
+		FExpansion Scale(const FExpansion& E, const double B)
+		{
+			FExpansion H;
+			H.Reserve(E.Num() * 2);
+
+			double Q;
+			double HH;
+			TwoProduct(E[0], B, Q, HH);
+			if (HH != 0) { H.Add(HH); }
+
+			for (int32 i = 1; i < E.Num(); i++)
+			{
+				double Product1, Product0, SumValue;
+				TwoProduct(E[i], B, Product1, Product0);
+
+				TwoSum(Q, Product0, SumValue, HH);
+				if (HH != 0) { H.Add(HH); }
+
+				FastTwoSum(Product1, SumValue, Q, HH);
+				if (HH != 0) { H.Add(HH); }
+			}
+
+			if (Q != 0 || H.IsEmpty()) { H.Add(Q); }
+			return H;
+		}
+
+		FExpansion Mul(const FExpansion& E, const FExpansion& F)
+		{
+			FExpansion Result = Scale(E, F[0]);
+			for (int32 i = 1; i < F.Num(); i++) { Result = Sum(Result, Scale(E, F[i])); }
+			return Result;
+		}
+
+		FExpansion Negate(FExpansion E)
+		{
+			for (double& Component : E) { Component = -Component; }
+			return E;
+		}
+
+		FORCEINLINE FExpansion Sub(const FExpansion& E, const FExpansion& F) { return Sum(E, Negate(F)); }
+
+		/** Most significant component: exact sign, approximate magnitude */
+		FORCEINLINE double Estimate(const FExpansion& E) { return E.Last(); }
+
+		/** A * D - B * C */
+		FORCEINLINE FExpansion Det2(const FExpansion& A, const FExpansion& B, const FExpansion& C, const FExpansion& D)
+		{
+			return Sub(Mul(A, D), Mul(B, C));
+		}
+
+		FORCEINLINE FExpansion Lift2(const FExpansion& X, const FExpansion& Y) { return Sum(Mul(X, X), Mul(Y, Y)); }
+
+		FORCEINLINE FExpansion Lift3(const FExpansion& X, const FExpansion& Y, const FExpansion& Z) { return Sum(Sum(Mul(X, X), Mul(Y, Y)), Mul(Z, Z)); }
+	}
+
+	namespace TestPredicates
+	{
+		double Orient2DExact(const FVector2D& A, const FVector2D& B, const FVector2D& C)
+		{
+			return Estimate(Det2(Diff(A.X, C.X), Diff(A.Y, C.Y), Diff(B.X, C.X), Diff(B.Y, C.Y)));
+		}
+
+		double InCircleExact(const FVector2D& A, const FVector2D& B, const FVector2D& C, const FVector2D& D)
+		{
+			const FExpansion ADX = Diff(A.X, D.X);
+			const FExpansion ADY = Diff(A.Y, D.Y);
+			const FExpansion BDX = Diff(B.X, D.X);
+			const FExpansion BDY = Diff(B.Y, D.Y);
+			const FExpansion CDX = Diff(C.X, D.X);
+			const FExpansion CDY = Diff(C.Y, D.Y);
+
+			const FExpansion BC = Det2(BDX, BDY, CDX, CDY);
+			const FExpansion CA = Det2(CDX, CDY, ADX, ADY);
+			const FExpansion AB = Det2(ADX, ADY, BDX, BDY);
+
+			return Estimate(Sum(Sum(Mul(Lift2(ADX, ADY), BC), Mul(Lift2(BDX, BDY), CA)), Mul(Lift2(CDX, CDY), AB)));
+		}
+
+		double Orient3DExact(const FVector& A, const FVector& B, const FVector& C, const FVector& D)
+		{
+			const FExpansion ADX = Diff(A.X, D.X);
+			const FExpansion ADY = Diff(A.Y, D.Y);
+			const FExpansion ADZ = Diff(A.Z, D.Z);
+			const FExpansion BDX = Diff(B.X, D.X);
+			const FExpansion BDY = Diff(B.Y, D.Y);
+			const FExpansion BDZ = Diff(B.Z, D.Z);
+			const FExpansion CDX = Diff(C.X, D.X);
+			const FExpansion CDY = Diff(C.Y, D.Y);
+			const FExpansion CDZ = Diff(C.Z, D.Z);
+
+			const FExpansion BC = Det2(BDX, BDY, CDX, CDY);
+			const FExpansion CA = Det2(CDX, CDY, ADX, ADY);
+			const FExpansion AB = Det2(ADX, ADY, BDX, BDY);
+
+			// Pivoted on D, the determinant is the negated orientation
+			return -Estimate(Sum(Sum(Mul(ADZ, BC), Mul(BDZ, CA)), Mul(CDZ, AB)));
+		}
+
+		double InSphereExact(const FVector& A, const FVector& B, const FVector& C, const FVector& D, const FVector& E)
+		{
+			const FExpansion AEX = Diff(A.X, E.X);
+			const FExpansion AEY = Diff(A.Y, E.Y);
+			const FExpansion AEZ = Diff(A.Z, E.Z);
+			const FExpansion BEX = Diff(B.X, E.X);
+			const FExpansion BEY = Diff(B.Y, E.Y);
+			const FExpansion BEZ = Diff(B.Z, E.Z);
+			const FExpansion CEX = Diff(C.X, E.X);
+			const FExpansion CEY = Diff(C.Y, E.Y);
+			const FExpansion CEZ = Diff(C.Z, E.Z);
+			const FExpansion DEX = Diff(D.X, E.X);
+			const FExpansion DEY = Diff(D.Y, E.Y);
+			const FExpansion DEZ = Diff(D.Z, E.Z);
+
+			const FExpansion AB = Det2(AEX, AEY, BEX, BEY);
+			const FExpansion BC = Det2(BEX, BEY, CEX, CEY);
+			const FExpansion CD = Det2(CEX, CEY, DEX, DEY);
+			const FExpansion DA = Det2(DEX, DEY, AEX, AEY);
+			const FExpansion AC = Det2(AEX, AEY, CEX, CEY);
+			const FExpansion BD = Det2(BEX, BEY, DEX, DEY);
+
+			const FExpansion ABC = Sum(Sub(Mul(AEZ, BC), Mul(BEZ, AC)), Mul(CEZ, AB));
+			const FExpansion BCD = Sum(Sub(Mul(BEZ, CD), Mul(CEZ, BD)), Mul(DEZ, BC));
+			const FExpansion CDA = Sum(Sum(Mul(CEZ, DA), Mul(DEZ, AC)), Mul(AEZ, CD));
+			const FExpansion DAB = Sum(Sum(Mul(DEZ, AB), Mul(AEZ, BD)), Mul(BEZ, DA));
+
+			const FExpansion Left = Sub(Mul(Lift3(AEX, AEY, AEZ), BCD), Mul(Lift3(BEX, BEY, BEZ), CDA));
+			const FExpansion Right = Sub(Mul(Lift3(CEX, CEY, CEZ), DAB), Mul(Lift3(DEX, DEY, DEZ), ABC));
+
+			return Estimate(Sum(Left, Right));
+		}
+
+		bool GetCircumcenter(const FVector2D& A, const FVector2D& B, const FVector2D& C, FVector2D& OutCenter)
+		{
+			const double Orientation = Orient2D(A, B, C);
+			if (Orientation == 0) { return false; }
+
+			const FVector2D BA = B - A;
+			const FVector2D CA = C - A;
+			const double BALength = BA.SizeSquared();
+			const double CALength = CA.SizeSquared();
+			const double Denominator = 0.5 / Orientation;
+
+			OutCenter = A + FVector2D(
+				(CA.Y * BALength - BA.Y * CALength) * Denominator,
+				(BA.X * CALength - CA.X * BALength) * Denominator);
+
+			return true;
+		}
+
+		bool GetCircumcenter(const FVector& A, const FVector& B, const FVector& C, FVector& OutCenter)
+		{
+			// Normal from the exact orientations of the three axis projections
+			const FVector Normal(
+				Orient2D(FVector2D(A.Y, A.Z), FVector2D(B.Y, B.Z), FVector2D(C.Y, C.Z)),
+				Orient2D(FVector2D(A.Z, A.X), FVector2D(B.Z, B.X), FVector2D(C.Z, C.X)),
+				Orient2D(FVector2D(A.X, A.Y), FVector2D(B.X, B.Y), FVector2D(C.X, C.Y)));
+
+			const double NormalLength = Normal.SizeSquared();
+			if (NormalLength == 0) { return false; }
+
+			const FVector BA = B - A;
+			const FVector CA = C - A;
+			const FVector Offset = FVector::CrossProduct(BA.SizeSquared() * CA - CA.SizeSquared() * BA, Normal) * (0.5 / NormalLength);
+
+			OutCenter = A + Offset;
+			return true;
+		}
+
+		bool GetCircumcenter(const FVector& A, const FVector& B, const FVector& C, const FVector& D, FVector& OutCenter)
+		{
+			const double Orientation = Orient3D(A, B, C, D);
+			if (Orientation == 0) { return false; }
+
+			const FVector BA = B - A;
+			const FVector CA = C - A;
+			const FVector DA = D - A;
+
+			const FVector Offset = (BA.SizeSquared() * FVector::CrossProduct(CA, DA)
+				+ CA.SizeSquared() * FVector::CrossProduct(DA, BA)
+				+ DA.SizeSquared() * FVector::CrossProduct(BA, CA)) * (0.5 / Orientation);
+
+			OutCenter = A + Offset;
+			return true;
+		}
+	}
+}
@@ -0,0 +1,76 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Helpers/PCGExShardedContainerHelpers.h"
+
+namespace PCGExTest
+{
+#pragma region Shard Count
+
+	int32 ComputeShardCount(int32 NumWorkers, const int32 ExpectedSize)
+	{
+		// Below this, shards are mostly empty and Collapse pays for nothing
+		constexpr int32 MinEntriesPerShard = 256;
+		constexpr int32 ShardsPerWorker = 4;
+		constexpr int32 MaxShards = 1024;
+
+		if (NumWorkers <= 0) { NumWorkers = FPlatformMisc::NumberOfCoresIncludingHyperthreads(); }
+		NumWorkers = FMath::Max(1, NumWorkers);
+
+		int32 Target = NumWorkers * ShardsPerWorker;
+		if (ExpectedSize > 0) { Target = FMath::Min(Target, FMath::Max(1, ExpectedSize / MinEntriesPerShard)); }
+
+		Target = FMath::Clamp(Target, 1, MaxShards);
+		return static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(Target)));
+	}
+
+#pragma endregion
+
+#pragma region FShardContentionStats
+
+	int64 FShardContentionStats::GetTotalAcquisitions() const
+	{
+		int64 Total = 0;
+		for (const int64 Count : Acquisitions) { Total += Count; }
+		return Total;
+	}
+
+	int64 FShardContentionStats::GetTotalWaits() const
+	{
+		int64 Total = 0;
+		for (const int64 Count : Waits) { Total += Count; }
+		return Total;
+	}
+
+	double FShardContentionStats::GetWaitRatio() const
+	{
+		const int64 Total = GetTotalAcquisitions();
+		return Total > 0 ? static_cast<double>(GetTotalWaits()) / static_cast<double>(Total) : 0;
+	}
+
+	int32 FShardContentionStats::GetHottestShard() const
+	{
+		int32 Hottest = -1;
+		int64 MaxWaits = 0;
+		for (int32 i = 0; i < Waits.Num(); i++)
+		{
+			if (Waits[i] > MaxWaits)
+			{
+				MaxWaits = Waits[i];
+				Hottest = i;
+			}
+		}
+		return Hottest;
+	}
+
+	FString FShardContentionStats::ToString() const
+	{
+		const int32 Hottest = GetHottestShard();
+		return FString::Printf(
+			TEXT("%d shards, %lld acquisitions, %lld waits (%.2f%%), hottest shard %d (%lld waits)"),
+			Acquisitions.Num(), GetTotalAcquisitions(), GetTotalWaits(), GetWaitRatio() * 100.0,
+			Hottest, Hottest >= 0 ? Waits[Hottest] : 0);
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,348 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Helpers/PCGExTangentFrameTestHelpers.h"
+#include "Async/ParallelFor.h"
+
+namespace PCGExTest::TestTangentFrames
+{
+	namespace
+	{
+		/** Nodes per batch in the structure-of-arrays passes */
+		constexpr int32 BatchSize = 1024;
+
+		/** Normals closer than this to Forward use Right as X hint */
+		constexpr double ForwardHintThreshold = 0.95;
+
+		/** Same scale as FVector::GetSafeNormal, so both paths normalize bit-identically */
+		FORCEINLINE double SafeNormalScale(const double SquareSum)
+		{
+			return SquareSum == 1.0 ? 1.0 : SquareSum < UE_SMALL_NUMBER ? 0.0 : FMath::InvSqrt(SquareSum);
+		}
+
+		FORCEINLINE FQuat MakeFrame(const FVector& Normal)
+		{
+			const FVector XHint = FMath::Abs(Normal | FVector::ForwardVector) < ForwardHintThreshold ? FVector::ForwardVector : FVector::RightVector;
+			return FRotationMatrix::MakeFromZX(Normal, XHint).ToQuat();
+		}
+	}
+
+#pragma region Scalar
+
+	void ComputeScalar(const FTestCluster& Cluster, TArray<FQuat>& OutFrames, TArray<FVector>* OutNormals)
+	{
+		const int32 NumNodes = Cluster.NumNodes();
+
+		// Step 1: per-node normal from the most independent pair of edge directions
+		TArray<FVector> Normals;
+		Normals.SetNumUninitialized(NumNodes);
+
+		TArray<FVector> Directions;
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			const TConstArrayView<PCGExGraphs::FLink> Links = Cluster.GetLinks(i);
+			if (Links.Num() < 2)
+			{
+				Normals[i] = FVector::UpVector;
+				continue;
+			}
+
+			const FVector Origin = Cluster.GetPos(i);
+
+			Directions.Reset();
+			for (const PCGExGraphs::FLink& Lk : Links) { Directions.Add((Cluster.GetPos(Lk.Node) - Origin).GetSafeNormal()); }
+
+			double BestLength = 0;
+			FVector BestCross = FVector::ZeroVector;
+
+			for (int32 a = 0; a < Directions.Num(); a++)
+			{
+				for (int32 b = a + 1; b < Directions.Num(); b++)
+				{
+					const FVector Cross = Directions[a] ^ Directions[b];
+					const double Length = Cross.Size();
+					if (Length > BestLength)
+					{
+						BestLength = Length;
+						BestCross = Cross;
+					}
+				}
+			}
+
+			// Collinear neighbors carry no orientation
+			Normals[i] = BestLength > UE_KINDA_SMALL_NUMBER ? BestCross * (1.0 / BestLength) : FVector::UpVector;
+		}
+
+		// Step 2: BFS sign consistency, one traversal per connected component
+		TBitArray<> Visited(false, NumNodes);
+		TArray<int32> Queue;
+		Queue.Reserve(NumNodes);
+
+		for (int32 Seed = 0; Seed < NumNodes; Seed++)
+		{
+			if (Visited[Seed]) { continue; }
+
+			Visited[Seed] = true;
+			Queue.Reset();
+			Queue.Add(Seed);
+
+			for (int32 Head = 0; Head < Queue.Num(); Head++)
+			{
+				const int32 Current = Queue[Head];
+				for (const PCGExGraphs::FLink& Lk : Cluster.GetLinks(Current))
+				{
+					if (Visited[Lk.Node]) { continue; }
+					Visited[Lk.Node] = true;
+
+					if ((Normals[Current] | Normals[Lk.Node]) < 0) { Normals[Lk.Node] = -Normals[Lk.Node]; }
+					Queue.Add(Lk.Node);
+				}
+			}
+		}
+
+		// Step 3: frames
+		OutFrames.SetNumUninitialized(NumNodes);
+		for (int32 i = 0; i < NumNodes; i++) { OutFrames[i] = MakeFrame(Normals[i]); }
+
+		if (OutNormals) { *OutNormals = MoveTemp(Normals); }
+	}
+
+#pragma endregion
+
+#pragma region Batched
+
+	void ComputeBatched(const FTestCluster& Cluster, TArray<FQuat>& OutFrames, TArray<FVector>* OutNormals, const bool bParallel)
+	{
+		const int32 NumNodes = Cluster.NumNodes();
+		const int32 NumBatches = FMath::DivideAndRoundUp(NumNodes, BatchSize);
+
+		const int32* Offsets = Cluster.AdjacencyOffsets.GetData();
+		const PCGExGraphs::FLink* Links = Cluster.AdjacencyLinks.GetData();
+
+		// Node positions as component arrays
+		TArray<double> PX, PY, PZ;
+		PX.SetNumUninitialized(NumNodes);
+		PY.SetNumUninitialized(NumNodes);
+		PZ.SetNumUninitialized(NumNodes);
+
+		TArray<double> NX, NY, NZ;
+		NX.SetNumUninitialized(NumNodes);
+		NY.SetNumUninitialized(NumNodes);
+		NZ.SetNumUninitialized(NumNodes);
+
+		ParallelFor(
+			NumBatches, [&](const int32 BatchIndex)
+			{
+				const int32 Start = BatchIndex * BatchSize;
+				const int32 End = FMath::Min(Start + BatchSize, NumNodes);
+
+				for (int32 i = Start; i < End; i++)
+				{
+					const FVector Pos = Cluster.GetPos(i);
+					PX[i] = Pos.X;
+					PY[i] = Pos.Y;
+					PZ[i] = Pos.Z;
+				}
+			}, !bParallel);
+
+		// Step 1: normals, batch by batch
+		ParallelFor(
+			NumBatches, [&](const int32 BatchIndex)
+			{
+				const int32 Start = BatchIndex * BatchSize;
+				const int32 End = FMath::Min(Start + BatchSize, NumNodes);
+
+				TArray<double, TInlineAllocator<16>> DX, DY, DZ;
+
+				for (int32 i = Start; i < End; i++)
+				{
+					const int32 First = Offsets[i];
+					const int32 Degree = Offsets[i + 1] - First;
+
+					NX[i] = 0;
+					NY[i] = 0;
+					NZ[i] = 1;
+
+					if (Degree < 2) { continue; }
+
+					DX.SetNumUninitialized(Degree, EAllowShrinking::No);
+					DY.SetNumUninitialized(Degree, EAllowShrinking::No);
+					DZ.SetNumUninitialized(Degree, EAllowShrinking::No);
+
+					// Gather, then normalize in a separate straight loop
+					for (int32 k = 0; k < Degree; k++)
+					{
+						const int32 Other = Links[First + k].Node;
+						DX[k] = PX[Other] - PX[i];
+						DY[k] = PY[Other] - PY[i];
+						DZ[k] = PZ[Other] - PZ[i];
+					}
+
+					for (int32 k = 0; k < Degree; k++)
+					{
+						const double Scale = SafeNormalScale(DX[k] * DX[k] + DY[k] * DY[k] + DZ[k] * DZ[k]);
+						DX[k] *= Scale;
+						DY[k] *= Scale;
+						DZ[k] *= Scale;
+					}
+
+					double BestLength = 0;
+					double BX = 0, BY = 0, BZ = 0;
+
+					for (int32 a = 0; a < Degree; a++)
+					{
+						for (int32 b = a + 1; b < Degree; b++)
+						{
+							const double CX = DY[a] * DZ[b] - DZ[a] * DY[b];
+							const double CY = DZ[a] * DX[b] - DX[a] * DZ[b];
+							const double CZ = DX[a] * DY[b] - DY[a] * DX[b];
+							const double Length = FMath::Sqrt(CX * CX + CY * CY + CZ * CZ);
+							if (Length > BestLength)
+							{
+								BestLength = Length;
+								BX = CX;
+								BY = CY;
+								BZ = CZ;
+							}
+						}
+					}
+
+					if (BestLength > UE_KINDA_SMALL_NUMBER)
+					{
+						const double InvLength = 1.0 / BestLength;
+						NX[i] = BX * InvLength;
+						NY[i] = BY * InvLength;
+						NZ[i] = BZ * InvLength;
+					}
+				}
+			}, !bParallel);
+
+		// Step 2: BFS only propagates a sign; normals stay untouched until the flip pass
+		TArray<int8> Sign;
+		Sign.SetNumZeroed(NumNodes);
+
+		TArray<int32> Queue;
+		Queue.Reserve(NumNodes);
+
+		for (int32 Seed = 0; Seed < NumNodes; Seed++)
+		{
+			if (Sign[Seed]) { continue; }
+
+			Sign[Seed] = 1;
+			Queue.Reset();
+			Queue.Add(Seed);
+
+			for (int32 Head = 0; Head < Queue.Num(); Head++)
+			{
+				const int32 Current = Queue[Head];
+				const int8 CurrentSign = Sign[Current];
+
+				for (int32 k = Offsets[Current]; k < Offsets[Current + 1]; k++)
+				{
+					const int32 Other = Links[k].Node;
+					if (Sign[Other]) { continue; }
+
+					// Flip when the other normal disagrees with the current, already signed, normal
+					const double Dot = CurrentSign * (NX[Current] * NX[Other] + NY[Current] * NY[Other] + NZ[Current] * NZ[Other]);
+					Sign[Other] = Dot < 0 ? -1 : 1;
+					Queue.Add(Other);
+				}
+			}
+		}
+
+		// Step 3: flip + frames, matrix and quaternion built inline rather than through FRotationMatrix
+		OutFrames.SetNumUninitialized(NumNodes);
+		if (OutNormals) { OutNormals->SetNumUninitialized(NumNodes); }
+
+		ParallelFor(
+			NumBatches, [&](const int32 BatchIndex)
+			{
+				const int32 Start = BatchIndex * BatchSize;
+				const int32 End = FMath::Min(Start + BatchSize, NumNodes);
+
+				for (int32 i = Start; i < End; i++)
+				{
+					// Sign[i] is set for every node by now
+					const double S = Sign[i];
+					NX[i] *= S;
+					NY[i] *= S;
+					NZ[i] *= S;
+				}
+
+				for (int32 i = Start; i < End; i++)
+				{
+					const double ZX = NX[i], ZY = NY[i], ZZ = NZ[i];
+
+					// Hint is Forward (1,0,0) or Right (0,1,0); Forward dot N is ZX
+					const double UseForward = FMath::Abs(ZX) < ForwardHintThreshold ? 1.0 : 0.0;
+					const double HX = UseForward;
+					const double HY = 1.0 - UseForward;
+
+					// Y = normalize(Z ^ Hint), X = Y ^ Z
+					double YX = -ZZ * HY;
+					double YY = ZZ * HX;
+					double YZ = ZX * HY - ZY * HX;
+					const double YScale = SafeNormalScale(YX * YX + YY * YY + YZ * YZ);
+					YX *= YScale;
+					YY *= YScale;
+					YZ *= YScale;
+
+					const double XX = YY * ZZ - YZ * ZY;
+					const double XY = YZ * ZX - YX * ZZ;
+					const double XZ = YX * ZY - YY * ZX;
+
+					// Rows of the rotation matrix are X, Y, Z (FMatrix layout), converted like FQuat(FMatrix)
+					const double M[3][3] = {{XX, XY, XZ}, {YX, YY, YZ}, {ZX, ZY, ZZ}};
+					double Q[4];
+
+					const double Trace = M[0][0] + M[1][1] + M[2][2];
+					if (Trace > 0)
+					{
+						const double InvS = FMath::InvSqrt(Trace + 1.0);
+						const double Half = 0.5 * InvS;
+						Q[3] = 0.5 * (1.0 / InvS);
+						Q[0] = (M[1][2] - M[2][1]) * Half;
+						Q[1] = (M[2][0] - M[0][2]) * Half;
+						Q[2] = (M[0][1] - M[1][0]) * Half;
+					}
+					else
+					{
+						int32 A = 0;
+						if (M[1][1] > M[0][0]) { A = 1; }
+						if (M[2][2] > M[A][A]) { A = 2; }
+
+						static constexpr int32 Next[3] = {1, 2, 0};
+						const int32 B = Next[A];
+						const int32 C = Next[B];
+
+						const double InvS = FMath::InvSqrt(M[A][A] - M[B][B] - M[C][C] + 1.0);
+						const double Half = 0.5 * InvS;
+						Q[A] = 0.5 * (1.0 / InvS);
+						Q[3] = (M[B][C] - M[C][B]) * Half;
+						Q[B] = (M[A][B] + M[B][A]) * Half;
+						Q[C] = (M[A][C] + M[C][A]) * Half;
+					}
+
+					OutFrames[i] = FQuat(Q[0], Q[1], Q[2], Q[3]);
+				}
+
+				if (OutNormals)
+				{
+					for (int32 i = Start; i < End; i++) { (*OutNormals)[i] = FVector(NX[i], NY[i], NZ[i]); }
+				}
+			}, !bParallel);
+	}
+
+#pragma endregion
+
+	TSharedPtr<PCGExClusters::FCachedTangentFrames> BuildCachedTangentFrames(const FTestCluster& Cluster, const bool bBatched)
+	{
+		TSharedPtr<TArray<FQuat>> Frames = MakeShared<TArray<FQuat>>();
+		if (bBatched) { ComputeBatched(Cluster, *Frames); }
+		else { ComputeScalar(Cluster, *Frames); }
+
+		TSharedPtr<PCGExClusters::FCachedTangentFrames> Cached = MakeShared<PCGExClusters::FCachedTangentFrames>();
+		Cached->NodeTangentFrames = Frames;
+		return Cached;
+	}
+}
@@ -0,0 +1,529 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Helpers/PCGExVoronoiTestHelpers.h"
+#include "Helpers/PCGExPredicateHelpers.h"
+#include "Algo/Reverse.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+#include "PCGExH.h"
+
+namespace PCGExTest
+{
+	namespace
+	{
+		/** Face of a site, sorted, with the site it belongs to */
+		struct FSiteFace
+		{
+			int32 A;
+			int32 B;
+			int32 C;
+			int32 Site;
+
+			FORCEINLINE bool SameFace(const FSiteFace& Other) const { return A == Other.A && B == Other.B && C == Other.C; }
+			FORCEINLINE bool operator<(const FSiteFace& Other) const
+			{
+				if (A != Other.A) { return A < Other.A; }
+				if (B != Other.B) { return B < Other.B; }
+				return C < Other.C;
+			}
+		};
+
+		FORCEINLINE bool ComputeBend(
+			const EPCGExVoronoiMetric Metric,
+			const FVector2D& Start, const FVector2D& End,
+			const FVector2D& SiteA, const FVector2D& SiteB,
+			FVector2D& OutBend)
+		{
+			switch (Metric)
+			{
+			case EPCGExVoronoiMetric::Manhattan: return TestVoronoiPaths::ComputeL1Bend(Start, End, SiteA, SiteB, OutBend);
+			case EPCGExVoronoiMetric::Chebyshev: return TestVoronoiPaths::ComputeLInfBend(Start, End, SiteA, SiteB, OutBend);
+			default: return false;
+			}
+		}
+	}
+
+#pragma region TestVoronoiPaths
+
+	namespace TestVoronoiPaths
+	{
+		bool ComputeL1Bend(
+			const FVector2D& Start, const FVector2D& End,
+			const FVector2D& SiteA, const FVector2D& SiteB,
+			FVector2D& OutBend)
+		{
+			const FVector2D Delta = End - Start;
+			const double AbsX = FMath::Abs(Delta.X);
+			const double AbsY = FMath::Abs(Delta.Y);
+
+			// Axis-aligned or diagonal already
+			const double Tolerance = UE_DOUBLE_KINDA_SMALL_NUMBER * FMath::Max(1.0, AbsX + AbsY);
+			if (AbsX <= Tolerance || AbsY <= Tolerance || FMath::Abs(AbsX - AbsY) <= Tolerance) { return false; }
+
+			const double Length = FMath::Min(AbsX, AbsY);
+			const FVector2D Diagonal(FMath::Sign(Delta.X) * Length, FMath::Sign(Delta.Y) * Length);
+
+			// The Manhattan bisector of two sites turns diagonal between them
+			const FVector2D Mid = (SiteA + SiteB) * 0.5;
+			const FVector2D ToFirst = Start + Diagonal * 0.5 - Mid;
+			const FVector2D ToLast = End - Diagonal * 0.5 - Mid;
+
+			const bool bDiagonalFirst = FMath::Abs(ToFirst.X) + FMath::Abs(ToFirst.Y) <= FMath::Abs(ToLast.X) + FMath::Abs(ToLast.Y);
+			OutBend = bDiagonalFirst ? Start + Diagonal : End - Diagonal;
+			return true;
+		}
+
+		bool ComputeLInfBend(
+			const FVector2D& Start, const FVector2D& End,
+			const FVector2D& SiteA, const FVector2D& SiteB,
+			FVector2D& OutBend)
+		{
+			FVector2D Bend;
+			if (!ComputeL1Bend(ToLInf(Start), ToLInf(End), ToLInf(SiteA), ToLInf(SiteB), Bend)) { return false; }
+
+			OutBend = FromLInf(Bend);
+			return true;
+		}
+
+		void ComputeEdgePath(
+			const EPCGExVoronoiMetric Metric,
+			const FVector2D& Start, const FVector2D& End,
+			const FVector2D& SiteA, const FVector2D& SiteB,
+			TArray<FVector2D>& OutPath)
+		{
+			OutPath.Reset();
+			OutPath.Add(Start);
+
+			FVector2D Bend;
+			if (ComputeBend(Metric, Start, End, SiteA, SiteB, Bend)) { OutPath.Add(Bend); }
+
+			OutPath.Add(End);
+		}
+	}
+
+#pragma endregion
+
+#pragma region FTestVoronoi2
+
+	bool FTestVoronoi2::Process(const TConstArrayView<FVector2D> Positions)
+	{
+		IsValid = false;
+		Circumcenters.Reset();
+		VoronoiEdges.Reset();
+		PointSite.Reset();
+
+		Delaunay = MakeShared<FTestDelaunay2>();
+		if (!Delaunay->Process(Positions)) { return false; }
+
+		PointSite.Init(INDEX_NONE, Positions.Num());
+		for (const PCGExMath::Geo::FDelaunaySite2& Site : Delaunay->Sites)
+		{
+			for (int32 k = 0; k < 3; k++) { PointSite[Site.Vtx[k]] = Site.Id; }
+		}
+
+		IsValid = true;
+		return true;
+	}
+
+	bool FTestVoronoi2::ProcessAll(const TConstArrayView<FVector2D> Positions)
+	{
+		if (!Process(Positions)) { return false; }
+
+		const TArray<PCGExMath::Geo::FDelaunaySite2>& Sites = Delaunay->Sites;
+
+		Circumcenters.SetNumUninitialized(Sites.Num());
+		ParallelFor(Sites.Num(), [&](const int32 i) { Circumcenters[i] = GetCircumcenter(i); });
+
+		VoronoiEdges.Reserve(Sites.Num() * 3 / 2);
+		for (const PCGExMath::Geo::FDelaunaySite2& Site : Sites)
+		{
+			for (int32 k = 0; k < 3; k++)
+			{
+				if (Site.Neighbors[k] > Site.Id) { VoronoiEdges.Add(PCGEx::H64U(Site.Id, Site.Neighbors[k])); }
+			}
+		}
+
+		return true;
+	}
+
+	FVector2D FTestVoronoi2::GetCircumcenter(const int32 Site) const
+	{
+		const TConstArrayView<FVector2D> Vertices = Delaunay->GetVertices();
+		const PCGExMath::Geo::FDelaunaySite2& S = Delaunay->Sites[Site];
+
+		const FVector2D& A = Vertices[S.Vtx[0]];
+		const FVector2D& B = Vertices[S.Vtx[1]];
+		const FVector2D& C = Vertices[S.Vtx[2]];
+
+		FVector2D Center;
+		if (!TestPredicates::GetCircumcenter(A, B, C, Center)) { Center = (A + B + C) / 3; }
+		return Center;
+	}
+
+	bool FTestVoronoi2::GetCell(const int32 Point, FTestVoronoiCell2& OutCell) const
+	{
+		OutCell.Point = Point;
+		OutCell.Sites.Reset();
+		OutCell.Vertices.Reset();
+		OutCell.bClosed = false;
+
+		if (!PointSite.IsValidIndex(Point) || PointSite[Point] == INDEX_NONE) { return false; }
+
+		const TArray<PCGExMath::Geo::FDelaunaySite2>& Sites = Delaunay->Sites;
+
+		// In a counter-clockwise site (Point, A, B), the next site counter-clockwise around Point is across B -> Point
+		auto Step = [&](const int32 Site, const bool bCounterClockwise)
+		{
+			const PCGExMath::Geo::FDelaunaySite2& S = Sites[Site];
+			const int32 K = S.Vtx[0] == Point ? 0 : S.Vtx[1] == Point ? 1 : 2;
+			return S.Neighbors[bCounterClockwise ? (K + 2) % 3 : K];
+		};
+
+		const int32 First = PointSite[Point];
+		int32 Site = First;
+		do
+		{
+			OutCell.Sites.Add(Site);
+			Site = Step(Site, true);
+		}
+		while (Site != INDEX_NONE && Site != First);
+
+		OutCell.bClosed = Site == First;
+
+		if (!OutCell.bClosed)
+		{
+			// Hit the hull: prepend what lies clockwise of the first site
+			TArray<int32> Clockwise;
+			for (Site = Step(First, false); Site != INDEX_NONE; Site = Step(Site, false)) { Clockwise.Add(Site); }
+
+			Algo::Reverse(Clockwise);
+			Clockwise.Append(OutCell.Sites);
+			OutCell.Sites = MoveTemp(Clockwise);
+		}
+
+		OutCell.Vertices.SetNumUninitialized(OutCell.Sites.Num());
+		for (int32 i = 0; i < OutCell.Sites.Num(); i++) { OutCell.Vertices[i] = GetCircumcenter(OutCell.Sites[i]); }
+
+		return true;
+	}
+
+	int32 FTestVoronoi2::GetCellsInBounds(const FBox2D& Bounds, TArray<FTestVoronoiCell2>& OutCells) const
+	{
+		OutCells.Reset();
+		if (!IsValid) { return 0; }
+
+		const TConstArrayView<FVector2D> Vertices = Delaunay->GetVertices();
+
+		TArray<int32> Points;
+		for (int32 i = 0; i < PointSite.Num(); i++)
+		{
+			if (PointSite[i] != INDEX_NONE && Bounds.IsInside(Vertices[i])) { Points.Add(i); }
+		}
+
+		OutCells.SetNum(Points.Num());
+		ParallelFor(Points.Num(), [&](const int32 i) { GetCell(Points[i], OutCells[i]); });
+
+		return OutCells.Num();
+	}
+
+	bool FTestVoronoi2::BuildPaths(const EPCGExVoronoiMetric Metric, FTestVoronoiPaths2& OutPaths) const
+	{
+		OutPaths.Vertices.Reset();
+		OutPaths.Edges.Reset();
+		OutPaths.NumBends = 0;
+
+		if (!IsValid) { return false; }
+
+		const TArray<PCGExMath::Geo::FDelaunaySite2>& Sites = Delaunay->Sites;
+		const TConstArrayView<FVector2D> Positions = Delaunay->GetVertices();
+		const int32 NumSites = Sites.Num();
+
+		// Each edge belongs to its lower site
+		TArray<int32> EdgeOffsets;
+		EdgeOffsets.SetNumUninitialized(NumSites + 1);
+		EdgeOffsets[0] = 0;
+
+		ParallelFor(
+			NumSites, [&](const int32 i)
+			{
+				int32 Count = 0;
+				for (int32 k = 0; k < 3; k++) { if (Sites[i].Neighbors[k] > i) { Count++; } }
+				EdgeOffsets[i + 1] = Count;
+			});
+
+		for (int32 i = 0; i < NumSites; i++) { EdgeOffsets[i + 1] += EdgeOffsets[i]; }
+		const int32 NumEdges = EdgeOffsets[NumSites];
+
+		// At most one bend per edge: bends land in their edge slot past the circumcenters, then get compacted
+		TArray<FVector2D>& Vertices = OutPaths.Vertices;
+		Vertices.SetNumUninitialized(NumSites + NumEdges);
+
+		if (Circumcenters.Num() == NumSites) { FMemory::Memcpy(Vertices.GetData(), Circumcenters.GetData(), NumSites * sizeof(FVector2D)); }
+		else { ParallelFor(NumSites, [&](const int32 i) { Vertices[i] = GetCircumcenter(i); }); }
+
+		TArray<int32> BendOffsets;
+		BendOffsets.SetNumUninitialized(NumEdges + 1);
+		BendOffsets[0] = 0;
+
+		ParallelFor(
+			NumSites, [&](const int32 i)
+			{
+				const PCGExMath::Geo::FDelaunaySite2& Site = Sites[i];
+				int32 Edge = EdgeOffsets[i];
+
+				for (int32 k = 0; k < 3; k++)
+				{
+					const int32 Neighbor = Site.Neighbors[k];
+					if (Neighbor <= i) { continue; }
+
+					FVector2D Bend;
+					const bool bBent = ComputeBend(Metric, Vertices[i], Vertices[Neighbor], Positions[Site.Vtx[k]], Positions[Site.Vtx[(k + 1) % 3]], Bend);
+					if (bBent) { Vertices[NumSites + Edge] = Bend; }
+
+					BendOffsets[++Edge] = bBent ? 1 : 0;
+				}
+			});
+
+		for (int32 e = 0; e < NumEdges; e++) { BendOffsets[e + 1] += BendOffsets[e]; }
+		OutPaths.NumBends = BendOffsets[NumEdges];
+
+		// Slot e only ever moves down, to NumSites + BendOffsets[e]
+		for (int32 e = 0; e < NumEdges; e++)
+		{
+			if (BendOffsets[e + 1] != BendOffsets[e]) { Vertices[NumSites + BendOffsets[e]] = Vertices[NumSites + e]; }
+		}
+
+		Vertices.SetNum(NumSites + OutPaths.NumBends, EAllowShrinking::No);
+
+		// Edge e starts at e + BendOffsets[e]
+		OutPaths.Edges.SetNumUninitialized(NumEdges + OutPaths.NumBends);
+
+		ParallelFor(
+			NumSites, [&](const int32 i)
+			{
+				const PCGExMath::Geo::FDelaunaySite2& Site = Sites[i];
+				int32 Edge = EdgeOffsets[i];
+
+				for (int32 k = 0; k < 3; k++)
+				{
+					const int32 Neighbor = Site.Neighbors[k];
+					if (Neighbor <= i) { continue; }
+
+					const int32 Out = Edge + BendOffsets[Edge];
+					if (BendOffsets[Edge + 1] != BendOffsets[Edge])
+					{
+						const int32 Bend = NumSites + BendOffsets[Edge];
+						OutPaths.Edges[Out] = PCGEx::H64U(i, Bend);
+						OutPaths.Edges[Out + 1] = PCGEx::H64U(Bend, Neighbor);
+					}
+					else { OutPaths.Edges[Out] = PCGEx::H64U(i, Neighbor); }
+
+					Edge++;
+				}
+			});
+
+		return true;
+	}
+
+	bool FTestVoronoi2::BuildPathsPerEdge(const EPCGExVoronoiMetric Metric, FTestVoronoiPaths2& OutPaths) const
+	{
+		OutPaths.Vertices.Reset();
+		OutPaths.Edges.Reset();
+		OutPaths.NumBends = 0;
+
+		if (!IsValid) { return false; }
+
+		const TArray<PCGExMath::Geo::FDelaunaySite2>& Sites = Delaunay->Sites;
+		const TConstArrayView<FVector2D> Positions = Delaunay->GetVertices();
+		const int32 NumSites = Sites.Num();
+
+		for (int32 i = 0; i < NumSites; i++) { OutPaths.Vertices.Add(Circumcenters.Num() == NumSites ? Circumcenters[i] : GetCircumcenter(i)); }
+
+		TArray<FVector2D> Path;
+		for (int32 i = 0; i < NumSites; i++)
+		{
+			const PCGExMath::Geo::FDelaunaySite2& Site = Sites[i];
+			for (int32 k = 0; k < 3; k++)
+			{
+				const int32 Neighbor = Site.Neighbors[k];
+				if (Neighbor <= i) { continue; }
+
+				TestVoronoiPaths::ComputeEdgePath(Metric, OutPaths.Vertices[i], OutPaths.Vertices[Neighbor], Positions[Site.Vtx[k]], Positions[Site.Vtx[(k + 1) % 3]], Path);
+
+				int32 Previous = i;
+				for (int32 p = 1; p < Path.Num() - 1; p++)
+				{
+					const int32 Bend = OutPaths.Vertices.Add(Path[p]);
+					OutPaths.Edges.Add(PCGEx::H64U(Previous, Bend));
+					OutPaths.NumBends++;
+					Previous = Bend;
+				}
+
+				OutPaths.Edges.Add(PCGEx::H64U(Previous, Neighbor));
+			}
+		}
+
+		return true;
+	}
+
+#pragma endregion
+
+#pragma region FTestVoronoi3
+
+	bool FTestVoronoi3::Process(const TConstArrayView<FVector> Positions, const bool bParallel)
+	{
+		IsValid = false;
+		Circumspheres.Reset();
+		VoronoiEdges.Reset();
+		PointSiteOffsets.Reset();
+		PointSites.Reset();
+
+		Delaunay = MakeShared<FTestDelaunay3>();
+		if (!(bParallel ? Delaunay->ProcessParallel(Positions) : Delaunay->Process(Positions))) { return false; }
+
+		// Incident sites per point, counting sort
+		const TArray<PCGExMath::Geo::FDelaunaySite3>& Sites = Delaunay->Sites;
+
+		PointSiteOffsets.SetNumZeroed(Positions.Num() + 1);
+		for (const PCGExMath::Geo::FDelaunaySite3& Site : Sites)
+		{
+			for (int32 k = 0; k < 4; k++) { PointSiteOffsets[Site.Vtx[k] + 1]++; }
+		}
+
+		for (int32 i = 0; i < Positions.Num(); i++) { PointSiteOffsets[i + 1] += PointSiteOffsets[i]; }
+
+		TArray<int32> Cursor(PointSiteOffsets.GetData(), Positions.Num());
+		PointSites.SetNumUninitialized(Sites.Num() * 4);
+		for (int32 s = 0; s < Sites.Num(); s++)
+		{
+			for (int32 k = 0; k < 4; k++) { PointSites[Cursor[Sites[s].Vtx[k]]++] = s; }
+		}
+
+		IsValid = true;
+		return true;
+	}
+
+	bool FTestVoronoi3::ProcessAll(const TConstArrayView<FVector> Positions, const bool bParallel)
+	{
+		if (!Process(Positions, bParallel)) { return false; }
+
+		const TArray<PCGExMath::Geo::FDelaunaySite3>& Sites = Delaunay->Sites;
+
+		Circumspheres.SetNumUninitialized(Sites.Num());
+		ParallelFor(Sites.Num(), [&](const int32 i) { Circumspheres[i] = GetCircumsphere(i); });
+
+		// Sites sharing a face; Vtx is sorted, so dropping one corner keeps the face sorted
+		TArray<FSiteFace> Faces;
+		Faces.SetNumUninitialized(Sites.Num() * 4);
+		for (int32 s = 0; s < Sites.Num(); s++)
+		{
+			const int32* V = Sites[s].Vtx;
+			Faces[s * 4] = {V[1], V[2], V[3], s};
+			Faces[s * 4 + 1] = {V[0], V[2], V[3], s};
+			Faces[s * 4 + 2] = {V[0], V[1], V[3], s};
+			Faces[s * 4 + 3] = {V[0], V[1], V[2], s};
+		}
+
+		Algo::Sort(Faces);
+
+		VoronoiEdges.Reserve(Sites.Num() * 2);
+		for (int32 i = 1; i < Faces.Num(); i++)
+		{
+			if (Faces[i].SameFace(Faces[i - 1])) { VoronoiEdges.Add(PCGEx::H64U(Faces[i - 1].Site, Faces[i].Site)); }
+		}
+
+		return true;
+	}
+
+	FSphere FTestVoronoi3::GetCircumsphere(const int32 Site) const
+	{
+		const TConstArrayView<FVector> Vertices = Delaunay->GetVertices();
+		const PCGExMath::Geo::FDelaunaySite3& S = Delaunay->Sites[Site];
+
+		const FVector& A = Vertices[S.Vtx[0]];
+		const FVector& B = Vertices[S.Vtx[1]];
+		const FVector& C = Vertices[S.Vtx[2]];
+		const FVector& D = Vertices[S.Vtx[3]];
+
+		FVector Center;
+		if (!TestPredicates::GetCircumcenter(A, B, C, D, Center)) { Center = (A + B + C + D) / 4; }
+		return FSphere(Center, FVector::Dist(Center, A));
+	}
+
+	bool FTestVoronoi3::GetCell(const int32 Point, FTestVoronoiCell3& OutCell) const
+	{
+		OutCell.Point = Point;
+		OutCell.Sites.Reset();
+		OutCell.Vertices.Reset();
+		OutCell.Edges.Reset();
+		OutCell.bClosed = false;
+
+		if (!PointSiteOffsets.IsValidIndex(Point + 1)) { return false; }
+
+		const int32 Begin = PointSiteOffsets[Point];
+		const int32 NumSites = PointSiteOffsets[Point + 1] - Begin;
+		if (NumSites == 0) { return false; }
+
+		const TArray<PCGExMath::Geo::FDelaunaySite3>& Sites = Delaunay->Sites;
+
+		OutCell.Sites.Append(PointSites.GetData() + Begin, NumSites);
+		OutCell.Vertices.SetNumUninitialized(NumSites);
+
+		// The three faces of each site through Point, keyed by their two other corners
+		TArray<TPair<uint64, int32>> Faces;
+		Faces.Reserve(NumSites * 3);
+
+		for (int32 i = 0; i < NumSites; i++)
+		{
+			const int32 Site = OutCell.Sites[i];
+			OutCell.Vertices[i] = GetCircumsphere(Site).Center;
+
+			int32 Others[3];
+			int32 NumOthers = 0;
+			for (int32 k = 0; k < 4; k++) { if (Sites[Site].Vtx[k] != Point) { Others[NumOthers++] = Sites[Site].Vtx[k]; } }
+
+			Faces.Emplace(PCGEx::H64U(Others[0], Others[1]), i);
+			Faces.Emplace(PCGEx::H64U(Others[0], Others[2]), i);
+			Faces.Emplace(PCGEx::H64U(Others[1], Others[2]), i);
+		}
+
+		Faces.Sort([](const TPair<uint64, int32>& A, const TPair<uint64, int32>& B) { return A.Key < B.Key; });
+
+		// Interior faces come in pairs; a lone face is on the hull
+		int32 NumOpen = 0;
+		for (int32 i = 0; i < Faces.Num(); i++)
+		{
+			if (i + 1 < Faces.Num() && Faces[i].Key == Faces[i + 1].Key)
+			{
+				OutCell.Edges.Add(PCGEx::H64U(Faces[i].Value, Faces[i + 1].Value));
+				i++;
+			}
+			else { NumOpen++; }
+		}
+
+		OutCell.bClosed = NumOpen == 0;
+		return true;
+	}
+
+	int32 FTestVoronoi3::GetCellsInBounds(const FBox& Bounds, TArray<FTestVoronoiCell3>& OutCells) const
+	{
+		OutCells.Reset();
+		if (!IsValid) { return 0; }
+
+		const TConstArrayView<FVector> Vertices = Delaunay->GetVertices();
+
+		TArray<int32> Points;
+		for (int32 i = 0; i + 1 < PointSiteOffsets.Num(); i++)
+		{
+			if (PointSiteOffsets[i + 1] > PointSiteOffsets[i] && Bounds.IsInside(Vertices[i])) { Points.Add(i); }
+		}
+
+		OutCells.SetNum(Points.Num());
+		ParallelFor(Points.Num(), [&](const int32 i) { GetCell(Points[i], OutCells[i]); });
+
+		return OutCells.Num();
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,766 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+/**
+ * PCGEx Cluster Performance Tests
+ *
+ * Benchmarks cluster topology layouts and the algorithms built on top of them
+ * (traversal, chain extraction, half-edge construction, tangent frames, artifact caching) on large
+ * synthetic graphs.
+ *
+ * Run these tests:
+ * - In Editor: Session Frontend > Automation > Filter "PCGEx.Performance.Clusters"
+ */
+
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+
+#include "Helpers/PCGExClusterHelpers.h"
+#include "Helpers/PCGExClusterReorderHelpers.h"
+#include "Helpers/PCGExChainTestHelpers.h"
+#include "Helpers/PCGExCompactEdgeHelpers.h"
+#include "Helpers/PCGExDCELTestHelpers.h"
+#include "Helpers/PCGExNodeClassHelpers.h"
+#include "Helpers/PCGExPersistentCacheHelpers.h"
+#include "Helpers/PCGExTangentFrameTestHelpers.h"
+
+namespace PCGExClusterPerfLocal
+{
+	/** BFS from node 0 reading per-node FNode::Links. Returns the sum of depths. */
+	int64 BFSNodeLinks(const TSharedRef<PCGExTest::FTestCluster>& Cluster)
+	{
+		const int32 NumNodes = Cluster->Nodes->Num();
+		TArray<int32> Depth;
+		Depth.Init(-1, NumNodes);
+		TArray<int32> Queue;
+		Queue.Reserve(NumNodes);
+
+		Depth[0] = 0;
+		Queue.Add(0);
+		int64 Sum = 0;
+
+		for (int32 Head = 0; Head < Queue.Num(); Head++)
+		{
+			const int32 Current = Queue[Head];
+			Sum += Depth[Current];
+			for (const PCGExGraphs::FLink& Lk : Cluster->GetNode(Current)->Links)
+			{
+				if (Depth[Lk.Node] != -1) { continue; }
+				Depth[Lk.Node] = Depth[Current] + 1;
+				Queue.Add(Lk.Node);
+			}
+		}
+
+		return Sum;
+	}
+
+	/** BFS from node 0 reading the CSR adjacency. Returns the sum of depths. */
+	int64 BFSAdjacency(const TSharedRef<PCGExTest::FTestCluster>& Cluster)
+	{
+		const int32 NumNodes = Cluster->NumNodes();
+		TArray<int32> Depth;
+		Depth.Init(-1, NumNodes);
+		TArray<int32> Queue;
+		Queue.Reserve(NumNodes);
+
+		Depth[0] = 0;
+		Queue.Add(0);
+		int64 Sum = 0;
+
+		for (int32 Head = 0; Head < Queue.Num(); Head++)
+		{
+			const int32 Current = Queue[Head];
+			Sum += Depth[Current];
+			for (const PCGExGraphs::FLink& Lk : Cluster->GetLinks(Current))
+			{
+				if (Depth[Lk.Node] != -1) { continue; }
+				Depth[Lk.Node] = Depth[Current] + 1;
+				Queue.Add(Lk.Node);
+			}
+		}
+
+		return Sum;
+	}
+}
+
+//////////////////////////////////////////////////////////////////
+// Adjacency Layout
+//////////////////////////////////////////////////////////////////
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfClusterAdjacencyBFS,
+	"PCGEx.Performance.Clusters.Adjacency.BFS",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfClusterAdjacencyBFS::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	constexpr int32 GridSize = 700;
+	constexpr int32 NumRuns = 5;
+
+	const double StartBuild = FPlatformTime::Seconds();
+	TSharedRef<FTestCluster> Regular = FClusterBuilder().WithGrid(GridSize, GridSize).Build();
+	const double MidBuild = FPlatformTime::Seconds();
+	TSharedRef<FTestCluster> Compact = FClusterBuilder().WithGrid(GridSize, GridSize).WithCompactAdjacency().Build();
+	const double EndBuild = FPlatformTime::Seconds();
+
+	AddInfo(FString::Printf(TEXT("%d nodes, %d edges. Build: per-node links %.3f ms, CSR only %.3f ms (%d fewer allocations)"),
+		Regular->NumNodes(), Regular->Edges->Num(), (MidBuild - StartBuild) * 1000.0, (EndBuild - MidBuild) * 1000.0, Regular->NumNodes()));
+
+	int64 NodeLinksSum = 0;
+	int64 AdjacencySum = 0;
+
+	const double StartNodeLinks = FPlatformTime::Seconds();
+	for (int32 Run = 0; Run < NumRuns; Run++) { NodeLinksSum = PCGExClusterPerfLocal::BFSNodeLinks(Regular); }
+	const double EndNodeLinks = FPlatformTime::Seconds();
+
+	const double StartAdjacency = FPlatformTime::Seconds();
+	for (int32 Run = 0; Run < NumRuns; Run++) { AdjacencySum = PCGExClusterPerfLocal::BFSAdjacency(Compact); }
+	const double EndAdjacency = FPlatformTime::Seconds();
+
+	TestEqual(TEXT("Both traversals reach the same depths"), AdjacencySum, NodeLinksSum);
+
+	const double NodeLinksMs = (EndNodeLinks - StartNodeLinks) * 1000.0 / NumRuns;
+	const double AdjacencyMs = (EndAdjacency - StartAdjacency) * 1000.0 / NumRuns;
+
+	AddInfo(FString::Printf(TEXT("BFS per-node links: %.3f ms/run"), NodeLinksMs));
+	AddInfo(FString::Printf(TEXT("BFS CSR adjacency: %.3f ms/run (%.2fx)"), AdjacencyMs, NodeLinksMs / FMath::Max(0.001, AdjacencyMs)));
+
+	// Chain building on the CSR cluster
+	TArray<TSharedPtr<FTestChain>> Chains;
+	const double StartChains = FPlatformTime::Seconds();
+	TestChainHelpers::BuildChains(Compact, Chains);
+	const double EndChains = FPlatformTime::Seconds();
+
+	AddInfo(FString::Printf(TEXT("BuildChains on CSR: %d chains in %.3f ms"), Chains.Num(), (EndChains - StartChains) * 1000.0));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfClusterCompactEdges,
+	"PCGEx.Performance.Clusters.Adjacency.CompactEdges",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfClusterCompactEdges::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// 8M edges over 4M points, as one large cluster and as 64K-edge clusters for uint16
+	constexpr int32 NumEdges = 8 << 20;
+	constexpr int32 NumPoints = 4 << 20;
+	constexpr int32 SmallClusterEdges = 1 << 16;
+	constexpr int32 SmallClusterPoints = 1 << 15;
+	constexpr int32 NumRuns = 5;
+
+	FRandomStream Random(42);
+
+	TArray<PCGExGraphs::FEdge> Edges;
+	Edges.SetNumUninitialized(NumEdges);
+	for (int32 i = 0; i < NumEdges; i++)
+	{
+		// Local connectivity, like a real graph: the other end is close in index space
+		const uint32 Start = static_cast<uint32>(Random.RandRange(0, NumPoints - 1));
+		const uint32 End = static_cast<uint32>(FMath::Clamp(static_cast<int32>(Start) + Random.RandRange(-64, 64), 0, NumPoints - 1));
+		Edges[i] = PCGExGraphs::FEdge(i, Start, End, i, 0);
+		Edges[i].bValid = 1;
+	}
+
+	// Small clusters re-index their points locally
+	TArray<TArray<PCGExGraphs::FEdge>> SmallEdges;
+	SmallEdges.SetNum(NumEdges / SmallClusterEdges);
+	for (int32 c = 0; c < SmallEdges.Num(); c++)
+	{
+		TArray<PCGExGraphs::FEdge>& Local = SmallEdges[c];
+		Local.SetNumUninitialized(SmallClusterEdges);
+		for (int32 i = 0; i < SmallClusterEdges; i++)
+		{
+			const PCGExGraphs::FEdge& Source = Edges[c * SmallClusterEdges + i];
+			Local[i] = PCGExGraphs::FEdge(i, Source.Start % SmallClusterPoints, Source.End % SmallClusterPoints, i, c);
+			Local[i].bValid = 1;
+		}
+	}
+
+	FCompactEdges32 Compact32;
+	const double StartBuild = FPlatformTime::Seconds();
+	TestTrue(TEXT("uint32 layout builds"), Compact32.Build(Edges));
+	const double BuildMs = (FPlatformTime::Seconds() - StartBuild) * 1000.0;
+
+	TArray<FCompactEdges16> Compact16;
+	Compact16.SetNum(SmallEdges.Num());
+	bool bAllSmallBuilt = true;
+	for (int32 c = 0; c < SmallEdges.Num(); c++) { bAllSmallBuilt &= Compact16[c].Build(SmallEdges[c]); }
+	TestTrue(TEXT("uint16 layouts build"), bAllSmallBuilt);
+
+	// Endpoint scan: the access pattern of most edge-centric passes
+	uint64 EdgeSum = 0, Compact32Sum = 0, SmallEdgeSum = 0, Compact16Sum = 0;
+
+	const double StartEdges = FPlatformTime::Seconds();
+	for (int32 Run = 0; Run < NumRuns; Run++)
+	{
+		EdgeSum = 0;
+		for (const PCGExGraphs::FEdge& E : Edges) { EdgeSum += E.Start + E.End; }
+	}
+	const double EdgesMs = (FPlatformTime::Seconds() - StartEdges) * 1000.0 / NumRuns;
+
+	const double StartCompact32 = FPlatformTime::Seconds();
+	for (int32 Run = 0; Run < NumRuns; Run++)
+	{
+		Compact32Sum = 0;
+		for (const uint64 Packed : Compact32.GetPackedEndpoints()) { Compact32Sum += FCompactEdges32::PackedA(Packed) + FCompactEdges32::PackedB(Packed); }
+	}
+	const double Compact32Ms = (FPlatformTime::Seconds() - StartCompact32) * 1000.0 / NumRuns;
+
+	const double StartSmallEdges = FPlatformTime::Seconds();
+	for (int32 Run = 0; Run < NumRuns; Run++)
+	{
+		SmallEdgeSum = 0;
+		for (const TArray<PCGExGraphs::FEdge>& Local : SmallEdges) { for (const PCGExGraphs::FEdge& E : Local) { SmallEdgeSum += E.Start + E.End; } }
+	}
+	const double SmallEdgesMs = (FPlatformTime::Seconds() - StartSmallEdges) * 1000.0 / NumRuns;
+
+	const double StartCompact16 = FPlatformTime::Seconds();
+	for (int32 Run = 0; Run < NumRuns; Run++)
+	{
+		Compact16Sum = 0;
+		for (const FCompactEdges16& Local : Compact16)
+		{
+			for (const uint32 Packed : Local.GetPackedEndpoints()) { Compact16Sum += FCompactEdges16::PackedA(Packed) + FCompactEdges16::PackedB(Packed); }
+		}
+	}
+	const double Compact16Ms = (FPlatformTime::Seconds() - StartCompact16) * 1000.0 / NumRuns;
+
+	TestEqual(TEXT("uint32 layout reads the same endpoints"), Compact32Sum, EdgeSum);
+	TestEqual(TEXT("uint16 layout reads the same endpoints"), Compact16Sum, SmallEdgeSum);
+
+	SIZE_T Compact16Bytes = 0;
+	for (const FCompactEdges16& Local : Compact16) { Compact16Bytes += Local.GetAllocatedSize(); }
+
+	const double EdgeBytes = static_cast<double>(Edges.GetAllocatedSize());
+	auto GBs = [](const double Bytes, const double Ms) { return Bytes / (1024.0 * 1024.0 * 1024.0) / FMath::Max(0.000001, Ms / 1000.0); };
+
+	AddInfo(FString::Printf(TEXT("%d edges. FEdge: %.1f MB, uint32 layout: %.1f MB, uint16 layout: %.1f MB (build %.3f ms)"),
+		NumEdges, EdgeBytes / (1024.0 * 1024.0), Compact32.GetAllocatedSize() / (1024.0 * 1024.0), Compact16Bytes / (1024.0 * 1024.0), BuildMs));
+	AddInfo(FString::Printf(TEXT("FEdge scan: %.3f ms/run (%.2f GB/s)"), EdgesMs, GBs(EdgeBytes, EdgesMs)));
+	AddInfo(FString::Printf(TEXT("uint32 scan: %.3f ms/run (%.2fx)"), Compact32Ms, EdgesMs / FMath::Max(0.001, Compact32Ms)));
+	AddInfo(FString::Printf(TEXT("FEdge scan, 64K-edge clusters: %.3f ms/run"), SmallEdgesMs));
+	AddInfo(FString::Printf(TEXT("uint16 scan, 64K-edge clusters: %.3f ms/run (%.2fx)"), Compact16Ms, SmallEdgesMs / FMath::Max(0.001, Compact16Ms)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfClusterMortonOrder,
+	"PCGEx.Performance.Clusters.Adjacency.MortonOrder",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfClusterMortonOrder::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// ~1M nodes by default; ~10M with -PCGExLargeBench
+	const int32 GridSize = FParse::Param(FCommandLine::Get(), TEXT("PCGExLargeBench")) ? 3163 : 1000;
+
+	TSharedRef<FTestCluster> Scattered = FClusterBuilder().WithSparseGrid(GridSize, 0.8f, 42).WithShuffledPoints(42).WithCompactAdjacency().Build();
+
+	FClusterOrder Order;
+	const double StartReorder = FPlatformTime::Seconds();
+	TSharedRef<FTestCluster> Ordered = TestClusterReorder::BuildMortonOrdered(*Scattered, Order);
+	const double ReorderMs = (FPlatformTime::Seconds() - StartReorder) * 1000.0;
+
+	AddInfo(FString::Printf(TEXT("%d nodes, %d edges. Reorder: %.3f ms. Average edge span: scattered %.1f, Morton %.1f"),
+		Scattered->NumNodes(), Scattered->Edges->Num(), ReorderMs,
+		TestClusterReorder::GetAverageEdgeSpan(*Scattered), TestClusterReorder::GetAverageEdgeSpan(*Ordered)));
+
+	auto Compare = [&](const TCHAR* Label, const double ScatteredMs, const double OrderedMs)
+	{
+		AddInfo(FString::Printf(TEXT("%s: scattered %.3f ms, Morton %.3f ms (%.2fx)"), Label, ScatteredMs, OrderedMs, ScatteredMs / FMath::Max(0.001, OrderedMs)));
+	};
+
+	// BFS, from the same source node
+	{
+		const int32 Root = Order.NodeToSource->Get(0);
+		TArray<int32> Depth;
+		TArray<int32> Queue;
+
+		auto BFS = [&](const FTestCluster& Cluster, const int32 From)
+		{
+			Depth.Init(-1, Cluster.NumNodes());
+			Queue.Reset(Cluster.NumNodes());
+			Depth[From] = 0;
+			Queue.Add(From);
+			for (int32 Head = 0; Head < Queue.Num(); Head++)
+			{
+				const int32 Current = Queue[Head];
+				for (const PCGExGraphs::FLink& Lk : Cluster.GetLinks(Current))
+				{
+					if (Depth[Lk.Node] != -1) { continue; }
+					Depth[Lk.Node] = Depth[Current] + 1;
+					Queue.Add(Lk.Node);
+				}
+			}
+			return Queue.Num();
+		};
+
+		const double StartScattered = FPlatformTime::Seconds();
+		const int32 ScatteredReached = BFS(*Scattered, Root);
+		const double ScatteredMs = (FPlatformTime::Seconds() - StartScattered) * 1000.0;
+
+		const double StartOrdered = FPlatformTime::Seconds();
+		const int32 OrderedReached = BFS(*Ordered, 0);
+		const double OrderedMs = (FPlatformTime::Seconds() - StartOrdered) * 1000.0;
+
+		TestEqual(TEXT("BFS reaches the same nodes"), OrderedReached, ScatteredReached);
+		Compare(TEXT("BFS"), ScatteredMs, OrderedMs);
+	}
+
+	// Chains
+	{
+		TArray<TSharedPtr<FTestChain>> ScatteredChains;
+		const double StartScattered = FPlatformTime::Seconds();
+		TestChainHelpers::BuildChains(Scattered, ScatteredChains);
+		const double ScatteredMs = (FPlatformTime::Seconds() - StartScattered) * 1000.0;
+
+		TArray<TSharedPtr<FTestChain>> OrderedChains;
+		const double StartOrdered = FPlatformTime::Seconds();
+		TestChainHelpers::BuildChains(Ordered, OrderedChains);
+		const double OrderedMs = (FPlatformTime::Seconds() - StartOrdered) * 1000.0;
+
+		TestEqual(TEXT("Same chain count"), OrderedChains.Num(), ScatteredChains.Num());
+		Compare(TEXT("BuildChains"), ScatteredMs, OrderedMs);
+	}
+
+	// Half-edge build and face walk
+	{
+		TArray<TArray<int32>> Faces;
+
+		FTestDCEL ScatteredDCEL;
+		const double StartScattered = FPlatformTime::Seconds();
+		ScatteredDCEL.Build(*Scattered);
+		const int32 ScatteredFaces = ScatteredDCEL.WalkFaces(Faces);
+		const double ScatteredMs = (FPlatformTime::Seconds() - StartScattered) * 1000.0;
+
+		FTestDCEL OrderedDCEL;
+		const double StartOrdered = FPlatformTime::Seconds();
+		OrderedDCEL.Build(*Ordered);
+		const int32 OrderedFaces = OrderedDCEL.WalkFaces(Faces);
+		const double OrderedMs = (FPlatformTime::Seconds() - StartOrdered) * 1000.0;
+
+		TestEqual(TEXT("Same face count"), OrderedFaces, ScatteredFaces);
+		Compare(TEXT("DCEL build + face walk"), ScatteredMs, OrderedMs);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfClusterNodeClasses,
+	"PCGEx.Performance.Clusters.Adjacency.NodeClasses",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfClusterNodeClasses::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	constexpr int32 GridSize = 1000;
+	constexpr int32 NumConsumers = 8;
+
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithSparseGrid(GridSize, 0.6f, 42).Build();
+	const int32 NumNodes = Cluster->NumNodes();
+
+	// Each consumer wants the leaves and the binaries, e.g. chain seeding, breakpoint generation, filters
+	int64 ScanSum = 0;
+	const double StartScan = FPlatformTime::Seconds();
+	for (int32 Consumer = 0; Consumer < NumConsumers; Consumer++)
+	{
+		for (int32 i = 0; i < NumNodes; i++) { if (Cluster->IsLeaf(i)) { ScanSum += i; } }
+		for (int32 i = 0; i < NumNodes; i++) { if (Cluster->IsBinary(i)) { ScanSum += i; } }
+	}
+	const double ScanMs = (FPlatformTime::Seconds() - StartScan) * 1000.0;
+
+	int64 ClassSum = 0;
+	const double StartClasses = FPlatformTime::Seconds();
+	const TSharedPtr<FCachedNodeClasses> Classes = TestNodeClasses::GetOrBuildNodeClasses(Cluster);
+	const double BuildMs = (FPlatformTime::Seconds() - StartClasses) * 1000.0;
+	for (int32 Consumer = 0; Consumer < NumConsumers; Consumer++)
+	{
+		const TSharedPtr<FCachedNodeClasses> Shared = TestNodeClasses::GetOrBuildNodeClasses(Cluster);
+		for (const int32 Node : Shared->GetLeaves()) { ClassSum += Node; }
+		for (const int32 Node : Shared->GetBinaries()) { ClassSum += Node; }
+	}
+	const double ClassesMs = (FPlatformTime::Seconds() - StartClasses) * 1000.0;
+
+	TestEqual(TEXT("Same nodes visited"), ClassSum, ScanSum);
+
+	AddInfo(FString::Printf(TEXT("%d nodes: %d leaves, %d binaries, %d complex"),
+		NumNodes, Classes->GetLeaves().Num(), Classes->GetBinaries().Num(), Classes->GetComplex().Num()));
+	AddInfo(FString::Printf(TEXT("%d consumers, per-node predicates: %.3f ms"), NumConsumers, ScanMs));
+	AddInfo(FString::Printf(TEXT("%d consumers, cached classes: %.3f ms including a %.3f ms build (%.2fx)"),
+		NumConsumers, ClassesMs, BuildMs, ScanMs / FMath::Max(0.001, ClassesMs)));
+
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////
+// Chain Building
+//////////////////////////////////////////////////////////////////
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfClusterChainsParallel,
+	"PCGEx.Performance.Clusters.Chains.Parallel",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfClusterChainsParallel::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	constexpr int32 GridSize = 600;
+
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithSparseGrid(GridSize, 0.6f, 42).Build();
+
+	FRandomStream Random(7);
+	TSharedPtr<TArray<int8>> Breakpoints = MakeShared<TArray<int8>>();
+	Breakpoints->SetNumUninitialized(Cluster->NumNodes());
+	for (int8& Breakpoint : *Breakpoints) { Breakpoint = Random.FRand() < 0.02f ? 1 : 0; }
+
+	AddInfo(FString::Printf(TEXT("%d nodes, %d edges, %d leaves, %d binaries, %d complex"),
+		Cluster->NumNodes(), Cluster->Edges->Num(),
+		ClusterVerify::CountLeafNodes(Cluster), ClusterVerify::CountBinaryNodes(Cluster), ClusterVerify::CountComplexNodes(Cluster)));
+
+	TArray<TSharedPtr<FTestChain>> Sequential;
+	const double StartSequential = FPlatformTime::Seconds();
+	TestChainHelpers::BuildChains(Cluster, Sequential, Breakpoints);
+	const double EndSequential = FPlatformTime::Seconds();
+
+	TArray<TSharedPtr<FTestChain>> Parallel;
+	const double StartParallel = FPlatformTime::Seconds();
+	TestChainHelpers::BuildChainsParallel(Cluster, Parallel, Breakpoints);
+	const double EndParallel = FPlatformTime::Seconds();
+
+	FString Mismatch;
+	const bool bMatch = TestChainHelpers::ChainsMatch(Sequential, Parallel, &Mismatch);
+	TestTrue(TEXT("Parallel chains match sequential"), bMatch);
+	if (!bMatch) { AddError(Mismatch); }
+
+	const double SequentialMs = (EndSequential - StartSequential) * 1000.0;
+	const double ParallelMs = (EndParallel - StartParallel) * 1000.0;
+
+	AddInfo(FString::Printf(TEXT("Sequential: %d chains in %.3f ms"), Sequential.Num(), SequentialMs));
+	AddInfo(FString::Printf(TEXT("Parallel: %d chains in %.3f ms (%.2fx)"), Parallel.Num(), ParallelMs, SequentialMs / FMath::Max(0.001, ParallelMs)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfClusterChainsIncremental,
+	"PCGEx.Performance.Clusters.Chains.IncrementalBreakpoints",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfClusterChainsIncremental::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	constexpr int32 GridSize = 600;
+	constexpr int32 NumEdits = 20;
+
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithSparseGrid(GridSize, 0.6f, 42).Build();
+
+	TSharedPtr<TArray<int8>> Breakpoints = MakeShared<TArray<int8>>();
+	Breakpoints->Init(0, Cluster->NumNodes());
+
+	const double StartBuild = FPlatformTime::Seconds();
+	TSharedPtr<FCachedChainData> Cached = TestChainHelpers::GetOrBuildCachedChains(Cluster, Breakpoints);
+	const double EndBuild = FPlatformTime::Seconds();
+
+	AddInfo(FString::Printf(TEXT("Initial cache build: %d base chains in %.3f ms"), Cached->BaseChains.Num(), (EndBuild - StartBuild) * 1000.0));
+
+	FRandomStream Random(11);
+	double FullMs = 0;
+	double IncrementalMs = 0;
+	int32 TotalResplit = 0;
+
+	for (int32 Edit = 0; Edit < NumEdits; Edit++)
+	{
+		const int32 PointIndex = Random.RandRange(0, Cluster->NumNodes() - 1);
+		(*Breakpoints)[PointIndex] = (*Breakpoints)[PointIndex] ? 0 : 1;
+
+		TArray<TSharedPtr<FTestChain>> Full;
+		const double StartFull = FPlatformTime::Seconds();
+		TestChainHelpers::BuildChains(Cluster, Full, Breakpoints);
+		FullMs += (FPlatformTime::Seconds() - StartFull) * 1000.0;
+
+		TArray<TSharedPtr<FTestChain>> Incremental;
+		const double StartIncremental = FPlatformTime::Seconds();
+		TotalResplit += TestChainHelpers::UpdateChains(Cluster, Breakpoints, {PointIndex}, Incremental);
+		IncrementalMs += (FPlatformTime::Seconds() - StartIncremental) * 1000.0;
+
+		if (Full.Num() != Incremental.Num())
+		{
+			AddError(FString::Printf(TEXT("Edit %d: %d chains rebuilt vs %d incremental"), Edit, Full.Num(), Incremental.Num()));
+			break;
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("Full rebuild: %.3f ms/edit"), FullMs / NumEdits));
+	AddInfo(FString::Printf(TEXT("Incremental: %.3f ms/edit, %.1f chains re-split/edit (%.2fx)"),
+		IncrementalMs / NumEdits, static_cast<double>(TotalResplit) / NumEdits, FullMs / FMath::Max(0.001, IncrementalMs)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfClusterPersistentCache,
+	"PCGEx.Performance.Clusters.PersistentCache.Chains",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfClusterPersistentCache::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	constexpr int32 GridSize = 600;
+
+	FPersistentArtifactCache Cache;
+
+	// First execution: hash, build, encode
+	TSharedRef<FTestCluster> First = FClusterBuilder().WithSparseGrid(GridSize, 0.6f, 42).Build();
+
+	const double StartCold = FPlatformTime::Seconds();
+	TSharedPtr<FCachedChainData> Built = TestChainHelpers::GetOrBuildCachedChains(First, nullptr, &Cache);
+	const double ColdMs = (FPlatformTime::Seconds() - StartCold) * 1000.0;
+
+	// Next execution: same content, fresh cluster
+	TSharedRef<FTestCluster> Second = FClusterBuilder().WithSparseGrid(GridSize, 0.6f, 42).Build();
+
+	const double StartHash = FPlatformTime::Seconds();
+	ComputeClusterContentHash(*Second);
+	const double HashMs = (FPlatformTime::Seconds() - StartHash) * 1000.0;
+
+	const double StartWarm = FPlatformTime::Seconds();
+	TSharedPtr<FCachedChainData> Restored = TestChainHelpers::GetOrBuildCachedChains(Second, nullptr, &Cache);
+	const double WarmMs = (FPlatformTime::Seconds() - StartWarm) * 1000.0;
+
+	TestEqual(TEXT("Restored chain count"), Restored->BaseChains.Num(), Built->BaseChains.Num());
+	TestEqual(TEXT("Second execution hits"), Cache.GetStats().Hits, 1LL);
+
+	AddInfo(FString::Printf(TEXT("Cold build + store: %d chains in %.3f ms"), Built->BaseChains.Num(), ColdMs));
+	AddInfo(FString::Printf(TEXT("Content hash: %.3f ms"), HashMs));
+	AddInfo(FString::Printf(TEXT("Warm restore: %.3f ms (%.2fx)"), WarmMs, ColdMs / FMath::Max(0.001, WarmMs)));
+	AddInfo(Cache.GetStats().ToString());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfClusterDCELBuild,
+	"PCGEx.Performance.Clusters.DCEL.ParallelBuild",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfClusterDCELBuild::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// 710 x 710 grid: ~1M edges, 2M half-edges
+	constexpr int32 GridSize = 710;
+
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithGrid(GridSize, GridSize).WithCompactAdjacency().Build();
+
+	FTestDCEL Sequential;
+	const double StartSequential = FPlatformTime::Seconds();
+	Sequential.Build(*Cluster, FVector::UpVector, false);
+	const double SequentialMs = (FPlatformTime::Seconds() - StartSequential) * 1000.0;
+
+	FTestDCEL Parallel;
+	const double StartParallel = FPlatformTime::Seconds();
+	Parallel.Build(*Cluster, FVector::UpVector, true);
+	const double ParallelMs = (FPlatformTime::Seconds() - StartParallel) * 1000.0;
+
+	TestTrue(TEXT("Parallel build identical"), Parallel.Equals(Sequential));
+
+	AddInfo(FString::Printf(TEXT("%d edges, %d half-edges"), Cluster->Edges->Num(), Parallel.NumHalfEdges()));
+	AddInfo(FString::Printf(TEXT("Sequential build: %.3f ms"), SequentialMs));
+	AddInfo(FString::Printf(TEXT("Parallel build: %.3f ms (%.2fx)"), ParallelMs, SequentialMs / FMath::Max(0.001, ParallelMs)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfClusterDCELCells,
+	"PCGEx.Performance.Clusters.DCEL.ParallelCells",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfClusterDCELCells::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// City-block-like: mostly complete grid with missing streets, so cells vary in size
+	constexpr int32 GridSize = 800;
+
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithSparseGrid(GridSize, 0.85f, 7).Build();
+
+	FTestDCEL DCEL;
+	DCEL.Build(*Cluster);
+
+	PCGExClusters::FCellConstraints Constraints;
+	Constraints.bKeepCellsWithLeaves = false;
+
+	TArray<FTestCell> Sequential;
+	const double StartSequential = FPlatformTime::Seconds();
+	DCEL.ExtractCells(*Cluster, Constraints, Sequential, nullptr, false);
+	const double SequentialMs = (FPlatformTime::Seconds() - StartSequential) * 1000.0;
+
+	TArray<FTestCell> Parallel;
+	const double StartParallel = FPlatformTime::Seconds();
+	DCEL.ExtractCells(*Cluster, Constraints, Parallel, nullptr, true);
+	const double ParallelMs = (FPlatformTime::Seconds() - StartParallel) * 1000.0;
+
+	TestEqual(TEXT("Same cell count"), Parallel.Num(), Sequential.Num());
+
+	AddInfo(FString::Printf(TEXT("%d half-edges, %d cells kept"), DCEL.NumHalfEdges(), Parallel.Num()));
+	AddInfo(FString::Printf(TEXT("Sequential extraction: %.3f ms"), SequentialMs));
+	AddInfo(FString::Printf(TEXT("Parallel extraction: %.3f ms (%.2fx)"), ParallelMs, SequentialMs / FMath::Max(0.001, ParallelMs)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfClusterDCELEdits,
+	"PCGEx.Performance.Clusters.DCEL.IncrementalEdits",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfClusterDCELEdits::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// Road-editing scenario: a handful of new connections on a large city-block grid
+	constexpr int32 GridSize = 800;
+	constexpr int32 NumEdits = 16;
+
+	FRandomStream Random(7);
+	TArray<FIntPoint> Edges;
+	for (int32 y = 0; y < GridSize; y++)
+	{
+		for (int32 x = 0; x < GridSize; x++)
+		{
+			const int32 Index = y * GridSize + x;
+			if (x < GridSize - 1 && Random.FRand() < 0.85f) { Edges.Emplace(Index, Index + 1); }
+			if (y < GridSize - 1 && Random.FRand() < 0.85f) { Edges.Emplace(Index, Index + GridSize); }
+		}
+	}
+
+	// Diagonals in distinct grid cells never cross anything
+	TArray<FTestDCELEdit> Edits;
+	TArray<FIntPoint> Edited = Edges;
+	TSet<int32> Cells;
+	while (Edits.Num() < NumEdits)
+	{
+		const int32 Index = Random.RandRange(0, GridSize - 2) * GridSize + Random.RandRange(0, GridSize - 2);
+		if (Cells.Contains(Index)) { continue; }
+		Cells.Add(Index);
+
+		Edits.Add(FTestDCELEdit::Insert(Index, Index + GridSize + 1, Edited.Num()));
+		Edited.Emplace(Index, Index + GridSize + 1);
+	}
+
+	auto BuildCluster = [&](const TArray<FIntPoint>& InEdges)
+	{
+		FClusterBuilder Builder;
+		for (int32 y = 0; y < GridSize; y++)
+		{
+			for (int32 x = 0; x < GridSize; x++) { Builder.AddNode(y * GridSize + x, FVector(x * 100, y * 100, 0)); }
+		}
+		for (const FIntPoint& Edge : InEdges) { Builder.AddEdge(Edge.X, Edge.Y); }
+		return Builder.WithCompactAdjacency().Build();
+	};
+
+	TSharedRef<FTestCluster> Cluster = BuildCluster(Edges);
+	TSharedRef<FTestCluster> EditedCluster = BuildCluster(Edited);
+
+	PCGExClusters::FCellConstraints Constraints;
+	Constraints.bKeepCellsWithLeaves = false;
+
+	FTestDCEL DCEL;
+	DCEL.Build(*Cluster);
+	TArray<FTestCell> Cells;
+	DCEL.ExtractCells(*Cluster, Constraints, Cells);
+
+	// Full re-enumeration of the edited cluster
+	const double StartFull = FPlatformTime::Seconds();
+	FTestDCEL Rebuilt;
+	Rebuilt.Build(*EditedCluster);
+	TArray<FTestCell> RebuiltCells;
+	Rebuilt.ExtractCells(*EditedCluster, Constraints, RebuiltCells);
+	const double FullMs = (FPlatformTime::Seconds() - StartFull) * 1000.0;
+
+	// Patch
+	const double StartPatch = FPlatformTime::Seconds();
+	FTestDCELEditResult Result;
+	const bool bApplied = DCEL.ApplyEdits(Edits, Result);
+	DCEL.UpdateCells(*Cluster, Constraints, Result, Cells);
+	const double PatchMs = (FPlatformTime::Seconds() - StartPatch) * 1000.0;
+
+	TestTrue(TEXT("Edits applied"), bApplied);
+	TestEqual(TEXT("Same cell count as a full rebuild"), Cells.Num(), RebuiltCells.Num());
+	TestTrue(TEXT("Same next pointers as a full rebuild"), DCEL.Next == Rebuilt.Next);
+
+	AddInfo(FString::Printf(TEXT("%d half-edges, %d edits, %d faces walked again"), DCEL.NumHalfEdges(), NumEdits, Result.AddedFaces.Num()));
+	AddInfo(FString::Printf(TEXT("Full rebuild + extraction: %.3f ms"), FullMs));
+	AddInfo(FString::Printf(TEXT("Incremental patch + cell update: %.3f ms (%.2fx)"), PatchMs, FullMs / FMath::Max(0.001, PatchMs)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfClusterTangentFramesBatched,
+	"PCGEx.Performance.Clusters.TangentFrames.Batched",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfClusterTangentFramesBatched::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// 700 x 700 grid draped over a height field: ~490K nodes, ~980K edges
+	constexpr int32 GridSize = 700;
+
+	FClusterBuilder Builder;
+	for (int32 y = 0; y < GridSize; y++)
+	{
+		for (int32 x = 0; x < GridSize; x++) { Builder.AddNode(y * GridSize + x, FVector(x * 100, y * 100, 40.0 * FMath::Sin(x * 0.3) * FMath::Cos(y * 0.2))); }
+	}
+	for (int32 y = 0; y < GridSize; y++)
+	{
+		for (int32 x = 0; x < GridSize; x++)
+		{
+			const int32 Index = y * GridSize + x;
+			if (x < GridSize - 1) { Builder.AddEdge(Index, Index + 1); }
+			if (y < GridSize - 1) { Builder.AddEdge(Index, Index + GridSize); }
+		}
+	}
+	TSharedRef<FTestCluster> Cluster = Builder.WithCompactAdjacency().Build();
+
+	TArray<FQuat> Scalar;
+	const double StartScalar = FPlatformTime::Seconds();
+	TestTangentFrames::ComputeScalar(*Cluster, Scalar);
+	const double ScalarMs = (FPlatformTime::Seconds() - StartScalar) * 1000.0;
+
+	TArray<FQuat> Batched;
+	const double StartBatched = FPlatformTime::Seconds();
+	TestTangentFrames::ComputeBatched(*Cluster, Batched, nullptr, false);
+	const double BatchedMs = (FPlatformTime::Seconds() - StartBatched) * 1000.0;
+
+	TArray<FQuat> Parallel;
+	const double StartParallel = FPlatformTime::Seconds();
+	TestTangentFrames::ComputeBatched(*Cluster, Parallel, nullptr, true);
+	const double ParallelMs = (FPlatformTime::Seconds() - StartParallel) * 1000.0;
+
+	int32 Mismatches = 0;
+	for (int32 i = 0; i < Scalar.Num(); i++) { if (!Scalar[i].Equals(Parallel[i], 1e-9) || !Scalar[i].Equals(Batched[i], 1e-9)) { Mismatches++; } }
+	TestEqual(TEXT("Batched frames match scalar"), Mismatches, 0);
+
+	AddInfo(FString::Printf(TEXT("%d nodes, %d edges"), Cluster->NumNodes(), Cluster->Edges->Num()));
+	AddInfo(FString::Printf(TEXT("Scalar: %.3f ms"), ScalarMs));
+	AddInfo(FString::Printf(TEXT("Batched (single thread): %.3f ms (%.2fx)"), BatchedMs, ScalarMs / FMath::Max(0.001, BatchedMs)));
+	AddInfo(FString::Printf(TEXT("Batched (parallel): %.3f ms (%.2fx)"), ParallelMs, ScalarMs / FMath::Max(0.001, ParallelMs)));
+
+	return true;
+}
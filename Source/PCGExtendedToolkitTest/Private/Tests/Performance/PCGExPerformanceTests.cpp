@@ -19,12 +19,25 @@
 
 #include "Math/OBB/PCGExOBBCollection.h"
 #include "Math/OBB/PCGExOBB.h"
+#include "Math/Geo/PCGExGeo.h"
 #include "Math/Geo/PCGExDelaunay.h"
 #include "Math/Geo/PCGExVoronoi.h"
+#include "Math/PCGExProjectionDetails.h"
 #include "Clusters/PCGExLink.h"
 #include "Clusters/PCGExEdge.h"
 #include "Clusters/PCGExNode.h"
 #include "Containers/PCGExIndexLookup.h"
+#include "Containers/PCGExScopedContainers.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+
+#include "Helpers/PCGExShardedContainerHelpers.h"
+#include "Helpers/PCGExEdgeDedupHelpers.h"
+#include "Helpers/PCGExDelaunayTestHelpers.h"
+#include "Helpers/PCGExPredicateHelpers.h"
+#include "Helpers/PCGExPointInPolygonHelpers.h"
+#include "Helpers/PCGExVoronoiTestHelpers.h"
 
 //////////////////////////////////////////////////////////////////
 // OBB Collection Stress Tests
@@ -183,6 +196,494 @@ bool FPCGExPerfOBBCollectionBulkClassify::RunTest(const FString& Parameters)
 	return true;
 }
 
+//////////////////////////////////////////////////////////////////
+// Geometric Predicate Stress Tests
+//////////////////////////////////////////////////////////////////
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfPredicatesAdaptive,
+	"PCGEx.Performance.Predicates.Adaptive",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfPredicatesAdaptive::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	constexpr int32 NumQueries = 1000000;
+
+	auto NaiveInCircle = [](const FVector2D& A, const FVector2D& B, const FVector2D& C, const FVector2D& D)
+	{
+		const FVector2D AD = A - D;
+		const FVector2D BD = B - D;
+		const FVector2D CD = C - D;
+		return AD.SizeSquared() * (BD.X * CD.Y - CD.X * BD.Y) + BD.SizeSquared() * (CD.X * AD.Y - AD.X * CD.Y) + CD.SizeSquared() * (AD.X * BD.Y - BD.X * AD.Y);
+	};
+
+	auto NaiveInSphere = [](const FVector& A, const FVector& B, const FVector& C, const FVector& D, const FVector& E)
+	{
+		const FVector AE = A - E;
+		const FVector BE = B - E;
+		const FVector CE = C - E;
+		const FVector DE = D - E;
+		return AE.SizeSquared() * FVector::DotProduct(BE, FVector::CrossProduct(CE, DE))
+			- BE.SizeSquared() * FVector::DotProduct(AE, FVector::CrossProduct(CE, DE))
+			+ CE.SizeSquared() * FVector::DotProduct(AE, FVector::CrossProduct(BE, DE))
+			- DE.SizeSquared() * FVector::DotProduct(AE, FVector::CrossProduct(BE, CE));
+	};
+
+	// Random inputs: the filter settles nearly every query
+	{
+		FRandomStream Random(7);
+		TArray<FVector> Points;
+		Points.SetNumUninitialized(NumQueries + 4);
+		for (FVector& Point : Points) { Point = FVector(Random.FRandRange(0, 1000), Random.FRandRange(0, 1000), Random.FRandRange(0, 1000)); }
+
+		int32 NaiveInside = 0;
+		const double StartNaive = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumQueries; i++)
+		{
+			if (NaiveInCircle(FVector2D(Points[i]), FVector2D(Points[i + 1]), FVector2D(Points[i + 2]), FVector2D(Points[i + 3])) > 0) { NaiveInside++; }
+		}
+		const double NaiveTime = FPlatformTime::Seconds() - StartNaive;
+
+		int32 AdaptiveInside = 0;
+		const double StartAdaptive = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumQueries; i++)
+		{
+			if (TestPredicates::InCircle(FVector2D(Points[i]), FVector2D(Points[i + 1]), FVector2D(Points[i + 2]), FVector2D(Points[i + 3])) > 0) { AdaptiveInside++; }
+		}
+		const double AdaptiveTime = FPlatformTime::Seconds() - StartAdaptive;
+
+		TestEqual(TEXT("InCircle: random inputs agree"), AdaptiveInside, NaiveInside);
+		AddInfo(FString::Printf(TEXT("InCircle, %d random queries: naive %.3f ms, adaptive %.3f ms (%.2fx)"),
+			NumQueries, NaiveTime * 1000.0, AdaptiveTime * 1000.0, NaiveTime / FMath::Max(AdaptiveTime, 1e-9)));
+
+		int32 NaiveInSphereCount = 0;
+		const double StartNaive3 = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumQueries; i++) { if (NaiveInSphere(Points[i], Points[i + 1], Points[i + 2], Points[i + 3], Points[i + 4]) > 0) { NaiveInSphereCount++; } }
+		const double NaiveTime3 = FPlatformTime::Seconds() - StartNaive3;
+
+		int32 AdaptiveInSphereCount = 0;
+		const double StartAdaptive3 = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumQueries; i++) { if (TestPredicates::InSphere(Points[i], Points[i + 1], Points[i + 2], Points[i + 3], Points[i + 4]) > 0) { AdaptiveInSphereCount++; } }
+		const double AdaptiveTime3 = FPlatformTime::Seconds() - StartAdaptive3;
+
+		TestEqual(TEXT("InSphere: random inputs agree"), AdaptiveInSphereCount, NaiveInSphereCount);
+		AddInfo(FString::Printf(TEXT("InSphere, %d random queries: naive %.3f ms, adaptive %.3f ms (%.2fx)"),
+			NumQueries, NaiveTime3 * 1000.0, AdaptiveTime3 * 1000.0, NaiveTime3 / FMath::Max(AdaptiveTime3, 1e-9)));
+	}
+
+	// Cocircular integer points far from the origin: every query takes the exact path
+	{
+		constexpr int32 NumDegenerate = NumQueries / 10;
+		const double Offset = 1073741824.0;
+
+		int32 NaiveNonZero = 0;
+		int32 AdaptiveNonZero = 0;
+
+		const double StartExact = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumDegenerate; i++)
+		{
+			const FVector2D Center(Offset + i % 1000, Offset + i / 1000);
+			const FVector2D A = Center + FVector2D(3452485, 66480);
+			const FVector2D B = Center + FVector2D(568323, 3406036);
+			const FVector2D C = Center + FVector2D(-2988000, 1730875);
+			const FVector2D D = Center + FVector2D(-785408, -3362619);
+
+			if (TestPredicates::InCircle(A, B, C, D) != 0) { AdaptiveNonZero++; }
+			if (NaiveInCircle(A, B, C, D) != 0) { NaiveNonZero++; }
+		}
+		const double ExactTime = FPlatformTime::Seconds() - StartExact;
+
+		TestEqual(TEXT("Cocircular: adaptive is always zero"), AdaptiveNonZero, 0);
+		AddInfo(FString::Printf(TEXT("InCircle, %d cocircular queries: %.3f ms on the exact path, naive non-zero on %d"),
+			NumDegenerate, ExactTime * 1000.0, NaiveNonZero));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfGeoPointInPolygon,
+	"PCGEx.Performance.Geo.PointInPolygon",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfGeoPointInPolygon::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// One polygon, many points: a call per point against the batched masks
+	constexpr int32 NumPoints = 1000000;
+	const int32 NumVertices = FParse::Param(FCommandLine::Get(), TEXT("PCGExLargeBench")) ? 10000 : 1000;
+
+	FRandomStream Random(NumVertices);
+
+	TArray<FVector2D> Polygon;
+	Polygon.SetNumUninitialized(NumVertices);
+	for (int32 i = 0; i < NumVertices; i++)
+	{
+		const double Angle = UE_DOUBLE_TWO_PI * i / NumVertices;
+		const double Radius = Random.FRandRange(2000, 5000);
+		Polygon[i] = FVector2D(5000 + Radius * FMath::Cos(Angle), 5000 + Radius * FMath::Sin(Angle));
+	}
+
+	TArray<FVector2D> Points;
+	Points.SetNumUninitialized(NumPoints);
+	for (FVector2D& Point : Points) { Point = FVector2D(Random.FRandRange(0, 10000), Random.FRandRange(0, 10000)); }
+
+	{
+		TBitArray<> PerPoint(false, NumPoints);
+		const double StartPerPoint = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumPoints; i++) { PerPoint[i] = PCGExMath::Geo::IsPointInPolygon(Points[i], Polygon); }
+		const double PerPointTime = FPlatformTime::Seconds() - StartPerPoint;
+
+		TBitArray<> BruteForce;
+		const double StartBruteForce = FPlatformTime::Seconds();
+		TestPointInPolygon::ClassifyPoints(Points, Polygon, BruteForce);
+		const double BruteForceTime = FPlatformTime::Seconds() - StartBruteForce;
+
+		TBitArray<> Banded;
+		const double StartBuild = FPlatformTime::Seconds();
+		const FTestPolygon2 Prepared(Polygon);
+		const double StartBanded = FPlatformTime::Seconds();
+		Prepared.ClassifyPoints(Points, Banded);
+		const double EndBanded = FPlatformTime::Seconds();
+
+		TestTrue(TEXT("Polygon: brute force batch matches"), BruteForce == PerPoint);
+		TestTrue(TEXT("Polygon: banded batch matches"), Banded == PerPoint);
+
+		AddInfo(FString::Printf(TEXT("%d points in a %d-vertex polygon: per point %.3f ms, batch %.3f ms (%.2fx), banded %.3f ms + build %.3f ms (%.2fx), %d edges in %d bands"),
+			NumPoints, NumVertices, PerPointTime * 1000.0,
+			BruteForceTime * 1000.0, PerPointTime / FMath::Max(BruteForceTime, 1e-9),
+			(EndBanded - StartBanded) * 1000.0, (StartBanded - StartBuild) * 1000.0, PerPointTime / FMath::Max(EndBanded - StartBuild, 1e-9),
+			Prepared.NumBandEdges(), Prepared.NumBands()));
+	}
+
+	{
+		const FVector A(1000, 1000, 0);
+		const FVector B(9000, 2000, 0);
+		const FVector C(3000, 8500, 0);
+
+		TArray<FVector> Points3;
+		Points3.SetNumUninitialized(NumPoints);
+		for (int32 i = 0; i < NumPoints; i++) { Points3[i] = FVector(Points[i].X, Points[i].Y, 0); }
+
+		TBitArray<> PerPoint(false, NumPoints);
+		const double StartPerPoint = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumPoints; i++) { PerPoint[i] = PCGExMath::Geo::IsPointInTriangle(Points3[i], A, B, C); }
+		const double PerPointTime = FPlatformTime::Seconds() - StartPerPoint;
+
+		TBitArray<> Batch;
+		const double StartBatch = FPlatformTime::Seconds();
+		TestPointInPolygon::ClassifyPoints(Points3, A, B, C, Batch);
+		const double BatchTime = FPlatformTime::Seconds() - StartBatch;
+
+		TestTrue(TEXT("Triangle: batch matches"), Batch == PerPoint);
+
+		AddInfo(FString::Printf(TEXT("%d points in a triangle: per point %.3f ms, batch %.3f ms (%.2fx)"),
+			NumPoints, PerPointTime * 1000.0, BatchTime * 1000.0, PerPointTime / FMath::Max(BatchTime, 1e-9)));
+	}
+
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////
+// Delaunay 2D Stress Tests
+//////////////////////////////////////////////////////////////////
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfDelaunay2DIncremental,
+	"PCGEx.Performance.Delaunay2D.Incremental",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfDelaunay2DIncremental::RunTest(const FString& Parameters)
+{
+	// 1e7 points needs several GB across both backends, so it only runs with -PCGExLargeBench
+	TArray<int32> Sizes = {100000, 1000000};
+	if (FParse::Param(FCommandLine::Get(), TEXT("PCGExLargeBench"))) { Sizes.Add(10000000); }
+
+	FPCGExGeo2DProjectionDetails Projection;
+
+	for (const int32 NumPoints : Sizes)
+	{
+		TArray<FVector> Positions;
+		Positions.SetNumUninitialized(NumPoints);
+
+		FRandomStream Random(NumPoints);
+		for (FVector& Position : Positions) { Position = FVector(Random.FRandRange(0, 100000), Random.FRandRange(0, 100000), 0); }
+
+		PCGExMath::Geo::TDelaunay2 Reference;
+		const double StartReference = FPlatformTime::Seconds();
+		const bool bReference = Reference.Process(MakeArrayView(Positions), Projection);
+		const double ReferenceTime = FPlatformTime::Seconds() - StartReference;
+
+		PCGExTest::FTestDelaunay2 Incremental;
+		const double StartIncremental = FPlatformTime::Seconds();
+		const bool bIncremental = Incremental.Process(MakeArrayView(Positions), Projection);
+		const double IncrementalTime = FPlatformTime::Seconds() - StartIncremental;
+
+		TestTrue(FString::Printf(TEXT("%d points: both succeeded"), NumPoints), bReference && bIncremental);
+		TestEqual(FString::Printf(TEXT("%d points: same site count"), NumPoints), Incremental.Sites.Num(), Reference.Sites.Num());
+		TestEqual(FString::Printf(TEXT("%d points: same edge count"), NumPoints), Incremental.DelaunayEdges.Num(), Reference.DelaunayEdges.Num());
+
+		AddInfo(FString::Printf(TEXT("%d points -> %d sites: TDelaunay2 %.3f ms, incremental %.3f ms (%.2fx)"),
+			NumPoints, Incremental.Sites.Num(), ReferenceTime * 1000.0, IncrementalTime * 1000.0, ReferenceTime / FMath::Max(IncrementalTime, 1e-9)));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfDelaunay2DStreaming,
+	"PCGEx.Performance.Delaunay2D.Streaming",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfDelaunay2DStreaming::RunTest(const FString& Parameters)
+{
+	// A long strip swept in 10K-point chunks: the stream only holds the frontier
+	TArray<int32> Sizes = {1000000};
+	if (FParse::Param(FCommandLine::Get(), TEXT("PCGExLargeBench"))) { Sizes.Add(10000000); }
+
+	constexpr int32 ChunkSize = 10000;
+
+	for (const int32 NumPoints : Sizes)
+	{
+		TArray<FVector2D> Positions;
+		Positions.SetNumUninitialized(NumPoints);
+
+		FRandomStream Random(NumPoints);
+		for (FVector2D& Position : Positions) { Position = FVector2D(Random.FRandRange(0, NumPoints), Random.FRandRange(0, 1000)); }
+		Positions.Sort([](const FVector2D& A, const FVector2D& B) { return A.X < B.X; });
+
+		PCGExTest::FTestDelaunay2 InMemory;
+		const double StartInMemory = FPlatformTime::Seconds();
+		const bool bInMemory = InMemory.Process(Positions);
+		const double InMemoryTime = FPlatformTime::Seconds() - StartInMemory;
+
+		int32 NumSites = 0;
+		int32 NumEdges = 0;
+
+		PCGExTest::FTestDelaunay2 Stream;
+		const double StartStream = FPlatformTime::Seconds();
+		Stream.BeginStream(
+			[&](const PCGExMath::Geo::FDelaunaySite2&) { NumSites++; },
+			[&](const uint64) { NumEdges++; });
+		for (int32 i = 0; i < NumPoints; i += ChunkSize) { Stream.AddChunk(MakeArrayView(Positions.GetData() + i, FMath::Min(ChunkSize, NumPoints - i))); }
+		const int32 PeakTriangles = Stream.GetPeakLiveTriangles();
+		const bool bStream = Stream.EndStream();
+		const double StreamTime = FPlatformTime::Seconds() - StartStream;
+
+		TestTrue(FString::Printf(TEXT("%d points: both succeeded"), NumPoints), bInMemory && bStream);
+		TestEqual(FString::Printf(TEXT("%d points: same site count"), NumPoints), NumSites, InMemory.Sites.Num());
+		TestEqual(FString::Printf(TEXT("%d points: same edge count"), NumPoints), NumEdges, InMemory.DelaunayEdges.Num());
+
+		AddInfo(FString::Printf(TEXT("%d points -> %d sites: in-memory %.3f ms, streamed %.3f ms (%.2fx), peak %d live triangles"),
+			NumPoints, NumSites, InMemoryTime * 1000.0, StreamTime * 1000.0, InMemoryTime / FMath::Max(StreamTime, 1e-9), PeakTriangles));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfDelaunay2DLocalUpdate,
+	"PCGEx.Performance.Delaunay2D.LocalUpdate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfDelaunay2DLocalUpdate::RunTest(const FString& Parameters)
+{
+	// An editing session: a few hundred points added and removed, against processing the result again
+	TArray<int32> Sizes = {100000};
+	if (FParse::Param(FCommandLine::Get(), TEXT("PCGExLargeBench"))) { Sizes.Add(1000000); }
+
+	constexpr int32 NumEdits = 500;
+
+	for (const int32 NumPoints : Sizes)
+	{
+		const double Extent = FMath::Sqrt(static_cast<double>(NumPoints)) * 10;
+
+		TArray<FVector2D> Positions;
+		Positions.SetNumUninitialized(NumPoints);
+
+		FRandomStream Random(NumPoints);
+		for (FVector2D& Position : Positions) { Position = FVector2D(Random.FRandRange(0, Extent), Random.FRandRange(0, Extent)); }
+
+		PCGExTest::FTestDelaunay2 Delaunay;
+		TestTrue(FString::Printf(TEXT("%d points: processed"), NumPoints), Delaunay.Process(Positions));
+
+		PCGExTest::FTestDelaunay2::FUpdate Update;
+		int32 NumDirty = 0;
+		int32 NumFailed = 0;
+
+		const double StartEdits = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumEdits; i++)
+		{
+			if (Delaunay.InsertPoint(FVector2D(Random.FRandRange(0, Extent), Random.FRandRange(0, Extent)), &Update) == INDEX_NONE) { NumFailed++; }
+			NumDirty += Update.DirtySites.Num();
+
+			if (!Delaunay.RemovePoint(i * (NumPoints / NumEdits), &Update)) { NumFailed++; }
+			NumDirty += Update.DirtySites.Num();
+		}
+		const double EditTime = FPlatformTime::Seconds() - StartEdits;
+
+		// Same point set from scratch
+		TArray<FVector2D> Edited;
+		Edited.Reserve(Delaunay.GetVertices().Num());
+		for (int32 i = 0; i < Delaunay.GetVertices().Num(); i++)
+		{
+			if (i >= NumPoints || i % (NumPoints / NumEdits) != 0) { Edited.Add(Delaunay.GetVertices()[i]); }
+		}
+
+		PCGExTest::FTestDelaunay2 Reprocessed;
+		const double StartProcess = FPlatformTime::Seconds();
+		Reprocessed.Process(Edited);
+		const double ProcessTime = FPlatformTime::Seconds() - StartProcess;
+
+		TestEqual(FString::Printf(TEXT("%d points: every edit applied"), NumPoints), NumFailed, 0);
+		TestEqual(FString::Printf(TEXT("%d points: same site count as Process"), NumPoints), Delaunay.Sites.Num(), Reprocessed.Sites.Num());
+
+		const int32 NumUpdates = 2 * NumEdits;
+		AddInfo(FString::Printf(TEXT("%d points, %d updates: %.3f ms local (%.4f ms each, %.1f dirty sites), one Process %.3f ms (%.2fx per update)"),
+			NumPoints, NumUpdates, EditTime * 1000.0, EditTime * 1000.0 / NumUpdates, static_cast<double>(NumDirty) / NumUpdates,
+			ProcessTime * 1000.0, ProcessTime * NumUpdates / FMath::Max(EditTime, 1e-9)));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfDelaunayFlatOutput,
+	"PCGEx.Performance.Delaunay.FlatOutput",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfDelaunayFlatOutput::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// Triangulation to cluster links: default output sorted out of its edge set, against flat output used as is
+	const bool bLarge = FParse::Param(FCommandLine::Get(), TEXT("PCGExLargeBench"));
+	const int32 NumPoints2 = bLarge ? 1000000 : 200000;
+	const int32 NumPoints3 = bLarge ? 400000 : 100000;
+
+	TArray<int32> Offsets;
+	TArray<PCGExGraphs::FLink> Links;
+
+	auto ToLinks = [&](const TSet<uint64>& DelaunayEdges, const int32 NumPoints)
+	{
+		TArray<uint64> Keys = DelaunayEdges.Array();
+		Algo::Sort(Keys);
+		TestEdgeDedup::BuildAdjacency(NumPoints, Keys, Offsets, Links);
+	};
+
+	{
+		TArray<FVector2D> Positions;
+		Positions.SetNumUninitialized(NumPoints2);
+
+		FRandomStream Random(NumPoints2);
+		for (FVector2D& Position : Positions) { Position = FVector2D(Random.FRandRange(0, 10000), Random.FRandRange(0, 10000)); }
+
+		FTestDelaunay2 Default;
+		const double StartDefault = FPlatformTime::Seconds();
+		Default.Process(Positions);
+		const double MidDefault = FPlatformTime::Seconds();
+		ToLinks(Default.DelaunayEdges, NumPoints2);
+		const double EndDefault = FPlatformTime::Seconds();
+
+		FTestDelaunay2 Flat;
+		Flat.bFlatOutput = true;
+		const double StartFlat = FPlatformTime::Seconds();
+		Flat.Process(Positions);
+		const double MidFlat = FPlatformTime::Seconds();
+		TestEdgeDedup::BuildAdjacency(NumPoints2, Flat.Flat.Edges, Offsets, Links);
+		const double EndFlat = FPlatformTime::Seconds();
+
+		TestEqual(TEXT("2D: same edge count"), Flat.Flat.Edges.Num(), Default.DelaunayEdges.Num());
+
+		AddInfo(FString::Printf(TEXT("2D %d points: default %.3f ms + links %.3f ms, flat %.3f ms + links %.3f ms (%.2fx)"),
+			NumPoints2, (MidDefault - StartDefault) * 1000.0, (EndDefault - MidDefault) * 1000.0,
+			(MidFlat - StartFlat) * 1000.0, (EndFlat - MidFlat) * 1000.0, (EndDefault - StartDefault) / FMath::Max(EndFlat - StartFlat, 1e-9)));
+	}
+
+	{
+		TArray<FVector> Positions;
+		Positions.SetNumUninitialized(NumPoints3);
+
+		FRandomStream Random(NumPoints3);
+		for (FVector& Position : Positions) { Position = FVector(Random.FRandRange(0, 10000), Random.FRandRange(0, 10000), Random.FRandRange(0, 10000)); }
+
+		FTestDelaunay3 Default;
+		const double StartDefault = FPlatformTime::Seconds();
+		Default.Process(Positions);
+		const double MidDefault = FPlatformTime::Seconds();
+		ToLinks(Default.DelaunayEdges, NumPoints3);
+		const double EndDefault = FPlatformTime::Seconds();
+
+		FTestDelaunay3 Flat;
+		Flat.bFlatOutput = true;
+		const double StartFlat = FPlatformTime::Seconds();
+		Flat.Process(Positions);
+		const double MidFlat = FPlatformTime::Seconds();
+		TestEdgeDedup::BuildAdjacency(NumPoints3, Flat.Flat.Edges, Offsets, Links);
+		const double EndFlat = FPlatformTime::Seconds();
+
+		TestEqual(TEXT("3D: same edge count"), Flat.Flat.Edges.Num(), Default.DelaunayEdges.Num());
+
+		AddInfo(FString::Printf(TEXT("3D %d points: default %.3f ms + links %.3f ms, flat %.3f ms + links %.3f ms (%.2fx)"),
+			NumPoints3, (MidDefault - StartDefault) * 1000.0, (EndDefault - MidDefault) * 1000.0,
+			(MidFlat - StartFlat) * 1000.0, (EndFlat - MidFlat) * 1000.0, (EndDefault - StartDefault) / FMath::Max(EndFlat - StartFlat, 1e-9)));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfDelaunay2DConstrained,
+	"PCGEx.Performance.Delaunay2D.Constrained",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfDelaunay2DConstrained::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// Constrained triangulation in one pass, against the plain one: constraint insertion and flips are the overhead
+	const int32 NumPoints = FParse::Param(FCommandLine::Get(), TEXT("PCGExLargeBench")) ? 1000000 : 200000;
+
+	TArray<FVector2D> Positions;
+	Positions.SetNumUninitialized(NumPoints);
+
+	FRandomStream Random(NumPoints);
+	for (FVector2D& Position : Positions) { Position = FVector2D(Random.FRandRange(0, 10000), Random.FRandRange(0, 10000)); }
+
+	// A planar constraint network over one point in five, each constraint crossing a few input edges
+	TArray<FVector2D> Subset;
+	for (int32 i = 0; i < NumPoints; i += 5) { Subset.Add(Positions[i]); }
+
+	FTestDelaunay2 Network;
+	Network.Process(Subset);
+
+	TArray<uint64> Constraints;
+	Constraints.Reserve(Network.DelaunayEdges.Num());
+	for (const uint64 Edge : Network.DelaunayEdges) { Constraints.Add(PCGEx::H64U(PCGEx::H64A(Edge) * 5, PCGEx::H64B(Edge) * 5)); }
+
+	FTestDelaunay2 Plain;
+	const double StartPlain = FPlatformTime::Seconds();
+	Plain.Process(Positions);
+	const double EndPlain = FPlatformTime::Seconds();
+
+	FTestDelaunay2 Constrained;
+	const double StartConstrained = FPlatformTime::Seconds();
+	Constrained.ProcessConstrained(Positions, Constraints);
+	const double EndConstrained = FPlatformTime::Seconds();
+
+	TestEqual(TEXT("Every constraint kept"), Constrained.SkippedConstraints.Num(), 0);
+	TestEqual(TEXT("Same site count"), Constrained.Sites.Num(), Plain.Sites.Num());
+
+	AddInfo(FString::Printf(TEXT("%d points, %d constraints: plain %.3f ms, constrained %.3f ms (%.2fx)"),
+		NumPoints, Constraints.Num(), (EndPlain - StartPlain) * 1000.0, (EndConstrained - StartConstrained) * 1000.0,
+		(EndConstrained - StartConstrained) / FMath::Max(EndPlain - StartPlain, 1e-9)));
+
+	return true;
+}
+
 //////////////////////////////////////////////////////////////////
 // Delaunay/Voronoi 3D Stress Tests
 //////////////////////////////////////////////////////////////////
@@ -226,6 +727,49 @@ bool FPCGExPerfDelaunay3DLarge::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfDelaunay3DParallel,
+	"PCGEx.Performance.Delaunay3D.Parallel",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfDelaunay3DParallel::RunTest(const FString& Parameters)
+{
+	// 4M points needs several GB and minutes of sequential time, so it only runs with -PCGExLargeBench
+	TArray<int32> Sizes = {100000, 1000000};
+	if (FParse::Param(FCommandLine::Get(), TEXT("PCGExLargeBench"))) { Sizes.Add(4000000); }
+
+	const int32 NumBlocks = FMath::Max(2, FTaskGraphInterface::Get().GetNumWorkerThreads());
+
+	for (const int32 NumPoints : Sizes)
+	{
+		TArray<FVector> Positions;
+		Positions.SetNumUninitialized(NumPoints);
+
+		FRandomStream Random(NumPoints);
+		for (FVector& Position : Positions) { Position = FVector(Random.FRandRange(0, 10000), Random.FRandRange(0, 10000), Random.FRandRange(0, 10000)); }
+
+		PCGExTest::FTestDelaunay3 Sequential;
+		const double StartSequential = FPlatformTime::Seconds();
+		const bool bSequential = Sequential.Process(Positions);
+		const double SequentialTime = FPlatformTime::Seconds() - StartSequential;
+
+		PCGExTest::FTestDelaunay3 Parallel;
+		const double StartParallel = FPlatformTime::Seconds();
+		const bool bParallel = Parallel.ProcessParallel(Positions, NumBlocks);
+		const double ParallelTime = FPlatformTime::Seconds() - StartParallel;
+
+		TestTrue(FString::Printf(TEXT("%d points: both succeeded"), NumPoints), bSequential && bParallel);
+		TestEqual(FString::Printf(TEXT("%d points: same site count"), NumPoints), Parallel.Sites.Num(), Sequential.Sites.Num());
+		TestEqual(FString::Printf(TEXT("%d points: same edge count"), NumPoints), Parallel.DelaunayEdges.Num(), Sequential.DelaunayEdges.Num());
+
+		AddInfo(FString::Printf(TEXT("%d points -> %d sites: sequential %.3f ms, %d blocks %.3f ms (%.2fx), border set %.1f%%"),
+			NumPoints, Parallel.Sites.Num(), SequentialTime * 1000.0, NumBlocks, ParallelTime * 1000.0,
+			SequentialTime / FMath::Max(ParallelTime, 1e-9), 100.0 * Parallel.NumBorderPoints() / NumPoints));
+	}
+
+	return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 	FPCGExPerfVoronoi3DLarge,
 	"PCGEx.Performance.Voronoi3D.LargePointSet",
@@ -265,6 +809,126 @@ bool FPCGExPerfVoronoi3DLarge::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfVoronoiLazyCells,
+	"PCGEx.Performance.Voronoi.LazyCells",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfVoronoiLazyCells::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// Eager diagram against triangulation + the cells in a box covering a tenth of the domain
+	const bool bLarge = FParse::Param(FCommandLine::Get(), TEXT("PCGExLargeBench"));
+	const int32 NumPoints2 = bLarge ? 1000000 : 100000;
+	const int32 NumPoints3 = bLarge ? 200000 : 50000;
+
+	{
+		TArray<FVector2D> Positions;
+		Positions.SetNumUninitialized(NumPoints2);
+
+		FRandomStream Random(NumPoints2);
+		for (FVector2D& Position : Positions) { Position = FVector2D(Random.FRandRange(0, 10000), Random.FRandRange(0, 10000)); }
+
+		FTestVoronoi2 Eager;
+		const double StartEager = FPlatformTime::Seconds();
+		const bool bEager = Eager.ProcessAll(Positions);
+		const double EagerTime = FPlatformTime::Seconds() - StartEager;
+
+		FTestVoronoi2 Lazy;
+		TArray<FTestVoronoiCell2> Cells;
+		const double StartLazy = FPlatformTime::Seconds();
+		const bool bLazy = Lazy.Process(Positions);
+		const double MidLazy = FPlatformTime::Seconds();
+		Lazy.GetCellsInBounds(FBox2D(FVector2D(0, 0), FVector2D(3162, 3162)), Cells);
+		const double EndLazy = FPlatformTime::Seconds();
+
+		TestTrue(TEXT("2D: both succeeded"), bEager && bLazy);
+
+		AddInfo(FString::Printf(TEXT("Voronoi 2D %d points: eager %.3f ms, lazy %.3f ms (%.2fx), of which %d cells %.3f ms"),
+			NumPoints2, EagerTime * 1000.0, (EndLazy - StartLazy) * 1000.0, EagerTime / FMath::Max(EndLazy - StartLazy, 1e-9),
+			Cells.Num(), (EndLazy - MidLazy) * 1000.0));
+	}
+
+	{
+		TArray<FVector> Positions;
+		Positions.SetNumUninitialized(NumPoints3);
+
+		FRandomStream Random(NumPoints3);
+		for (FVector& Position : Positions) { Position = FVector(Random.FRandRange(0, 10000), Random.FRandRange(0, 10000), Random.FRandRange(0, 10000)); }
+
+		FTestVoronoi3 Eager;
+		const double StartEager = FPlatformTime::Seconds();
+		const bool bEager = Eager.ProcessAll(Positions);
+		const double EagerTime = FPlatformTime::Seconds() - StartEager;
+
+		FTestVoronoi3 Lazy;
+		TArray<FTestVoronoiCell3> Cells;
+		const double StartLazy = FPlatformTime::Seconds();
+		const bool bLazy = Lazy.Process(Positions);
+		const double MidLazy = FPlatformTime::Seconds();
+		Lazy.GetCellsInBounds(FBox(FVector(0, 0, 0), FVector(4642, 4642, 4642)), Cells);
+		const double EndLazy = FPlatformTime::Seconds();
+
+		TestTrue(TEXT("3D: both succeeded"), bEager && bLazy);
+
+		AddInfo(FString::Printf(TEXT("Voronoi 3D %d points: eager %.3f ms, lazy %.3f ms (%.2fx), of which %d cells %.3f ms"),
+			NumPoints3, EagerTime * 1000.0, (EndLazy - StartLazy) * 1000.0, EagerTime / FMath::Max(EndLazy - StartLazy, 1e-9),
+			Cells.Num(), (EndLazy - MidLazy) * 1000.0));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfVoronoiMetricPaths,
+	"PCGEx.Performance.Voronoi2D.MetricPaths",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfVoronoiMetricPaths::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	const int32 NumPoints = FParse::Param(FCommandLine::Get(), TEXT("PCGExLargeBench")) ? 1000000 : 200000;
+
+	TArray<FVector2D> Positions;
+	Positions.SetNumUninitialized(NumPoints);
+
+	FRandomStream Random(NumPoints);
+	for (FVector2D& Position : Positions) { Position = FVector2D(Random.FRandRange(0, 10000), Random.FRandRange(0, 10000)); }
+
+	FTestVoronoi2 Voronoi;
+	TestTrue(TEXT("Processed"), Voronoi.ProcessAll(Positions));
+
+	// Buffers are reused, so the second round of each runs on warm allocations
+	FTestVoronoiPaths2 Paths;
+
+	const double StartEuclidean = FPlatformTime::Seconds();
+	Voronoi.BuildPaths(EPCGExVoronoiMetric::Euclidean, Paths);
+	const double EuclideanTime = FPlatformTime::Seconds() - StartEuclidean;
+
+	for (const EPCGExVoronoiMetric Metric : {EPCGExVoronoiMetric::Manhattan, EPCGExVoronoiMetric::Chebyshev})
+	{
+		const TCHAR* Name = Metric == EPCGExVoronoiMetric::Manhattan ? TEXT("Manhattan") : TEXT("Chebyshev");
+
+		const double StartPerEdge = FPlatformTime::Seconds();
+		Voronoi.BuildPathsPerEdge(Metric, Paths);
+		const double PerEdgeTime = FPlatformTime::Seconds() - StartPerEdge;
+
+		const double StartBatched = FPlatformTime::Seconds();
+		Voronoi.BuildPaths(Metric, Paths);
+		const double BatchedTime = FPlatformTime::Seconds() - StartBatched;
+
+		TestTrue(FString::Printf(TEXT("%s: bends"), Name), Paths.NumBends > 0);
+
+		AddInfo(FString::Printf(TEXT("%s %d points -> %d edges, %d bends: per-edge %.3f ms, batched %.3f ms (%.2fx), Euclidean %.3f ms"),
+			Name, NumPoints, Paths.Edges.Num() - Paths.NumBends, Paths.NumBends, PerEdgeTime * 1000.0, BatchedTime * 1000.0,
+			PerEdgeTime / FMath::Max(BatchedTime, 1e-9), EuclideanTime * 1000.0));
+	}
+
+	return true;
+}
+
 //////////////////////////////////////////////////////////////////
 // Cluster Structure Stress Tests
 //////////////////////////////////////////////////////////////////
@@ -396,6 +1060,62 @@ bool FPCGExPerfEdgeHashPerformance::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfEdgeDedupPerformance,
+	"PCGEx.Performance.ClusterStructs.EdgeDedup",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfEdgeDedupPerformance::RunTest(const FString& Parameters)
+{
+	// Edge keys as a graph builder sees them: local edges, each emitted from both endpoints.
+	// 1e8 keys needs several GB, so it only runs with -PCGExLargeBench
+	TArray<int32> Sizes = {1000000, 10000000};
+	if (FParse::Param(FCommandLine::Get(), TEXT("PCGExLargeBench"))) { Sizes.Add(100000000); }
+
+	for (const int32 NumKeys : Sizes)
+	{
+		const int32 NumNodes = FMath::Max(2, NumKeys / 6);
+
+		TArray<uint64> Keys;
+		Keys.SetNumUninitialized(NumKeys);
+
+		FRandomStream Random(NumKeys);
+		for (int32 i = 0; i + 1 < NumKeys; i += 2)
+		{
+			const uint32 A = static_cast<uint32>(Random.RandRange(0, NumNodes - 1));
+			const uint32 B = static_cast<uint32>(FMath::Clamp(static_cast<int32>(A) + Random.RandRange(-64, 64), 0, NumNodes - 1));
+			Keys[i] = PCGExGraphs::FEdge(0, A, B).H64U();
+			Keys[i + 1] = PCGExGraphs::FEdge(0, B, A).H64U();
+		}
+		if (NumKeys % 2) { Keys.Last() = Keys[0]; }
+
+		TArray<uint64> Hashed;
+		const double StartHashed = FPlatformTime::Seconds();
+		const int32 NumHashed = PCGExTest::TestEdgeDedup::DedupHashed(Keys, Hashed);
+		const double HashedTime = FPlatformTime::Seconds() - StartHashed;
+
+		TArray<uint64> Sorted;
+		const double StartSorted = FPlatformTime::Seconds();
+		const int32 NumSorted = PCGExTest::TestEdgeDedup::DedupSorted(Keys, Sorted);
+		const double SortedTime = FPlatformTime::Seconds() - StartSorted;
+
+		TestEqual(FString::Printf(TEXT("%d keys: same unique edges"), NumKeys), NumSorted, NumHashed);
+
+		TArray<int32> Offsets;
+		TArray<PCGExGraphs::FLink> Links;
+		const double StartAdjacency = FPlatformTime::Seconds();
+		PCGExTest::TestEdgeDedup::BuildAdjacency(NumNodes, Sorted, Offsets, Links);
+		const double AdjacencyTime = FPlatformTime::Seconds() - StartAdjacency;
+
+		TestEqual(FString::Printf(TEXT("%d keys: two links per edge"), NumKeys), Links.Num(), NumSorted * 2);
+
+		AddInfo(FString::Printf(TEXT("%d keys -> %d edges: TSet %.3f ms, radix sort %.3f ms (%.2fx), adjacency %.3f ms"),
+			NumKeys, NumSorted, HashedTime * 1000.0, SortedTime * 1000.0, HashedTime / FMath::Max(SortedTime, 1e-9), AdjacencyTime * 1000.0));
+	}
+
+	return true;
+}
+
 //////////////////////////////////////////////////////////////////
 // Index Lookup Stress Tests
 //////////////////////////////////////////////////////////////////
@@ -576,3 +1296,105 @@ bool FPCGExPerfMixedOperations::RunTest(const FString& Parameters)
 
 	return true;
 }
+
+//////////////////////////////////////////////////////////////////
+// Sharded Container Stress Tests
+//////////////////////////////////////////////////////////////////
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfShardedMapBuildVsLocked,
+	"PCGEx.Performance.ShardedContainers.BuildThenMergeVsLocked",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfShardedMapBuildVsLocked::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumInserts = 10000000;
+	const int32 NumChunks = FMath::Max(1, FPlatformMisc::NumberOfCoresIncludingHyperthreads() * 4);
+	const int32 ChunkSize = FMath::DivideAndRoundUp(NumInserts, NumChunks);
+
+	auto MakeKey = [](const int32 i) { return static_cast<uint64>(i) * 0x9E3779B1ull + 1; };
+
+	// Locked shards
+	TMap<uint64, int32> LockedResult;
+	double LockedInsertMs = 0;
+	double LockedCollapseMs = 0;
+	{
+		PCGExMT::TH64MapShards<int32, 32> Map;
+
+		const double Start = FPlatformTime::Seconds();
+		ParallelFor(
+			NumChunks, [&](const int32 Chunk)
+			{
+				const int32 End = FMath::Min(NumInserts, (Chunk + 1) * ChunkSize);
+				for (int32 i = Chunk * ChunkSize; i < End; i++) { Map.Add(MakeKey(i), i); }
+			});
+		const double Mid = FPlatformTime::Seconds();
+		Map.Collapse(LockedResult);
+		const double End = FPlatformTime::Seconds();
+
+		LockedInsertMs = (Mid - Start) * 1000.0;
+		LockedCollapseMs = (End - Mid) * 1000.0;
+	}
+
+	// Thread-local build, parallel merge
+	TMap<uint64, int32> BuildResult;
+	double BuildInsertMs = 0;
+	double BuildCollapseMs = 0;
+	{
+		PCGExTest::TH64MapBuildShards<int32, 32> Map(NumChunks);
+
+		const double Start = FPlatformTime::Seconds();
+		ParallelFor(
+			NumChunks, [&](const int32 Chunk)
+			{
+				const int32 End = FMath::Min(NumInserts, (Chunk + 1) * ChunkSize);
+				for (int32 i = Chunk * ChunkSize; i < End; i++) { Map.Add(Chunk, MakeKey(i), i); }
+			});
+		const double Mid = FPlatformTime::Seconds();
+		Map.Collapse(BuildResult);
+		const double End = FPlatformTime::Seconds();
+
+		BuildInsertMs = (Mid - Start) * 1000.0;
+		BuildCollapseMs = (End - Mid) * 1000.0;
+	}
+
+	TestEqual(TEXT("Locked shards hold all inserts"), LockedResult.Num(), NumInserts);
+	TestEqual(TEXT("Build-then-merge holds all inserts"), BuildResult.Num(), NumInserts);
+
+	AddInfo(FString::Printf(TEXT("Locked shards: %d inserts in %.3f ms, collapse %.3f ms"), NumInserts, LockedInsertMs, LockedCollapseMs));
+	AddInfo(FString::Printf(TEXT("Build-then-merge (%d slots): %d inserts in %.3f ms, merge+collapse %.3f ms"), NumChunks, NumInserts, BuildInsertMs, BuildCollapseMs));
+	AddInfo(FString::Printf(TEXT("Total speedup: %.2fx"), (LockedInsertMs + LockedCollapseMs) / FMath::Max(0.001, BuildInsertMs + BuildCollapseMs)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPerfShardCountSweep,
+	"PCGEx.Performance.ShardedContainers.ShardCountSweep",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPerfShardCountSweep::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumInserts = 1000000;
+	const int32 NumWorkers = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+	const int32 AutoShards = PCGExTest::ComputeShardCount(NumWorkers, NumInserts);
+
+	AddInfo(FString::Printf(TEXT("%d logical cores, auto-tuned shard count: %d"), NumWorkers, AutoShards));
+
+	for (const int32 NumShards : {1, 4, 16, 32, 64, 256, 1024})
+	{
+		PCGExTest::FH64SetShardsDyn Set(NumShards, true);
+
+		const double Start = FPlatformTime::Seconds();
+		ParallelFor(NumInserts, [&](const int32 i) { Set.Add(static_cast<uint64>(i) * 0x9E3779B1ull); });
+		const double End = FPlatformTime::Seconds();
+
+		const PCGExTest::FShardContentionStats Stats = Set.GetContentionStats();
+		TestEqual(FString::Printf(TEXT("%d shards: all inserts recorded"), NumShards), Stats.GetTotalAcquisitions(), static_cast<int64>(NumInserts));
+
+		AddInfo(FString::Printf(TEXT("%4d shards%s: %.3f ms, %s"),
+			NumShards, NumShards == AutoShards ? TEXT(" (auto)") : TEXT(""), (End - Start) * 1000.0, *Stats.ToString()));
+	}
+
+	return true;
+}
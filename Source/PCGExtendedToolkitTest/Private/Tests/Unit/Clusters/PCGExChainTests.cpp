@@ -1340,3 +1340,256 @@ bool FPCGExChainAllBreakpointsTest::RunTest(const FString& Parameters)
 
 	return true;
 }
+
+//
+// Parallel Chain Building Tests
+//
+
+namespace PCGExChainTestsLocal
+{
+	TSharedPtr<TArray<int8>> RandomBreakpoints(const int32 Num, const float Ratio, const int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TSharedPtr<TArray<int8>> Breakpoints = MakeShared<TArray<int8>>();
+		Breakpoints->SetNumUninitialized(Num);
+		for (int8& Breakpoint : *Breakpoints) { Breakpoint = Random.FRand() < Ratio ? 1 : 0; }
+		return Breakpoints;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExChainParallelTopologiesTest,
+	"PCGEx.Unit.Clusters.Chain.Parallel.Topologies",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExChainParallelTopologiesTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TArray<TPair<FString, TSharedRef<FTestCluster>>> Clusters;
+	Clusters.Emplace(TEXT("LinearChain"), FClusterBuilder().WithLinearChain(12).Build());
+	Clusters.Emplace(TEXT("ClosedLoop"), FClusterBuilder().WithClosedLoop(9).Build());
+	Clusters.Emplace(TEXT("Star"), FClusterBuilder().WithStar(7).Build());
+	Clusters.Emplace(TEXT("Grid"), FClusterBuilder().WithGrid(6, 5).Build());
+	Clusters.Emplace(TEXT("SingleEdge"), FClusterBuilder().WithLinearChain(2).Build());
+
+	for (const TPair<FString, TSharedRef<FTestCluster>>& Entry : Clusters)
+	{
+		TArray<TSharedPtr<FTestChain>> Sequential;
+		TArray<TSharedPtr<FTestChain>> Parallel;
+
+		const bool bSequential = TestChainHelpers::BuildChains(Entry.Value, Sequential);
+		const bool bParallel = TestChainHelpers::BuildChainsParallel(Entry.Value, Parallel);
+
+		TestTrue(FString::Printf(TEXT("%s: same return value"), *Entry.Key), bParallel == bSequential);
+
+		FString Mismatch;
+		const bool bMatch = TestChainHelpers::ChainsMatch(Sequential, Parallel, &Mismatch);
+		TestTrue(FString::Printf(TEXT("%s: parallel matches sequential"), *Entry.Key), bMatch);
+		if (!bMatch) { AddError(FString::Printf(TEXT("%s: %s"), *Entry.Key, *Mismatch)); }
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExChainParallelBreakpointsTest,
+	"PCGEx.Unit.Clusters.Chain.Parallel.Breakpoints",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExChainParallelBreakpointsTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// Closed loop with breakpoints exercises the seed rejoin in the worker
+	{
+		TSharedRef<FTestCluster> Loop = FClusterBuilder().WithClosedLoop(10).Build();
+		TSharedPtr<TArray<int8>> Breakpoints = MakeShared<TArray<int8>>();
+		Breakpoints->Init(0, 10);
+		(*Breakpoints)[3] = 1;
+		(*Breakpoints)[7] = 1;
+
+		TArray<TSharedPtr<FTestChain>> Sequential;
+		TArray<TSharedPtr<FTestChain>> Parallel;
+		TestChainHelpers::BuildChains(Loop, Sequential, Breakpoints);
+		TestChainHelpers::BuildChainsParallel(Loop, Parallel, Breakpoints);
+
+		FString Mismatch;
+		const bool bMatch = TestChainHelpers::ChainsMatch(Sequential, Parallel, &Mismatch);
+		TestTrue(TEXT("Loop with breakpoints matches"), bMatch);
+		if (!bMatch) { AddError(Mismatch); }
+		TestEqual(TEXT("Loop splits into 2 chains"), Parallel.Num(), 2);
+	}
+
+	// Random sparse grids, with and without breakpoints
+	for (int32 Seed = 0; Seed < 8; Seed++)
+	{
+		TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithSparseGrid(24, 0.7f, Seed).Build();
+		if (!Cluster->bValid) { continue; }
+
+		const TSharedPtr<TArray<int8>> Breakpoints = PCGExChainTestsLocal::RandomBreakpoints(Cluster->NumNodes(), 0.1f, Seed + 100);
+
+		for (const bool bUseBreakpoints : {false, true})
+		{
+			const TSharedPtr<TArray<int8>> BP = bUseBreakpoints ? Breakpoints : nullptr;
+
+			TArray<TSharedPtr<FTestChain>> Sequential;
+			TArray<TSharedPtr<FTestChain>> Parallel;
+			TestChainHelpers::BuildChains(Cluster, Sequential, BP);
+			TestChainHelpers::BuildChainsParallel(Cluster, Parallel, BP);
+
+			FString Mismatch;
+			if (!TestChainHelpers::ChainsMatch(Sequential, Parallel, &Mismatch))
+			{
+				AddError(FString::Printf(TEXT("Seed %d (breakpoints: %s): %s"), Seed, bUseBreakpoints ? TEXT("yes") : TEXT("no"), *Mismatch));
+			}
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExChainParallelDeterminismTest,
+	"PCGEx.Unit.Clusters.Chain.Parallel.Determinism",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExChainParallelDeterminismTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithSparseGrid(40, 0.65f, 1234).Build();
+	const TSharedPtr<TArray<int8>> Breakpoints = PCGExChainTestsLocal::RandomBreakpoints(Cluster->NumNodes(), 0.05f, 99);
+
+	TArray<TSharedPtr<FTestChain>> Reference;
+	TestChainHelpers::BuildChainsParallel(Cluster, Reference, Breakpoints);
+
+	bool bStable = true;
+	for (int32 Run = 0; Run < 10 && bStable; Run++)
+	{
+		TArray<TSharedPtr<FTestChain>> Chains;
+		TestChainHelpers::BuildChainsParallel(Cluster, Chains, Breakpoints);
+
+		FString Mismatch;
+		if (!TestChainHelpers::ChainsMatch(Reference, Chains, &Mismatch))
+		{
+			bStable = false;
+			AddError(FString::Printf(TEXT("Run %d: %s"), Run, *Mismatch));
+		}
+	}
+
+	TestTrue(TEXT("Parallel output is identical across runs"), bStable);
+
+	return true;
+}
+
+//
+// Incremental Breakpoint Tests
+//
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExChainIncrementalMatchesRebuildTest,
+	"PCGEx.Unit.Clusters.Chain.Incremental.MatchesRebuild",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExChainIncrementalMatchesRebuildTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithSparseGrid(30, 0.7f, 5).Build();
+	const int32 NumPoints = Cluster->NumNodes();
+
+	TSharedPtr<TArray<int8>> Breakpoints = PCGExChainTestsLocal::RandomBreakpoints(NumPoints, 0.05f, 17);
+
+	TArray<TSharedPtr<FTestChain>> Incremental;
+	TestChainHelpers::UpdateChains(Cluster, Breakpoints, {}, Incremental);
+
+	FRandomStream Random(3);
+	for (int32 Round = 0; Round < 20; Round++)
+	{
+		// Toggle a handful of points, like an interactive edit would
+		TArray<int32> Dirty;
+		const int32 NumToggles = Random.RandRange(1, 6);
+		for (int32 t = 0; t < NumToggles; t++)
+		{
+			const int32 PointIndex = Random.RandRange(0, NumPoints - 1);
+			(*Breakpoints)[PointIndex] = (*Breakpoints)[PointIndex] ? 0 : 1;
+			Dirty.Add(PointIndex);
+		}
+
+		TestChainHelpers::UpdateChains(Cluster, Breakpoints, Dirty, Incremental);
+
+		TArray<TSharedPtr<FTestChain>> Rebuilt;
+		TestChainHelpers::BuildChains(Cluster, Rebuilt, Breakpoints);
+
+		FString Mismatch;
+		if (!TestChainHelpers::ChainsMatch(Rebuilt, Incremental, &Mismatch))
+		{
+			AddError(FString::Printf(TEXT("Round %d: %s"), Round, *Mismatch));
+			break;
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExChainIncrementalReuseTest,
+	"PCGEx.Unit.Clusters.Chain.Incremental.ReusesUnaffectedChains",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExChainIncrementalReuseTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// Hub with three arms: 1-2-3-0, 4-5-6-0, 7-8-9-0
+	FClusterBuilder Builder;
+	Builder.AddNode(0, FVector::ZeroVector);
+	for (int32 Arm = 0; Arm < 3; Arm++)
+	{
+		const FVector Dir = FVector(FMath::Cos(Arm * 2.0), FMath::Sin(Arm * 2.0), 0);
+		for (int32 i = 1; i <= 3; i++) { Builder.AddNode(Arm * 3 + i, Dir * (400 - i * 100)); }
+		Builder.AddEdge(Arm * 3 + 1, Arm * 3 + 2).AddEdge(Arm * 3 + 2, Arm * 3 + 3).AddEdge(Arm * 3 + 3, 0);
+	}
+	TSharedRef<FTestCluster> Cluster = Builder.Build();
+
+	TSharedPtr<TArray<int8>> Breakpoints = MakeShared<TArray<int8>>();
+	Breakpoints->Init(0, 10);
+
+	TSharedPtr<FCachedChainData> Cached = TestChainHelpers::GetOrBuildCachedChains(Cluster, Breakpoints);
+	TestEqual(TEXT("Three arms"), Cached->BaseChains.Num(), 3);
+	TestTrue(TEXT("Cache is stored on the cluster"), Cluster->GetCachedData<FCachedChainData>(FCachedChainData::CacheKey) == Cached);
+
+	TArray<TSharedPtr<FTestChain>> Before;
+	Cached->Gather(Before);
+
+	// Breakpoint on node 5, only the middle arm goes through it
+	(*Breakpoints)[5] = 1;
+	const int32 NumResplit = Cached->UpdateBreakpoints(Cluster, Breakpoints, {5});
+	TestEqual(TEXT("Only one chain re-split"), NumResplit, 1);
+
+	TArray<TSharedPtr<FTestChain>> After;
+	Cached->Gather(After);
+	TestEqual(TEXT("Middle arm split in two"), After.Num(), 4);
+
+	int32 NumReused = 0;
+	for (const TSharedPtr<FTestChain>& Chain : After)
+	{
+		if (Before.Contains(Chain)) { NumReused++; }
+	}
+	TestEqual(TEXT("Untouched arms keep their chain objects"), NumReused, 2);
+
+	// Diff-based update through the cluster cache
+	(*Breakpoints)[5] = 0;
+	TSharedPtr<FCachedChainData> Again = TestChainHelpers::GetOrBuildCachedChains(Cluster, Breakpoints);
+	TestTrue(TEXT("Same cache object is reused"), Again == Cached);
+
+	TArray<TSharedPtr<FTestChain>> Restored;
+	Again->Gather(Restored);
+	TestEqual(TEXT("Back to three chains"), Restored.Num(), 3);
+
+	// Toggling a point no chain goes through re-splits nothing
+	TestEqual(TEXT("Out-of-range dirty point is ignored"), Cached->UpdateBreakpoints(Cluster, Breakpoints, {42}), 0);
+
+	return true;
+}
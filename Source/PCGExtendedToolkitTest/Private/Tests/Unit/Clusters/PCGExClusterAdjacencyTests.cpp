@@ -0,0 +1,208 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "Helpers/PCGExClusterHelpers.h"
+#include "Helpers/PCGExChainTestHelpers.h"
+
+/**
+ * Cluster CSR Adjacency Tests
+ *
+ * Verifies the compressed-sparse-row adjacency (one offsets array + one flat link array)
+ * against per-node FNode::Links, and that topology queries and chain building behave
+ * identically when nodes don't own their links.
+ *
+ * Test naming convention: PCGEx.Unit.Clusters.Adjacency.<Case>
+ */
+
+namespace PCGExAdjacencyTestsLocal
+{
+	bool SameAdjacency(const TSharedRef<PCGExTest::FTestCluster>& A, const TSharedRef<PCGExTest::FTestCluster>& B)
+	{
+		if (A->AdjacencyOffsets != B->AdjacencyOffsets || A->AdjacencyLinks.Num() != B->AdjacencyLinks.Num()) { return false; }
+		for (int32 i = 0; i < A->AdjacencyLinks.Num(); i++)
+		{
+			if (A->AdjacencyLinks[i].Node != B->AdjacencyLinks[i].Node || A->AdjacencyLinks[i].Edge != B->AdjacencyLinks[i].Edge) { return false; }
+		}
+		return true;
+	}
+}
+
+//
+// Layout Tests
+//
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExClusterAdjacencyMatchesNodeLinksTest,
+	"PCGEx.Unit.Clusters.Adjacency.MatchesNodeLinks",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExClusterAdjacencyMatchesNodeLinksTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder()
+		.WithGrid(5, 4)
+		.Build();
+
+	TestEqual(TEXT("One offset per node + 1"), Cluster->AdjacencyOffsets.Num(), 21);
+	TestEqual(TEXT("NumNodes"), Cluster->NumNodes(), 20);
+	TestEqual(TEXT("Two links per edge"), Cluster->AdjacencyLinks.Num(), Cluster->Edges->Num() * 2);
+
+	bool bAllMatch = true;
+	for (int32 i = 0; i < Cluster->NumNodes(); i++)
+	{
+		const PCGExClusters::FNode* Node = Cluster->GetNode(i);
+		const TConstArrayView<PCGExGraphs::FLink> Links = Cluster->GetLinks(i);
+
+		if (Links.Num() != Node->Num())
+		{
+			bAllMatch = false;
+			AddError(FString::Printf(TEXT("Node %d: %d CSR links vs %d node links"), i, Links.Num(), Node->Num()));
+			continue;
+		}
+
+		for (int32 j = 0; j < Links.Num(); j++)
+		{
+			if (Links[j].Node != Node->Links[j].Node || Links[j].Edge != Node->Links[j].Edge)
+			{
+				bAllMatch = false;
+				AddError(FString::Printf(TEXT("Node %d link %d differs"), i, j));
+			}
+		}
+
+		if (Cluster->IsLeaf(i) != Node->IsLeaf() ||
+			Cluster->IsBinary(i) != Node->IsBinary() ||
+			Cluster->IsComplex(i) != Node->IsComplex())
+		{
+			bAllMatch = false;
+			AddError(FString::Printf(TEXT("Node %d classification differs"), i));
+		}
+	}
+
+	TestTrue(TEXT("CSR adjacency matches per-node links"), bAllMatch);
+
+	// Corners have 2 neighbors, interior nodes 4
+	TestEqual(TEXT("Corner node has 2 links"), Cluster->GetNumLinks(0), 2);
+	TestEqual(TEXT("Interior node has 4 links"), Cluster->GetNumLinks(6), 4);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExClusterAdjacencyCompactBuildTest,
+	"PCGEx.Unit.Clusters.Adjacency.CompactBuild",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExClusterAdjacencyCompactBuildTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedRef<FTestCluster> Regular = FClusterBuilder()
+		.WithGrid(6, 6)
+		.Build();
+
+	TSharedRef<FTestCluster> Compact = FClusterBuilder()
+		.WithGrid(6, 6)
+		.WithCompactAdjacency()
+		.Build();
+
+	int32 NodesWithLinks = 0;
+	for (const PCGExClusters::FNode& Node : *Compact->Nodes)
+	{
+		if (!Node.IsEmpty()) { NodesWithLinks++; }
+	}
+
+	TestEqual(TEXT("Compact nodes own no links"), NodesWithLinks, 0);
+	TestTrue(TEXT("Edge-derived CSR matches node-derived CSR"), PCGExAdjacencyTestsLocal::SameAdjacency(Regular, Compact));
+
+	TestEqual(TEXT("Same leaf count"), ClusterVerify::CountLeafNodes(Compact), ClusterVerify::CountLeafNodes(Regular));
+	TestEqual(TEXT("Same binary count"), ClusterVerify::CountBinaryNodes(Compact), ClusterVerify::CountBinaryNodes(Regular));
+	TestEqual(TEXT("Same complex count"), ClusterVerify::CountComplexNodes(Compact), ClusterVerify::CountComplexNodes(Regular));
+	TestTrue(TEXT("Corner is binary through CSR"), ClusterVerify::NodeIsBinary(Compact, 0));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExClusterAdjacencyReleaseNodeLinksTest,
+	"PCGEx.Unit.Clusters.Adjacency.ReleaseNodeLinks",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExClusterAdjacencyReleaseNodeLinksTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedRef<FTestCluster> Source = FClusterBuilder()
+		.WithStar(5)
+		.Build();
+
+	TSharedPtr<TArray<PCGExClusters::FNode>> NodesCopy = MakeShared<TArray<PCGExClusters::FNode>>(*Source->Nodes);
+	TSharedPtr<TArray<PCGExGraphs::FEdge>> EdgesCopy = MakeShared<TArray<PCGExGraphs::FEdge>>(*Source->Edges);
+
+	TSharedRef<FTestCluster> Released = MakeShared<FTestCluster>();
+	Released->Initialize(Source->NodeIndexLookup, NodesCopy, EdgesCopy, Source->Positions, true);
+
+	TestTrue(TEXT("Center node links released"), (*Released->Nodes)[0].Links.IsEmpty());
+	TestTrue(TEXT("CSR preserved"), PCGExAdjacencyTestsLocal::SameAdjacency(Source, Released));
+	TestTrue(TEXT("Center is complex"), Released->IsComplex(0));
+	TestEqual(TEXT("5 leaves"), ClusterVerify::CountLeafNodes(Released), 5);
+
+	// Rebuilding after release falls back to the edge list
+	Released->BuildAdjacency();
+	TestTrue(TEXT("Rebuild from edges preserves CSR"), PCGExAdjacencyTestsLocal::SameAdjacency(Source, Released));
+
+	return true;
+}
+
+//
+// Chain Building On CSR
+//
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExClusterAdjacencyChainsTest,
+	"PCGEx.Unit.Clusters.Adjacency.Chains",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExClusterAdjacencyChainsTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// Branching topology: 0-1-2-3 with 2-4-5 and a loop 3-6-7-3
+	auto MakeBuilder = []()
+	{
+		FClusterBuilder Builder;
+		for (int32 i = 0; i < 8; i++) { Builder.AddNode(i, FVector(i * 100, (i % 3) * 50, 0)); }
+		Builder.AddEdge(0, 1).AddEdge(1, 2).AddEdge(2, 3).AddEdge(2, 4).AddEdge(4, 5).AddEdge(3, 6).AddEdge(6, 7).AddEdge(7, 3);
+		return Builder;
+	};
+
+	TSharedRef<FTestCluster> Regular = MakeBuilder().Build();
+	TSharedRef<FTestCluster> Compact = MakeBuilder().WithCompactAdjacency().Build();
+
+	TSharedPtr<TArray<int8>> Breakpoints = MakeShared<TArray<int8>>();
+	Breakpoints->Init(0, 8);
+	(*Breakpoints)[1] = 1;
+
+	for (const bool bWithBreakpoints : {false, true})
+	{
+		const TSharedPtr<TArray<int8>> BP = bWithBreakpoints ? Breakpoints : nullptr;
+
+		TArray<TSharedPtr<FTestChain>> RegularChains;
+		TArray<TSharedPtr<FTestChain>> CompactChains;
+		TestTrue(TEXT("Regular chains built"), TestChainHelpers::BuildChains(Regular, RegularChains, BP));
+		TestTrue(TEXT("Compact chains built"), TestChainHelpers::BuildChains(Compact, CompactChains, BP));
+
+		TestEqual(TEXT("Same chain count"), CompactChains.Num(), RegularChains.Num());
+		if (CompactChains.Num() != RegularChains.Num()) { continue; }
+
+		for (int32 i = 0; i < RegularChains.Num(); i++)
+		{
+			TestEqual(FString::Printf(TEXT("Chain %d hash"), i), CompactChains[i]->UniqueHash, RegularChains[i]->UniqueHash);
+			TestEqual(FString::Printf(TEXT("Chain %d leaf flag"), i), CompactChains[i]->bIsLeaf, RegularChains[i]->bIsLeaf);
+			TestEqual(FString::Printf(TEXT("Chain %d loop flag"), i), CompactChains[i]->bIsClosedLoop, RegularChains[i]->bIsClosedLoop);
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,350 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+/**
+ * PCGEx Cluster Cache Store Unit Tests
+ *
+ * Tests the budgeted cache store for cluster cached data:
+ * - Hit/miss accounting, ContextHash / version / type validation
+ * - Size accounting, memory budget and LRU eviction
+ * - FTestCluster routing its cache through a shared store
+ *
+ * Test naming convention: PCGEx.Unit.Clusters.CacheStore.<Case>
+ */
+
+#include "Misc/AutomationTest.h"
+#include "Async/ParallelFor.h"
+#include "Clusters/Artifacts/PCGExCachedFaceEnumerator.h"
+#include "Clusters/Artifacts/PCGExPlanarFaceEnumerator.h"
+
+#include "Helpers/PCGExClusterCacheHelpers.h"
+#include "Helpers/PCGExClusterHelpers.h"
+#include "Helpers/PCGExChainTestHelpers.h"
+
+namespace PCGExCacheStoreTestsLocal
+{
+	TSharedPtr<PCGExClusters::ICachedClusterData> MakeEntry(const uint32 ContextHash = 0)
+	{
+		TSharedPtr<PCGExClusters::FCachedTangentFrames> Data = MakeShared<PCGExClusters::FCachedTangentFrames>();
+		Data->ContextHash = ContextHash;
+		return Data;
+	}
+
+	// Distinct owners without needing real clusters
+	uint8 OwnerA = 0;
+	uint8 OwnerB = 0;
+}
+
+// =============================================================================
+// Lookup Tests
+// =============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExCacheStoreHitMissTest,
+	"PCGEx.Unit.Clusters.CacheStore.HitMiss",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExCacheStoreHitMissTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExCacheStoreTestsLocal;
+
+	PCGExTest::FClusterCacheStore Store;
+	const FName Key = TEXT("Frames");
+
+	TestFalse(TEXT("Empty store misses"), Store.Find(&OwnerA, Key).IsValid());
+
+	TSharedPtr<PCGExClusters::ICachedClusterData> Entry = MakeEntry();
+	TestTrue(TEXT("Add succeeds"), Store.AddWithSize(&OwnerA, Key, Entry, 100));
+
+	TestTrue(TEXT("Same owner and key hits"), Store.Find(&OwnerA, Key) == Entry);
+	TestFalse(TEXT("Other owner misses"), Store.Find(&OwnerB, Key).IsValid());
+	TestFalse(TEXT("Other key misses"), Store.Find(&OwnerA, TEXT("Faces")).IsValid());
+
+	const PCGExTest::FClusterCacheStats Stats = Store.GetStats();
+	TestEqual(TEXT("1 hit"), Stats.Hits, 1LL);
+	TestEqual(TEXT("3 misses"), Stats.Misses, 3LL);
+	TestEqual(TEXT("1 insertion"), Stats.Insertions, 1LL);
+	TestEqual(TEXT("100 bytes in use"), Stats.BytesInUse, 100LL);
+	TestEqual(TEXT("1 entry"), Stats.NumEntries, 1);
+	TestTrue(TEXT("Hit ratio is 25%"), FMath::IsNearlyEqual(Stats.GetHitRatio(), 0.25));
+
+	// Replacing an entry releases the previous size
+	Store.AddWithSize(&OwnerA, Key, MakeEntry(), 40);
+	TestEqual(TEXT("Replacement accounts new size only"), Store.GetStats().BytesInUse, 40LL);
+
+	TestTrue(TEXT("Remove existing entry"), Store.Remove(&OwnerA, Key));
+	TestFalse(TEXT("Remove missing entry"), Store.Remove(&OwnerA, Key));
+	TestEqual(TEXT("No bytes after remove"), Store.GetStats().BytesInUse, 0LL);
+
+	Store.ResetStats();
+	TestEqual(TEXT("Stats reset"), Store.GetStats().Hits + Store.GetStats().Misses, 0LL);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExCacheStoreValidationTest,
+	"PCGEx.Unit.Clusters.CacheStore.Validation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExCacheStoreValidationTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExCacheStoreTestsLocal;
+
+	PCGExTest::FClusterCacheStore Store;
+	const FName Key = TEXT("Frames");
+
+	// ContextHash
+	Store.AddWithSize(&OwnerA, Key, MakeEntry(1234), 10);
+	TestTrue(TEXT("Matching ContextHash hits"), Store.Find(&OwnerA, Key, 1234).IsValid());
+	TestTrue(TEXT("ContextHash 0 accepts any"), Store.Find(&OwnerA, Key, 0).IsValid());
+	TestFalse(TEXT("Mismatching ContextHash misses"), Store.Find(&OwnerA, Key, 999).IsValid());
+	TestFalse(TEXT("Stale entry was dropped"), Store.Find(&OwnerA, Key).IsValid());
+	TestEqual(TEXT("One stale drop"), Store.GetStats().StaleDrops, 1LL);
+
+	// Version
+	Store.AddWithSize(&OwnerA, Key, MakeEntry(), 10, 2);
+	TestFalse(TEXT("Older version misses"), Store.Find(&OwnerA, Key, 0, 1).IsValid());
+	Store.AddWithSize(&OwnerA, Key, MakeEntry(), 10, 2);
+	TestTrue(TEXT("Matching version hits"), Store.Find(&OwnerA, Key, 0, 2).IsValid());
+
+	// Type
+	TSharedPtr<PCGExClusters::FCachedTangentFrames> Frames = MakeShared<PCGExClusters::FCachedTangentFrames>();
+	Frames->NodeTangentFrames = MakeShared<TArray<FQuat>>();
+	Frames->NodeTangentFrames->Init(FQuat::Identity, 64);
+
+	TestTrue(TEXT("Typed add"), Store.Add(&OwnerB, Key, Frames));
+	TestTrue(TEXT("Typed size includes frames"), Store.GetStats().BytesInUse >= static_cast<int64>(64 * sizeof(FQuat)));
+	TestTrue(TEXT("Same type hits"), Store.Find<PCGExClusters::FCachedTangentFrames>(&OwnerB, Key) == Frames);
+	TestFalse(TEXT("Other type misses"), Store.Find<PCGExTest::FCachedChainData>(&OwnerB, Key).IsValid());
+
+	return true;
+}
+
+// =============================================================================
+// Budget Tests
+// =============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExCacheStoreLRUTest,
+	"PCGEx.Unit.Clusters.CacheStore.LRUEviction",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExCacheStoreLRUTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExCacheStoreTestsLocal;
+
+	// Budget fits 4 entries of 100 bytes; evictions go down to 50%
+	PCGExTest::FClusterCacheStore Store(400, 0.5);
+
+	const FName Keys[] = {TEXT("A"), TEXT("B"), TEXT("C"), TEXT("D"), TEXT("E")};
+	for (int32 i = 0; i < 4; i++) { Store.AddWithSize(&OwnerA, Keys[i], MakeEntry(), 100); }
+
+	TestEqual(TEXT("At budget"), Store.GetStats().BytesInUse, 400LL);
+	TestEqual(TEXT("No eviction yet"), Store.GetStats().Evictions, 0LL);
+
+	// Touch A and C so B and D are the least recently used
+	Store.Find(&OwnerA, Keys[0]);
+	Store.Find(&OwnerA, Keys[2]);
+
+	Store.AddWithSize(&OwnerA, Keys[4], MakeEntry(), 100);
+
+	// Target is 50% of budget minus incoming: 100 bytes kept before inserting E
+	const PCGExTest::FClusterCacheStats Stats = Store.GetStats();
+	TestEqual(TEXT("Three entries evicted in one batch"), Stats.Evictions, 3LL);
+	TestEqual(TEXT("200 bytes in use"), Stats.BytesInUse, 200LL);
+	TestTrue(TEXT("Most recently used survives"), Store.Find(&OwnerA, Keys[2]).IsValid());
+	TestTrue(TEXT("New entry present"), Store.Find(&OwnerA, Keys[4]).IsValid());
+	TestFalse(TEXT("LRU entry B evicted"), Store.Find(&OwnerA, Keys[1]).IsValid());
+	TestFalse(TEXT("LRU entry D evicted"), Store.Find(&OwnerA, Keys[3]).IsValid());
+	TestEqual(TEXT("Peak never exceeded budget"), Stats.PeakBytes, 400LL);
+
+	// Oversized entries are refused outright
+	TestFalse(TEXT("Entry larger than budget is rejected"), Store.AddWithSize(&OwnerA, TEXT("Huge"), MakeEntry(), 1000));
+	TestEqual(TEXT("Rejection counted"), Store.GetStats().Rejections, 1LL);
+
+	// Shrinking the budget evicts immediately
+	Store.SetBudget(100);
+	TestTrue(TEXT("Shrunk budget respected"), Store.GetStats().BytesInUse <= 100);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExCacheStoreConcurrencyTest,
+	"PCGEx.Unit.Clusters.CacheStore.Concurrency",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExCacheStoreConcurrencyTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExCacheStoreTestsLocal;
+
+	constexpr int32 NumOps = 20000;
+	constexpr int32 NumKeys = 64;
+
+	PCGExTest::FClusterCacheStore Store(NumKeys * 50);
+
+	TArray<FName> Keys;
+	for (int32 i = 0; i < NumKeys; i++) { Keys.Add(FName(*FString::Printf(TEXT("Key%d"), i))); }
+
+	ParallelFor(
+		NumOps, [&](const int32 i)
+		{
+			const FName& Key = Keys[i % NumKeys];
+			if (!Store.Find(&OwnerA, Key)) { Store.AddWithSize(&OwnerA, Key, MakeEntry(), 100); }
+		});
+
+	const PCGExTest::FClusterCacheStats Stats = Store.GetStats();
+	TestEqual(TEXT("Every lookup accounted"), Stats.Hits + Stats.Misses, static_cast<int64>(NumOps));
+	TestTrue(TEXT("Budget respected"), Stats.BytesInUse <= Store.GetBudget());
+	TestEqual(TEXT("Bytes match entry count"), Stats.BytesInUse, static_cast<int64>(Stats.NumEntries) * 100);
+
+	AddInfo(Stats.ToString());
+
+	return true;
+}
+
+// =============================================================================
+// Cluster Integration Tests
+// =============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExCacheStoreClusterTest,
+	"PCGEx.Unit.Clusters.CacheStore.ClusterIntegration",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExCacheStoreClusterTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedPtr<FClusterCacheStore> Store = MakeShared<FClusterCacheStore>();
+
+	TSharedRef<FTestCluster> ClusterA = FClusterBuilder().WithLinearChain(20).Build();
+	TSharedRef<FTestCluster> ClusterB = FClusterBuilder().WithClosedLoop(20).Build();
+
+	// Local entries migrate when the store is attached
+	ClusterA->SetCachedData(TEXT("Local"), PCGExCacheStoreTestsLocal::MakeEntry());
+	ClusterA->SetCacheStore(Store);
+	ClusterB->SetCacheStore(Store);
+	TestEqual(TEXT("Local entry migrated"), Store->GetStats().NumEntries, 1);
+
+	// Chain caches of both clusters land in the shared store, with their real footprint
+	TSharedPtr<FCachedChainData> ChainsA = TestChainHelpers::GetOrBuildCachedChains(ClusterA, nullptr);
+	TSharedPtr<FCachedChainData> ChainsB = TestChainHelpers::GetOrBuildCachedChains(ClusterB, nullptr);
+
+	TestEqual(TEXT("Three entries in store"), Store->GetStats().NumEntries, 3);
+	TestTrue(TEXT("Chain footprint accounted"), Store->GetStats().BytesInUse > GetCachedDataSize(*ChainsA));
+	TestTrue(TEXT("Cluster A reads its own chains"), ClusterA->GetCachedData<FCachedChainData>(FCachedChainData::CacheKey) == ChainsA);
+	TestTrue(TEXT("Cluster B reads its own chains"), ClusterB->GetCachedData<FCachedChainData>(FCachedChainData::CacheKey) == ChainsB);
+
+	ClusterA->ClearCachedData();
+	TestEqual(TEXT("Clearing A leaves B's entry"), Store->GetStats().NumEntries, 1);
+
+	// Evicted caches are rebuilt transparently
+	Store->SetBudget(1);
+	TestFalse(TEXT("Budget evicted B's chains"), ClusterB->GetCachedData<FCachedChainData>(FCachedChainData::CacheKey).IsValid());
+
+	Store->SetBudget(0);
+	TArray<TSharedPtr<FTestChain>> Chains;
+	TestChainHelpers::UpdateChains(ClusterB, nullptr, {}, Chains);
+	TestEqual(TEXT("Rebuilt loop chain"), Chains.Num(), 1);
+
+	// Destroying a cluster releases its entries
+	{
+		TSharedRef<FTestCluster> Temp = FClusterBuilder().WithStar(4).Build();
+		Temp->SetCacheStore(Store);
+		TestChainHelpers::GetOrBuildCachedChains(Temp, nullptr);
+		TestEqual(TEXT("Temp cluster entry added"), Store->GetStats().NumEntries, 2);
+	}
+	TestEqual(TEXT("Temp cluster entry released on destruction"), Store->GetStats().NumEntries, 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExCacheStoreConcreteSizeTest,
+	"PCGEx.Unit.Clusters.CacheStore.ConcreteSize",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExCacheStoreConcreteSizeTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedPtr<FClusterCacheStore> Store = MakeShared<FClusterCacheStore>();
+	const FName Key = TEXT("Frames");
+
+	TSharedPtr<PCGExClusters::FCachedTangentFrames> Frames = MakeShared<PCGExClusters::FCachedTangentFrames>();
+	Frames->NodeTangentFrames = MakeShared<TArray<FQuat>>();
+	Frames->NodeTangentFrames->Init(FQuat::Identity, 64);
+
+	// No explicit size: accounted as tangent frames, not as the base interface
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithGrid(4, 4).Build();
+	Cluster->SetCacheStore(Store);
+	Cluster->SetCachedData(Key, Frames);
+
+	TestEqual(TEXT("Frames sized as their concrete type"), Store->GetStats().BytesInUse, GetCachedDataSize(*Frames));
+	TestTrue(TEXT("Frame storage accounted"), Store->GetStats().BytesInUse >= static_cast<int64>(64 * sizeof(FQuat)));
+	TestFalse(TEXT("Stored typed"), Cluster->GetCachedData<FCachedChainData>(Key).IsValid());
+
+	// Local entries keep their type and are sized on migration
+	TSharedRef<FTestCluster> Local = FClusterBuilder().WithSparseGrid(12, 0.7f, 5).Build();
+	TSharedPtr<FCachedChainData> Chains = TestChainHelpers::GetOrBuildCachedChains(Local, nullptr);
+	Local->SetCachedData(Key, Frames);
+
+	Store->Empty();
+	Local->SetCacheStore(Store);
+
+	TestEqual(TEXT("Both entries migrated"), Store->GetStats().NumEntries, 2);
+	TestEqual(TEXT("Migrated entries sized as their concrete types"), Store->GetStats().BytesInUse, GetCachedDataSize(*Chains) + GetCachedDataSize(*Frames));
+	TestTrue(TEXT("Migrated chains hit as their type"), Local->GetCachedData<FCachedChainData>(FCachedChainData::CacheKey) == Chains);
+	TestFalse(TEXT("Migrated frames miss as another type"), Local->GetCachedData<FCachedChainData>(Key).IsValid());
+
+	// Explicit sizes carry the type as well
+	Store->Empty();
+	Store->AddWithSize(&PCGExCacheStoreTestsLocal::OwnerA, Key, Frames, 10, 0, GetCachedDataTypeId<PCGExClusters::FCachedTangentFrames>());
+	TestEqual(TEXT("Explicit size kept"), Store->GetStats().BytesInUse, 10LL);
+	TestFalse(TEXT("Explicit size entry is typed"), Store->Find<FCachedChainData>(&PCGExCacheStoreTestsLocal::OwnerA, Key).IsValid());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExCacheStoreChainResizeTest,
+	"PCGEx.Unit.Clusters.CacheStore.ChainResize",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExCacheStoreChainResizeTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedPtr<FClusterCacheStore> Store = MakeShared<FClusterCacheStore>();
+
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithSparseGrid(20, 0.7f, 3).Build();
+	Cluster->SetCacheStore(Store);
+
+	TSharedPtr<FCachedChainData> Cached = TestChainHelpers::GetOrBuildCachedChains(Cluster, nullptr);
+	const int64 UnsplitBytes = Store->GetStats().BytesInUse;
+	TestEqual(TEXT("Unsplit chains accounted"), UnsplitBytes, GetCachedDataSize(*Cached));
+
+	// Splits are updated in place; the store must follow their footprint
+	TSharedPtr<TArray<int8>> Breakpoints = MakeShared<TArray<int8>>();
+	Breakpoints->Init(0, Cluster->NumRawVtx);
+	for (int32 i = 0; i < Breakpoints->Num(); i += 3) { (*Breakpoints)[i] = 1; }
+
+	TestChainHelpers::GetOrBuildCachedChains(Cluster, Breakpoints);
+	const int64 SplitBytes = Store->GetStats().BytesInUse;
+	TestEqual(TEXT("Split chains accounted after update"), SplitBytes, GetCachedDataSize(*Cached));
+	TestTrue(TEXT("Splitting grew the entry"), SplitBytes > UnsplitBytes);
+
+	// Dropping the breakpoints releases the split copies
+	TArray<int32> Dirty;
+	for (int32 i = 0; i < Breakpoints->Num(); i += 3) { Dirty.Add(i); }
+
+	TArray<TSharedPtr<FTestChain>> Chains;
+	TestChainHelpers::UpdateChains(Cluster, nullptr, Dirty, Chains);
+	TestEqual(TEXT("Incremental update accounted"), Store->GetStats().BytesInUse, GetCachedDataSize(*Cached));
+	TestTrue(TEXT("Clearing breakpoints shrank the entry"), Store->GetStats().BytesInUse < SplitBytes);
+	TestEqual(TEXT("Still a single entry"), Store->GetStats().NumEntries, 1);
+
+	return true;
+}
@@ -0,0 +1,178 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "Helpers/PCGExClusterHelpers.h"
+#include "Helpers/PCGExClusterReorderHelpers.h"
+#include "Helpers/PCGExChainTestHelpers.h"
+#include "Helpers/PCGExDCELTestHelpers.h"
+
+/**
+ * Cluster Reorder Tests
+ *
+ * Verifies Morton renumbering of cluster nodes and edges: remaps are inverse permutations,
+ * topology and positions survive the round-trip, edge data is carried over, and scattered
+ * input comes out spatially coherent.
+ *
+ * Test naming convention: PCGEx.Unit.Clusters.Reorder.<Case>
+ */
+
+//
+// Remap Tests
+//
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExClusterReorderRemapsTest,
+	"PCGEx.Unit.Clusters.Reorder.Remaps",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExClusterReorderRemapsTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedRef<FTestCluster> Source = FClusterBuilder().WithGrid(24, 24).WithShuffledPoints(3).Build();
+
+	FClusterOrder Order;
+	TSharedRef<FTestCluster> Reordered = TestClusterReorder::BuildMortonOrdered(*Source, Order);
+
+	TestEqual(TEXT("Same node count"), Reordered->NumNodes(), Source->NumNodes());
+	TestEqual(TEXT("Same edge count"), Reordered->Edges->Num(), Source->Edges->Num());
+
+	int32 BadNodes = 0;
+	for (int32 i = 0; i < Reordered->NumNodes(); i++)
+	{
+		const int32 SourceNode = Order.NodeToSource->Get(i);
+		if (Order.SourceToNode->Get(SourceNode) != i) { BadNodes++; }
+		if (Order.PointToSourcePoint->Get(i) != Source->GetNodePointIndex(SourceNode)) { BadNodes++; }
+		if (Reordered->GetNodePointIndex(i) != i) { BadNodes++; }
+		if (!Reordered->GetPos(i).Equals(Source->GetPos(SourceNode))) { BadNodes++; }
+	}
+	TestEqual(TEXT("Node remaps are inverse permutations, positions follow"), BadNodes, 0);
+
+	// Every edge maps back to a source edge with the same endpoints and data
+	TBitArray<> SeenEdges(false, Source->Edges->Num());
+	int32 BadEdges = 0;
+	for (int32 i = 0; i < Reordered->Edges->Num(); i++)
+	{
+		const PCGExGraphs::FEdge& Edge = *Reordered->GetEdge(i);
+		const int32 SourceIndex = Order.EdgeToSource->Get(i);
+		const PCGExGraphs::FEdge& From = *Source->GetEdge(SourceIndex);
+
+		if (SeenEdges[SourceIndex]) { BadEdges++; }
+		SeenEdges[SourceIndex] = true;
+
+		if (Edge.Index != i) { BadEdges++; }
+		if (Order.PointToSourcePoint->Get(Edge.Start) != static_cast<int32>(From.Start)) { BadEdges++; }
+		if (Order.PointToSourcePoint->Get(Edge.End) != static_cast<int32>(From.End)) { BadEdges++; }
+		if (Edge.PointIndex != From.PointIndex || Edge.IOIndex != From.IOIndex || Edge.bValid != From.bValid) { BadEdges++; }
+	}
+	TestEqual(TEXT("Edges map back to distinct source edges with the same data"), BadEdges, 0);
+
+	return true;
+}
+
+//
+// Topology Tests
+//
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExClusterReorderTopologyTest,
+	"PCGEx.Unit.Clusters.Reorder.Topology",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExClusterReorderTopologyTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	for (const bool bCompact : {false, true})
+	{
+		TSharedRef<FTestCluster> Source = FClusterBuilder().WithGrid(20, 20).WithShuffledPoints(11).WithCompactAdjacency(bCompact).Build();
+
+		FClusterOrder Order;
+		TSharedRef<FTestCluster> Reordered = TestClusterReorder::BuildMortonOrdered(*Source, Order, false);
+
+		// Neighbors map back to the same neighbors, through the same edges
+		int32 BadLinks = 0;
+		for (int32 i = 0; i < Reordered->NumNodes(); i++)
+		{
+			const TConstArrayView<PCGExGraphs::FLink> SourceLinks = Source->GetLinks(Order.NodeToSource->Get(i));
+			const TConstArrayView<PCGExGraphs::FLink> Links = Reordered->GetLinks(i);
+			if (Links.Num() != SourceLinks.Num())
+			{
+				BadLinks++;
+				continue;
+			}
+
+			for (const PCGExGraphs::FLink& Lk : Links)
+			{
+				const PCGExGraphs::FLink Expected(Order.NodeToSource->Get(Lk.Node), Order.EdgeToSource->Get(Lk.Edge));
+				if (!SourceLinks.ContainsByPredicate([&](const PCGExGraphs::FLink& S) { return S.Node == Expected.Node && S.Edge == Expected.Edge; })) { BadLinks++; }
+			}
+		}
+		TestEqual(FString::Printf(TEXT("Adjacency preserved (compact: %d)"), bCompact), BadLinks, 0);
+
+		TestTrue(FString::Printf(TEXT("Node links kept only when the source had them (compact: %d)"), bCompact),
+			Reordered->GetNode(0)->IsEmpty() == bCompact);
+
+		// Traversal-derived structures agree
+		TArray<TSharedPtr<FTestChain>> SourceChains;
+		TArray<TSharedPtr<FTestChain>> Chains;
+		TestChainHelpers::BuildChains(Source, SourceChains);
+		TestChainHelpers::BuildChains(Reordered, Chains);
+		TestEqual(FString::Printf(TEXT("Same chain count (compact: %d)"), bCompact), Chains.Num(), SourceChains.Num());
+
+		FTestDCEL SourceDCEL;
+		FTestDCEL DCEL;
+		SourceDCEL.Build(*Source);
+		DCEL.Build(*Reordered);
+
+		TArray<TArray<int32>> SourceFaces;
+		TArray<TArray<int32>> Faces;
+		TestEqual(FString::Printf(TEXT("Same face count (compact: %d)"), bCompact), DCEL.WalkFaces(Faces), SourceDCEL.WalkFaces(SourceFaces));
+		TestTrue(FString::Printf(TEXT("Reordered DCEL is valid (compact: %d)"), bCompact), DCEL.Validate());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExClusterReorderLocalityTest,
+	"PCGEx.Unit.Clusters.Reorder.Locality",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExClusterReorderLocalityTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedRef<FTestCluster> Source = FClusterBuilder().WithGrid(64, 64).WithShuffledPoints(5).Build();
+
+	FClusterOrder Order;
+	TSharedRef<FTestCluster> Reordered = TestClusterReorder::BuildMortonOrdered(*Source, Order);
+
+	const double SourceSpan = TestClusterReorder::GetAverageEdgeSpan(*Source);
+	const double ReorderedSpan = TestClusterReorder::GetAverageEdgeSpan(*Reordered);
+
+	AddInfo(FString::Printf(TEXT("Average edge span: scattered %.1f, Morton %.1f"), SourceSpan, ReorderedSpan));
+	TestTrue(TEXT("Morton order brings neighbors closer in memory"), ReorderedSpan * 4 < SourceSpan);
+
+	// Edges are sorted by their lowest endpoint
+	bool bEdgesSorted = true;
+	for (int32 i = 1; i < Reordered->Edges->Num(); i++)
+	{
+		const PCGExGraphs::FEdge& Prev = *Reordered->GetEdge(i - 1);
+		const PCGExGraphs::FEdge& Edge = *Reordered->GetEdge(i);
+		bEdgesSorted &= FMath::Min(Prev.Start, Prev.End) <= FMath::Min(Edge.Start, Edge.End);
+	}
+	TestTrue(TEXT("Edges sorted by lowest endpoint"), bEdgesSorted);
+
+	// Reordering is a fixed point
+	FClusterOrder SecondOrder;
+	TSharedRef<FTestCluster> Twice = TestClusterReorder::BuildMortonOrdered(*Reordered, SecondOrder);
+
+	bool bIdentity = true;
+	for (int32 i = 0; i < Twice->NumNodes(); i++) { bIdentity &= SecondOrder.NodeToSource->Get(i) == i; }
+	for (int32 i = 0; i < Twice->Edges->Num(); i++) { bIdentity &= SecondOrder.EdgeToSource->Get(i) == i; }
+	TestTrue(TEXT("Reordering a reordered cluster is the identity"), bIdentity);
+
+	return true;
+}
@@ -0,0 +1,219 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "Helpers/PCGExClusterHelpers.h"
+#include "Helpers/PCGExCompactEdgeHelpers.h"
+
+/**
+ * Compact Edge Tests
+ *
+ * Verifies the packed edge and link layouts: lossless round-trip to FEdge/FLink in both
+ * index widths, rejection of clusters that don't fit, IOIndex hoisting, and unordered keys.
+ *
+ * Test naming convention: PCGEx.Unit.Clusters.CompactEdges.<Case>
+ */
+
+namespace PCGExCompactEdgeTestsLocal
+{
+	bool SameEdge(const PCGExGraphs::FEdge& A, const PCGExGraphs::FEdge& B)
+	{
+		return A.Index == B.Index && A.Start == B.Start && A.End == B.End &&
+			A.PointIndex == B.PointIndex && A.IOIndex == B.IOIndex && A.bValid == B.bValid;
+	}
+
+	template <typename TIndex>
+	int32 CountRoundTripMismatches(const TArray<PCGExGraphs::FEdge>& Edges)
+	{
+		PCGExTest::TCompactEdges<TIndex> Compact;
+		if (!Compact.Build(Edges)) { return Edges.Num(); }
+
+		TArray<PCGExGraphs::FEdge> Expanded;
+		Compact.Expand(Expanded);
+
+		int32 Mismatches = FMath::Abs(Expanded.Num() - Edges.Num());
+		for (int32 i = 0; i < FMath::Min(Expanded.Num(), Edges.Num()); i++) { if (!SameEdge(Expanded[i], Edges[i])) { Mismatches++; } }
+		return Mismatches;
+	}
+}
+
+//
+// Edge Layout Tests
+//
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExCompactEdgesRoundTripTest,
+	"PCGEx.Unit.Clusters.CompactEdges.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExCompactEdgesRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithGrid(20, 15).Build();
+	const TArray<PCGExGraphs::FEdge>& Edges = *Cluster->Edges;
+
+	TestEqual(TEXT("uint16 round-trip"), PCGExCompactEdgeTestsLocal::CountRoundTripMismatches<uint16>(Edges), 0);
+	TestEqual(TEXT("uint32 round-trip"), PCGExCompactEdgeTestsLocal::CountRoundTripMismatches<uint32>(Edges), 0);
+
+	FCompactEdges16 Compact;
+	TestTrue(TEXT("Builds"), Compact.Build(Edges));
+	TestEqual(TEXT("IOIndex hoisted"), Compact.GetIOIndex(), Edges[0].IOIndex);
+
+	// Identity point indices and all-valid edges only cost the packed endpoints
+	TestFalse(TEXT("No point index storage"), Compact.HasPointIndices());
+	TestFalse(TEXT("No validity storage"), Compact.HasValidity());
+	TestTrue(TEXT("Under a quarter of FEdge storage"), Compact.GetAllocatedSize() * 4 < static_cast<SIZE_T>(Edges.GetAllocatedSize()));
+
+	// Arbitrary point indices and an invalid edge are stored on the side
+	TArray<PCGExGraphs::FEdge> Edited = Edges;
+	for (int32 i = 0; i < Edited.Num(); i++) { Edited[i].PointIndex = Edited.Num() - 1 - i; }
+	Edited[3].bValid = 0;
+
+	TestEqual(TEXT("Edited uint16 round-trip"), PCGExCompactEdgeTestsLocal::CountRoundTripMismatches<uint16>(Edited), 0);
+	TestEqual(TEXT("Edited uint32 round-trip"), PCGExCompactEdgeTestsLocal::CountRoundTripMismatches<uint32>(Edited), 0);
+
+	TestTrue(TEXT("Builds edited"), Compact.Build(Edited));
+	TestTrue(TEXT("Point indices stored"), Compact.HasPointIndices());
+	TestTrue(TEXT("Validity stored"), Compact.HasValidity());
+	TestFalse(TEXT("Invalid edge kept invalid"), Compact.IsValid(3));
+	TestEqual(TEXT("Point index kept"), Compact.GetPointIndex(0), Edited.Num() - 1);
+
+	// Other() reads through the packed word
+	const PCGExGraphs::FEdge& First = Edges[0];
+	TestEqual(TEXT("Other from start"), static_cast<uint32>(Compact.Other(0, static_cast<uint16>(First.Start))), First.End);
+	TestEqual(TEXT("Other from end"), static_cast<uint32>(Compact.Other(0, static_cast<uint16>(First.End))), First.Start);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExCompactEdgesLimitsTest,
+	"PCGEx.Unit.Clusters.CompactEdges.Limits",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExCompactEdgesLimitsTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TArray<PCGExGraphs::FEdge> Edges;
+	Edges.Emplace(0, 10, 65535, 0, 2);
+	Edges.Emplace(1, 65535, 3, 1, 2);
+	for (PCGExGraphs::FEdge& E : Edges) { E.bValid = 1; }
+
+	TestTrue(TEXT("65535 fits in uint16"), FCompactEdges16::CanHold(Edges));
+
+	Edges.Emplace(2, 3, 65536, 2, 2);
+	Edges.Last().bValid = 1;
+
+	TestFalse(TEXT("65536 doesn't fit in uint16"), FCompactEdges16::CanHold(Edges));
+	TestTrue(TEXT("65536 fits in uint32"), FCompactEdges32::CanHold(Edges));
+
+	FCompactEdges16 Compact16;
+	TestFalse(TEXT("uint16 build rejected"), Compact16.Build(Edges));
+	TestEqual(TEXT("Rejected build left empty"), Compact16.Num(), 0);
+
+	FCompactEdges32 Compact32;
+	TestTrue(TEXT("uint32 build"), Compact32.Build(Edges));
+	TestEqual(TEXT("Large index kept"), Compact32.GetEnd(2), 65536u);
+
+	// IOIndex can only be hoisted if shared
+	TArray<PCGExGraphs::FEdge> Mixed = Edges;
+	Mixed[1].IOIndex = 3;
+	TestFalse(TEXT("Mixed IO rejected"), Compact32.Build(Mixed));
+
+	// Index is implicit
+	TArray<PCGExGraphs::FEdge> Shuffled = Edges;
+	Swap(Shuffled[0], Shuffled[1]);
+	TestFalse(TEXT("Out-of-place edges rejected"), Compact32.Build(Shuffled));
+
+	// No point index
+	TArray<PCGExGraphs::FEdge> Unassigned = Edges;
+	Unassigned[0].PointIndex = -1;
+	TestFalse(TEXT("Unassigned point index rejected"), Compact32.Build(Unassigned));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExCompactEdgesKeysTest,
+	"PCGEx.Unit.Clusters.CompactEdges.Keys",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExCompactEdgesKeysTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TArray<PCGExGraphs::FEdge> Edges;
+	Edges.Emplace(0, 10, 20, 0, 0);
+	Edges.Emplace(1, 20, 10, 1, 0);
+	Edges.Emplace(2, 10, 30, 2, 0);
+	for (PCGExGraphs::FEdge& E : Edges) { E.bValid = 1; }
+
+	FCompactEdges16 Compact16;
+	FCompactEdges32 Compact32;
+	TestTrue(TEXT("Build uint16"), Compact16.Build(Edges));
+	TestTrue(TEXT("Build uint32"), Compact32.Build(Edges));
+
+	TestEqual(TEXT("uint16 key is direction-independent"), Compact16.GetUnorderedKey(0), Compact16.GetUnorderedKey(1));
+	TestNotEqual(TEXT("uint16 keys differ for different edges"), Compact16.GetUnorderedKey(0), Compact16.GetUnorderedKey(2));
+
+	// Keys identify the same edges H64U does
+	for (int32 a = 0; a < Edges.Num(); a++)
+	{
+		for (int32 b = 0; b < Edges.Num(); b++)
+		{
+			const bool bSameH64U = Edges[a].H64U() == Edges[b].H64U();
+			TestTrue(FString::Printf(TEXT("uint16 key agrees with H64U (%d, %d)"), a, b), (Compact16.GetUnorderedKey(a) == Compact16.GetUnorderedKey(b)) == bSameH64U);
+			TestTrue(FString::Printf(TEXT("uint32 key agrees with H64U (%d, %d)"), a, b), (Compact32.GetUnorderedKey(a) == Compact32.GetUnorderedKey(b)) == bSameH64U);
+		}
+	}
+
+	return true;
+}
+
+//
+// Link Layout Tests
+//
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExCompactLinksTest,
+	"PCGEx.Unit.Clusters.CompactEdges.Links",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExCompactLinksTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithGrid(12, 9).WithCompactAdjacency().Build();
+
+	FCompactLinks16 Links16;
+	FCompactLinks32 Links32;
+	TestTrue(TEXT("Build uint16 links"), Links16.Build(*Cluster));
+	TestTrue(TEXT("Build uint32 links"), Links32.Build(*Cluster));
+
+	int32 Mismatches = 0;
+	for (int32 Node = 0; Node < Cluster->NumNodes(); Node++)
+	{
+		const TConstArrayView<PCGExGraphs::FLink> Expected = Cluster->GetLinks(Node);
+		const TConstArrayView<uint32> Packed16 = Links16.GetLinks(Node);
+		const TConstArrayView<uint64> Packed32 = Links32.GetLinks(Node);
+
+		if (Packed16.Num() != Expected.Num() || Packed32.Num() != Expected.Num())
+		{
+			Mismatches++;
+			continue;
+		}
+
+		for (int32 i = 0; i < Expected.Num(); i++)
+		{
+			if (FCompactLinks16::GetNode(Packed16[i]) != Expected[i].Node || FCompactLinks16::GetEdge(Packed16[i]) != Expected[i].Edge) { Mismatches++; }
+			if (FCompactLinks32::GetNode(Packed32[i]) != Expected[i].Node || FCompactLinks32::GetEdge(Packed32[i]) != Expected[i].Edge) { Mismatches++; }
+		}
+	}
+
+	TestEqual(TEXT("Links match the CSR adjacency"), Mismatches, 0);
+	TestTrue(TEXT("uint16 links are half the size of FLink"), Links16.GetAllocatedSize() < static_cast<SIZE_T>(Cluster->AdjacencyLinks.GetAllocatedSize() + Cluster->AdjacencyOffsets.GetAllocatedSize()));
+
+	return true;
+}
@@ -0,0 +1,676 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "Helpers/PCGExClusterHelpers.h"
+#include "Helpers/PCGExDCELTestHelpers.h"
+
+/**
+ * Test DCEL Tests
+ *
+ * Verifies the half-edge structure built over test clusters: twin/next consistency,
+ * face counts against Euler's formula, LocalTangent frames, and that the parallel
+ * build matches the single-threaded one exactly. Cell extraction is checked against
+ * FCellConstraints filtering, in both parallel and single-threaded modes. Incremental
+ * edge edits are checked against a full rebuild of the edited cluster.
+ *
+ * Test naming convention: PCGEx.Unit.Clusters.DCEL.<Case>
+ */
+
+namespace PCGExDCELTestsLocal
+{
+	/** Faces a planar embedding must have: E - V + 2C, isolated nodes excluded */
+	int32 ExpectedFaceCount(const PCGExTest::FTestCluster& Cluster)
+	{
+		const int32 NumNodes = Cluster.NumNodes();
+		TArray<int32> Component;
+		Component.Init(-1, NumNodes);
+
+		int32 NumComponents = 0;
+		int32 NumConnected = 0;
+		TArray<int32> Stack;
+
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			if (Component[i] != -1 || Cluster.IsIsolated(i)) { continue; }
+
+			Component[i] = NumComponents;
+			Stack.Add(i);
+			while (!Stack.IsEmpty())
+			{
+				const int32 Current = Stack.Pop(EAllowShrinking::No);
+				NumConnected++;
+				for (const PCGExGraphs::FLink& Lk : Cluster.GetLinks(Current))
+				{
+					if (Component[Lk.Node] != -1) { continue; }
+					Component[Lk.Node] = NumComponents;
+					Stack.Add(Lk.Node);
+				}
+			}
+
+			NumComponents++;
+		}
+
+		return Cluster.Edges->Num() - NumConnected + 2 * NumComponents;
+	}
+
+	/** Edges of a cluster, as point index pairs */
+	TArray<FIntPoint> GetEdges(const PCGExTest::FTestCluster& Cluster)
+	{
+		TArray<FIntPoint> Edges;
+		Edges.Reserve(Cluster.Edges->Num());
+		for (const PCGExGraphs::FEdge& Edge : *Cluster.Edges) { Edges.Emplace(Edge.Start, Edge.End); }
+		return Edges;
+	}
+
+	/** Grid nodes, every one of them kept, with the given edges */
+	TSharedRef<PCGExTest::FTestCluster> BuildFromEdges(const int32 Size, const TArray<FIntPoint>& Edges)
+	{
+		PCGExTest::FClusterBuilder Builder;
+		for (int32 y = 0; y < Size; y++)
+		{
+			for (int32 x = 0; x < Size; x++) { Builder.AddNode(y * Size + x, FVector(x * 100, y * 100, 0)); }
+		}
+		for (const FIntPoint& Edge : Edges) { Builder.AddEdge(Edge.X, Edge.Y); }
+		return Builder.Build();
+	}
+
+	/** Same half-edge layout and links, edge indices aside */
+	bool SameTopology(const PCGExTest::FTestDCEL& A, const PCGExTest::FTestDCEL& B)
+	{
+		return A.Offsets == B.Offsets && A.Origin == B.Origin && A.Target == B.Target &&
+			A.Twin == B.Twin && A.Next == B.Next && A.RingPos == B.RingPos;
+	}
+
+	bool SameCells(const TArray<PCGExTest::FTestCell>& A, const TArray<PCGExTest::FTestCell>& B, FString& OutMismatch)
+	{
+		if (A.Num() != B.Num())
+		{
+			OutMismatch = FString::Printf(TEXT("%d cells vs %d"), A.Num(), B.Num());
+			return false;
+		}
+
+		for (int32 i = 0; i < A.Num(); i++)
+		{
+			if (A[i].Face != B[i].Face || A[i].Nodes != B[i].Nodes ||
+				A[i].bIsConvex != B[i].bIsConvex || A[i].bHasLeaves != B[i].bHasLeaves ||
+				!FMath::IsNearlyEqual(A[i].Area, B[i].Area))
+			{
+				OutMismatch = FString::Printf(TEXT("Cell %d differs (face %d vs %d)"), i, A[i].Face, B[i].Face);
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+//
+// Structure Tests
+//
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExDCELSquareTest,
+	"PCGEx.Unit.Clusters.DCEL.Square",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExDCELSquareTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder()
+		.AddNode(0, FVector(0, 0, 0))
+		.AddNode(1, FVector(100, 0, 0))
+		.AddNode(2, FVector(100, 100, 0))
+		.AddNode(3, FVector(0, 100, 0))
+		.AddEdge(0, 1).AddEdge(1, 2).AddEdge(2, 3).AddEdge(3, 0)
+		.Build();
+
+	FTestDCEL DCEL;
+	DCEL.Build(*Cluster);
+
+	FString Error;
+	TestTrue(FString::Printf(TEXT("Valid DCEL %s"), *Error), DCEL.Validate(&Error));
+	TestEqual(TEXT("Two half-edges per edge"), DCEL.NumHalfEdges(), 8);
+
+	TArray<TArray<int32>> Faces;
+	TestEqual(TEXT("Inner and outer face"), DCEL.WalkFaces(Faces), 2);
+
+	// Rings are CCW: from node 1, the edge toward 2 (90°) comes before the edge toward 0 (180°)
+	const int32 Start = DCEL.Offsets[1];
+	TestEqual(TEXT("Node 1 ring starts toward node 2"), DCEL.Target[Start], 2);
+	TestEqual(TEXT("Node 1 ring then toward node 0"), DCEL.Target[Start + 1], 0);
+
+	// 0->1 is followed by 1->2: the face on its left is the interior
+	int32 ZeroToOne = -1;
+	for (int32 h = DCEL.Offsets[0]; h < DCEL.Offsets[1]; h++) { if (DCEL.Target[h] == 1) { ZeroToOne = h; } }
+	TestEqual(TEXT("Interior face walks CCW"), DCEL.Target[DCEL.Next[ZeroToOne]], 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExDCELEulerTest,
+	"PCGEx.Unit.Clusters.DCEL.Euler",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExDCELEulerTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// Full grid: (X-1)(Y-1) cells + outer face
+	{
+		TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithGrid(5, 4).Build();
+		FTestDCEL DCEL;
+		DCEL.Build(*Cluster);
+
+		TArray<TArray<int32>> Faces;
+		TestEqual(TEXT("Grid faces"), DCEL.WalkFaces(Faces), 13);
+		TestTrue(TEXT("Grid valid"), DCEL.Validate());
+	}
+
+	// Tree: a single face going around every edge twice
+	{
+		TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithStar(5).Build();
+		FTestDCEL DCEL;
+		DCEL.Build(*Cluster);
+
+		TArray<TArray<int32>> Faces;
+		TestEqual(TEXT("Star has one face"), DCEL.WalkFaces(Faces), 1);
+		TestEqual(TEXT("Star face uses every half-edge"), Faces[0].Num(), 10);
+	}
+
+	// Sparse grid: several components, leaves and isolated nodes
+	for (int32 Seed = 0; Seed < 4; Seed++)
+	{
+		TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithSparseGrid(20, 0.6f, Seed).Build();
+		FTestDCEL DCEL;
+		DCEL.Build(*Cluster);
+
+		FString Error;
+		const bool bValid = DCEL.Validate(&Error);
+		TestTrue(FString::Printf(TEXT("Seed %d valid %s"), Seed, *Error), bValid);
+
+		TArray<TArray<int32>> Faces;
+		TestEqual(FString::Printf(TEXT("Seed %d face count matches Euler"), Seed), DCEL.WalkFaces(Faces), PCGExDCELTestsLocal::ExpectedFaceCount(*Cluster));
+	}
+
+	return true;
+}
+
+//
+// Projection Tests
+//
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExDCELLocalTangentTest,
+	"PCGEx.Unit.Clusters.DCEL.LocalTangent",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExDCELLocalTangentTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedRef<FTestCluster> Flat = FClusterBuilder().WithSparseGrid(16, 0.7f, 3).Build();
+
+	FTestDCEL Projected;
+	Projected.Build(*Flat);
+
+	// Identity frames on a flat cluster are the global Up projection
+	TArray<FQuat> Identity;
+	Identity.Init(FQuat::Identity, Flat->NumNodes());
+
+	FTestDCEL Local;
+	Local.Build(*Flat, Identity);
+	TestTrue(TEXT("Identity frames match Up projection"), Local.Equals(Projected));
+
+	// Same graph stood up on a wall, frames follow the wall
+	const FQuat ToWall(FVector::ForwardVector, UE_HALF_PI);
+	TSharedRef<FTestCluster> Wall = FClusterBuilder().WithSparseGrid(16, 0.7f, 3, nullptr, ToWall).Build();
+
+	TArray<FQuat> WallFrames;
+	WallFrames.Init(ToWall, Wall->NumNodes());
+
+	FTestDCEL WallDCEL;
+	WallDCEL.Build(*Wall, WallFrames);
+	TestTrue(TEXT("Wall frames match flat rings"), WallDCEL.Equals(Projected));
+
+	// Global projection along the wall normal agrees too
+	FTestDCEL WallProjected;
+	WallProjected.Build(*Wall, ToWall.GetUpVector());
+	TestTrue(TEXT("Wall normal projection valid"), WallProjected.Validate());
+
+	TArray<TArray<int32>> FlatFaces;
+	TArray<TArray<int32>> WallFaces;
+	TestEqual(TEXT("Same face count on the wall"), WallProjected.WalkFaces(WallFaces), Projected.WalkFaces(FlatFaces));
+
+	return true;
+}
+
+//
+// Parallel Build Tests
+//
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExDCELParallelTest,
+	"PCGEx.Unit.Clusters.DCEL.ParallelMatchesSequential",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExDCELParallelTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	for (int32 Seed = 0; Seed < 3; Seed++)
+	{
+		TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithSparseGrid(60, 0.65f, Seed).Build();
+
+		FTestDCEL Sequential;
+		Sequential.Build(*Cluster, FVector::UpVector, false);
+
+		FTestDCEL Parallel;
+		Parallel.Build(*Cluster, FVector::UpVector, true);
+
+		TestTrue(FString::Printf(TEXT("Seed %d: parallel build identical"), Seed), Parallel.Equals(Sequential));
+		TestTrue(FString::Printf(TEXT("Seed %d: parallel build valid"), Seed), Parallel.Validate());
+	}
+
+	return true;
+}
+
+//
+// Cell Extraction Tests
+//
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExDCELCellsGridTest,
+	"PCGEx.Unit.Clusters.DCEL.Cells.Grid",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExDCELCellsGridTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithGrid(5, 4).Build();
+	FTestDCEL DCEL;
+	DCEL.Build(*Cluster);
+
+	PCGExClusters::FCellConstraints Constraints;
+	TArray<FTestCell> Cells;
+	FTestCell Wrapper;
+
+	TestEqual(TEXT("One cell per grid square"), DCEL.ExtractCells(*Cluster, Constraints, Cells, &Wrapper), 12);
+
+	bool bAllSquares = true;
+	for (const FTestCell& Cell : Cells)
+	{
+		bAllSquares &= Cell.Nodes.Num() == 4 && Cell.bIsConvex && !Cell.bHasLeaves && FMath::IsNearlyEqual(Cell.Area, 10000.0);
+	}
+	TestTrue(TEXT("Every cell is a convex 100x100 square"), bAllSquares);
+
+	TestTrue(TEXT("Wrapper built"), Wrapper.bIsWrapper);
+	TestEqual(TEXT("Wrapper goes around the perimeter"), Wrapper.Nodes.Num(), 14);
+	TestTrue(TEXT("Wrapper area is the negated grid area"), FMath::IsNearlyEqual(Wrapper.Area, -400.0 * 300.0));
+
+	Constraints.bBuildWrapper = false;
+	DCEL.ExtractCells(*Cluster, Constraints, Cells, &Wrapper);
+	TestEqual(TEXT("No wrapper when disabled"), Wrapper.Face, -1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExDCELCellsConstraintsTest,
+	"PCGEx.Unit.Clusters.DCEL.Cells.Constraints",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExDCELCellsConstraintsTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// Square with a dead end poking inside from corner 0
+	TSharedRef<FTestCluster> WithLeaf = FClusterBuilder()
+		.AddNode(0, FVector(0, 0, 0))
+		.AddNode(1, FVector(100, 0, 0))
+		.AddNode(2, FVector(100, 100, 0))
+		.AddNode(3, FVector(0, 100, 0))
+		.AddNode(4, FVector(50, 50, 0))
+		.AddEdge(0, 1).AddEdge(1, 2).AddEdge(2, 3).AddEdge(3, 0).AddEdge(0, 4)
+		.Build();
+
+	FTestDCEL LeafDCEL;
+	LeafDCEL.Build(*WithLeaf);
+
+	TArray<FTestCell> Cells;
+
+	{
+		PCGExClusters::FCellConstraints Constraints;
+		TestEqual(TEXT("Cell with leaf kept by default"), LeafDCEL.ExtractCells(*WithLeaf, Constraints, Cells), 1);
+		TestTrue(TEXT("Cell has leaves"), Cells[0].bHasLeaves);
+		TestFalse(TEXT("Cell with leaves isn't convex"), Cells[0].bIsConvex);
+		TestEqual(TEXT("Attachment node kept once"), Cells[0].Nodes.Num(), 5);
+	}
+
+	{
+		PCGExClusters::FCellConstraints Constraints;
+		Constraints.bDuplicateLeafPoints = true;
+		LeafDCEL.ExtractCells(*WithLeaf, Constraints, Cells);
+		TestEqual(TEXT("Attachment node duplicated"), Cells[0].Nodes.Num(), 6);
+	}
+
+	{
+		PCGExClusters::FCellConstraints Constraints;
+		Constraints.bKeepCellsWithLeaves = false;
+		TestEqual(TEXT("Cells with leaves dropped"), LeafDCEL.ExtractCells(*WithLeaf, Constraints, Cells), 0);
+	}
+
+	{
+		PCGExClusters::FCellConstraints Constraints;
+		Constraints.MaxPointCount = 4;
+		TestEqual(TEXT("MaxPointCount drops the 5-node cell"), LeafDCEL.ExtractCells(*WithLeaf, Constraints, Cells), 0);
+	}
+
+	// L-shaped loop
+	TSharedRef<FTestCluster> LShape = FClusterBuilder()
+		.AddNode(0, FVector(0, 0, 0))
+		.AddNode(1, FVector(200, 0, 0))
+		.AddNode(2, FVector(200, 100, 0))
+		.AddNode(3, FVector(100, 100, 0))
+		.AddNode(4, FVector(100, 200, 0))
+		.AddNode(5, FVector(0, 200, 0))
+		.AddEdge(0, 1).AddEdge(1, 2).AddEdge(2, 3).AddEdge(3, 4).AddEdge(4, 5).AddEdge(5, 0)
+		.Build();
+
+	FTestDCEL LDCEL;
+	LDCEL.Build(*LShape);
+
+	{
+		PCGExClusters::FCellConstraints Constraints;
+		Constraints.bConvexOnly = true;
+		TestEqual(TEXT("Concave cell dropped by bConvexOnly"), LDCEL.ExtractCells(*LShape, Constraints, Cells), 0);
+	}
+
+	{
+		PCGExClusters::FCellConstraints Constraints;
+		Constraints.bConcaveOnly = true;
+		TestEqual(TEXT("Concave cell kept by bConcaveOnly"), LDCEL.ExtractCells(*LShape, Constraints, Cells), 1);
+		TestTrue(TEXT("L area"), FMath::IsNearlyEqual(Cells[0].Area, 30000.0));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExDCELCellsParallelTest,
+	"PCGEx.Unit.Clusters.DCEL.Cells.ParallelMatchesSequential",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExDCELCellsParallelTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	for (int32 Seed = 0; Seed < 3; Seed++)
+	{
+		TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithSparseGrid(60, 0.7f, Seed).Build();
+		FTestDCEL DCEL;
+		DCEL.Build(*Cluster);
+
+		for (int32 Variant = 0; Variant < 3; Variant++)
+		{
+			PCGExClusters::FCellConstraints Constraints;
+			Constraints.bKeepCellsWithLeaves = Variant != 1;
+			Constraints.bConvexOnly = Variant == 2;
+			Constraints.MaxPointCount = Variant == 2 ? 12 : MAX_int32;
+
+			TArray<FTestCell> Sequential;
+			FTestCell SequentialWrapper;
+			DCEL.ExtractCells(*Cluster, Constraints, Sequential, &SequentialWrapper, false);
+
+			TArray<FTestCell> Parallel;
+			FTestCell ParallelWrapper;
+			DCEL.ExtractCells(*Cluster, Constraints, Parallel, &ParallelWrapper, true);
+
+			FString Mismatch;
+			const bool bSame = PCGExDCELTestsLocal::SameCells(Sequential, Parallel, Mismatch);
+			TestTrue(FString::Printf(TEXT("Seed %d variant %d: identical cells %s"), Seed, Variant, *Mismatch), bSame);
+			TestEqual(FString::Printf(TEXT("Seed %d variant %d: same wrapper"), Seed, Variant), ParallelWrapper.Face, SequentialWrapper.Face);
+		}
+	}
+
+	return true;
+}
+
+//
+// Incremental Edit Tests
+//
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExDCELEditsSplitTest,
+	"PCGEx.Unit.Clusters.DCEL.Edits.Split",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExDCELEditsSplitTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	const TArray<FIntPoint> Square = {{0, 1}, {1, 3}, {3, 2}, {2, 0}};
+	TSharedRef<FTestCluster> Cluster = PCGExDCELTestsLocal::BuildFromEdges(2, Square);
+
+	FTestDCEL DCEL;
+	DCEL.Build(*Cluster);
+
+	// Diagonal splits the square in two triangles
+	FTestDCELEditResult Result;
+	TestTrue(TEXT("Insert applied"), DCEL.ApplyEdits({FTestDCELEdit::Insert(0, 3, 4)}, Result));
+
+	FString Error;
+	TestTrue(FString::Printf(TEXT("Valid after insert %s"), *Error), DCEL.Validate(&Error));
+	TestEqual(TEXT("Inner and outer face replaced"), Result.RemovedFaces.Num(), 2);
+	TestEqual(TEXT("Two triangles and the outer face"), Result.AddedFaces.Num(), 3);
+
+	TArray<TArray<int32>> Faces;
+	TestEqual(TEXT("Three faces after insert"), DCEL.WalkFaces(Faces), 3);
+
+	// Removing it merges them back into the original structure
+	FTestDCEL Original;
+	Original.Build(*Cluster);
+
+	TestTrue(TEXT("Remove applied"), DCEL.ApplyEdits({FTestDCELEdit::Remove(3, 0)}, Result));
+	TestTrue(TEXT("Back to the original structure"), DCEL.Equals(Original));
+	TestEqual(TEXT("Two faces after remove"), DCEL.WalkFaces(Faces), 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExDCELEditsRebuildTest,
+	"PCGEx.Unit.Clusters.DCEL.Edits.MatchesRebuild",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExDCELEditsRebuildTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	constexpr int32 Size = 30;
+
+	for (int32 Seed = 0; Seed < 3; Seed++)
+	{
+		FRandomStream Random(Seed + 100);
+
+		TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithSparseGrid(Size, 0.75f, Seed).Build();
+		TArray<FIntPoint> Edges = PCGExDCELTestsLocal::GetEdges(*Cluster);
+
+		FTestDCEL DCEL;
+		DCEL.Build(*Cluster);
+
+		PCGExClusters::FCellConstraints Constraints;
+		Constraints.bKeepCellsWithLeaves = Seed != 1;
+
+		TArray<FTestCell> Cells;
+		DCEL.ExtractCells(*Cluster, Constraints, Cells);
+
+		TSet<FIntPoint> Existing(Edges);
+		TArray<FTestDCELEdit> Edits;
+		TArray<FIntPoint> Edited = Edges;
+
+		// A few removals, missing grid edges, and one diagonal per chosen grid cell
+		for (int32 i = 0; i < 6; i++)
+		{
+			const int32 Index = Random.RandRange(0, Edited.Num() - 1);
+			Edits.Add(FTestDCELEdit::Remove(Edited[Index].X, Edited[Index].Y));
+			Existing.Remove(Edited[Index]);
+			Edited.RemoveAt(Index);
+		}
+
+		int32 NextEdgeIndex = Edges.Num();
+		TSet<int32> DiagonalCells;
+
+		for (int32 i = 0; i < 12; i++)
+		{
+			const int32 x = Random.RandRange(0, Size - 2);
+			const int32 y = Random.RandRange(0, Size - 2);
+			const int32 Index = y * Size + x;
+
+			FIntPoint Candidate;
+			if (i % 3 == 0)
+			{
+				if (DiagonalCells.Contains(Index)) { continue; }
+				DiagonalCells.Add(Index);
+				Candidate = FIntPoint(Index, Index + Size + 1);
+			}
+			else
+			{
+				Candidate = i % 3 == 1 ? FIntPoint(Index, Index + 1) : FIntPoint(Index, Index + Size);
+			}
+
+			if (Existing.Contains(Candidate)) { continue; }
+
+			Existing.Add(Candidate);
+			Edited.Add(Candidate);
+			Edits.Add(FTestDCELEdit::Insert(Candidate.X, Candidate.Y, NextEdgeIndex++));
+		}
+
+		FTestDCELEditResult Result;
+		TestTrue(FString::Printf(TEXT("Seed %d: edits applied"), Seed), DCEL.ApplyEdits(Edits, Result));
+
+		FString Error;
+		TestTrue(FString::Printf(TEXT("Seed %d: valid after edits %s"), Seed, *Error), DCEL.Validate(&Error));
+
+		TSharedRef<FTestCluster> EditedCluster = PCGExDCELTestsLocal::BuildFromEdges(Size, Edited);
+		FTestDCEL Rebuilt;
+		Rebuilt.Build(*EditedCluster);
+
+		TestTrue(FString::Printf(TEXT("Seed %d: same structure as a full rebuild"), Seed), PCGExDCELTestsLocal::SameTopology(DCEL, Rebuilt));
+
+		TArray<TArray<int32>> Faces;
+		TestEqual(FString::Printf(TEXT("Seed %d: face count"), Seed), DCEL.WalkFaces(Faces), PCGExDCELTestsLocal::ExpectedFaceCount(*EditedCluster));
+		TestTrue(FString::Printf(TEXT("Seed %d: only a few faces touched"), Seed), Result.AddedFaces.Num() < Faces.Num() / 2);
+
+		// Patched cells match a fresh extraction
+		DCEL.UpdateCells(*Cluster, Constraints, Result, Cells);
+
+		TArray<FTestCell> Expected;
+		Rebuilt.ExtractCells(*EditedCluster, Constraints, Expected);
+
+		FString Mismatch;
+		const bool bSame = PCGExDCELTestsLocal::SameCells(Cells, Expected, Mismatch);
+		TestTrue(FString::Printf(TEXT("Seed %d: updated cells match extraction %s"), Seed, *Mismatch), bSame);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExDCELEditsManyNodesTest,
+	"PCGEx.Unit.Clusters.DCEL.Edits.ManyNodes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExDCELEditsManyNodesTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	constexpr int32 Size = 30;
+
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithGrid(Size, Size).Build();
+	TArray<FIntPoint> Edited = PCGExDCELTestsLocal::GetEdges(*Cluster);
+
+	FTestDCEL DCEL;
+	DCEL.Build(*Cluster);
+
+	PCGExClusters::FCellConstraints Constraints;
+	TArray<FTestCell> Cells;
+	DCEL.ExtractCells(*Cluster, Constraints, Cells);
+
+	// One batch touching hundreds of distinct nodes: a diagonal in every other grid cell
+	TArray<FTestDCELEdit> Edits;
+	int32 NextEdgeIndex = Edited.Num();
+	for (int32 y = 0; y < Size - 1; y += 2)
+	{
+		for (int32 x = 0; x < Size - 1; x += 2)
+		{
+			const FIntPoint Diagonal(y * Size + x, (y + 1) * Size + x + 1);
+			Edited.Add(Diagonal);
+			Edits.Add(FTestDCELEdit::Insert(Diagonal.X, Diagonal.Y, NextEdgeIndex++));
+		}
+	}
+
+	FTestDCELEditResult Result;
+	TestTrue(TEXT("Edits applied"), DCEL.ApplyEdits(Edits, Result));
+
+	FString Error;
+	TestTrue(FString::Printf(TEXT("Valid after edits %s"), *Error), DCEL.Validate(&Error));
+
+	TSharedRef<FTestCluster> EditedCluster = PCGExDCELTestsLocal::BuildFromEdges(Size, Edited);
+	FTestDCEL Rebuilt;
+	Rebuilt.Build(*EditedCluster);
+	TestTrue(TEXT("Same structure as a full rebuild"), PCGExDCELTestsLocal::SameTopology(DCEL, Rebuilt));
+
+	TArray<TArray<int32>> Faces;
+	TestEqual(TEXT("Face count"), DCEL.WalkFaces(Faces), PCGExDCELTestsLocal::ExpectedFaceCount(*EditedCluster));
+
+	DCEL.UpdateCells(*Cluster, Constraints, Result, Cells);
+
+	TArray<FTestCell> Expected;
+	Rebuilt.ExtractCells(*EditedCluster, Constraints, Expected);
+
+	FString Mismatch;
+	const bool bSame = PCGExDCELTestsLocal::SameCells(Cells, Expected, Mismatch);
+	TestTrue(FString::Printf(TEXT("Updated cells match extraction %s"), *Mismatch), bSame);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExDCELEditsInvalidTest,
+	"PCGEx.Unit.Clusters.DCEL.Edits.Invalid",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExDCELEditsInvalidTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithGrid(3, 3).Build();
+
+	FTestDCEL DCEL;
+	DCEL.Build(*Cluster);
+
+	FTestDCEL Original;
+	Original.Build(*Cluster);
+
+	FTestDCELEditResult Result;
+	TestFalse(TEXT("Duplicate edge rejected"), DCEL.ApplyEdits({FTestDCELEdit::Insert(0, 1, 99)}, Result));
+	TestFalse(TEXT("Missing edge rejected"), DCEL.ApplyEdits({FTestDCELEdit::Remove(0, 8)}, Result));
+	TestFalse(TEXT("Unknown node rejected"), DCEL.ApplyEdits({FTestDCELEdit::Insert(0, 42, 99)}, Result));
+
+	// A valid edit followed by an invalid one leaves everything untouched
+	TestFalse(TEXT("Partly invalid set rejected"), DCEL.ApplyEdits({FTestDCELEdit::Insert(0, 4, 99), FTestDCELEdit::Remove(2, 6)}, Result));
+	TestTrue(TEXT("Structure untouched"), DCEL.Equals(Original));
+
+	// LocalTangent builds have no projected positions to place new edges
+	TArray<FQuat> Frames;
+	Frames.Init(FQuat::Identity, Cluster->NumNodes());
+	FTestDCEL LocalTangent;
+	LocalTangent.Build(*Cluster, Frames);
+	TestFalse(TEXT("LocalTangent build rejected"), LocalTangent.ApplyEdits({FTestDCELEdit::Insert(0, 4, 99)}, Result));
+
+	return true;
+}
@@ -0,0 +1,157 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "PCGExH.h"
+#include "Helpers/PCGExEdgeDedupHelpers.h"
+
+/**
+ * Edge Dedup Tests
+ *
+ * Verifies the sort-based edge deduplication against the hash-set reference (same unique
+ * edges, first occurrences, self-loops dropped) and the CSR adjacency built from its output.
+ *
+ * Test naming convention: PCGEx.Unit.Clusters.EdgeDedup.<Case>
+ */
+
+namespace PCGExEdgeDedupTestsLocal
+{
+	/** Random edges emitted from both endpoints, with repeats and self-loops */
+	TArray<uint64> MakeKeys(const int32 NumNodes, const int32 NumKeys, const int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<uint64> Keys;
+		Keys.Reserve(NumKeys);
+
+		while (Keys.Num() < NumKeys)
+		{
+			const uint32 A = static_cast<uint32>(Random.RandRange(0, NumNodes - 1));
+			const uint32 B = static_cast<uint32>(Random.RandRange(0, NumNodes - 1));
+			Keys.Add(PCGEx::H64U(A, B));
+			if (Random.FRand() < 0.5f) { Keys.Add(PCGEx::H64U(B, A)); }
+		}
+
+		return Keys;
+	}
+}
+
+//
+// Dedup Tests
+//
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExEdgeDedupMatchesHashTest,
+	"PCGEx.Unit.Clusters.EdgeDedup.MatchesHashSet",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExEdgeDedupMatchesHashTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	for (int32 Seed = 0; Seed < 3; Seed++)
+	{
+		const TArray<uint64> Keys = PCGExEdgeDedupTestsLocal::MakeKeys(200, 3000, Seed);
+
+		TArray<uint64> Sorted;
+		TArray<int32> FirstIndex;
+		const int32 NumSorted = TestEdgeDedup::DedupSorted(Keys, Sorted, &FirstIndex);
+
+		TArray<uint64> Hashed;
+		const int32 NumHashed = TestEdgeDedup::DedupHashed(Keys, Hashed);
+
+		TestEqual(FString::Printf(TEXT("Seed %d: same unique count"), Seed), NumSorted, NumHashed);
+
+		bool bAscending = true;
+		for (int32 i = 1; i < Sorted.Num(); i++) { bAscending &= Sorted[i - 1] < Sorted[i]; }
+		TestTrue(FString::Printf(TEXT("Seed %d: sorted keys strictly ascending"), Seed), bAscending);
+
+		Hashed.Sort();
+		TestTrue(FString::Printf(TEXT("Seed %d: same unique edges"), Seed), Sorted == Hashed);
+
+		// First occurrence: key matches, and no earlier input has it
+		int32 BadFirst = 0;
+		for (int32 i = 0; i < Sorted.Num(); i++)
+		{
+			const int32 First = FirstIndex[i];
+			if (Keys[First] != Sorted[i]) { BadFirst++; }
+			for (int32 j = 0; j < First; j++) { if (Keys[j] == Sorted[i]) { BadFirst++; } }
+		}
+		TestEqual(FString::Printf(TEXT("Seed %d: first occurrences"), Seed), BadFirst, 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExEdgeDedupEdgeCasesTest,
+	"PCGEx.Unit.Clusters.EdgeDedup.EdgeCases",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExEdgeDedupEdgeCasesTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TArray<uint64> Unique;
+
+	TestEqual(TEXT("Empty input"), TestEdgeDedup::DedupSorted({}, Unique), 0);
+
+	const TArray<uint64> Loops = {PCGEx::H64U(3, 3), PCGEx::H64U(0, 0)};
+	TestEqual(TEXT("Self-loops dropped (sorted)"), TestEdgeDedup::DedupSorted(Loops, Unique), 0);
+	TestEqual(TEXT("Self-loops dropped (hashed)"), TestEdgeDedup::DedupHashed(Loops, Unique), 0);
+
+	const TArray<uint64> Reversed = {PCGEx::H64U(1, 2), PCGEx::H64U(2, 1), PCGEx::H64U(1, 2)};
+	TArray<int32> FirstIndex;
+	TestEqual(TEXT("Both directions are one edge"), TestEdgeDedup::DedupSorted(Reversed, Unique, &FirstIndex), 1);
+	TestEqual(TEXT("First occurrence kept"), FirstIndex[0], 0);
+
+	return true;
+}
+
+//
+// Adjacency Tests
+//
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExEdgeDedupAdjacencyTest,
+	"PCGEx.Unit.Clusters.EdgeDedup.Adjacency",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExEdgeDedupAdjacencyTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	constexpr int32 NumNodes = 150;
+	const TArray<uint64> Keys = PCGExEdgeDedupTestsLocal::MakeKeys(NumNodes, 1000, 7);
+
+	TArray<uint64> Unique;
+	TestEdgeDedup::DedupSorted(Keys, Unique);
+
+	TArray<int32> Offsets;
+	TArray<PCGExGraphs::FLink> Links;
+	TestEdgeDedup::BuildAdjacency(NumNodes, Unique, Offsets, Links);
+
+	TestEqual(TEXT("One offset per node, plus end"), Offsets.Num(), NumNodes + 1);
+	TestEqual(TEXT("Two links per edge"), Links.Num(), Unique.Num() * 2);
+	TestEqual(TEXT("Offsets cover every link"), Offsets.Last(), Links.Num());
+
+	// Every link points back through the same edge, and matches its key
+	int32 Broken = 0;
+	for (int32 Node = 0; Node < NumNodes; Node++)
+	{
+		for (int32 k = Offsets[Node]; k < Offsets[Node + 1]; k++)
+		{
+			const PCGExGraphs::FLink& Lk = Links[k];
+			if (PCGEx::H64U(Node, Lk.Node) != Unique[Lk.Edge]) { Broken++; }
+
+			bool bBack = false;
+			for (int32 j = Offsets[Lk.Node]; j < Offsets[Lk.Node + 1]; j++) { bBack |= Links[j].Node == Node && Links[j].Edge == Lk.Edge; }
+			if (!bBack) { Broken++; }
+
+			// Edge order within each node
+			if (k > Offsets[Node] && Links[k - 1].Edge >= Lk.Edge) { Broken++; }
+		}
+	}
+	TestEqual(TEXT("Symmetric links in edge order"), Broken, 0);
+
+	return true;
+}
@@ -0,0 +1,185 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "Helpers/PCGExClusterHelpers.h"
+#include "Helpers/PCGExNodeClassHelpers.h"
+#include "Helpers/PCGExChainTestHelpers.h"
+
+/**
+ * Node Class Tests
+ *
+ * Verifies the bulk leaf/binary/complex classification: agreement with the per-node predicates,
+ * per-class node lists (complete, disjoint, ascending), parallel/sequential equivalence, and
+ * reuse through the cluster cache, and invalidation on any rewiring.
+ *
+ * Test naming convention: PCGEx.Unit.Clusters.NodeClasses.<Case>
+ */
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExNodeClassesMatchPredicatesTest,
+	"PCGEx.Unit.Clusters.NodeClasses.MatchPredicates",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExNodeClassesMatchPredicatesTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// Large enough to span several chunks
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithSparseGrid(120, 0.55f, 9).Build();
+
+	FCachedNodeClasses Classes;
+	Classes.Build(*Cluster);
+
+	TestEqual(TEXT("One class per node"), Classes.NumNodes(), Cluster->NumNodes());
+
+	int32 Mismatches = 0;
+	for (int32 i = 0; i < Cluster->NumNodes(); i++)
+	{
+		if (Classes.IsLeaf(i) != Cluster->IsLeaf(i)) { Mismatches++; }
+		if (Classes.IsBinary(i) != Cluster->IsBinary(i)) { Mismatches++; }
+		if (Classes.IsComplex(i) != Cluster->IsComplex(i)) { Mismatches++; }
+		if ((Classes.Get(i) == ETestNodeClass::Isolated) != Cluster->IsIsolated(i)) { Mismatches++; }
+	}
+	TestEqual(TEXT("Classes agree with the per-node predicates"), Mismatches, 0);
+
+	TestEqual(TEXT("Leaf count"), Classes.GetLeaves().Num(), ClusterVerify::CountLeafNodes(Cluster));
+	TestEqual(TEXT("Binary count"), Classes.GetBinaries().Num(), ClusterVerify::CountBinaryNodes(Cluster));
+	TestEqual(TEXT("Complex count"), Classes.GetComplex().Num(), ClusterVerify::CountComplexNodes(Cluster));
+	TestTrue(TEXT("Sample has isolated nodes"), Classes.Num(ETestNodeClass::Isolated) > 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExNodeClassesIteratorsTest,
+	"PCGEx.Unit.Clusters.NodeClasses.Iterators",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExNodeClassesIteratorsTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithSparseGrid(90, 0.55f, 4).Build();
+
+	FCachedNodeClasses Parallel;
+	FCachedNodeClasses Sequential;
+	Parallel.Build(*Cluster, true);
+	Sequential.Build(*Cluster, false);
+
+	TestTrue(TEXT("Parallel classes identical"), Parallel.Classes == Sequential.Classes);
+	TestTrue(TEXT("Parallel class lists identical"), Parallel.ClassNodes == Sequential.ClassNodes);
+
+	// Every node appears once, under its own class, in ascending order
+	TBitArray<> Seen(false, Cluster->NumNodes());
+	int32 Problems = 0;
+
+	for (int32 c = 0; c < FCachedNodeClasses::NumClasses; c++)
+	{
+		const ETestNodeClass Class = static_cast<ETestNodeClass>(c);
+		int32 Previous = -1;
+		for (const int32 Node : Parallel.GetNodes(Class))
+		{
+			if (Node <= Previous || Seen[Node] || Parallel.Get(Node) != Class) { Problems++; }
+			Seen[Node] = true;
+			Previous = Node;
+		}
+	}
+
+	TestEqual(TEXT("Class lists are ascending and consistent"), Problems, 0);
+	TestEqual(TEXT("Class lists cover every node"), Seen.CountSetBits(), Cluster->NumNodes());
+
+	// Clamping
+	TestTrue(TEXT("5 links is complex"), FCachedNodeClasses::Classify(5) == ETestNodeClass::Complex);
+	TestTrue(TEXT("0 links is isolated"), FCachedNodeClasses::Classify(0) == ETestNodeClass::Isolated);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExNodeClassesCacheTest,
+	"PCGEx.Unit.Clusters.NodeClasses.Cache",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExNodeClassesCacheTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithStar(6).WithCompactAdjacency().Build();
+
+	TSharedPtr<FCachedNodeClasses> First = TestNodeClasses::GetOrBuildNodeClasses(Cluster);
+	TSharedPtr<FCachedNodeClasses> Second = TestNodeClasses::GetOrBuildNodeClasses(Cluster);
+
+	TestTrue(TEXT("Built"), First.IsValid());
+	TestTrue(TEXT("Second call hits the cache"), First == Second);
+
+	TestEqual(TEXT("Star: one complex center"), First->GetComplex().Num(), 1);
+	TestEqual(TEXT("Star: six leaves"), First->GetLeaves().Num(), 6);
+	TestEqual(TEXT("Star: no binaries"), First->GetBinaries().Num(), 0);
+
+	Cluster->ClearCachedData();
+	TSharedPtr<FCachedNodeClasses> Rebuilt = TestNodeClasses::GetOrBuildNodeClasses(Cluster);
+	TestTrue(TEXT("Rebuilt after the cache was cleared"), Rebuilt != First);
+
+	// Same node count, different edges: the cached classes are stale
+	TSharedRef<FTestCluster> Loop = FClusterBuilder().WithClosedLoop(7).Build();
+	Cluster->Initialize(Loop->NodeIndexLookup, Loop->Nodes, Loop->Edges, Loop->Positions);
+
+	TSharedPtr<FCachedNodeClasses> Rewired = TestNodeClasses::GetOrBuildNodeClasses(Cluster);
+	TestTrue(TEXT("Rebuilt after rewiring"), Rewired != Rebuilt);
+	TestEqual(TEXT("Loop: all binaries"), Rewired->GetBinaries().Num(), 7);
+	TestTrue(TEXT("Rebuild was cached"), TestNodeClasses::GetOrBuildNodeClasses(Cluster) == Rewired);
+
+	// Uncached lookups reuse current classes without adding any
+	TSharedRef<FTestCluster> Fresh = FClusterBuilder().WithStar(6).Build();
+	TSharedPtr<FCachedNodeClasses> Transient = TestNodeClasses::GetOrBuildNodeClasses(Fresh, false);
+	TestEqual(TEXT("Transient classes are complete"), Transient->GetLeaves().Num(), 6);
+	TestFalse(TEXT("Transient classes aren't cached"), Fresh->GetCachedData<FCachedNodeClasses>(FCachedNodeClasses::CacheKey).IsValid());
+	TestTrue(TEXT("Cached classes are reused"), TestNodeClasses::GetOrBuildNodeClasses(Cluster, false) == Rewired);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExNodeClassesSameCountsRewireTest,
+	"PCGEx.Unit.Clusters.NodeClasses.SameCountsRewire",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExNodeClassesSameCountsRewireTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// 6 nodes and 5 edges either way: a chain of binaries, then a star of leaves
+	TSharedRef<FTestCluster> Cluster = FClusterBuilder().WithLinearChain(6).Build();
+
+	TSharedPtr<FCachedNodeClasses> Before = TestNodeClasses::GetOrBuildNodeClasses(Cluster);
+	TestEqual(TEXT("Chain: four binaries"), Before->GetBinaries().Num(), 4);
+
+	TSharedRef<FTestCluster> Star = FClusterBuilder().WithStar(5).Build();
+	Cluster->Initialize(Star->NodeIndexLookup, Star->Nodes, Star->Edges, Star->Positions);
+
+	TestEqual(TEXT("Same node count"), Cluster->NumNodes(), Before->NumNodes());
+	TestEqual(TEXT("Same link count"), Cluster->AdjacencyOffsets[Cluster->NumNodes()], Before->NumLinks);
+	TestFalse(TEXT("Stale after rewiring"), Before->IsUpToDate(*Cluster));
+
+	TSharedPtr<FCachedNodeClasses> After = TestNodeClasses::GetOrBuildNodeClasses(Cluster);
+	TestTrue(TEXT("Rebuilt after rewiring"), After != Before);
+	TestEqual(TEXT("Star: five leaves"), After->GetLeaves().Num(), 5);
+	TestEqual(TEXT("Star: no binaries"), After->GetBinaries().Num(), 0);
+
+	// Classes built for another cluster never pass as current
+	TestFalse(TEXT("Other cluster's classes are stale"), After->IsUpToDate(*Star));
+
+	// Parallel chains seed from the cached classes
+	TArray<TSharedPtr<FTestChain>> Sequential;
+	TArray<TSharedPtr<FTestChain>> Parallel;
+	TestChainHelpers::BuildChains(Cluster, Sequential);
+	TestChainHelpers::BuildChainsParallel(Cluster, Parallel);
+
+	FString Mismatch;
+	const bool bMatch = TestChainHelpers::ChainsMatch(Sequential, Parallel, &Mismatch);
+	TestTrue(FString::Printf(TEXT("Parallel chains match sequential after rewiring %s"), *Mismatch), bMatch);
+	TestEqual(TEXT("Star: five chains"), Parallel.Num(), 5);
+
+	return true;
+}
@@ -0,0 +1,482 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+/**
+ * PCGEx Persistent Artifact Cache Unit Tests
+ *
+ * Tests the content-addressed artifact cache that outlives clusters:
+ * - Cluster content hash (topology + quantized positions)
+ * - Reuse of tangent frames, chains and DCEL cells across cluster instances
+ * - Context hash separation (FFaceEnumeratorCacheFactory::ComputeProjectionHash)
+ * - Disk round-trip and rejection of invalid data
+ *
+ * Test naming convention: PCGEx.Unit.Clusters.PersistentCache.<Case>
+ */
+
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "Serialization/MemoryWriter.h"
+#include "Math/PCGExProjectionDetails.h"
+#include "Clusters/Artifacts/PCGExCachedFaceEnumerator.h"
+#include "Clusters/Artifacts/PCGExPlanarFaceEnumerator.h"
+
+#include "Helpers/PCGExPersistentCacheHelpers.h"
+#include "Helpers/PCGExChainTestHelpers.h"
+#include "Helpers/PCGExDCELTestHelpers.h"
+
+namespace PCGExPersistentCacheTestsLocal
+{
+	/** Plain 6x4 grid: corners join two-edge chains, every other edge is a single-edge chain */
+	TSharedRef<PCGExTest::FTestCluster> BuildTestCluster(const FVector& Offset = FVector::ZeroVector)
+	{
+		return PCGExTest::FClusterBuilder().WithGrid(6, 4, 100.0, Offset).Build();
+	}
+
+	TSharedPtr<PCGExClusters::FCachedTangentFrames> BuildFrames(const PCGExTest::FTestCluster& Cluster, int32& BuildCount)
+	{
+		BuildCount++;
+
+		TSharedPtr<TArray<FQuat>> Frames = MakeShared<TArray<FQuat>>();
+		Frames->SetNum(Cluster.NumNodes());
+		for (int32 i = 0; i < Cluster.NumNodes(); i++)
+		{
+			(*Frames)[i] = FQuat(FVector::UpVector, i * 0.1);
+		}
+
+		TSharedPtr<PCGExClusters::FCachedTangentFrames> Cached = MakeShared<PCGExClusters::FCachedTangentFrames>();
+		Cached->NodeTangentFrames = Frames;
+		return Cached;
+	}
+
+	uint32 GetProjectionHash(const EPCGExProjectionMethod Method)
+	{
+		FPCGExGeo2DProjectionDetails Projection;
+		Projection.Method = Method;
+		return PCGExClusters::FFaceEnumeratorCacheFactory::ComputeProjectionHash(Projection);
+	}
+
+	bool CellsMatch(const TArray<PCGExTest::FTestCell>& A, const TArray<PCGExTest::FTestCell>& B)
+	{
+		if (A.Num() != B.Num()) { return false; }
+		for (int32 i = 0; i < A.Num(); i++)
+		{
+			if (A[i].Face != B[i].Face || A[i].Nodes != B[i].Nodes || A[i].Area != B[i].Area) { return false; }
+			if (A[i].bIsConvex != B[i].bIsConvex || A[i].bHasLeaves != B[i].bHasLeaves) { return false; }
+		}
+		return true;
+	}
+}
+
+// =============================================================================
+// Content Hash Tests
+// =============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPersistentCacheContentHashTest,
+	"PCGEx.Unit.Clusters.PersistentCache.ContentHash",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPersistentCacheContentHashTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+	using namespace PCGExPersistentCacheTestsLocal;
+
+	const uint64 HashA = ComputeClusterContentHash(*BuildTestCluster());
+	const uint64 HashB = ComputeClusterContentHash(*BuildTestCluster());
+	TestEqual(TEXT("Identical clusters hash the same"), HashA, HashB);
+
+	// Sub-tolerance jitter doesn't change the hash
+	const uint64 HashJitter = ComputeClusterContentHash(*BuildTestCluster(FVector(0.001, 0, 0)));
+	TestEqual(TEXT("Jitter below tolerance is ignored"), HashA, HashJitter);
+
+	const uint64 HashMoved = ComputeClusterContentHash(*BuildTestCluster(FVector(5, 0, 0)));
+	TestNotEqual(TEXT("Moved cluster hashes differently"), HashA, HashMoved);
+
+	const uint64 HashCoarse = ComputeClusterContentHash(*BuildTestCluster(FVector(5, 0, 0)), 100.0);
+	TestEqual(TEXT("Coarse tolerance absorbs the move"), ComputeClusterContentHash(*BuildTestCluster(), 100.0), HashCoarse);
+
+	const uint64 HashOtherTopology = ComputeClusterContentHash(*FClusterBuilder().WithGrid(4, 6).Build());
+	TestNotEqual(TEXT("Different topology hashes differently"), HashA, HashOtherTopology);
+
+	// Same topology and positions whether or not nodes own their links
+	const uint64 HashCompact = ComputeClusterContentHash(*FClusterBuilder().WithGrid(6, 4).WithCompactAdjacency().Build());
+	TestEqual(TEXT("Compact adjacency hashes the same"), HashA, HashCompact);
+
+	return true;
+}
+
+// =============================================================================
+// Reuse Tests
+// =============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPersistentCacheTangentFramesTest,
+	"PCGEx.Unit.Clusters.PersistentCache.TangentFrames",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPersistentCacheTangentFramesTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+	using namespace PCGExPersistentCacheTestsLocal;
+
+	FPersistentArtifactCache Cache;
+	const uint32 LocalTangentHash = GetProjectionHash(EPCGExProjectionMethod::LocalTangent);
+	const uint32 NormalHash = GetProjectionHash(EPCGExProjectionMethod::Normal);
+
+	int32 BuildCount = 0;
+	bool bFromCache = false;
+
+	// First execution builds
+	TSharedRef<FTestCluster> First = BuildTestCluster();
+	TSharedPtr<PCGExClusters::FCachedTangentFrames> Built = FindOrBuildArtifact<PCGExClusters::FCachedTangentFrames>(
+		First, TangentFramesArtifact, LocalTangentHash, [&]() { return BuildFrames(*First, BuildCount); }, Cache, &bFromCache);
+
+	TestEqual(TEXT("First execution builds"), BuildCount, 1);
+	TestFalse(TEXT("First execution isn't a cache hit"), bFromCache);
+	TestEqual(TEXT("Built artifact carries the context hash"), Built->ContextHash, LocalTangentHash);
+
+	// Same cluster instance: served by its own cache
+	FindOrBuildArtifact<PCGExClusters::FCachedTangentFrames>(
+		First, TangentFramesArtifact, LocalTangentHash, [&]() { return BuildFrames(*First, BuildCount); }, Cache, &bFromCache);
+	TestEqual(TEXT("Cluster cache hit doesn't build"), BuildCount, 1);
+	TestFalse(TEXT("Cluster cache hit doesn't touch the persistent cache"), bFromCache);
+
+	// Next execution, new cluster instance with the same content
+	TSharedRef<FTestCluster> Second = BuildTestCluster();
+	TSharedPtr<PCGExClusters::FCachedTangentFrames> Restored = FindOrBuildArtifact<PCGExClusters::FCachedTangentFrames>(
+		Second, TangentFramesArtifact, LocalTangentHash, [&]() { return BuildFrames(*Second, BuildCount); }, Cache, &bFromCache);
+
+	TestEqual(TEXT("Unchanged cluster skips the build"), BuildCount, 1);
+	TestTrue(TEXT("Restored from persistent cache"), bFromCache);
+	TestTrue(TEXT("Restored instance isn't shared"), Restored != Built);
+	TestEqual(TEXT("Restored frame count"), Restored->NodeTangentFrames->Num(), Built->NodeTangentFrames->Num());
+
+	bool bFramesMatch = true;
+	for (int32 i = 0; i < Built->NodeTangentFrames->Num(); i++)
+	{
+		bFramesMatch &= (*Restored->NodeTangentFrames)[i].Equals((*Built->NodeTangentFrames)[i], 1e-5);
+	}
+	TestTrue(TEXT("Restored frames match"), bFramesMatch);
+	TestTrue(TEXT("Restored artifact is in the cluster cache"), Second->GetCachedData<PCGExClusters::FCachedTangentFrames>(TangentFramesArtifact, LocalTangentHash) == Restored);
+
+	// Other projection settings are a different artifact
+	TSharedRef<FTestCluster> Third = BuildTestCluster();
+	FindOrBuildArtifact<PCGExClusters::FCachedTangentFrames>(
+		Third, TangentFramesArtifact, NormalHash, [&]() { return BuildFrames(*Third, BuildCount); }, Cache, &bFromCache);
+	TestEqual(TEXT("Other context hash builds"), BuildCount, 2);
+
+	// Moved cluster is a different artifact
+	TSharedRef<FTestCluster> Moved = BuildTestCluster(FVector(0, 0, 50));
+	FindOrBuildArtifact<PCGExClusters::FCachedTangentFrames>(
+		Moved, TangentFramesArtifact, LocalTangentHash, [&]() { return BuildFrames(*Moved, BuildCount); }, Cache, &bFromCache);
+	TestEqual(TEXT("Changed positions build"), BuildCount, 3);
+
+	const FPersistentArtifactCacheStats Stats = Cache.GetStats();
+	TestEqual(TEXT("Three entries"), Stats.NumEntries, 3);
+	TestEqual(TEXT("One persistent hit"), Stats.Hits, 1LL);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPersistentCacheChainsTest,
+	"PCGEx.Unit.Clusters.PersistentCache.Chains",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPersistentCacheChainsTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	FPersistentArtifactCache Cache;
+
+	auto MakeCluster = []()
+	{
+		return FClusterBuilder()
+		       .AddNode(0, FVector(0, 0, 0)).AddNode(1, FVector(100, 100, 0)).AddNode(2, FVector(100, 0, 0))
+		       .AddNode(3, FVector(200, 0, 0)).AddNode(4, FVector(300, 0, 0)).AddNode(5, FVector(100, -100, 0))
+		       .AddNode(6, FVector(400, 0, 0)).AddNode(7, FVector(500, 0, 0))
+		       .AddEdge(0, 2).AddEdge(2, 1).AddEdge(2, 3).AddEdge(2, 5).AddEdge(3, 4).AddEdge(4, 6).AddEdge(6, 7)
+		       .Build();
+	};
+
+	TSharedPtr<TArray<int8>> Breakpoints = MakeShared<TArray<int8>>();
+	Breakpoints->Init(0, 8);
+	(*Breakpoints)[4] = 1;
+
+	TSharedRef<FTestCluster> First = MakeCluster();
+	TSharedPtr<FCachedChainData> Built = TestChainHelpers::GetOrBuildCachedChains(First, Breakpoints, &Cache);
+	TestEqual(TEXT("Chains stored"), Cache.GetStats().Stores, 1LL);
+
+	TSharedRef<FTestCluster> Second = MakeCluster();
+	TSharedPtr<FCachedChainData> Restored = TestChainHelpers::GetOrBuildCachedChains(Second, Breakpoints, &Cache);
+	TestEqual(TEXT("Chains restored"), Cache.GetStats().Hits, 1LL);
+	TestTrue(TEXT("Restored chains aren't shared"), Restored != Built);
+
+	TArray<TSharedPtr<FTestChain>> Expected;
+	TestChainHelpers::BuildChains(Second, Expected, Breakpoints);
+
+	TArray<TSharedPtr<FTestChain>> Gathered;
+	Restored->Gather(Gathered);
+
+	FString Mismatch;
+	const bool bMatch = TestChainHelpers::ChainsMatch(Expected, Gathered, &Mismatch);
+	TestTrue(FString::Printf(TEXT("Restored chains match a rebuild %s"), *Mismatch), bMatch);
+
+	// Edits on the restored chains don't leak into the cache
+	(*Breakpoints)[4] = 0;
+	Restored->UpdateBreakpoints(Second, Breakpoints);
+
+	TSharedRef<FTestCluster> Third = MakeCluster();
+	TSharedPtr<FCachedChainData> Again = TestChainHelpers::GetOrBuildCachedChains(Third, nullptr, &Cache);
+
+	TArray<TSharedPtr<FTestChain>> Unsplit;
+	TestChainHelpers::BuildChains(Third, Unsplit, nullptr);
+	Gathered.Reset();
+	Again->Gather(Gathered);
+	TestTrue(TEXT("Cache holds unsplit chains"), TestChainHelpers::ChainsMatch(Unsplit, Gathered));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPersistentCacheDCELCellsTest,
+	"PCGEx.Unit.Clusters.PersistentCache.DCELCells",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPersistentCacheDCELCellsTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+	using namespace PCGExPersistentCacheTestsLocal;
+
+	const FString Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PCGExTest"), TEXT("PersistentCacheCellsTest.bin"));
+
+	FPCGExGeo2DProjectionDetails Projection;
+	Projection.Method = EPCGExProjectionMethod::Normal;
+	Projection.Normal = FVector::UpVector;
+
+	PCGExClusters::FCellConstraints Constraints;
+	Constraints.bBuildWrapper = true;
+
+	auto MakeCluster = []() { return FClusterBuilder().WithSparseGrid(16, 0.7f, 3).Build(); };
+
+	FPersistentArtifactCache Cache;
+	bool bFromCache = false;
+
+	TSharedRef<FTestCluster> First = MakeCluster();
+	TSharedPtr<FCachedDCELCells> Built = GetOrBuildCachedCells(First, Projection, Constraints, nullptr, &Cache, &bFromCache);
+	TestFalse(TEXT("First execution enumerates faces"), bFromCache);
+	TestTrue(TEXT("Cells built"), Built->Cells.Num() > 0);
+	TestEqual(TEXT("Cells stored"), Cache.GetStats().Stores, 1LL);
+	TestTrue(TEXT("Second lookup served by the cluster cache"), GetOrBuildCachedCells(First, Projection, Constraints, nullptr, &Cache) == Built);
+
+	// Round-trip through disk, into a new session
+	TestTrue(TEXT("Saved to disk"), Cache.SaveToFile(Path));
+	FPersistentArtifactCache Loaded;
+	TestEqual(TEXT("Entry loaded"), Loaded.LoadFromFile(Path), 1);
+	IFileManager::Get().Delete(*Path);
+
+	TSharedRef<FTestCluster> Second = MakeCluster();
+	TSharedPtr<FCachedDCELCells> Restored = GetOrBuildCachedCells(Second, Projection, Constraints, nullptr, &Loaded, &bFromCache);
+
+	TestTrue(TEXT("Unchanged cluster skips face enumeration"), bFromCache);
+	TestTrue(TEXT("Restored instance isn't shared"), Restored != Built);
+	TestEqual(TEXT("Restored context hash"), Restored->ContextHash, ComputeCellsContextHash(Projection, Constraints));
+
+	FString Error;
+	TestTrue(FString::Printf(TEXT("Restored DCEL is valid %s"), *Error), Restored->DCEL.Validate(&Error));
+	TestTrue(TEXT("Restored DCEL matches the build"), Restored->DCEL.Equals(Built->DCEL));
+	TestTrue(TEXT("Restored projected positions"), Restored->DCEL.Positions2D == Built->DCEL.Positions2D);
+	TestTrue(TEXT("Restored cells match the build"), CellsMatch(Restored->Cells, Built->Cells));
+	TestTrue(TEXT("Restored wrapper matches the build"), Restored->Wrapper.Face == Built->Wrapper.Face && Restored->Wrapper.Nodes == Built->Wrapper.Nodes);
+
+	// The restored DCEL supports incremental edits like a fresh build
+	FTestDCELEditResult EditResult;
+	const int32 RemovedFrom = Restored->DCEL.Origin[0];
+	const int32 RemovedTo = Restored->DCEL.Target[0];
+	TestTrue(TEXT("Restored DCEL accepts edits"), Restored->DCEL.ApplyEdits({FTestDCELEdit::Remove(RemovedFrom, RemovedTo)}, EditResult));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPersistentCacheDCELCellsStaleTest,
+	"PCGEx.Unit.Clusters.PersistentCache.DCELCellsStale",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPersistentCacheDCELCellsStaleTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+	using namespace PCGExPersistentCacheTestsLocal;
+
+	FPCGExGeo2DProjectionDetails Projection;
+	Projection.Method = EPCGExProjectionMethod::Normal;
+	Projection.Normal = FVector::UpVector;
+
+	const PCGExClusters::FCellConstraints Constraints;
+
+	FPersistentArtifactCache Cache;
+	bool bFromCache = false;
+
+	TSharedRef<FTestCluster> Grid = BuildTestCluster();
+	GetOrBuildCachedCells(Grid, Projection, Constraints, nullptr, &Cache);
+
+	// Other projection or constraints are other artifacts
+	FPCGExGeo2DProjectionDetails Tilted = Projection;
+	Tilted.Normal = FVector(0, 1, 1).GetSafeNormal();
+	GetOrBuildCachedCells(BuildTestCluster(), Tilted, Constraints, nullptr, &Cache, &bFromCache);
+	TestFalse(TEXT("Other projection rebuilds"), bFromCache);
+
+	PCGExClusters::FCellConstraints ConvexOnly;
+	ConvexOnly.bConvexOnly = true;
+	GetOrBuildCachedCells(BuildTestCluster(), Projection, ConvexOnly, nullptr, &Cache, &bFromCache);
+	TestFalse(TEXT("Other constraints rebuild"), bFromCache);
+
+	// Edited topology has another content hash
+	TSharedRef<FTestCluster> Edited = FClusterBuilder().WithGrid(6, 4, 100.0).AddEdge(0, 7).Build();
+	TSharedPtr<FCachedDCELCells> EditedCells = GetOrBuildCachedCells(Edited, Projection, Constraints, nullptr, &Cache, &bFromCache);
+	TestFalse(TEXT("Edited cluster rebuilds"), bFromCache);
+
+	TArray<FTestCell> Expected;
+	FTestDCEL Rebuilt;
+	Rebuilt.Build(*Edited);
+	Rebuilt.ExtractCells(*Edited, Constraints, Expected);
+	TestTrue(TEXT("Edited cluster gets its own cells"), CellsMatch(EditedCells->Cells, Expected));
+
+	// A blob filed under the wrong content hash doesn't fit the cluster it's decoded for
+	const uint32 ContextHash = ComputeCellsContextHash(Projection, Constraints);
+	TSharedPtr<FCachedDCELCells> GridCells = GetOrBuildCachedCells(Grid, Projection, Constraints);
+	const FClusterArtifactKey StaleKey(ComputeClusterContentHash(*Edited), ContextHash, FCachedDCELCells::CacheKey);
+	Cache.Add(StaleKey, *GridCells);
+
+	TestFalse(TEXT("Stale cells aren't decoded"), Cache.Find(StaleKey, Edited).IsValid());
+	TestEqual(TEXT("Decode failure counted"), Cache.GetStats().DecodeFailures, 1LL);
+	TestFalse(TEXT("Stale entry dropped"), Cache.Contains(StaleKey));
+
+	return true;
+}
+
+// =============================================================================
+// Disk Tests
+// =============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPersistentCacheDiskTest,
+	"PCGEx.Unit.Clusters.PersistentCache.Disk",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPersistentCacheDiskTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+	using namespace PCGExPersistentCacheTestsLocal;
+
+	const FString Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PCGExTest"), TEXT("PersistentCacheTest.bin"));
+	const uint32 ContextHash = GetProjectionHash(EPCGExProjectionMethod::LocalTangent);
+
+	int32 BuildCount = 0;
+
+	{
+		FPersistentArtifactCache Cache;
+		TSharedRef<FTestCluster> Cluster = BuildTestCluster();
+		FindOrBuildArtifact<PCGExClusters::FCachedTangentFrames>(
+			Cluster, TangentFramesArtifact, ContextHash, [&]() { return BuildFrames(*Cluster, BuildCount); }, Cache);
+		TestChainHelpers::GetOrBuildCachedChains(Cluster, nullptr, &Cache);
+
+		TestTrue(TEXT("Saved to disk"), Cache.SaveToFile(Path));
+	}
+
+	// New session: empty cache filled from disk
+	FPersistentArtifactCache Loaded;
+	TestEqual(TEXT("Both entries loaded"), Loaded.LoadFromFile(Path), 2);
+
+	TSharedRef<FTestCluster> Cluster = BuildTestCluster();
+	bool bFromCache = false;
+	TSharedPtr<PCGExClusters::FCachedTangentFrames> Frames = FindOrBuildArtifact<PCGExClusters::FCachedTangentFrames>(
+		Cluster, TangentFramesArtifact, ContextHash, [&]() { return BuildFrames(*Cluster, BuildCount); }, Loaded, &bFromCache);
+
+	TestTrue(TEXT("Frames restored from disk"), bFromCache);
+	TestEqual(TEXT("No rebuild after load"), BuildCount, 1);
+	TestEqual(TEXT("Frame count"), Frames->NodeTangentFrames->Num(), Cluster->NumNodes());
+
+	// Blob that doesn't fit the cluster is dropped rather than trusted
+	TSharedRef<FTestCluster> Smaller = FClusterBuilder().WithLinearChain(3).Build();
+	const FClusterArtifactKey WrongKey(ComputeClusterContentHash(*Smaller), ContextHash, TangentFramesArtifact);
+	Loaded.Add(WrongKey, *Frames);
+	TestFalse(TEXT("Mismatching blob isn't decoded"), Loaded.Find(WrongKey, Smaller).IsValid());
+	TestEqual(TEXT("Decode failure counted"), Loaded.GetStats().DecodeFailures, 1LL);
+	TestFalse(TEXT("Undecodable entry dropped"), Loaded.Contains(WrongKey));
+
+	// Invalid files are ignored
+	TArray<uint8> Garbage = {1, 2, 3, 4, 5, 6, 7, 8};
+	FFileHelper::SaveArrayToFile(Garbage, *Path);
+	TestEqual(TEXT("Garbage file rejected"), Loaded.LoadFromFile(Path), -1);
+	TestEqual(TEXT("Missing file rejected"), Loaded.LoadFromFile(Path + TEXT(".missing")), -1);
+
+	IFileManager::Get().Delete(*Path);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPersistentCacheCorruptCountsTest,
+	"PCGEx.Unit.Clusters.PersistentCache.CorruptCounts",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPersistentCacheCorruptCountsTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	const FString Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PCGExTest"), TEXT("PersistentCacheCorruptTest.bin"));
+
+	auto WriteFile = [&](int32 NumEntries, int32 BlobSize)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+
+		uint32 Magic = 0x43415850; // 'PXAC'
+		int32 Version = 1;
+		Writer << Magic;
+		Writer << Version;
+		Writer << NumEntries;
+
+		uint64 ContentHash = 1;
+		uint32 ContextHash = 0;
+		FString Artifact = TangentFramesArtifact.ToString();
+		Writer << ContentHash;
+		Writer << ContextHash;
+		Writer << Artifact;
+		Writer << BlobSize;
+
+		FFileHelper::SaveArrayToFile(Bytes, *Path);
+	};
+
+	// Counts larger than what the file holds are rejected before reserving for them
+	WriteFile(MAX_int32, 0);
+	FPersistentArtifactCache Cache;
+	TestEqual(TEXT("Oversized entry count rejected"), Cache.LoadFromFile(Path), -1);
+
+	WriteFile(1, MAX_int32);
+	TestEqual(TEXT("Oversized blob rejected"), Cache.LoadFromFile(Path), -1);
+
+	WriteFile(1, 0);
+	TestEqual(TEXT("Well-formed header still loads"), Cache.LoadFromFile(Path), 1);
+
+	IFileManager::Get().Delete(*Path);
+
+	// Chains referencing edges the cluster doesn't have aren't decoded
+	TSharedRef<FTestCluster> Loop = FClusterBuilder().WithClosedLoop(8).Build();
+	TSharedRef<FTestCluster> Line = FClusterBuilder().WithLinearChain(8).Build();
+
+	TSharedPtr<FCachedChainData> LoopChains = TestChainHelpers::GetOrBuildCachedChains(Loop, nullptr);
+
+	const FClusterArtifactKey Key(ComputeClusterContentHash(*Loop), 0, FCachedChainData::CacheKey);
+	TestTrue(TEXT("Loop chains stored"), Cache.Add(Key, *LoopChains));
+	TestTrue(TEXT("Loop chains decode on their cluster"), Cache.Find(Key, Loop).IsValid());
+
+	// Same node count, one edge less
+	TestFalse(TEXT("Out of range edge rejected"), Cache.Find(Key, Line).IsValid());
+	TestEqual(TEXT("Decode failure counted"), Cache.GetStats().DecodeFailures, 1LL);
+
+	return true;
+}
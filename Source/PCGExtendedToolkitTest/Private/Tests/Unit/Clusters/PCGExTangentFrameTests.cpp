@@ -0,0 +1,235 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "Helpers/PCGExClusterHelpers.h"
+#include "Helpers/PCGExDCELTestHelpers.h"
+#include "Helpers/PCGExTangentFrameTestHelpers.h"
+
+/**
+ * Tangent Frame Tests
+ *
+ * Verifies the batched (structure-of-arrays) LocalTangent frame computation against the
+ * node-by-node reference: matching normals and frames, orthonormal frames aligned with
+ * their normal, consistent signs across each connected component, and degenerate nodes.
+ *
+ * Test naming convention: PCGEx.Unit.Clusters.TangentFrames.<Case>
+ */
+
+namespace PCGExTangentFrameTestsLocal
+{
+	/** Height field the test grids are draped over */
+	double WavyHeight(const int32 X, const int32 Y)
+	{
+		return 40.0 * FMath::Sin(X * 0.3) * FMath::Cos(Y * 0.2);
+	}
+
+	/** Compare both paths; returns the number of mismatching nodes */
+	int32 CountMismatches(const PCGExTest::FTestCluster& Cluster, const bool bParallel, FString& OutFirst)
+	{
+		TArray<FQuat> ScalarFrames, BatchedFrames;
+		TArray<FVector> ScalarNormals, BatchedNormals;
+
+		PCGExTest::TestTangentFrames::ComputeScalar(Cluster, ScalarFrames, &ScalarNormals);
+		PCGExTest::TestTangentFrames::ComputeBatched(Cluster, BatchedFrames, &BatchedNormals, bParallel);
+
+		if (ScalarFrames.Num() != BatchedFrames.Num()) { return FMath::Max(ScalarFrames.Num(), BatchedFrames.Num()); }
+
+		int32 Mismatches = 0;
+		for (int32 i = 0; i < ScalarFrames.Num(); i++)
+		{
+			const bool bSameNormal = ScalarNormals[i].Equals(BatchedNormals[i], 1e-9);
+			const bool bSameFrame = ScalarFrames[i].Equals(BatchedFrames[i], 1e-9);
+			if (bSameNormal && bSameFrame) { continue; }
+
+			if (Mismatches == 0)
+			{
+				OutFirst = FString::Printf(
+					TEXT("Node %d: normal %s vs %s, frame %s vs %s"), i,
+					*ScalarNormals[i].ToString(), *BatchedNormals[i].ToString(),
+					*ScalarFrames[i].ToString(), *BatchedFrames[i].ToString());
+			}
+			Mismatches++;
+		}
+
+		return Mismatches;
+	}
+}
+
+//
+// Batched vs Scalar
+//
+
+/**
+ * Batched normals and frames match the node-by-node reference, parallel or not
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExTangentFramesMatchesScalarTest,
+	"PCGEx.Unit.Clusters.TangentFrames.MatchesScalar",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExTangentFramesMatchesScalarTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTangentFrameTestsLocal;
+
+	const FQuat Tilt = FQuat(FVector(1, 2, 0.5).GetSafeNormal(), FMath::DegreesToRadians(70));
+
+	const TArray<TSharedRef<PCGExTest::FTestCluster>> Clusters = {
+		PCGExTest::FClusterBuilder().WithGrid(5, 4).Build(),
+		PCGExTest::FClusterBuilder().WithSparseGrid(40, 1.0f, 3, WavyHeight).Build(),
+		PCGExTest::FClusterBuilder().WithSparseGrid(60, 0.7f, 11, WavyHeight, Tilt).Build(),
+		PCGExTest::FClusterBuilder().WithSparseGrid(50, 0.45f, 17, WavyHeight, FQuat(FVector::ForwardVector, UE_HALF_PI)).Build()
+	};
+
+	for (int32 c = 0; c < Clusters.Num(); c++)
+	{
+		for (const bool bParallel : {false, true})
+		{
+			FString First;
+			const int32 Mismatches = CountMismatches(*Clusters[c], bParallel, First);
+			TestEqual(FString::Printf(TEXT("Cluster %d (%s): batched matches scalar"), c, bParallel ? TEXT("parallel") : TEXT("single")), Mismatches, 0);
+			if (Mismatches) { AddError(First); }
+		}
+	}
+
+	return true;
+}
+
+//
+// Frame Properties
+//
+
+/**
+ * Frames are orthonormal, Z is the node normal, and normals agree across edges on a smooth surface
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExTangentFramesPropertiesTest,
+	"PCGEx.Unit.Clusters.TangentFrames.Properties",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExTangentFramesPropertiesTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTangentFrameTestsLocal;
+
+	const TSharedRef<PCGExTest::FTestCluster> Cluster = PCGExTest::FClusterBuilder().WithSparseGrid(30, 1.0f, 5, WavyHeight).Build();
+
+	TArray<FQuat> Frames;
+	TArray<FVector> Normals;
+	PCGExTest::TestTangentFrames::ComputeBatched(*Cluster, Frames, &Normals);
+
+	int32 BadFrames = 0;
+	for (int32 i = 0; i < Frames.Num(); i++)
+	{
+		const FVector X = Frames[i].GetAxisX();
+		const FVector Y = Frames[i].GetAxisY();
+		const FVector Z = Frames[i].GetAxisZ();
+
+		const bool bOrthonormal =
+			FMath::IsNearlyEqual(X.Size(), 1.0, 1e-6) && FMath::IsNearlyEqual(Y.Size(), 1.0, 1e-6) &&
+			FMath::IsNearlyZero(X | Y, 1e-6) && FMath::IsNearlyZero(Y | Z, 1e-6) && FMath::IsNearlyZero(Z | X, 1e-6);
+
+		if (!bOrthonormal || !Z.Equals(Normals[i], 1e-6)) { BadFrames++; }
+	}
+	TestEqual(TEXT("Every frame is orthonormal with Z along the normal"), BadFrames, 0);
+
+	int32 Disagreeing = 0;
+	for (int32 i = 0; i < Cluster->NumNodes(); i++)
+	{
+		for (const PCGExGraphs::FLink& Lk : Cluster->GetLinks(i))
+		{
+			if ((Normals[i] | Normals[Lk.Node]) < 0) { Disagreeing++; }
+		}
+	}
+	TestEqual(TEXT("Adjacent normals agree on a smooth surface"), Disagreeing, 0);
+
+	// Flat plane: every normal is the same, whatever its sign
+	TArray<FQuat> FlatFrames;
+	TArray<FVector> FlatNormals;
+	const TSharedRef<PCGExTest::FTestCluster> Flat = PCGExTest::FClusterBuilder().WithGrid(6, 6).Build();
+	PCGExTest::TestTangentFrames::ComputeBatched(*Flat, FlatFrames, &FlatNormals);
+
+	bool bAllParallel = true;
+	for (const FVector& Normal : FlatNormals) { bAllParallel &= Normal.Equals(FlatNormals[0], 1e-9) && FMath::IsNearlyEqual(FMath::Abs(Normal.Z), 1.0, 1e-9); }
+	TestTrue(TEXT("Flat grid has a single, consistent normal"), bAllParallel);
+
+	return true;
+}
+
+/**
+ * Nodes without two independent edges fall back to Up, then follow their component's sign
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExTangentFramesDegenerateTest,
+	"PCGEx.Unit.Clusters.TangentFrames.Degenerate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExTangentFramesDegenerateTest::RunTest(const FString& Parameters)
+{
+	// Straight chain: no node has two independent directions
+	{
+		const TSharedRef<PCGExTest::FTestCluster> Chain = PCGExTest::FClusterBuilder().WithLinearChain(8).Build();
+
+		TArray<FQuat> Frames;
+		TArray<FVector> Normals;
+		PCGExTest::TestTangentFrames::ComputeBatched(*Chain, Frames, &Normals);
+
+		bool bAllUp = true;
+		for (const FVector& Normal : Normals) { bAllUp &= Normal.Equals(FVector::UpVector, 1e-9); }
+		TestTrue(TEXT("Collinear chain uses Up everywhere"), bAllUp);
+		TestTrue(TEXT("Up frame is identity"), Frames[0].Equals(FQuat::Identity, 1e-9));
+	}
+
+	// Normal along Forward switches the X hint to Right
+	{
+		const FQuat ToForward = FQuat::FindBetweenNormals(FVector::UpVector, FVector::ForwardVector);
+		const TSharedRef<PCGExTest::FTestCluster> Wall = PCGExTest::FClusterBuilder().WithSparseGrid(4, 1.0f, 0, PCGExTangentFrameTestsLocal::WavyHeight, ToForward).Build();
+
+		FString First;
+		TestEqual(TEXT("Forward-facing wall matches scalar"), PCGExTangentFrameTestsLocal::CountMismatches(*Wall, true, First), 0);
+
+		TArray<FQuat> Frames;
+		PCGExTest::TestTangentFrames::ComputeBatched(*Wall, Frames);
+
+		bool bFinite = true;
+		for (const FQuat& Frame : Frames) { bFinite &= !Frame.ContainsNaN() && Frame.IsNormalized(); }
+		TestTrue(TEXT("Frames facing Forward are valid"), bFinite);
+	}
+
+	return true;
+}
+
+//
+// Cached Data
+//
+
+/**
+ * Cached frames drive a LocalTangent DCEL build
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExTangentFramesCachedTest,
+	"PCGEx.Unit.Clusters.TangentFrames.Cached",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExTangentFramesCachedTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<PCGExTest::FTestCluster> Cluster = PCGExTest::FClusterBuilder().WithSparseGrid(12, 1.0f, 2, PCGExTangentFrameTestsLocal::WavyHeight).Build();
+
+	const TSharedPtr<PCGExClusters::FCachedTangentFrames> Cached = PCGExTest::TestTangentFrames::BuildCachedTangentFrames(*Cluster);
+	TestTrue(TEXT("Cached frames are set"), Cached.IsValid() && Cached->NodeTangentFrames.IsValid());
+	if (!Cached.IsValid() || !Cached->NodeTangentFrames.IsValid()) { return false; }
+
+	TestEqual(TEXT("One frame per node"), Cached->NodeTangentFrames->Num(), Cluster->NumNodes());
+
+	PCGExTest::FTestDCEL DCEL;
+	DCEL.Build(*Cluster, *Cached->NodeTangentFrames);
+
+	FString Error;
+	TestTrue(TEXT("DCEL from cached frames is valid"), DCEL.Validate(&Error));
+	if (!Error.IsEmpty()) { AddError(Error); }
+
+	// Full grid: (Size - 1)^2 quads plus the outer face
+	TArray<TArray<int32>> Faces;
+	TestEqual(TEXT("Face count"), DCEL.WalkFaces(Faces), 11 * 11 + 1);
+
+	return true;
+}
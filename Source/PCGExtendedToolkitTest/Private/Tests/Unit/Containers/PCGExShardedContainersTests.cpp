@@ -7,6 +7,8 @@
  * Tests thread-safe sharded containers:
  * - TH64SetShards: Sharded hash set for concurrent access
  * - TH64MapShards: Sharded hash map for concurrent access
+ * - TH64MapBuildShards: Lock-free build-then-merge variant for write-heavy phases
+ * - FH64SetShardsDyn / TH64MapShardsDyn: Runtime shard count with contention counters
  *
  * These containers distribute data across multiple shards using
  * a hash function, allowing concurrent access with reduced lock contention.
@@ -16,6 +18,9 @@
 
 #include "Misc/AutomationTest.h"
 #include "Containers/PCGExScopedContainers.h"
+#include "Async/ParallelFor.h"
+
+#include "Helpers/PCGExShardedContainerHelpers.h"
 
 // =============================================================================
 // TH64SetShards Tests
@@ -447,3 +452,335 @@ bool FPCGExShardedDistributionTest::RunTest(const FString& Parameters)
 
 	return true;
 }
+
+// =============================================================================
+// TH64MapBuildShards Tests
+// =============================================================================
+
+/**
+ * Test build-then-merge map basic operations
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExH64MapBuildShardsBasicTest,
+	"PCGEx.Unit.Containers.Sharded.MapBuild.Basic",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExH64MapBuildShardsBasicTest::RunTest(const FString& Parameters)
+{
+	PCGExTest::TH64MapBuildShards<int32, 32> Map(2);
+
+	TestEqual(TEXT("Two writer slots"), Map.NumSlots(), 2);
+	TestFalse(TEXT("Not merged before Merge()"), Map.IsMerged());
+
+	Map.Add(0, 100, 1);
+	Map.Add(0, 200, 2);
+	Map.Add(1, 300, 3);
+
+	Map.Merge();
+
+	TestTrue(TEXT("Merged after Merge()"), Map.IsMerged());
+	TestEqual(TEXT("Merged map has 3 entries"), Map.Num(), 3);
+
+	const int32* Value = Map.Find(300);
+	TestNotNull(TEXT("Key 300 found"), Value);
+	if (Value) { TestEqual(TEXT("Key 300 maps to 3"), *Value, 3); }
+
+	TestFalse(TEXT("Missing key is not found"), Map.Contains(400));
+
+	return true;
+}
+
+/**
+ * Test that duplicate keys across slots resolve deterministically
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExH64MapBuildShardsDuplicatesTest,
+	"PCGEx.Unit.Containers.Sharded.MapBuild.Duplicates",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExH64MapBuildShardsDuplicatesTest::RunTest(const FString& Parameters)
+{
+	// Default merge: highest slot wins
+	{
+		PCGExTest::TH64MapBuildShards<int32, 8> Map(3);
+		Map.Add(2, 42, 300);
+		Map.Add(0, 42, 100);
+		Map.Add(1, 42, 200);
+		Map.Merge();
+
+		const int32* Value = Map.Find(42);
+		TestNotNull(TEXT("Duplicate key found"), Value);
+		if (Value) { TestEqual(TEXT("Highest slot wins"), *Value, 300); }
+		TestEqual(TEXT("Single entry after merge"), Map.Num(), 1);
+	}
+
+	// Custom merge: accumulate
+	{
+		PCGExTest::TH64MapBuildShards<int32, 8> Map(4);
+		for (int32 Slot = 0; Slot < 4; Slot++)
+		{
+			Map.FindOrAddAndUpdate(
+				Slot, 7, 0, [&](int32& Count, const bool bIsNew)
+				{
+					TestTrue(TEXT("First write in a slot is new"), bIsNew);
+					Count += Slot + 1;
+				});
+		}
+
+		Map.Merge([](int32& Existing, const int32& Incoming) { Existing += Incoming; });
+
+		const int32* Value = Map.Find(7);
+		TestNotNull(TEXT("Accumulated key found"), Value);
+		if (Value) { TestEqual(TEXT("Sum of all slots (1+2+3+4)"), *Value, 10); }
+	}
+
+	return true;
+}
+
+/**
+ * Test parallel build and collapse against the locked sharded map
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExH64MapBuildShardsParallelTest,
+	"PCGEx.Unit.Containers.Sharded.MapBuild.Parallel",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExH64MapBuildShardsParallelTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumValues = 20000;
+	constexpr int32 NumChunks = 16;
+	constexpr int32 ChunkSize = NumValues / NumChunks;
+
+	PCGExMT::TH64MapShards<int32, 32> Locked;
+	PCGExTest::TH64MapBuildShards<int32, 32> Build(NumChunks);
+	Build.Reserve(ChunkSize);
+
+	ParallelFor(
+		NumChunks, [&](const int32 Chunk)
+		{
+			for (int32 i = Chunk * ChunkSize; i < (Chunk + 1) * ChunkSize; i++)
+			{
+				const uint64 Key = static_cast<uint64>(i) * 7919;
+				Locked.Add(Key, i);
+				Build.Add(Chunk, Key, i);
+			}
+		});
+
+	TMap<uint64, int32> LockedResult;
+	TMap<uint64, int32> BuildResult;
+	Locked.Collapse(LockedResult);
+	Build.Collapse(BuildResult);
+
+	TestEqual(TEXT("Build-then-merge has all values"), BuildResult.Num(), NumValues);
+	TestEqual(TEXT("Same size as locked shards"), BuildResult.Num(), LockedResult.Num());
+
+	bool bAllMatch = true;
+	for (const TPair<uint64, int32>& Pair : LockedResult)
+	{
+		const int32* Value = BuildResult.Find(Pair.Key);
+		if (!Value || *Value != Pair.Value)
+		{
+			bAllMatch = false;
+			AddError(FString::Printf(TEXT("Key %llu mismatch"), Pair.Key));
+			break;
+		}
+	}
+	TestTrue(TEXT("Contents match locked shards"), bAllMatch);
+
+	TestFalse(TEXT("Not merged after Collapse"), Build.IsMerged());
+	TestEqual(TEXT("Container empty after Collapse"), Build.Num(), 0);
+
+	return true;
+}
+
+/**
+ * Test that Empty and Init reset the container
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExH64MapBuildShardsResetTest,
+	"PCGEx.Unit.Containers.Sharded.MapBuild.Reset",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExH64MapBuildShardsResetTest::RunTest(const FString& Parameters)
+{
+	PCGExTest::TH64MapBuildShards<int32, 4> Map(2);
+	for (int32 i = 0; i < 100; i++) { Map.Add(i % 2, i, i); }
+
+	Map.Empty();
+	Map.Merge();
+	TestEqual(TEXT("Empty discards pending slot data"), Map.Num(), 0);
+
+	Map.Init(0);
+	TestEqual(TEXT("Init clamps to one slot"), Map.NumSlots(), 1);
+
+	Map.Add(0, 5, 50);
+	Map.Merge();
+	TestEqual(TEXT("Usable after Init"), Map.Num(), 1);
+
+	return true;
+}
+
+// =============================================================================
+// Runtime Shard Count Tests
+// =============================================================================
+
+/**
+ * Test ComputeShardCount heuristics
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExComputeShardCountTest,
+	"PCGEx.Unit.Containers.Sharded.ComputeShardCount",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExComputeShardCountTest::RunTest(const FString& Parameters)
+{
+	using PCGExTest::ComputeShardCount;
+
+	TestEqual(TEXT("8 workers, unknown size -> 32 shards"), ComputeShardCount(8), 32);
+	TestEqual(TEXT("128 workers, unknown size -> 512 shards"), ComputeShardCount(128), 512);
+	TestEqual(TEXT("Worker count is clamped to 1"), ComputeShardCount(1), 4);
+
+	// Small expected sizes cap the shard count
+	TestEqual(TEXT("128 workers, 1K entries -> 4 shards"), ComputeShardCount(128, 1000), 4);
+	TestEqual(TEXT("Tiny sets get a single shard"), ComputeShardCount(64, 10), 1);
+	TestEqual(TEXT("Large sets are capped by workers"), ComputeShardCount(8, 10000000), 32);
+
+	// Always a power of two within bounds
+	bool bAllValid = true;
+	for (int32 Workers = 1; Workers <= 512; Workers += 7)
+	{
+		const int32 Count = ComputeShardCount(Workers, Workers * 1000);
+		if (Count < 1 || Count > 1024 || !FMath::IsPowerOfTwo(Count))
+		{
+			bAllValid = false;
+			AddError(FString::Printf(TEXT("Invalid shard count %d for %d workers"), Count, Workers));
+			break;
+		}
+	}
+	TestTrue(TEXT("Shard counts are powers of two in [1, 1024]"), bAllValid);
+
+	TestTrue(TEXT("Default uses logical core count"), ComputeShardCount() >= 4);
+
+	return true;
+}
+
+/**
+ * Test runtime-sized set
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExH64SetShardsDynTest,
+	"PCGEx.Unit.Containers.Sharded.SetDyn.Basic",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExH64SetShardsDynTest::RunTest(const FString& Parameters)
+{
+	PCGExTest::FH64SetShardsDyn Set(PCGExTest::ComputeShardCount(16, 4096));
+	TestEqual(TEXT("Shard count set at construction"), Set.GetNumShards(), 16);
+
+	bool bIsAlreadySet = true;
+	Set.Add(100, bIsAlreadySet);
+	TestFalse(TEXT("First add is new"), bIsAlreadySet);
+	Set.Add(100, bIsAlreadySet);
+	TestTrue(TEXT("Second add is a duplicate"), bIsAlreadySet);
+
+	for (uint64 i = 0; i < 1000; ++i) { Set.Add(i); }
+	TestTrue(TEXT("Contains(500)"), Set.Contains(500));
+	TestTrue(TEXT("Remove(500)"), Set.Remove(500));
+	TestFalse(TEXT("Removed value is gone"), Set.Contains(500));
+
+	int32 ShardTotal = 0;
+	int32 NonEmptyShards = 0;
+	for (int32 i = 0; i < Set.GetNumShards(); i++)
+	{
+		const int32 ShardNum = Set.GetShardNum(i);
+		ShardTotal += ShardNum;
+		if (ShardNum > 0) { NonEmptyShards++; }
+	}
+	TestEqual(TEXT("Shard sizes sum to 999"), ShardTotal, 999);
+	TestEqual(TEXT("Sequential values reach every shard"), NonEmptyShards, Set.GetNumShards());
+
+	TSet<uint64> Merged;
+	Set.Collapse(Merged);
+	TestEqual(TEXT("Collapsed set has 999 elements"), Merged.Num(), 999);
+
+	return true;
+}
+
+/**
+ * Test runtime-sized map
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExH64MapShardsDynTest,
+	"PCGEx.Unit.Containers.Sharded.MapDyn.Basic",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExH64MapShardsDynTest::RunTest(const FString& Parameters)
+{
+	PCGExTest::TH64MapShardsDyn<int32> Map(8);
+
+	Map.Add(1, 10);
+	Map.Add(2, 20);
+
+	int32 Value = 0;
+	TestTrue(TEXT("Find(1)"), Map.Find(1, Value));
+	TestEqual(TEXT("Find(1) == 10"), Value, 10);
+	TestFalse(TEXT("Find(3) fails"), Map.Find(3, Value));
+
+	Map.FindOrAddAndUpdate(2, 0, [](int32& V, const bool bIsNew) { V += bIsNew ? 1000 : 1; });
+	Map.FindOrAddAndUpdate(3, 0, [](int32& V, const bool bIsNew) { V += bIsNew ? 1000 : 1; });
+
+	TestTrue(TEXT("Find(2)"), Map.Find(2, Value));
+	TestEqual(TEXT("Existing value updated"), Value, 21);
+	TestTrue(TEXT("Find(3)"), Map.Find(3, Value));
+	TestEqual(TEXT("New value initialized"), Value, 1000);
+
+	TestTrue(TEXT("Remove(1)"), Map.Remove(1));
+	TestFalse(TEXT("Contains(1) after remove"), Map.Contains(1));
+
+	TMap<uint64, int32> Merged;
+	Map.Collapse(Merged);
+	TestEqual(TEXT("Collapsed map has 2 entries"), Merged.Num(), 2);
+
+	return true;
+}
+
+/**
+ * Test contention counters
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExShardedContentionTest,
+	"PCGEx.Unit.Containers.Sharded.Contention",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExShardedContentionTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumValues = 10000;
+
+	// Tracking disabled: nothing is recorded
+	{
+		PCGExTest::FH64SetShardsDyn Set(4);
+		for (uint64 i = 0; i < 100; ++i) { Set.Add(i); }
+		TestEqual(TEXT("No acquisitions recorded without tracking"), Set.GetContentionStats().GetTotalAcquisitions(), 0LL);
+	}
+
+	// Single shard, many writers: every operation goes through one lock
+	PCGExTest::FH64SetShardsDyn Set(1, true);
+	TestTrue(TEXT("Tracking enabled"), Set.IsTrackingContention());
+
+	ParallelFor(NumValues, [&](const int32 i) { Set.Add(static_cast<uint64>(i)); });
+
+	const PCGExTest::FShardContentionStats Stats = Set.GetContentionStats();
+	TestEqual(TEXT("One stat entry per shard"), Stats.Acquisitions.Num(), 1);
+	TestEqual(TEXT("Every add acquired the lock"), Stats.GetTotalAcquisitions(), static_cast<int64>(NumValues));
+	TestTrue(TEXT("Waits never exceed acquisitions"), Stats.GetTotalWaits() <= Stats.GetTotalAcquisitions());
+	TestTrue(TEXT("Wait ratio in [0, 1]"), Stats.GetWaitRatio() >= 0 && Stats.GetWaitRatio() <= 1);
+	TestTrue(TEXT("Hottest shard is 0 or none"), Stats.GetHottestShard() <= 0);
+
+	AddInfo(Stats.ToString());
+
+	Set.ResetContentionStats();
+	TestEqual(TEXT("Reset clears acquisitions"), Set.GetContentionStats().GetTotalAcquisitions(), 0LL);
+	TestEqual(TEXT("Reset clears waits"), Set.GetContentionStats().GetTotalWaits(), 0LL);
+
+	return true;
+}
@@ -0,0 +1,264 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "Helpers/PCGExDelaunayTestHelpers.h"
+#include "Math/PCGExProjectionDetails.h"
+#include "PCGExH.h"
+
+/**
+ * Constrained Delaunay Tests
+ *
+ * Verifies FTestDelaunay2::ProcessConstrained: every kept constraint is an output edge and no edge
+ * crosses one, the rest of the triangulation stays locally Delaunay, constraints through other
+ * vertices are split there, crossing constraints are skipped, and interior-only output keeps
+ * exactly the triangles inside the constraint loops.
+ *
+ * Test naming convention: PCGEx.Unit.Delaunay.Constrained2.<Case>
+ */
+
+namespace PCGExConstrainedDelaunayTestsLocal
+{
+	/** Segments AB and CD cross at a point that is neither's endpoint */
+	bool Crosses(const FVector2D& A, const FVector2D& B, const FVector2D& C, const FVector2D& D)
+	{
+		const double C1 = FVector2D::CrossProduct(B - A, C - A);
+		const double C2 = FVector2D::CrossProduct(B - A, D - A);
+		const double C3 = FVector2D::CrossProduct(D - C, A - C);
+		const double C4 = FVector2D::CrossProduct(D - C, B - C);
+		return ((C1 > 0 && C2 < 0) || (C1 < 0 && C2 > 0)) && ((C3 > 0 && C4 < 0) || (C3 < 0 && C4 > 0));
+	}
+
+	/** Closed loop around a rectangle, NumPerSide points per side, appended to Positions and Constraints */
+	void AddLoop(const FVector2D& Min, const FVector2D& Max, const int32 NumPerSide, TArray<FVector2D>& Positions, TArray<uint64>& Constraints)
+	{
+		const FVector2D Corners[4] = {Min, FVector2D(Max.X, Min.Y), Max, FVector2D(Min.X, Max.Y)};
+
+		const int32 First = Positions.Num();
+		for (int32 Side = 0; Side < 4; Side++)
+		{
+			for (int32 i = 0; i < NumPerSide; i++) { Positions.Add(FMath::Lerp(Corners[Side], Corners[(Side + 1) % 4], static_cast<double>(i) / NumPerSide)); }
+		}
+
+		const int32 Last = Positions.Num() - 1;
+		for (int32 i = First; i <= Last; i++) { Constraints.Add(PCGEx::H64U(i, i == Last ? First : i + 1)); }
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExConstrainedDelaunay2EdgesTest,
+	"PCGEx.Unit.Delaunay.Constrained2.Edges",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExConstrainedDelaunay2EdgesTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	FRandomStream Random(31);
+
+	// Grid points on top of random ones, so some constraints run through vertices
+	TArray<FVector2D> Positions;
+	for (int32 i = 0; i < 3000; i++) { Positions.Emplace(Random.FRandRange(0, 1000), Random.FRandRange(0, 1000)); }
+	for (int32 x = 0; x <= 10; x++) { for (int32 y = 0; y <= 10; y++) { Positions.Emplace(x * 100, y * 100); } }
+
+	// Planar network: the triangulation of one point in five, so no two constraints cross
+	TArray<FVector2D> Subset;
+	for (int32 i = 0; i < Positions.Num(); i += 5) { Subset.Add(Positions[i]); }
+
+	FTestDelaunay2 Network;
+	TestTrue(TEXT("Network processed"), Network.Process(Subset));
+
+	TArray<uint64> Constraints;
+	for (const uint64 Edge : Network.DelaunayEdges) { Constraints.Add(PCGEx::H64U(PCGEx::H64A(Edge) * 5, PCGEx::H64B(Edge) * 5)); }
+
+	FTestDelaunay2 Delaunay;
+	TestTrue(TEXT("Processed"), Delaunay.ProcessConstrained(Positions, Constraints));
+	TestTrue(TEXT("Constrained"), Delaunay.IsConstrained());
+	TestEqual(TEXT("Nothing skipped"), Delaunay.SkippedConstraints.Num(), 0);
+	TestTrue(TEXT("Some constraints split at a vertex"), Delaunay.ConstrainedEdges.Num() > Constraints.Num());
+
+	FString Error;
+	const bool bValid = Delaunay.Validate(&Error, true);
+	TestTrue(FString::Printf(TEXT("Valid and locally Delaunay (%s)"), *Error), bValid);
+
+	int32 NumMissing = 0;
+	for (const uint64 Edge : Delaunay.ConstrainedEdges) { if (!Delaunay.DelaunayEdges.Contains(Edge)) { NumMissing++; } }
+	TestEqual(TEXT("Every constraint piece is an edge"), NumMissing, 0);
+
+	int32 NumCrossing = 0;
+	for (const uint64 Edge : Delaunay.DelaunayEdges)
+	{
+		for (const uint64 Constraint : Constraints)
+		{
+			if (PCGExConstrainedDelaunayTestsLocal::Crosses(
+				Positions[PCGEx::H64A(Edge)], Positions[PCGEx::H64B(Edge)],
+				Positions[PCGEx::H64A(Constraint)], Positions[PCGEx::H64B(Constraint)])) { NumCrossing++; }
+		}
+	}
+
+	TestEqual(TEXT("No edge crosses a constraint"), NumCrossing, 0);
+
+	// Same point set, same number of triangles and same hull
+	FTestDelaunay2 Plain;
+	Plain.Process(Positions);
+	TestEqual(TEXT("Same site count"), Delaunay.Sites.Num(), Plain.Sites.Num());
+	TestEqual(TEXT("Same edge count"), Delaunay.DelaunayEdges.Num(), Plain.DelaunayEdges.Num());
+	TestTrue(TEXT("Same hull"), Delaunay.DelaunayHull.Num() == Plain.DelaunayHull.Num() && Delaunay.DelaunayHull.Includes(Plain.DelaunayHull));
+
+	// Without constraints it is Process
+	FTestDelaunay2 Unconstrained;
+	Unconstrained.ProcessConstrained(Positions, {});
+	TestTrue(TEXT("No constraints: same edges as Process"),
+		Unconstrained.DelaunayEdges.Num() == Plain.DelaunayEdges.Num() && Unconstrained.DelaunayEdges.Includes(Plain.DelaunayEdges));
+
+	// Flat output holds the same triangulation
+	FTestDelaunay2 Flat;
+	Flat.bFlatOutput = true;
+	Flat.ProcessConstrained(Positions, Constraints);
+	TestEqual(TEXT("Flat: same site count"), Flat.Flat.NumSites(), Delaunay.Sites.Num());
+	TestEqual(TEXT("Flat: same edge count"), Flat.Flat.Edges.Num(), Delaunay.DelaunayEdges.Num());
+
+	// Projected inputs, flat on XY
+	TArray<FVector> Positions3;
+	for (const FVector2D& P : Positions) { Positions3.Emplace(P.X, P.Y, 0); }
+
+	FPCGExGeo2DProjectionDetails Projection;
+	FTestDelaunay2 Projected;
+	TestTrue(TEXT("Projected processed"), Projected.ProcessConstrained(MakeArrayView(Positions3), Constraints, Projection));
+	TestEqual(TEXT("Projected: same constraints"), Projected.ConstrainedEdges.Num(), Delaunay.ConstrainedEdges.Num());
+	TestEqual(TEXT("Projected: same site count"), Projected.Sites.Num(), Delaunay.Sites.Num());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExConstrainedDelaunay2InteriorTest,
+	"PCGEx.Unit.Delaunay.Constrained2.Interior",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExConstrainedDelaunay2InteriorTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// Square with a square hole, inside a larger random cloud
+	TArray<FVector2D> Positions;
+	TArray<uint64> Constraints;
+	PCGExConstrainedDelaunayTestsLocal::AddLoop(FVector2D(0, 0), FVector2D(1000, 1000), 10, Positions, Constraints);
+	PCGExConstrainedDelaunayTestsLocal::AddLoop(FVector2D(400, 400), FVector2D(600, 600), 3, Positions, Constraints);
+
+	FRandomStream Random(32);
+	for (int32 i = 0; i < 2000; i++) { Positions.Emplace(Random.FRandRange(-300, 1300), Random.FRandRange(-300, 1300)); }
+
+	FTestDelaunay2 Delaunay;
+	TestTrue(TEXT("Processed"), Delaunay.ProcessConstrained(Positions, Constraints, true));
+	TestEqual(TEXT("Nothing skipped"), Delaunay.SkippedConstraints.Num(), 0);
+
+	FString Error;
+	const bool bValid = Delaunay.Validate(&Error, true);
+	TestTrue(FString::Printf(TEXT("Valid and locally Delaunay (%s)"), *Error), bValid);
+
+	double Area = 0;
+	int32 NumOutside = 0;
+	for (const PCGExMath::Geo::FDelaunaySite2& Site : Delaunay.Sites)
+	{
+		const FVector2D& A = Positions[Site.Vtx[0]];
+		const FVector2D& B = Positions[Site.Vtx[1]];
+		const FVector2D& C = Positions[Site.Vtx[2]];
+		Area += FVector2D::CrossProduct(B - A, C - A) * 0.5;
+
+		const FVector2D Centroid = (A + B + C) / 3;
+		const bool bInOuter = Centroid.X > 0 && Centroid.X < 1000 && Centroid.Y > 0 && Centroid.Y < 1000;
+		const bool bInHole = Centroid.X > 400 && Centroid.X < 600 && Centroid.Y > 400 && Centroid.Y < 600;
+		if (!bInOuter || bInHole) { NumOutside++; }
+	}
+
+	TestEqual(TEXT("Every site is inside the loops"), NumOutside, 0);
+	TestTrue(TEXT("Sites cover the square minus the hole"), FMath::IsNearlyEqual(Area, 1000.0 * 1000.0 - 200.0 * 200.0, 1e-3));
+
+	// The boundary is the two loops
+	TestEqual(TEXT("Hull is both loops"), Delaunay.DelaunayHull.Num(), 40 + 12);
+
+	int32 NumBoundary = 0;
+	for (const PCGExMath::Geo::FDelaunaySite2& Site : Delaunay.Sites)
+	{
+		for (int32 k = 0; k < 3; k++)
+		{
+			if (Site.Neighbors[k] != -1) { continue; }
+			NumBoundary++;
+			TestTrue(TEXT("Boundary edges are constraints"), Delaunay.ConstrainedEdges.Contains(PCGEx::H64U(Site.Vtx[k], Site.Vtx[(k + 1) % 3])));
+		}
+	}
+
+	TestEqual(TEXT("Every constraint bounds the output"), NumBoundary, Constraints.Num());
+
+	FTestDelaunay2 Flat;
+	Flat.bFlatOutput = true;
+	Flat.ProcessConstrained(Positions, Constraints, true);
+	TestEqual(TEXT("Flat: same site count"), Flat.Flat.NumSites(), Delaunay.Sites.Num());
+	TestEqual(TEXT("Flat: same hull"), Flat.Flat.Hull.Num(), Delaunay.DelaunayHull.Num());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExConstrainedDelaunay2DegenerateTest,
+	"PCGEx.Unit.Delaunay.Constrained2.Degenerate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExConstrainedDelaunay2DegenerateTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// Grid: cocircular everywhere, diagonals through vertices
+	TArray<FVector2D> Positions;
+	for (int32 x = 0; x < 20; x++) { for (int32 y = 0; y < 20; y++) { Positions.Emplace(x * 10, y * 10); } }
+
+	auto Index = [](const int32 X, const int32 Y) { return X * 20 + Y; };
+
+	const int32 Duplicate = Positions.Add(Positions[Index(19, 0)]);
+
+	const TArray<uint64> Constraints = {
+		PCGEx::H64U(Index(0, 0), Index(19, 19)),  // Main diagonal, through 18 vertices
+		PCGEx::H64U(Index(0, 19), Index(19, 0)),  // Crosses it between vertices
+		PCGEx::H64U(Index(5, 0), Index(5, 19)),   // Along existing edges
+		PCGEx::H64U(Index(0, 0), Index(2, 1)),    // Shares an endpoint only
+		PCGEx::H64U(Duplicate, Index(18, 3)),     // From a duplicate position
+		PCGEx::H64U(Index(3, 3), Index(3, 3)),    // Zero length
+		PCGEx::H64U(Index(1, 1), 100000)          // Out of range
+	};
+
+	FTestDelaunay2 Delaunay;
+	TestTrue(TEXT("Processed"), Delaunay.ProcessConstrained(Positions, Constraints));
+
+	FString Error;
+	const bool bValid = Delaunay.Validate(&Error, true);
+	TestTrue(FString::Printf(TEXT("Valid and locally Delaunay (%s)"), *Error), bValid);
+
+	TestEqual(TEXT("Crossing, zero length and out of range skipped"), Delaunay.SkippedConstraints.Num(), 3);
+	TestTrue(TEXT("Crossing constraint skipped"), Delaunay.SkippedConstraints.Contains(Constraints[1]));
+
+	for (int32 i = 0; i < 19; i++)
+	{
+		const uint64 Piece = PCGEx::H64U(Index(i, i), Index(i + 1, i + 1));
+		TestTrue(FString::Printf(TEXT("Diagonal piece %d kept"), i), Delaunay.ConstrainedEdges.Contains(Piece) && Delaunay.DelaunayEdges.Contains(Piece));
+	}
+
+	TestTrue(TEXT("Duplicate endpoint uses the connected copy"), Delaunay.ConstrainedEdges.Contains(PCGEx::H64U(Index(19, 0), Index(18, 3))));
+	TestTrue(TEXT("Endpoint-sharing constraint kept"), Delaunay.DelaunayEdges.Contains(Constraints[3]));
+
+	// Local updates would break the constraints
+	TestEqual(TEXT("No local insert"), Delaunay.InsertPoint(FVector2D(55.5, 55.5)), INDEX_NONE);
+	TestFalse(TEXT("No local removal"), Delaunay.RemovePoint(Index(10, 10)));
+
+	// Degenerate points
+	FTestDelaunay2 Collinear;
+	TestFalse(TEXT("Collinear points fail"), Collinear.ProcessConstrained({FVector2D(0, 0), FVector2D(1, 1), FVector2D(2, 2)}, {PCGEx::H64U(0, 2)}));
+	TestFalse(TEXT("Left unconstrained"), Collinear.IsConstrained());
+
+	// Process after ProcessConstrained is a plain triangulation again
+	Delaunay.Process(Positions);
+	TestFalse(TEXT("Reprocessed: unconstrained"), Delaunay.IsConstrained());
+	TestEqual(TEXT("Reprocessed: no constraints"), Delaunay.ConstrainedEdges.Num(), 0);
+
+	return true;
+}
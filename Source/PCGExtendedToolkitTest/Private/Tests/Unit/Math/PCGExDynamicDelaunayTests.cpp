@@ -0,0 +1,287 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "Algo/BinarySearch.h"
+#include "Math/Geo/PCGExDelaunay.h"
+#include "Helpers/PCGExDelaunayTestHelpers.h"
+#include "PCGExH.h"
+
+/**
+ * Dynamic Delaunay 2D Tests
+ *
+ * Verifies local point insertion and removal on a processed triangulation: the patched Sites,
+ * DelaunayEdges and DelaunayHull match a fresh Process over the same points, the update report
+ * covers every changed site and edge, and hull, duplicate and degenerate removals are handled.
+ *
+ * Test naming convention: PCGEx.Unit.Delaunay.Dynamic2.<Case>
+ */
+
+namespace PCGExDynamicDelaunayTestsLocal
+{
+	FIntVector SortedTriple(const int32 A, const int32 B, const int32 C)
+	{
+		int32 V[3] = {A, B, C};
+		if (V[0] > V[1]) { Swap(V[0], V[1]); }
+		if (V[1] > V[2]) { Swap(V[1], V[2]); }
+		if (V[0] > V[1]) { Swap(V[0], V[1]); }
+		return FIntVector(V[0], V[1], V[2]);
+	}
+
+	/** Process the connected points from scratch and compare, mapping the fresh indices back */
+	bool MatchesProcess(const PCGExTest::FTestDelaunay2& Delaunay, const TArray<int32>& Connected, FString& OutError)
+	{
+		TArray<FVector2D> Positions;
+		for (const int32 Vertex : Connected) { Positions.Add(Delaunay.GetVertices()[Vertex]); }
+
+		PCGExTest::FTestDelaunay2 Fresh;
+		if (!Fresh.Process(Positions))
+		{
+			OutError = TEXT("Fresh Process failed");
+			return false;
+		}
+
+		TSet<FIntVector> Expected;
+		for (const PCGExMath::Geo::FDelaunaySite2& Site : Fresh.Sites) { Expected.Add(SortedTriple(Connected[Site.Vtx[0]], Connected[Site.Vtx[1]], Connected[Site.Vtx[2]])); }
+
+		TSet<FIntVector> Actual;
+		for (const PCGExMath::Geo::FDelaunaySite2& Site : Delaunay.Sites) { Actual.Add(SortedTriple(Site.Vtx[0], Site.Vtx[1], Site.Vtx[2])); }
+
+		if (Actual.Num() != Delaunay.Sites.Num() || Actual.Num() != Expected.Num() || !Actual.Includes(Expected))
+		{
+			OutError = FString::Printf(TEXT("Sites differ: %d vs %d"), Delaunay.Sites.Num(), Fresh.Sites.Num());
+			return false;
+		}
+
+		TSet<uint64> ExpectedEdges;
+		for (const uint64 Edge : Fresh.DelaunayEdges) { ExpectedEdges.Add(PCGEx::H64U(Connected[PCGEx::H64A(Edge)], Connected[PCGEx::H64B(Edge)])); }
+
+		if (ExpectedEdges.Num() != Delaunay.DelaunayEdges.Num() || !ExpectedEdges.Includes(Delaunay.DelaunayEdges))
+		{
+			OutError = FString::Printf(TEXT("Edges differ: %d vs %d"), Delaunay.DelaunayEdges.Num(), Fresh.DelaunayEdges.Num());
+			return false;
+		}
+
+		TSet<int32> ExpectedHull;
+		for (const int32 Vertex : Fresh.DelaunayHull) { ExpectedHull.Add(Connected[Vertex]); }
+
+		if (ExpectedHull.Num() != Delaunay.DelaunayHull.Num() || !ExpectedHull.Includes(Delaunay.DelaunayHull))
+		{
+			OutError = FString::Printf(TEXT("Hull differs: %d vs %d"), Delaunay.DelaunayHull.Num(), Fresh.DelaunayHull.Num());
+			return false;
+		}
+
+		// Ids are compact and neighbors point at the site across each edge
+		for (int32 i = 0; i < Delaunay.Sites.Num(); i++)
+		{
+			const PCGExMath::Geo::FDelaunaySite2& Site = Delaunay.Sites[i];
+			if (Site.Id != i)
+			{
+				OutError = FString::Printf(TEXT("Site %d has Id %d"), i, Site.Id);
+				return false;
+			}
+
+			for (int32 k = 0; k < 3; k++)
+			{
+				const int32 Neighbor = Site.Neighbors[k];
+				if (Neighbor != INDEX_NONE && !Delaunay.Sites[Neighbor].ContainsEdge(PCGEx::H64U(Site.Vtx[k], Site.Vtx[(k + 1) % 3])))
+				{
+					OutError = FString::Printf(TEXT("Site %d neighbor %d doesn't share its edge"), i, Neighbor);
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExDynamicDelaunay2MatchesProcessTest,
+	"PCGEx.Unit.Delaunay.Dynamic2.MatchesProcess",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExDynamicDelaunay2MatchesProcessTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	FRandomStream Random(11);
+
+	TArray<FVector2D> Positions;
+	for (int32 i = 0; i < 500; i++) { Positions.Emplace(Random.FRandRange(0, 1000), Random.FRandRange(0, 1000)); }
+
+	FTestDelaunay2 Delaunay;
+	TestTrue(TEXT("Processed"), Delaunay.Process(Positions));
+
+	TArray<int32> Connected;
+	for (int32 i = 0; i < Positions.Num(); i++) { Connected.Add(i); }
+
+	// Inserts reach past the bounds so the hull grows, removals pick hull vertices now and then so it shrinks
+	for (int32 Step = 0; Step < 300; Step++)
+	{
+		if (Random.FRand() < 0.5)
+		{
+			const int32 Vertex = Delaunay.InsertPoint(FVector2D(Random.FRandRange(-100, 1100), Random.FRandRange(-100, 1100)));
+			TestEqual(FString::Printf(TEXT("Step %d: new vertex index"), Step), Vertex, Delaunay.GetVertices().Num() - 1);
+			Connected.Add(Vertex);
+		}
+		else
+		{
+			int32 Index = Random.RandRange(0, Connected.Num() - 1);
+			if (Step % 4 == 0) { Index = Connected.IndexOfByPredicate([&](const int32 Vertex) { return Delaunay.DelaunayHull.Contains(Vertex); }); }
+
+			TestTrue(FString::Printf(TEXT("Step %d: removed %d"), Step, Connected[Index]), Delaunay.RemovePoint(Connected[Index]));
+			Connected.RemoveAt(Index);
+		}
+
+		if (Step % 25 != 24) { continue; }
+
+		FString Error;
+		const bool bValid = Delaunay.Validate(&Error, true);
+		TestTrue(FString::Printf(TEXT("Step %d: valid (%s)"), Step, *Error), bValid);
+
+		const bool bMatches = PCGExDynamicDelaunayTestsLocal::MatchesProcess(Delaunay, Connected, Error);
+		TestTrue(FString::Printf(TEXT("Step %d: matches Process (%s)"), Step, *Error), bMatches);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExDynamicDelaunay2UpdateReportTest,
+	"PCGEx.Unit.Delaunay.Dynamic2.UpdateReport",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExDynamicDelaunay2UpdateReportTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	FRandomStream Random(5);
+
+	TArray<FVector2D> Positions;
+	for (int32 i = 0; i < 2000; i++) { Positions.Emplace(Random.FRandRange(0, 1000), Random.FRandRange(0, 1000)); }
+
+	FTestDelaunay2 Delaunay;
+	TestTrue(TEXT("Processed"), Delaunay.Process(Positions));
+
+	int32 MaxDirty = 0;
+	for (int32 Step = 0; Step < 200; Step++)
+	{
+		const TArray<PCGExMath::Geo::FDelaunaySite2> Before = Delaunay.Sites;
+		const TSet<uint64> EdgesBefore = Delaunay.DelaunayEdges;
+
+		FTestDelaunay2::FUpdate Update;
+		if (Step % 2 == 0) { TestTrue(TEXT("Inserted"), Delaunay.InsertPoint(FVector2D(Random.FRandRange(0, 1000), Random.FRandRange(0, 1000)), &Update) != INDEX_NONE); }
+		else { TestTrue(TEXT("Removed"), Delaunay.RemovePoint(Step * 7, &Update)); }
+
+		TestEqual(TEXT("Previous site count"), Update.PreviousNumSites, Before.Num());
+		MaxDirty = FMath::Max(MaxDirty, Update.DirtySites.Num());
+
+		// Every site that differs from before is reported
+		for (int32 i = 0; i < Delaunay.Sites.Num(); i++)
+		{
+			const PCGExMath::Geo::FDelaunaySite2& Site = Delaunay.Sites[i];
+			bool bSame = Before.IsValidIndex(i);
+			for (int32 k = 0; bSame && k < 3; k++) { bSame = Before[i].Vtx[k] == Site.Vtx[k] && Before[i].Neighbors[k] == Site.Neighbors[k]; }
+
+			if (!bSame && Algo::BinarySearch(Update.DirtySites, i) == INDEX_NONE)
+			{
+				AddError(FString::Printf(TEXT("Step %d: site %d changed but is not dirty"), Step, i));
+			}
+		}
+
+		TSet<uint64> Added;
+		TSet<uint64> Removed;
+		for (const uint64 Edge : Delaunay.DelaunayEdges) { if (!EdgesBefore.Contains(Edge)) { Added.Add(Edge); } }
+		for (const uint64 Edge : EdgesBefore) { if (!Delaunay.DelaunayEdges.Contains(Edge)) { Removed.Add(Edge); } }
+
+		TSet<uint64> ReportedAdded;
+		TSet<uint64> ReportedRemoved;
+		ReportedAdded.Append(Update.AddedEdges);
+		ReportedRemoved.Append(Update.RemovedEdges);
+
+		TestTrue(FString::Printf(TEXT("Step %d: added edges reported"), Step), Added.Num() == ReportedAdded.Num() && Added.Includes(ReportedAdded));
+		TestTrue(FString::Printf(TEXT("Step %d: removed edges reported"), Step), Removed.Num() == ReportedRemoved.Num() && Removed.Includes(ReportedRemoved));
+	}
+
+	// Local: a handful of sites, not a fraction of the triangulation
+	TestTrue(FString::Printf(TEXT("Dirty sites stay local (%d)"), MaxDirty), MaxDirty < 60);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExDynamicDelaunay2DegenerateTest,
+	"PCGEx.Unit.Delaunay.Dynamic2.Degenerate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExDynamicDelaunay2DegenerateTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// Nothing processed yet
+	{
+		FTestDelaunay2 Delaunay;
+		TestEqual(TEXT("Insert needs a triangulation"), Delaunay.InsertPoint(FVector2D(0, 0)), INDEX_NONE);
+		TestFalse(TEXT("Remove needs a triangulation"), Delaunay.RemovePoint(0));
+	}
+
+	// Duplicates, removed vertices and the last triangle
+	{
+		TArray<FVector2D> Positions = {FVector2D(0, 0), FVector2D(2, 0), FVector2D(4, 0), FVector2D(2, 3), FVector2D(2, 3)};
+
+		FTestDelaunay2 Delaunay;
+		TestTrue(TEXT("Processed"), Delaunay.Process(Positions));
+		TestEqual(TEXT("Existing position not inserted"), Delaunay.InsertPoint(FVector2D(2, 0)), INDEX_NONE);
+		TestFalse(TEXT("Duplicate is not connected"), Delaunay.RemovePoint(4));
+
+		TestFalse(TEXT("Apex kept, the rest is collinear"), Delaunay.RemovePoint(3));
+		TestTrue(TEXT("Collinear hull vertex removed"), Delaunay.RemovePoint(0));
+		TestFalse(TEXT("Removed vertex can't be removed again"), Delaunay.RemovePoint(0));
+		TestEqual(TEXT("One triangle left"), Delaunay.Sites.Num(), 1);
+		TestEqual(TEXT("Three hull vertices left"), Delaunay.DelaunayHull.Num(), 3);
+		TestFalse(TEXT("Last triangle kept"), Delaunay.RemovePoint(1));
+
+		TestEqual(TEXT("Position is free again"), Delaunay.InsertPoint(FVector2D(0, 0)), 5);
+		TestTrue(TEXT("Valid after edits"), Delaunay.Validate(nullptr, true));
+	}
+
+	// Grid: cocircular everywhere, so every removal relies on the exact ear tests
+	{
+		constexpr int32 Size = 20;
+
+		TArray<FVector2D> Positions;
+		for (int32 x = 0; x < Size; x++) { for (int32 y = 0; y < Size; y++) { Positions.Emplace(x * 10, y * 10); } }
+
+		FTestDelaunay2 Delaunay;
+		TestTrue(TEXT("Grid processed"), Delaunay.Process(Positions));
+
+		FRandomStream Random(2);
+		TArray<int32> Connected;
+		for (int32 i = 0; i < Positions.Num(); i++) { Connected.Add(i); }
+
+		for (int32 Step = 0; Step < 300; Step++)
+		{
+			if (Step % 3 == 2)
+			{
+				const int32 Vertex = Delaunay.InsertPoint(FVector2D(Random.RandRange(0, Size - 1) * 10 + 5, Random.RandRange(0, Size - 1) * 10 + 5));
+				if (Vertex != INDEX_NONE) { Connected.Add(Vertex); }
+				continue;
+			}
+
+			const int32 Index = Random.RandRange(0, Connected.Num() - 1);
+			TestTrue(FString::Printf(TEXT("Grid step %d: removed"), Step), Delaunay.RemovePoint(Connected[Index]));
+			Connected.RemoveAt(Index);
+		}
+
+		FString Error;
+		const bool bValid = Delaunay.Validate(&Error, true);
+		TestTrue(FString::Printf(TEXT("Grid: valid (%s)"), *Error), bValid);
+
+		const int32 H = Delaunay.DelaunayHull.Num();
+		TestEqual(TEXT("Grid: triangle count"), Delaunay.Sites.Num(), 2 * Connected.Num() - H - 2);
+		TestEqual(TEXT("Grid: edge count"), Delaunay.DelaunayEdges.Num(), 3 * Connected.Num() - H - 3);
+	}
+
+	return true;
+}
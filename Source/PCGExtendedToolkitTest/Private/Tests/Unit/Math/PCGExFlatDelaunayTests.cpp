@@ -0,0 +1,222 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "Helpers/PCGExDelaunayTestHelpers.h"
+#include "Helpers/PCGExCompactEdgeHelpers.h"
+#include "Helpers/PCGExEdgeDedupHelpers.h"
+#include "PCGExH.h"
+
+/**
+ * Flat Delaunay Output Tests
+ *
+ * Verifies the bFlatOutput mode of FTestDelaunay2/FTestDelaunay3: the flat site, neighbor, edge
+ * and hull arrays hold the same triangulation as Sites, DelaunayEdges and DelaunayHull, and the
+ * flat edges become cluster edges and links without conversion.
+ *
+ * Test naming convention: PCGEx.Unit.Delaunay.Flat.<Case>
+ */
+
+namespace PCGExFlatDelaunayTestsLocal
+{
+	bool SameEdges(const TArray<uint64>& Flat, const TSet<uint64>& Edges)
+	{
+		if (Flat.Num() != Edges.Num()) { return false; }
+		for (int32 i = 0; i < Flat.Num(); i++)
+		{
+			if (!Edges.Contains(Flat[i]) || (i > 0 && Flat[i - 1] >= Flat[i])) { return false; }
+		}
+		return true;
+	}
+
+	bool SameHull(const TArray<int32>& Flat, const TSet<int32>& Hull)
+	{
+		if (Flat.Num() != Hull.Num()) { return false; }
+		for (int32 i = 0; i < Flat.Num(); i++)
+		{
+			if (!Hull.Contains(Flat[i]) || (i > 0 && Flat[i - 1] >= Flat[i])) { return false; }
+		}
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExFlatDelaunay2MatchesTest,
+	"PCGEx.Unit.Delaunay.Flat.Matches2",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExFlatDelaunay2MatchesTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	FRandomStream Random(21);
+
+	TArray<FVector2D> Positions;
+	for (int32 i = 0; i < 3000; i++) { Positions.Emplace(Random.FRandRange(0, 1000), Random.FRandRange(0, 1000)); }
+	Positions.Add(Positions[7]);
+
+	// Grid: cocircular quads everywhere
+	TArray<FVector2D> Grid;
+	for (int32 x = 0; x < 30; x++) { for (int32 y = 0; y < 30; y++) { Grid.Emplace(x * 10, y * 10); } }
+
+	for (const TArray<FVector2D>* Input : {&Positions, &Grid})
+	{
+		const TCHAR* Name = Input == &Positions ? TEXT("Random") : TEXT("Grid");
+
+		FTestDelaunay2 Default;
+		TestTrue(FString::Printf(TEXT("%s: default processed"), Name), Default.Process(*Input));
+
+		FTestDelaunay2 Flat;
+		Flat.bFlatOutput = true;
+		TestTrue(FString::Printf(TEXT("%s: flat processed"), Name), Flat.Process(*Input));
+
+		TestEqual(FString::Printf(TEXT("%s: no sites"), Name), Flat.Sites.Num(), 0);
+		TestEqual(FString::Printf(TEXT("%s: no edge set"), Name), Flat.DelaunayEdges.Num(), 0);
+		TestEqual(FString::Printf(TEXT("%s: no hull set"), Name), Flat.DelaunayHull.Num(), 0);
+
+		const FTestFlatDelaunay2& Output = Flat.Flat;
+		TestEqual(FString::Printf(TEXT("%s: site count"), Name), Output.NumSites(), Default.Sites.Num());
+		TestEqual(FString::Printf(TEXT("%s: neighbor count"), Name), Output.SiteNeighbors.Num(), Output.SiteVtx.Num());
+
+		// Same sites in the same order
+		int32 NumMismatches = 0;
+		for (int32 s = 0; s < FMath::Min(Output.NumSites(), Default.Sites.Num()); s++)
+		{
+			for (int32 k = 0; k < 3; k++)
+			{
+				if (Output.SiteVtx[s * 3 + k] != Default.Sites[s].Vtx[k] || Output.SiteNeighbors[s * 3 + k] != Default.Sites[s].Neighbors[k]) { NumMismatches++; }
+			}
+		}
+
+		TestEqual(FString::Printf(TEXT("%s: same sites and neighbors"), Name), NumMismatches, 0);
+		TestTrue(FString::Printf(TEXT("%s: same edges, ascending"), Name), PCGExFlatDelaunayTestsLocal::SameEdges(Output.Edges, Default.DelaunayEdges));
+		TestTrue(FString::Printf(TEXT("%s: same hull, ascending"), Name), PCGExFlatDelaunayTestsLocal::SameHull(Output.Hull, Default.DelaunayHull));
+
+		// Local updates patch Sites, which the flat mode doesn't fill
+		TestEqual(FString::Printf(TEXT("%s: no local insert"), Name), Flat.InsertPoint(FVector2D(5.5, 5.5)), INDEX_NONE);
+	}
+
+	// Process resets the previous flat output
+	FTestDelaunay2 Reused;
+	Reused.bFlatOutput = true;
+	Reused.Process(Positions);
+	Reused.Process(Grid);
+	TestEqual(TEXT("Reprocessed: grid sites only"), Reused.Flat.NumSites(), 2 * 29 * 29);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExFlatDelaunay3MatchesTest,
+	"PCGEx.Unit.Delaunay.Flat.Matches3",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExFlatDelaunay3MatchesTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	FRandomStream Random(22);
+
+	TArray<FVector> Positions;
+	for (int32 i = 0; i < 8000; i++) { Positions.Emplace(Random.FRandRange(0, 1000), Random.FRandRange(0, 1000), Random.FRandRange(0, 1000)); }
+
+	for (const bool bParallel : {false, true})
+	{
+		const TCHAR* Mode = bParallel ? TEXT("Parallel") : TEXT("Sequential");
+
+		FTestDelaunay3 Default;
+		FTestDelaunay3 Flat;
+		Flat.bFlatOutput = true;
+
+		TestTrue(FString::Printf(TEXT("%s: default processed"), Mode), bParallel ? Default.ProcessParallel(Positions, 4) : Default.Process(Positions));
+		TestTrue(FString::Printf(TEXT("%s: flat processed"), Mode), bParallel ? Flat.ProcessParallel(Positions, 4) : Flat.Process(Positions));
+
+		TestEqual(FString::Printf(TEXT("%s: no sites"), Mode), Flat.Sites.Num(), 0);
+
+		const FTestFlatDelaunay3& Output = Flat.Flat;
+		TestEqual(FString::Printf(TEXT("%s: site count"), Mode), Output.NumSites(), Default.Sites.Num());
+
+		TSet<FIntVector4> Expected;
+		for (const PCGExMath::Geo::FDelaunaySite3& Site : Default.Sites) { Expected.Add(FIntVector4(Site.Vtx[0], Site.Vtx[1], Site.Vtx[2], Site.Vtx[3])); }
+
+		int32 NumMismatches = 0;
+		for (int32 s = 0; s < Output.NumSites(); s++)
+		{
+			const int32* Vtx = Output.SiteVtx.GetData() + s * 4;
+			const bool bSorted = Vtx[0] < Vtx[1] && Vtx[1] < Vtx[2] && Vtx[2] < Vtx[3];
+			if (!bSorted || !Expected.Contains(FIntVector4(Vtx[0], Vtx[1], Vtx[2], Vtx[3]))) { NumMismatches++; }
+		}
+
+		TestEqual(FString::Printf(TEXT("%s: same sorted sites"), Mode), NumMismatches, 0);
+		TestTrue(FString::Printf(TEXT("%s: same edges, ascending"), Mode), PCGExFlatDelaunayTestsLocal::SameEdges(Output.Edges, Default.DelaunayEdges));
+		TestTrue(FString::Printf(TEXT("%s: same hull, ascending"), Mode), PCGExFlatDelaunayTestsLocal::SameHull(Output.Hull, Default.DelaunayHull));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExFlatDelaunayClusterViewTest,
+	"PCGEx.Unit.Delaunay.Flat.ClusterView",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExFlatDelaunayClusterViewTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	FRandomStream Random(23);
+
+	TArray<FVector2D> Positions;
+	for (int32 i = 0; i < 2000; i++) { Positions.Emplace(Random.FRandRange(0, 1000), Random.FRandRange(0, 1000)); }
+
+	FTestDelaunay2 Delaunay;
+	Delaunay.bFlatOutput = true;
+	TestTrue(TEXT("Processed"), Delaunay.Process(Positions));
+
+	const TArray<uint64> Keys = Delaunay.Flat.Edges;
+
+	// Links straight from the flat edges
+	TArray<int32> Offsets;
+	TArray<PCGExGraphs::FLink> Links;
+	TestEdgeDedup::BuildAdjacency(Positions.Num(), Delaunay.Flat.Edges, Offsets, Links);
+	TestEqual(TEXT("Two links per edge"), Links.Num(), Keys.Num() * 2);
+
+	int32 NumBadLinks = 0;
+	for (int32 Node = 0; Node < Positions.Num(); Node++)
+	{
+		for (int32 i = Offsets[Node]; i < Offsets[Node + 1]; i++)
+		{
+			if (Keys[Links[i].Edge] != PCGEx::H64U(Node, Links[i].Node)) { NumBadLinks++; }
+		}
+	}
+
+	TestEqual(TEXT("Links point along their edge"), NumBadLinks, 0);
+
+	// The flat edges become the compact cluster edges by moving the array
+	const uint64* Data = Delaunay.Flat.Edges.GetData();
+
+	TCompactEdges<uint32> Edges;
+	TestTrue(TEXT("Edges taken over"), Edges.Build(MoveTemp(Delaunay.Flat.Edges), 0));
+	TestTrue(TEXT("No copy"), Edges.GetPackedEndpoints().GetData() == Data);
+	TestEqual(TEXT("Edge count"), Edges.Num(), Keys.Num());
+	TestEqual(TEXT("IO index"), Edges.GetIOIndex(), 0);
+	TestFalse(TEXT("Identity point indices"), Edges.HasPointIndices());
+
+	int32 NumBadEdges = 0;
+	for (int32 i = 0; i < Edges.Num(); i++)
+	{
+		const PCGExGraphs::FEdge Edge = Edges.Get(i);
+		if (Edge.Index != i || Edge.Start != PCGEx::H64A(Keys[i]) || Edge.End != PCGEx::H64B(Keys[i]) || Edge.Start >= Edge.End) { NumBadEdges++; }
+	}
+
+	TestEqual(TEXT("Endpoints from the keys, lowest first"), NumBadEdges, 0);
+
+	// uint16 indexing can't hold that many edges
+	TArray<uint32> TooMany;
+	TooMany.SetNumZeroed(70000);
+	TCompactEdges<uint16> Small;
+	TestFalse(TEXT("Too many edges for uint16"), Small.Build(MoveTemp(TooMany), 0));
+	TestEqual(TEXT("Left empty"), Small.Num(), 0);
+
+	return true;
+}
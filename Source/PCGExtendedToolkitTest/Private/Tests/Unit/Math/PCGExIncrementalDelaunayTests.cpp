@@ -0,0 +1,182 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "Math/Geo/PCGExDelaunay.h"
+#include "Math/PCGExProjectionDetails.h"
+#include "Helpers/PCGExDelaunayTestHelpers.h"
+
+/**
+ * Incremental Delaunay 2D Tests
+ *
+ * Verifies the Morton-ordered, walk-located incremental triangulator: identical output to
+ * TDelaunay2 on points in general position, Euler counts, empty circumcircles, half-edge
+ * consistency, and degenerate inputs (grids, collinear sets, duplicates).
+ *
+ * Test naming convention: PCGEx.Unit.Delaunay.Incremental2.<Case>
+ */
+
+namespace PCGExIncrementalDelaunayTestsLocal
+{
+	TArray<FVector> RandomPositions(const int32 NumPoints, const int32 Seed, const double Extent = 1000)
+	{
+		FRandomStream Random(Seed);
+		TArray<FVector> Positions;
+		Positions.Reserve(NumPoints);
+		for (int32 i = 0; i < NumPoints; i++) { Positions.Emplace(Random.FRandRange(0, Extent), Random.FRandRange(0, Extent), 0); }
+		return Positions;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExIncrementalDelaunay2MatchesTest,
+	"PCGEx.Unit.Delaunay.Incremental2.MatchesDelaunay2",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExIncrementalDelaunay2MatchesTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	FPCGExGeo2DProjectionDetails Projection;
+
+	for (const int32 NumPoints : {3, 4, 17, 250, 4000})
+	{
+		TArray<FVector> Positions = PCGExIncrementalDelaunayTestsLocal::RandomPositions(NumPoints, NumPoints);
+
+		PCGExMath::Geo::TDelaunay2 Reference;
+		FTestDelaunay2 Incremental;
+
+		TestTrue(FString::Printf(TEXT("%d: reference processed"), NumPoints), Reference.Process(MakeArrayView(Positions), Projection));
+		TestTrue(FString::Printf(TEXT("%d: incremental processed"), NumPoints), Incremental.Process(MakeArrayView(Positions), Projection));
+		TestTrue(FString::Printf(TEXT("%d: incremental is valid"), NumPoints), Incremental.IsValid);
+
+		TestEqual(FString::Printf(TEXT("%d: same site count"), NumPoints), Incremental.Sites.Num(), Reference.Sites.Num());
+		TestEqual(FString::Printf(TEXT("%d: same edge count"), NumPoints), Incremental.DelaunayEdges.Num(), Reference.DelaunayEdges.Num());
+		TestEqual(FString::Printf(TEXT("%d: same hull size"), NumPoints), Incremental.DelaunayHull.Num(), Reference.DelaunayHull.Num());
+
+		int32 MissingEdges = 0;
+		for (const uint64 Edge : Reference.DelaunayEdges) { if (!Incremental.DelaunayEdges.Contains(Edge)) { MissingEdges++; } }
+		TestEqual(FString::Printf(TEXT("%d: same edges"), NumPoints), MissingEdges, 0);
+
+		int32 MissingHull = 0;
+		for (const int32 Vertex : Reference.DelaunayHull) { if (!Incremental.DelaunayHull.Contains(Vertex)) { MissingHull++; } }
+		TestEqual(FString::Printf(TEXT("%d: same hull"), NumPoints), MissingHull, 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExIncrementalDelaunay2TopologyTest,
+	"PCGEx.Unit.Delaunay.Incremental2.Topology",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExIncrementalDelaunay2TopologyTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TArray<FVector> Positions = PCGExIncrementalDelaunayTestsLocal::RandomPositions(3000, 31);
+
+	FTestDelaunay2 Delaunay;
+	TestTrue(TEXT("Processed"), Delaunay.Process(MakeArrayView(Positions), FPCGExGeo2DProjectionDetails()));
+
+	FString Error;
+	TestTrue(FString::Printf(TEXT("Half-edge mesh and empty circles (%s)"), *Error), Delaunay.Validate(&Error, true));
+
+	// Euler: a triangulation of N points with H on the hull has 2N - H - 2 triangles and 3N - H - 3 edges
+	const int32 N = Positions.Num();
+	const int32 H = Delaunay.DelaunayHull.Num();
+	TestEqual(TEXT("Triangle count"), Delaunay.Sites.Num(), 2 * N - H - 2);
+	TestEqual(TEXT("Edge count"), Delaunay.DelaunayEdges.Num(), 3 * N - H - 3);
+
+	// Neighbors are symmetric and share the edge they are listed across
+	int32 Problems = 0;
+	int32 HullEdges = 0;
+	for (const PCGExMath::Geo::FDelaunaySite2& Site : Delaunay.Sites)
+	{
+		for (int32 k = 0; k < 3; k++)
+		{
+			const int32 Neighbor = Site.Neighbors[k];
+			if (Neighbor == -1)
+			{
+				HullEdges++;
+				continue;
+			}
+
+			const PCGExMath::Geo::FDelaunaySite2& Other = Delaunay.Sites[Neighbor];
+			if (Other.Neighbors[0] != Site.Id && Other.Neighbors[1] != Site.Id && Other.Neighbors[2] != Site.Id) { Problems++; }
+			if (!Other.ContainsEdge(PCGEx::H64U(Site.Vtx[k], Site.Vtx[(k + 1) % 3]))) { Problems++; }
+		}
+	}
+
+	TestEqual(TEXT("Neighbors are symmetric"), Problems, 0);
+	TestEqual(TEXT("One open edge per hull vertex"), HullEdges, H);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExIncrementalDelaunay2DegenerateTest,
+	"PCGEx.Unit.Delaunay.Incremental2.Degenerate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExIncrementalDelaunay2DegenerateTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// Too few points
+	{
+		FTestDelaunay2 Delaunay;
+		TArray<FVector2D> Positions = {FVector2D(0, 0), FVector2D(1, 0)};
+		TestFalse(TEXT("Two points fail"), Delaunay.Process(Positions));
+		TestFalse(TEXT("Two points are not valid"), Delaunay.IsValid);
+	}
+
+	// Collinear
+	{
+		FTestDelaunay2 Delaunay;
+		TArray<FVector2D> Positions;
+		for (int32 i = 0; i < 10; i++) { Positions.Emplace(i, i * 2); }
+		TestFalse(TEXT("Collinear points fail"), Delaunay.Process(Positions));
+
+		// One point off the line is enough
+		Positions.Emplace(3, 0);
+		TestTrue(TEXT("Collinear plus one succeeds"), Delaunay.Process(Positions));
+		TestEqual(TEXT("Fan of 9 triangles"), Delaunay.Sites.Num(), 9);
+		TestTrue(TEXT("Collinear plus one is valid"), Delaunay.Validate(nullptr, true));
+	}
+
+	// Grid: every cell is cocircular, and the hull has collinear runs
+	{
+		constexpr int32 Size = 40;
+
+		TArray<FVector2D> Positions;
+		for (int32 y = 0; y < Size; y++) { for (int32 x = 0; x < Size; x++) { Positions.Emplace(x * 10, y * 10); } }
+
+		FTestDelaunay2 Delaunay;
+		TestTrue(TEXT("Grid processed"), Delaunay.Process(Positions));
+
+		FString Error;
+		TestTrue(FString::Printf(TEXT("Grid is valid (%s)"), *Error), Delaunay.Validate(&Error, true));
+		TestEqual(TEXT("Grid: two triangles per cell"), Delaunay.Sites.Num(), 2 * (Size - 1) * (Size - 1));
+		TestEqual(TEXT("Grid: whole boundary is hull"), Delaunay.DelaunayHull.Num(), 4 * (Size - 1));
+	}
+
+	// Duplicates are connected once
+	{
+		TArray<FVector2D> Positions;
+		FRandomStream Random(5);
+		for (int32 i = 0; i < 500; i++) { Positions.Emplace(Random.FRandRange(0, 100), Random.FRandRange(0, 100)); }
+		for (int32 i = 0; i < 50; i++) { Positions.Add(Positions[i * 3]); }
+
+		FTestDelaunay2 Delaunay;
+		TestTrue(TEXT("Duplicates processed"), Delaunay.Process(Positions));
+		TestEqual(TEXT("Duplicates counted"), Delaunay.NumDuplicates(), 50);
+		TestTrue(TEXT("Duplicates are valid"), Delaunay.Validate(nullptr, true));
+
+		const int32 H = Delaunay.DelaunayHull.Num();
+		TestEqual(TEXT("Triangle count ignores duplicates"), Delaunay.Sites.Num(), 2 * 500 - H - 2);
+	}
+
+	return true;
+}
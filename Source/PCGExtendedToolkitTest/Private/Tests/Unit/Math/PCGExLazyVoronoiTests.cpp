@@ -0,0 +1,219 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "Helpers/PCGExVoronoiTestHelpers.h"
+#include "PCGExH.h"
+
+/**
+ * Lazy Voronoi Tests
+ *
+ * Verifies on-demand Voronoi cells against the eager ProcessAll output: cell vertices are the
+ * eager circumcenters, consecutive cell vertices are eager Voronoi edges and every edge is
+ * covered by all the cells around it, hull cells are open, and GetCellsInBounds returns exactly
+ * the connected points inside the box.
+ *
+ * Test naming convention: PCGEx.Unit.Voronoi.Lazy<Dim>.<Case>
+ */
+
+namespace PCGExLazyVoronoiTestsLocal
+{
+	TArray<FVector2D> RandomPositions2(const int32 NumPoints, const int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<FVector2D> Positions;
+		for (int32 i = 0; i < NumPoints; i++) { Positions.Emplace(Random.FRandRange(0, 1000), Random.FRandRange(0, 1000)); }
+		return Positions;
+	}
+
+	TArray<FVector> RandomPositions3(const int32 NumPoints, const int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<FVector> Positions;
+		for (int32 i = 0; i < NumPoints; i++) { Positions.Emplace(Random.FRandRange(0, 1000), Random.FRandRange(0, 1000), Random.FRandRange(0, 1000)); }
+		return Positions;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExLazyVoronoi2MatchesEagerTest,
+	"PCGEx.Unit.Voronoi.Lazy2.MatchesEager",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExLazyVoronoi2MatchesEagerTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	TArray<FVector2D> Positions = PCGExLazyVoronoiTestsLocal::RandomPositions2(2000, 3);
+	Positions.Add(Positions[10]);
+
+	FTestVoronoi2 Lazy;
+	TestTrue(TEXT("Lazy processed"), Lazy.Process(Positions));
+	TestEqual(TEXT("Lazy computes no circumcenters"), Lazy.Circumcenters.Num(), 0);
+	TestEqual(TEXT("Lazy computes no edges"), Lazy.VoronoiEdges.Num(), 0);
+
+	FTestVoronoi2 Eager;
+	TestTrue(TEXT("Eager processed"), Eager.ProcessAll(Positions));
+	TestEqual(TEXT("One circumcenter per site"), Eager.Circumcenters.Num(), Eager.Delaunay->Sites.Num());
+
+	int32 EdgeRefs = 0;
+	for (int32 Point = 0; Point < Positions.Num(); Point++)
+	{
+		FTestVoronoiCell2 Cell;
+		if (!Lazy.GetCell(Point, Cell))
+		{
+			TestEqual(TEXT("Only the duplicate has no cell"), Point, Positions.Num() - 1);
+			continue;
+		}
+
+		TestEqual(TEXT("Cell point"), Cell.Point, Point);
+		TestEqual(TEXT("Open on the hull only"), !Cell.bClosed, Lazy.Delaunay->DelaunayHull.Contains(Point));
+
+		const int32 NumSites = Cell.Sites.Num();
+		for (int32 i = 0; i < NumSites; i++)
+		{
+			const int32 Site = Cell.Sites[i];
+			const int32* Vtx = Lazy.Delaunay->Sites[Site].Vtx;
+			TestTrue(FString::Printf(TEXT("Point %d: site %d surrounds it"), Point, Site), Vtx[0] == Point || Vtx[1] == Point || Vtx[2] == Point);
+			TestTrue(FString::Printf(TEXT("Point %d: vertex %d is the eager circumcenter"), Point, i), Cell.Vertices[i].Equals(Eager.Circumcenters[Site]));
+
+			if (i == NumSites - 1 && !Cell.bClosed) { break; }
+
+			EdgeRefs++;
+			TestTrue(FString::Printf(TEXT("Point %d: edge %d is an eager edge"), Point, i), Eager.VoronoiEdges.Contains(PCGEx::H64U(Site, Cell.Sites[(i + 1) % NumSites])));
+		}
+	}
+
+	// Each Voronoi edge separates exactly two cells
+	TestEqual(TEXT("Every eager edge is in two cells"), EdgeRefs, Eager.VoronoiEdges.Num() * 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExLazyVoronoi2BoundsTest,
+	"PCGEx.Unit.Voronoi.Lazy2.Bounds",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExLazyVoronoi2BoundsTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	const TArray<FVector2D> Positions = PCGExLazyVoronoiTestsLocal::RandomPositions2(3000, 8);
+
+	FTestVoronoi2 Voronoi;
+	TestTrue(TEXT("Processed"), Voronoi.Process(Positions));
+
+	const FBox2D Bounds(FVector2D(200, 300), FVector2D(450, 500));
+
+	TSet<int32> Expected;
+	for (int32 i = 0; i < Positions.Num(); i++) { if (Bounds.IsInside(Positions[i])) { Expected.Add(i); } }
+
+	TArray<FTestVoronoiCell2> Cells;
+	TestEqual(TEXT("Returned count"), Voronoi.GetCellsInBounds(Bounds, Cells), Cells.Num());
+	TestEqual(TEXT("One cell per point inside"), Cells.Num(), Expected.Num());
+
+	for (const FTestVoronoiCell2& Cell : Cells)
+	{
+		TestTrue(FString::Printf(TEXT("Point %d is inside"), Cell.Point), Expected.Contains(Cell.Point));
+
+		FTestVoronoiCell2 Single;
+		Voronoi.GetCell(Cell.Point, Single);
+		TestTrue(FString::Printf(TEXT("Point %d: same as GetCell"), Cell.Point), Single.Sites == Cell.Sites && Single.bClosed == Cell.bClosed);
+	}
+
+	// Box away from every point
+	TestEqual(TEXT("Empty box"), Voronoi.GetCellsInBounds(FBox2D(FVector2D(2000, 2000), FVector2D(3000, 3000)), Cells), 0);
+
+	// Not processed
+	FTestVoronoi2 Empty;
+	FTestVoronoiCell2 Cell;
+	TestFalse(TEXT("No cell before Process"), Empty.GetCell(0, Cell));
+	TestEqual(TEXT("No cells before Process"), Empty.GetCellsInBounds(Bounds, Cells), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExLazyVoronoi3MatchesEagerTest,
+	"PCGEx.Unit.Voronoi.Lazy3.MatchesEager",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExLazyVoronoi3MatchesEagerTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	const TArray<FVector> Positions = PCGExLazyVoronoiTestsLocal::RandomPositions3(1500, 4);
+
+	for (const bool bParallel : {false, true})
+	{
+		const TCHAR* Mode = bParallel ? TEXT("Parallel") : TEXT("Sequential");
+
+		FTestVoronoi3 Lazy;
+		TestTrue(FString::Printf(TEXT("%s: lazy processed"), Mode), Lazy.Process(Positions, bParallel));
+		TestEqual(FString::Printf(TEXT("%s: lazy computes no circumspheres"), Mode), Lazy.Circumspheres.Num(), 0);
+
+		FTestVoronoi3 Eager;
+		TestTrue(FString::Printf(TEXT("%s: eager processed"), Mode), Eager.ProcessAll(Positions, bParallel));
+
+		int32 EdgeRefs = 0;
+		for (int32 Point = 0; Point < Positions.Num(); Point++)
+		{
+			FTestVoronoiCell3 Cell;
+			if (!TestTrue(FString::Printf(TEXT("%s: point %d has a cell"), Mode, Point), Lazy.GetCell(Point, Cell))) { continue; }
+
+			TestEqual(FString::Printf(TEXT("%s: point %d open on the hull only"), Mode, Point), !Cell.bClosed, Lazy.Delaunay->DelaunayHull.Contains(Point));
+
+			for (int32 i = 0; i < Cell.Sites.Num(); i++)
+			{
+				const int32 Site = Cell.Sites[i];
+				TestTrue(FString::Printf(TEXT("%s: point %d vertex %d is the eager circumsphere"), Mode, Point, i), Cell.Vertices[i].Equals(Eager.Circumspheres[Site].Center));
+			}
+
+			for (const uint64 Edge : Cell.Edges)
+			{
+				EdgeRefs++;
+				const uint64 Global = PCGEx::H64U(Cell.Sites[PCGEx::H64A(Edge)], Cell.Sites[PCGEx::H64B(Edge)]);
+				TestTrue(FString::Printf(TEXT("%s: point %d edge is an eager edge"), Mode, Point), Eager.VoronoiEdges.Contains(Global));
+			}
+		}
+
+		// A Voronoi edge is dual to a Delaunay face, shared by the cells of its three corners
+		TestEqual(FString::Printf(TEXT("%s: every eager edge is in three cells"), Mode), EdgeRefs, Eager.VoronoiEdges.Num() * 3);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExLazyVoronoi3BoundsTest,
+	"PCGEx.Unit.Voronoi.Lazy3.Bounds",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExLazyVoronoi3BoundsTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	const TArray<FVector> Positions = PCGExLazyVoronoiTestsLocal::RandomPositions3(2000, 6);
+
+	FTestVoronoi3 Voronoi;
+	TestTrue(TEXT("Processed"), Voronoi.Process(Positions));
+
+	const FBox Bounds(FVector(100, 200, 300), FVector(500, 600, 700));
+
+	TSet<int32> Expected;
+	for (int32 i = 0; i < Positions.Num(); i++) { if (Bounds.IsInside(Positions[i])) { Expected.Add(i); } }
+
+	TArray<FTestVoronoiCell3> Cells;
+	Voronoi.GetCellsInBounds(Bounds, Cells);
+	TestEqual(TEXT("One cell per point inside"), Cells.Num(), Expected.Num());
+
+	for (const FTestVoronoiCell3& Cell : Cells)
+	{
+		TestTrue(FString::Printf(TEXT("Point %d is inside"), Cell.Point), Expected.Contains(Cell.Point));
+		TestTrue(FString::Printf(TEXT("Point %d: vertices match sites"), Cell.Point), Cell.Vertices.Num() == Cell.Sites.Num());
+		if (Cell.bClosed) { TestTrue(FString::Printf(TEXT("Point %d: at least a tetrahedron's edges"), Cell.Point), Cell.Edges.Num() >= 6); }
+	}
+
+	return true;
+}
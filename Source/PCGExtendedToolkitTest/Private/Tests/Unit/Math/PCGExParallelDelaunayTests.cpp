@@ -0,0 +1,402 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "Math/Geo/PCGExDelaunay.h"
+#include "Helpers/PCGExDelaunayTestHelpers.h"
+#include "Helpers/PCGExPredicateHelpers.h"
+
+/**
+ * Parallel Delaunay 3D Tests
+ *
+ * Verifies the incremental 3D tetrahedralization (agreement with TDelaunay3, adjacency,
+ * orientation and empty circumspheres, degenerate grids) and the block-parallel mode, which
+ * must produce exactly the sequential sites, edges and hull. Parallel output keeps no mesh and is
+ * checked from its sites alone (shared faces, hull facets and volume, exact empty spheres).
+ *
+ * Test naming convention: PCGEx.Unit.Delaunay.Parallel3.<Case>
+ */
+
+namespace PCGExParallelDelaunayTestsLocal
+{
+	TArray<FVector> RandomPositions(const int32 NumPoints, const int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<FVector> Positions;
+		Positions.Reserve(NumPoints);
+		for (int32 i = 0; i < NumPoints; i++) { Positions.Emplace(Random.FRandRange(0, 1000), Random.FRandRange(0, 1000), Random.FRandRange(0, 1000)); }
+		return Positions;
+	}
+
+	/** Flattened gaussian clusters, plus exact copies of some points */
+	TArray<FVector> ClusteredPositions(const int32 NumClusters, const int32 PointsPerCluster, const int32 NumCopies, const int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<FVector> Positions;
+
+		for (int32 c = 0; c < NumClusters; c++)
+		{
+			const FVector Center(Random.FRandRange(0, 1000), Random.FRandRange(0, 1000), Random.FRandRange(0, 1000));
+			for (int32 i = 0; i < PointsPerCluster; i++)
+			{
+				Positions.Add(Center + FVector(Random.GetFraction() - 0.5, Random.GetFraction() - 0.5, (Random.GetFraction() - 0.5) * 0.2) * 100);
+			}
+		}
+
+		for (int32 i = 0; i < NumCopies; i++) { Positions.Add(Positions[i * 5]); }
+		return Positions;
+	}
+
+	/**
+	 * Two random slabs along X with a plane of points between them at the median X, plus exact copies
+	 * of plane points. The first kd split lands on the plane, so copies may end up in either block.
+	 */
+	TArray<FVector> SplitPlanePositions(const int32 NumPerSlab, const int32 NumOnPlane, const int32 NumCopies, const int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<FVector> Positions;
+
+		for (int32 i = 0; i < NumPerSlab; i++) { Positions.Emplace(Random.FRandRange(0, 990), Random.FRandRange(0, 1000), Random.FRandRange(0, 1000)); }
+		for (int32 i = 0; i < NumPerSlab; i++) { Positions.Emplace(Random.FRandRange(1010, 2000), Random.FRandRange(0, 1000), Random.FRandRange(0, 1000)); }
+		for (int32 i = 0; i < NumOnPlane; i++) { Positions.Emplace(1000, Random.FRandRange(0, 1000), Random.FRandRange(0, 1000)); }
+		for (int32 i = 0; i < NumCopies; i++) { Positions.Add(Positions[NumPerSlab * 2 + (i * 3) % NumOnPlane]); }
+
+		return Positions;
+	}
+
+	TArray<FIntVector4> SortedSites(const PCGExTest::FTestDelaunay3& Delaunay)
+	{
+		TArray<FIntVector4> Sites;
+		Sites.Reserve(Delaunay.Sites.Num());
+		for (const PCGExMath::Geo::FDelaunaySite3& Site : Delaunay.Sites) { Sites.Emplace(Site.Vtx[0], Site.Vtx[1], Site.Vtx[2], Site.Vtx[3]); }
+
+		Sites.Sort([](const FIntVector4& A, const FIntVector4& B)
+		{
+			if (A.X != B.X) { return A.X < B.X; }
+			if (A.Y != B.Y) { return A.Y < B.Y; }
+			if (A.Z != B.Z) { return A.Z < B.Z; }
+			return A.W < B.W;
+		});
+
+		return Sites;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExParallelDelaunay3MatchesDelaunay3Test,
+	"PCGEx.Unit.Delaunay.Parallel3.MatchesDelaunay3",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExParallelDelaunay3MatchesDelaunay3Test::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	for (const int32 NumPoints : {4, 9, 120, 800})
+	{
+		TArray<FVector> Positions = PCGExParallelDelaunayTestsLocal::RandomPositions(NumPoints, NumPoints);
+
+		PCGExMath::Geo::TDelaunay3 Reference;
+		FTestDelaunay3 Incremental;
+
+		TestTrue(FString::Printf(TEXT("%d: reference processed"), NumPoints), Reference.Process<false, true>(MakeArrayView(Positions)));
+		TestTrue(FString::Printf(TEXT("%d: incremental processed"), NumPoints), Incremental.Process(Positions));
+
+		TestEqual(FString::Printf(TEXT("%d: same site count"), NumPoints), Incremental.Sites.Num(), Reference.Sites.Num());
+		TestEqual(FString::Printf(TEXT("%d: same edge count"), NumPoints), Incremental.DelaunayEdges.Num(), Reference.DelaunayEdges.Num());
+
+		int32 MissingEdges = 0;
+		for (const uint64 Edge : Reference.DelaunayEdges) { if (!Incremental.DelaunayEdges.Contains(Edge)) { MissingEdges++; } }
+		TestEqual(FString::Printf(TEXT("%d: same edges"), NumPoints), MissingEdges, 0);
+
+		int32 MissingHull = 0;
+		for (const int32 Vertex : Reference.DelaunayHull) { if (!Incremental.DelaunayHull.Contains(Vertex)) { MissingHull++; } }
+		TestEqual(FString::Printf(TEXT("%d: same hull"), NumPoints), MissingHull, 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExParallelDelaunay3TopologyTest,
+	"PCGEx.Unit.Delaunay.Parallel3.Topology",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExParallelDelaunay3TopologyTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	{
+		TArray<FVector> Positions = PCGExParallelDelaunayTestsLocal::RandomPositions(1500, 12);
+
+		FTestDelaunay3 Delaunay;
+		TestTrue(TEXT("Processed"), Delaunay.Process(Positions));
+
+		FString Error;
+		TestTrue(FString::Printf(TEXT("Adjacency and empty spheres (%s)"), *Error), Delaunay.Validate(&Error, true));
+		TestTrue(FString::Printf(TEXT("Sites fill the hull (%s)"), *Error), Delaunay.ValidateSites(&Error, true));
+	}
+
+	// Grid: every cell is cospherical and the hull faces hold coplanar points
+	{
+		constexpr int32 Size = 6;
+
+		TArray<FVector> Positions;
+		for (int32 z = 0; z < Size; z++) { for (int32 y = 0; y < Size; y++) { for (int32 x = 0; x < Size; x++) { Positions.Emplace(x * 10, y * 10, z * 10); } } }
+
+		FTestDelaunay3 Delaunay;
+		TestTrue(TEXT("Grid processed"), Delaunay.Process(Positions));
+
+		FString Error;
+		TestTrue(FString::Printf(TEXT("Grid is valid (%s)"), *Error), Delaunay.Validate(&Error, true));
+		TestTrue(FString::Printf(TEXT("Grid sites are valid (%s)"), *Error), Delaunay.ValidateSites(&Error, true));
+		TestEqual(TEXT("Grid: six tetrahedra per cell"), Delaunay.Sites.Num(), 6 * (Size - 1) * (Size - 1) * (Size - 1));
+		TestEqual(TEXT("Grid: whole boundary is hull"), Delaunay.DelaunayHull.Num(), Size * Size * Size - (Size - 2) * (Size - 2) * (Size - 2));
+	}
+
+	// Degenerate inputs
+	{
+		FTestDelaunay3 Delaunay;
+
+		TArray<FVector> TooFew = {FVector(0, 0, 0), FVector(1, 0, 0), FVector(0, 1, 0)};
+		TestFalse(TEXT("Three points fail"), Delaunay.Process(TooFew));
+
+		TArray<FVector> Coplanar;
+		for (int32 i = 0; i < 50; i++) { Coplanar.Emplace(i % 7, i / 7, 0); }
+		TestFalse(TEXT("Coplanar points fail"), Delaunay.Process(Coplanar));
+		TestFalse(TEXT("Coplanar points are not valid"), Delaunay.IsValid);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExParallelDelaunay3ValidateSitesTest,
+	"PCGEx.Unit.Delaunay.Parallel3.ValidateSites",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExParallelDelaunay3ValidateSitesTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	const TArray<FVector> Positions = PCGExParallelDelaunayTestsLocal::RandomPositions(1500, 21);
+
+	FTestDelaunay3 Delaunay;
+	TestTrue(TEXT("Processed"), Delaunay.Process(Positions));
+
+	FString Error;
+	TestTrue(FString::Printf(TEXT("Valid as processed (%s)"), *Error), Delaunay.ValidateSites(&Error, true));
+
+	const TArray<PCGExMath::Geo::FDelaunaySite3> Original = Delaunay.Sites;
+
+	// A missing site leaves a hole whose faces aren't on the hull
+	Delaunay.Sites.RemoveAt(Delaunay.Sites.Num() / 2);
+	TestFalse(TEXT("Missing site is caught"), Delaunay.ValidateSites(&Error));
+
+	// A repeated site shares its faces three ways
+	Delaunay.Sites = Original;
+	Delaunay.Sites.Add(Delaunay.Sites[0]);
+	TestFalse(TEXT("Repeated site is caught"), Delaunay.ValidateSites(&Error));
+
+	// Retriangulate the pair around one interior face as three sites around the opposite edge: volume and
+	// faces stay consistent wherever the pair is convex, but the result is no longer Delaunay
+	Delaunay.Sites = Original;
+
+	TMap<FIntVector, int32> FaceSites;
+	int32 First = INDEX_NONE;
+	int32 Second = INDEX_NONE;
+
+	for (int32 s = 0; s < Delaunay.Sites.Num() && Second == INDEX_NONE; s++)
+	{
+		const int32* Vtx = Delaunay.Sites[s].Vtx;
+		for (int32 k = 0; k < 4 && Second == INDEX_NONE; k++)
+		{
+			const FIntVector Face(Vtx[k == 0 ? 1 : 0], Vtx[k <= 1 ? 2 : 1], Vtx[k <= 2 ? 3 : 2]);
+			if (const int32* Other = FaceSites.Find(Face))
+			{
+				int32 Apex[2];
+				for (int32 p = 0; p < 2; p++)
+				{
+					const int32* PairVtx = Delaunay.Sites[p == 0 ? *Other : s].Vtx;
+					for (int32 j = 0; j < 4; j++) { if (PairVtx[j] != Face.X && PairVtx[j] != Face.Y && PairVtx[j] != Face.Z) { Apex[p] = PairVtx[j]; } }
+				}
+
+				// The apex segment must cross the shared face for the flip to stay a valid tiling
+				const TConstArrayView<FVector> V = Delaunay.GetVertices();
+				const double S0 = TestPredicates::Orient3D(V[Apex[0]], V[Apex[1]], V[Face.X], V[Face.Y]);
+				const double S1 = TestPredicates::Orient3D(V[Apex[0]], V[Apex[1]], V[Face.Y], V[Face.Z]);
+				const double S2 = TestPredicates::Orient3D(V[Apex[0]], V[Apex[1]], V[Face.Z], V[Face.X]);
+				if ((S0 > 0 && S1 > 0 && S2 > 0) || (S0 < 0 && S1 < 0 && S2 < 0))
+				{
+					First = *Other;
+					Second = s;
+					Delaunay.Sites[First] = PCGExMath::Geo::FDelaunaySite3(FIntVector4(Apex[0], Apex[1], Face.X, Face.Y), First);
+					Delaunay.Sites[Second] = PCGExMath::Geo::FDelaunaySite3(FIntVector4(Apex[0], Apex[1], Face.Y, Face.Z), Second);
+					Delaunay.Sites.Emplace(FIntVector4(Apex[0], Apex[1], Face.Z, Face.X), Delaunay.Sites.Num());
+				}
+			}
+			else { FaceSites.Add(Face, s); }
+		}
+	}
+
+	TestTrue(TEXT("Found a flippable face"), Second != INDEX_NONE);
+	TestTrue(FString::Printf(TEXT("Flipped sites still tile the hull (%s)"), *Error), Delaunay.ValidateSites(&Error));
+	TestFalse(TEXT("Flipped sites aren't Delaunay"), Delaunay.ValidateSites(&Error, true));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExParallelDelaunay3MatchesSequentialTest,
+	"PCGEx.Unit.Delaunay.Parallel3.MatchesSequential",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExParallelDelaunay3MatchesSequentialTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	const TArray<FVector> Uniform = PCGExParallelDelaunayTestsLocal::RandomPositions(20000, 3);
+	const TArray<FVector> Clustered = PCGExParallelDelaunayTestsLocal::ClusteredPositions(8, 2500, 200, 5);
+
+	for (const TArray<FVector>* Positions : {&Uniform, &Clustered})
+	{
+		const TCHAR* Label = Positions == &Uniform ? TEXT("Uniform") : TEXT("Clustered");
+
+		FTestDelaunay3 Sequential;
+		TestTrue(FString::Printf(TEXT("%s: sequential processed"), Label), Sequential.Process(*Positions));
+
+		const TArray<FIntVector4> Expected = PCGExParallelDelaunayTestsLocal::SortedSites(Sequential);
+
+		for (const int32 NumBlocks : {2, 8, 16})
+		{
+			FTestDelaunay3 Parallel;
+			TestTrue(FString::Printf(TEXT("%s/%d: parallel processed"), Label, NumBlocks), Parallel.ProcessParallel(*Positions, NumBlocks));
+			TestTrue(FString::Printf(TEXT("%s/%d: border set is a subset"), Label, NumBlocks), Parallel.NumBorderPoints() > 0 && Parallel.NumBorderPoints() < Positions->Num());
+
+			TestTrue(FString::Printf(TEXT("%s/%d: same sites"), Label, NumBlocks), PCGExParallelDelaunayTestsLocal::SortedSites(Parallel) == Expected);
+			TestEqual(FString::Printf(TEXT("%s/%d: same edge count"), Label, NumBlocks), Parallel.DelaunayEdges.Num(), Sequential.DelaunayEdges.Num());
+
+			int32 MissingEdges = 0;
+			for (const uint64 Edge : Sequential.DelaunayEdges) { if (!Parallel.DelaunayEdges.Contains(Edge)) { MissingEdges++; } }
+			TestEqual(FString::Printf(TEXT("%s/%d: same edges"), Label, NumBlocks), MissingEdges, 0);
+
+			TestTrue(FString::Printf(TEXT("%s/%d: same hull"), Label, NumBlocks), Parallel.DelaunayHull.Num() == Sequential.DelaunayHull.Num() && Parallel.DelaunayHull.Includes(Sequential.DelaunayHull));
+			TestEqual(FString::Printf(TEXT("%s/%d: same duplicates"), Label, NumBlocks), Parallel.NumDuplicates(), Sequential.NumDuplicates());
+
+			FString Error;
+			const bool bValid = Parallel.ValidateSites(&Error, true);
+			TestTrue(FString::Printf(TEXT("%s/%d: valid (%s)"), Label, NumBlocks, *Error), bValid);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExParallelDelaunay3SplitPlaneCopiesTest,
+	"PCGEx.Unit.Delaunay.Parallel3.SplitPlaneCopies",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExParallelDelaunay3SplitPlaneCopiesTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	const TArray<FVector> Positions = PCGExParallelDelaunayTestsLocal::SplitPlanePositions(3000, 400, 100, 7);
+
+	FTestDelaunay3 Sequential;
+	TestTrue(TEXT("Sequential processed"), Sequential.Process(Positions));
+	TestEqual(TEXT("Sequential finds every copy"), Sequential.NumDuplicates(), 100);
+
+	const TArray<FIntVector4> Expected = PCGExParallelDelaunayTestsLocal::SortedSites(Sequential);
+
+	for (const int32 NumBlocks : {2, 4, 8})
+	{
+		FTestDelaunay3 Parallel;
+		TestTrue(FString::Printf(TEXT("%d: parallel processed"), NumBlocks), Parallel.ProcessParallel(Positions, NumBlocks));
+
+		// Copies split across blocks are only seen together by the border pass
+		TestEqual(FString::Printf(TEXT("%d: same duplicates"), NumBlocks), Parallel.NumDuplicates(), Sequential.NumDuplicates());
+		TestTrue(FString::Printf(TEXT("%d: same sites"), NumBlocks), PCGExParallelDelaunayTestsLocal::SortedSites(Parallel) == Expected);
+
+		FString Error;
+		const bool bValid = Parallel.ValidateSites(&Error, true);
+		TestTrue(FString::Printf(TEXT("%d: valid (%s)"), NumBlocks, *Error), bValid);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExParallelDelaunay3LatticeTest,
+	"PCGEx.Unit.Delaunay.Parallel3.Lattice",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExParallelDelaunay3LatticeTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// Every lattice cell is cospherical, so the tetrahedralization isn't unique: blocks and the border pass
+	// may split a cell differently than Process does. Sites can't be compared one to one, only validity
+	// (exact empty spheres) and counts: every cell still ends up as six tetrahedra.
+	for (const int32 Size : {16, 20})
+	{
+		TArray<FVector> Positions;
+		for (int32 z = 0; z < Size; z++) { for (int32 y = 0; y < Size; y++) { for (int32 x = 0; x < Size; x++) { Positions.Emplace(x * 10, y * 10, z * 10); } } }
+
+		FTestDelaunay3 Sequential;
+		TestTrue(FString::Printf(TEXT("%d: sequential processed"), Size), Sequential.Process(Positions));
+
+		for (const int32 NumBlocks : {2, 8})
+		{
+			FTestDelaunay3 Parallel;
+			TestTrue(FString::Printf(TEXT("%d/%d: parallel processed"), Size, NumBlocks), Parallel.ProcessParallel(Positions, NumBlocks));
+			TestTrue(FString::Printf(TEXT("%d/%d: border pass ran"), Size, NumBlocks), Parallel.NumBorderPoints() > 0);
+
+			// No mesh is kept, only the sites can be checked
+			TestFalse(FString::Printf(TEXT("%d/%d: no mesh to validate"), Size, NumBlocks), Parallel.Validate());
+
+			FString Error;
+			const bool bValid = Parallel.ValidateSites(&Error, true);
+			TestTrue(FString::Printf(TEXT("%d/%d: valid (%s)"), Size, NumBlocks, *Error), bValid);
+
+			TestEqual(FString::Printf(TEXT("%d/%d: same site count"), Size, NumBlocks), Parallel.Sites.Num(), Sequential.Sites.Num());
+			TestEqual(FString::Printf(TEXT("%d/%d: same edge count"), Size, NumBlocks), Parallel.DelaunayEdges.Num(), Sequential.DelaunayEdges.Num());
+			TestEqual(FString::Printf(TEXT("%d/%d: same hull size"), Size, NumBlocks), Parallel.DelaunayHull.Num(), Sequential.DelaunayHull.Num());
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExParallelDelaunay3FallbackTest,
+	"PCGEx.Unit.Delaunay.Parallel3.Fallback",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExParallelDelaunay3FallbackTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// Too few points per block, and a single block: both run the sequential path
+	const TArray<FVector> Small = PCGExParallelDelaunayTestsLocal::RandomPositions(1500, 8);
+
+	FTestDelaunay3 Sequential;
+	Sequential.Process(Small);
+
+	for (const int32 NumBlocks : {1, 64})
+	{
+		FTestDelaunay3 Parallel;
+		TestTrue(FString::Printf(TEXT("%d blocks: processed"), NumBlocks), Parallel.ProcessParallel(Small, NumBlocks));
+		TestEqual(FString::Printf(TEXT("%d blocks: no border pass"), NumBlocks), Parallel.NumBorderPoints(), 0);
+		TestEqual(FString::Printf(TEXT("%d blocks: same sites"), NumBlocks), Parallel.Sites.Num(), Sequential.Sites.Num());
+	}
+
+	// Every block degenerate
+	TArray<FVector> Coplanar;
+	for (int32 i = 0; i < 5000; i++) { Coplanar.Emplace(i % 71, i / 71, 0); }
+
+	FTestDelaunay3 Parallel;
+	TestFalse(TEXT("Coplanar points fail"), Parallel.ProcessParallel(Coplanar, 4));
+	TestFalse(TEXT("Coplanar points are not valid"), Parallel.IsValid);
+
+	return true;
+}
@@ -0,0 +1,225 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "Helpers/PCGExPointInPolygonHelpers.h"
+#include "Math/Geo/PCGExGeo.h"
+
+/**
+ * Batched Point-In-Polygon Tests
+ *
+ * Verifies the TestPointInPolygon batches and FTestPolygon2: every bit of the output mask matches
+ * the scalar test exactly, banded or not, including points on vertices and horizontal edges, and
+ * agrees with PCGExMath::Geo::IsPointInPolygon / IsPointInTriangle on random points.
+ *
+ * Test naming convention: PCGEx.Unit.Math.Geo.Batch.<Case>
+ */
+
+namespace PCGExPointInPolygonTestsLocal
+{
+	/** Simple concave polygon: vertices at increasing angles, random radii */
+	TArray<FVector2D> StarPolygon(const int32 NumVertices, const int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<FVector2D> Polygon;
+		for (int32 i = 0; i < NumVertices; i++)
+		{
+			const double Angle = UE_DOUBLE_TWO_PI * i / NumVertices;
+			const double Radius = Random.FRandRange(200, 500);
+			Polygon.Emplace(500 + Radius * FMath::Cos(Angle), 500 + Radius * FMath::Sin(Angle));
+		}
+		return Polygon;
+	}
+
+	TArray<FVector2D> RandomPoints(const int32 NumPoints, const int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<FVector2D> Points;
+		for (int32 i = 0; i < NumPoints; i++) { Points.Emplace(Random.FRandRange(-50, 1050), Random.FRandRange(-50, 1050)); }
+		return Points;
+	}
+
+	/** Bits of Mask that differ from Expected, plus any size difference */
+	int32 CountMismatches(const TBitArray<>& Mask, TFunctionRef<bool(int32)> Expected, const int32 NumPoints)
+	{
+		int32 NumMismatches = FMath::Abs(Mask.Num() - NumPoints);
+		for (int32 i = 0; i < FMath::Min(Mask.Num(), NumPoints); i++) { if (Mask[i] != Expected(i)) { NumMismatches++; } }
+		return NumMismatches;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExGeoBatchPolygonTest,
+	"PCGEx.Unit.Math.Geo.Batch.Polygon",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExGeoBatchPolygonTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+	using namespace PCGExPointInPolygonTestsLocal;
+
+	const TArray<FVector2D> Polygon = StarPolygon(1000, 41);
+
+	// Not a multiple of 32, so the last word is partial
+	const TArray<FVector2D> Points = RandomPoints(20001, 42);
+
+	TArray<FVector> Points3;
+	for (const FVector2D& P : Points) { Points3.Emplace(P.X, P.Y, 100); }
+
+	TBitArray<> Expected(false, Points.Num());
+	for (int32 i = 0; i < Points.Num(); i++) { Expected[i] = TestPointInPolygon::IsInside(Points[i], Polygon); }
+
+	const int32 NumInside = Expected.CountSetBits();
+	TestTrue(TEXT("Some points inside, some outside"), NumInside > Points.Num() / 10 && NumInside < Points.Num() * 9 / 10);
+
+	int32 NumProductionMismatches = 0;
+	for (int32 i = 0; i < Points.Num(); i++) { if (Expected[i] != PCGExMath::Geo::IsPointInPolygon(Points[i], Polygon)) { NumProductionMismatches++; } }
+	TestEqual(TEXT("Scalar test agrees with IsPointInPolygon"), NumProductionMismatches, 0);
+
+	auto IsExpected = [&](const int32 i) { return static_cast<bool>(Expected[i]); };
+
+	TBitArray<> Mask;
+	TestPointInPolygon::ClassifyPoints(Points, Polygon, Mask);
+	TestEqual(TEXT("Brute force batch"), CountMismatches(Mask, IsExpected, Points.Num()), 0);
+	TestEqual(TEXT("No bit set past the last point"), Mask.CountSetBits(), NumInside);
+
+	TestPointInPolygon::ClassifyPoints(Points3, Polygon, Mask);
+	TestEqual(TEXT("Brute force batch, FVector"), CountMismatches(Mask, IsExpected, Points.Num()), 0);
+
+	const FTestPolygon2 Banded(Polygon);
+	TestEqual(TEXT("One band per edge by default"), Banded.NumBands(), Polygon.Num());
+	TestTrue(TEXT("A band holds a fraction of the edges"), Banded.NumBandEdges() / Banded.NumBands() < Polygon.Num() / 4);
+
+	Banded.ClassifyPoints(Points, Mask);
+	TestEqual(TEXT("Banded batch"), CountMismatches(Mask, IsExpected, Points.Num()), 0);
+
+	Banded.ClassifyPoints(Points3, Mask);
+	TestEqual(TEXT("Banded batch, FVector"), CountMismatches(Mask, IsExpected, Points.Num()), 0);
+
+	int32 NumSingleMismatches = 0;
+	for (int32 i = 0; i < Points.Num(); i++) { if (Banded.IsInside(Points[i]) != Expected[i]) { NumSingleMismatches++; } }
+	TestEqual(TEXT("Banded single point"), NumSingleMismatches, 0);
+
+	// Same L shape as the IsPointInPolygon tests
+	const TArray<FVector2D> LShape = {FVector2D(0, 0), FVector2D(2, 0), FVector2D(2, 1), FVector2D(1, 1), FVector2D(1, 2), FVector2D(0, 2)};
+	const TArray<FVector2D> LPoints = {FVector2D(1.5, 0.5), FVector2D(0.5, 1.5), FVector2D(1.5, 1.5), FVector2D(-0.5, 0.5)};
+
+	FTestPolygon2(LShape).ClassifyPoints(LPoints, Mask);
+	TestTrue(TEXT("L: bottom part inside"), Mask[0]);
+	TestTrue(TEXT("L: left part inside"), Mask[1]);
+	TestFalse(TEXT("L: concave region outside"), Mask[2]);
+	TestFalse(TEXT("L: left of the shape outside"), Mask[3]);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExGeoBatchBandsTest,
+	"PCGEx.Unit.Math.Geo.Batch.Bands",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExGeoBatchBandsTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+	using namespace PCGExPointInPolygonTestsLocal;
+
+	// Staircase with integer vertices: queries on vertices, on horizontal edges, on the bounds
+	TArray<FVector2D> Stairs;
+	for (int32 i = 0; i < 10; i++)
+	{
+		Stairs.Emplace(i, i);
+		Stairs.Emplace(i + 1, i);
+	}
+	Stairs.Emplace(10, 10);
+	Stairs.Emplace(0, 10);
+
+	TArray<FVector2D> Points;
+	for (int32 x = -2; x <= 24; x++) { for (int32 y = -2; y <= 24; y++) { Points.Emplace(x * 0.5, y * 0.5); } }
+
+	auto IsExpected = [&](const int32 i) { return TestPointInPolygon::IsInside(Points[i], Stairs); };
+
+	TBitArray<> Mask;
+	for (const int32 NumBands : {0, 1, 3, 7, 64, 1000})
+	{
+		const FTestPolygon2 Banded(Stairs, NumBands);
+		TestEqual(FString::Printf(TEXT("%d bands: band count"), NumBands), Banded.NumBands(), NumBands > 0 ? NumBands : Stairs.Num());
+
+		Banded.ClassifyPoints(Points, Mask);
+		TestEqual(FString::Printf(TEXT("%d bands: matches the scalar test"), NumBands), CountMismatches(Mask, IsExpected, Points.Num()), 0);
+	}
+
+	// Horizontal edges are never stored
+	TestEqual(TEXT("Single band: only the non-horizontal edges"), FTestPolygon2(Stairs, 1).NumBandEdges(), 11);
+
+	// A long edge is stored in every band it spans
+	const TArray<FVector2D> Square = {FVector2D(0, 0), FVector2D(1, 0), FVector2D(1, 1), FVector2D(0, 1)};
+	TestEqual(TEXT("Square over 8 bands: both sides in each"), FTestPolygon2(Square, 8).NumBandEdges(), 16);
+
+	// Degenerate inputs
+	FTestPolygon2 Empty(TArray<FVector2D>{});
+	Empty.ClassifyPoints(Points, Mask);
+	TestEqual(TEXT("Empty polygon: one bit per point"), Mask.Num(), Points.Num());
+	TestEqual(TEXT("Empty polygon: nothing inside"), Mask.CountSetBits(), 0);
+
+	const TArray<FVector2D> Flat = {FVector2D(0, 5), FVector2D(10, 5), FVector2D(20, 5)};
+	FTestPolygon2(Flat).ClassifyPoints(Points, Mask);
+	TestEqual(TEXT("Flat polygon: nothing inside"), Mask.CountSetBits(), 0);
+
+	FTestPolygon2(Square).ClassifyPoints(TArray<FVector2D>{}, Mask);
+	TestEqual(TEXT("No points: empty mask"), Mask.Num(), 0);
+
+	TestFalse(TEXT("NaN is outside"), FTestPolygon2(Square).IsInside(FVector2D(0.5, TNumericLimits<double>::QuietNaN())));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExGeoBatchTriangleTest,
+	"PCGEx.Unit.Math.Geo.Batch.Triangle",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExGeoBatchTriangleTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+	using namespace PCGExPointInPolygonTestsLocal;
+
+	const FVector2D A(100, 100);
+	const FVector2D B(900, 200);
+	const FVector2D C(300, 850);
+
+	const TArray<FVector2D> Points = RandomPoints(10007, 43);
+
+	TArray<FVector> Points3;
+	for (const FVector2D& P : Points) { Points3.Emplace(P.X, P.Y, 0); }
+
+	auto IsExpected = [&](const int32 i) { return TestPointInPolygon::IsInTriangle(Points[i], A, B, C); };
+
+	int32 NumProductionMismatches = 0;
+	for (int32 i = 0; i < Points.Num(); i++)
+	{
+		if (IsExpected(i) != PCGExMath::Geo::IsPointInTriangle(Points3[i], FVector(A.X, A.Y, 0), FVector(B.X, B.Y, 0), FVector(C.X, C.Y, 0))) { NumProductionMismatches++; }
+	}
+	TestEqual(TEXT("Scalar test agrees with IsPointInTriangle"), NumProductionMismatches, 0);
+
+	TBitArray<> Mask;
+	TestPointInPolygon::ClassifyPoints(Points, A, B, C, Mask);
+	TestEqual(TEXT("Batch"), CountMismatches(Mask, IsExpected, Points.Num()), 0);
+	TestTrue(TEXT("Some points inside"), Mask.CountSetBits() > 0);
+
+	TestPointInPolygon::ClassifyPoints(Points, A, C, B, Mask);
+	TestEqual(TEXT("Batch, clockwise"), CountMismatches(Mask, IsExpected, Points.Num()), 0);
+
+	TestPointInPolygon::ClassifyPoints(Points3, FVector(A.X, A.Y, 0), FVector(B.X, B.Y, 0), FVector(C.X, C.Y, 0), Mask);
+	TestEqual(TEXT("Batch, FVector"), CountMismatches(Mask, IsExpected, Points.Num()), 0);
+
+	// Boundary included
+	const TArray<FVector2D> Boundary = {A, B, C, (A + B) * 0.5, FVector2D(99, 100)};
+	TestPointInPolygon::ClassifyPoints(Boundary, A, B, C, Mask);
+	TestTrue(TEXT("Vertex A inside"), Mask[0]);
+	TestTrue(TEXT("Vertex B inside"), Mask[1]);
+	TestTrue(TEXT("Vertex C inside"), Mask[2]);
+	TestTrue(TEXT("Edge midpoint inside"), Mask[3]);
+	TestFalse(TEXT("Just outside a vertex"), Mask[4]);
+
+	return true;
+}
@@ -0,0 +1,289 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "Helpers/PCGExPredicateHelpers.h"
+#include "Helpers/PCGExDelaunayTestHelpers.h"
+
+/**
+ * Adaptive Predicate Tests
+ *
+ * Verifies the filtered exact predicates on inputs where plain double evaluation can't be trusted:
+ * near-collinear points a few ulps apart, cocircular and cospherical integer lattices far from the
+ * origin (exactly zero), consistency under permutation, robust circumcenters, and Delaunay
+ * triangulations of such inputs without jittering them.
+ *
+ * Test naming convention: PCGEx.Unit.Math.Predicates.<Case>
+ */
+
+namespace PCGExPredicateTestsLocal
+{
+	// Large enough that products of the coordinates exceed the double mantissa, small enough that differences stay exact
+	constexpr double Offset = 1073741824.0; // 2^30
+
+	/** Integer points on the circle of radius 3453125: lifted terms need ~90 bits, so plain doubles round them */
+	TArray<FVector2D> CocircularPoints()
+	{
+		constexpr int32 Coordinates[][2] = {
+			{3452485, 66480}, {1389245, 3161340}, {568323, 3406036}, {-1101379, 3272772}, {-2988000, 1730875},
+			{-3406036, 568323}, {-3272772, -1101379}, {-785408, -3362619}, {1522452, -3099389}, {3161340, -1389245}};
+
+		TArray<FVector2D> Points;
+		for (const auto& Coordinate : Coordinates) { Points.Emplace(Offset + Coordinate[0], -Offset + Coordinate[1]); }
+		return Points;
+	}
+
+	/** Integer points on the sphere of radius 1234567 */
+	TArray<FVector> CosphericalPoints()
+	{
+		constexpr int32 Coordinates[][3] = {
+			{-1224189, 53322, -150578}, {-1116483, 185910, 493010}, {-1039203, 207766, 633282}, {-970173, 679346, 348438},
+			{-620189, 421002, 980958}, {-409923, 1118082, -325594}, {-231987, 852894, 861922}, {303507, 998922, 658934}};
+
+		TArray<FVector> Points;
+		for (const auto& Coordinate : Coordinates) { Points.Emplace(Offset + Coordinate[0], -Offset + Coordinate[1], Offset + Coordinate[2]); }
+		return Points;
+	}
+
+	int32 Sign(const double Value) { return Value > 0 ? 1 : Value < 0 ? -1 : 0; }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPredicatesOrient2DTest,
+	"PCGEx.Unit.Math.Predicates.Orient2D",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPredicatesOrient2DTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+	using PCGExPredicateTestsLocal::Sign;
+
+	// P a few ulps around (0.5, 0.5), against the line y = x through Q and R: left iff P.Y > P.X
+	const double Ulp = FMath::Pow(2.0, -53.0);
+	const FVector2D Q(12, 12);
+	const FVector2D R(24, 24);
+
+	int32 WrongSigns = 0;
+	int32 Inconsistent = 0;
+	for (int32 i = 0; i < 64; i++)
+	{
+		for (int32 j = 0; j < 64; j++)
+		{
+			const FVector2D P(0.5 + i * Ulp, 0.5 + j * Ulp);
+			const int32 Expected = j > i ? 1 : j < i ? -1 : 0;
+
+			const int32 Orientation = Sign(TestPredicates::Orient2D(P, Q, R));
+			if (Orientation != Expected) { WrongSigns++; }
+
+			// Cyclic shifts keep the sign, swaps flip it
+			if (Sign(TestPredicates::Orient2D(Q, R, P)) != Orientation || Sign(TestPredicates::Orient2D(R, P, Q)) != Orientation) { Inconsistent++; }
+			if (Sign(TestPredicates::Orient2D(Q, P, R)) != -Orientation) { Inconsistent++; }
+		}
+	}
+
+	TestEqual(TEXT("Near-collinear signs are exact"), WrongSigns, 0);
+	TestEqual(TEXT("Signs are consistent under permutation"), Inconsistent, 0);
+
+	// Far from the origin
+	const FVector2D A(PCGExPredicateTestsLocal::Offset, PCGExPredicateTestsLocal::Offset);
+	TestEqual(TEXT("Collinear far away is zero"), TestPredicates::Orient2D(A, A + FVector2D(3, 7), A + FVector2D(6, 14)), 0.0);
+	TestTrue(TEXT("Counter-clockwise far away is positive"), TestPredicates::Orient2D(A, A + FVector2D(1, 0), A + FVector2D(0, 1)) > 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPredicatesInCircleTest,
+	"PCGEx.Unit.Math.Predicates.InCircle",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPredicatesInCircleTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+	using PCGExPredicateTestsLocal::Sign;
+
+	const TArray<FVector2D> Points = PCGExPredicateTestsLocal::CocircularPoints();
+	const int32 NumPoints = Points.Num();
+
+	// Every quadruple of distinct points is exactly cocircular
+	int32 NonZero = 0;
+	for (int32 a = 0; a < NumPoints; a++)
+	{
+		for (int32 b = a + 1; b < NumPoints; b++)
+		{
+			for (int32 c = b + 1; c < NumPoints; c++)
+			{
+				for (int32 d = 0; d < NumPoints; d++)
+				{
+					if (d == a || d == b || d == c) { continue; }
+					if (TestPredicates::InCircle(Points[a], Points[b], Points[c], Points[d]) != 0) { NonZero++; }
+				}
+			}
+		}
+	}
+
+	TestEqual(TEXT("Cocircular points are exactly zero"), NonZero, 0);
+
+	// One unit in or out of the circle, out of a radius of ~3.5e6
+	const FVector2D& A = Points[0];
+	const FVector2D& B = Points[2];
+	const FVector2D& C = Points[5];
+	const FVector2D& D = Points[7];
+
+	TestEqual(TEXT("Nudged inside"), Sign(TestPredicates::InCircle(A, B, C, D + FVector2D(0, 1))), 1);
+	TestEqual(TEXT("Nudged outside"), Sign(TestPredicates::InCircle(A, B, C, D - FVector2D(0, 1))), -1);
+	TestEqual(TEXT("Clockwise triangle flips the sign"), Sign(TestPredicates::InCircle(A, C, B, D + FVector2D(0, 1))), -1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPredicates3DTest,
+	"PCGEx.Unit.Math.Predicates.Orient3DInSphere",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPredicates3DTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+	using PCGExPredicateTestsLocal::Sign;
+
+	const FVector Center(PCGExPredicateTestsLocal::Offset, -PCGExPredicateTestsLocal::Offset, PCGExPredicateTestsLocal::Offset);
+	const TArray<FVector> OnSphere = PCGExPredicateTestsLocal::CosphericalPoints();
+
+	int32 NonZero = 0;
+	for (int32 e = 4; e < OnSphere.Num(); e++)
+	{
+		if (TestPredicates::InSphere(OnSphere[0], OnSphere[1], OnSphere[2], OnSphere[3], OnSphere[e]) != 0) { NonZero++; }
+	}
+
+	TestEqual(TEXT("Cospherical points are exactly zero"), NonZero, 0);
+
+	// Positive tetrahedron, with a point just inside and just outside its sphere
+	FVector A = OnSphere[0];
+	FVector B = OnSphere[2];
+	const FVector C = OnSphere[4];
+	const FVector D = OnSphere[6];
+	if (TestPredicates::Orient3D(A, B, C, D) < 0) { Swap(A, B); }
+
+	TestTrue(TEXT("Tetrahedron is positive"), TestPredicates::Orient3D(A, B, C, D) > 0);
+	TestTrue(TEXT("Swapping two corners flips the orientation"), TestPredicates::Orient3D(B, A, C, D) < 0);
+
+	// The last point has a positive X relative to the center
+	TestEqual(TEXT("Nudged inside"), Sign(TestPredicates::InSphere(A, B, C, D, OnSphere[7] - FVector(1, 0, 0))), 1);
+	TestEqual(TEXT("Nudged outside"), Sign(TestPredicates::InSphere(A, B, C, D, OnSphere[7] + FVector(1, 0, 0))), -1);
+
+	// Coplanar and collinear far from the origin
+	const FVector P0 = Center;
+	const FVector P1 = Center + FVector(3, 1, 4);
+	const FVector P2 = Center + FVector(-2, 7, 5);
+	TestEqual(TEXT("Coplanar is zero"), TestPredicates::Orient3D(P0, P1, P2, P0 + (P1 - P0) * 2 + (P2 - P0) * 3), 0.0);
+	TestEqual(TEXT("Collinear midpoint is zero"), TestPredicates::Orient3D(P0, P1, P2, (P0 + P2) * 0.5), 0.0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPredicatesCircumcenterTest,
+	"PCGEx.Unit.Math.Predicates.Circumcenter",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPredicatesCircumcenterTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// 2D
+	{
+		FVector2D Center;
+		TestTrue(TEXT("2D: triangle has a center"), TestPredicates::GetCircumcenter(FVector2D(0, 0), FVector2D(4, 0), FVector2D(0, 2), Center));
+		TestTrue(TEXT("2D: center"), Center.Equals(FVector2D(2, 1), 1e-12));
+		TestFalse(TEXT("2D: collinear has none"), TestPredicates::GetCircumcenter(FVector2D(1, 1), FVector2D(2, 2), FVector2D(5, 5), Center));
+
+		const TArray<FVector2D> Points = PCGExPredicateTestsLocal::CocircularPoints();
+		TestTrue(TEXT("2D: far triangle has a center"), TestPredicates::GetCircumcenter(Points[0], Points[3], Points[7], Center));
+		TestTrue(TEXT("2D: far center"), Center.Equals(FVector2D(PCGExPredicateTestsLocal::Offset, -PCGExPredicateTestsLocal::Offset), 1e-3));
+	}
+
+	// 3D triangle, in its plane
+	{
+		FVector Center;
+		const FVector A(1, 0, 0);
+		const FVector B(0, 1, 0);
+		const FVector C(0, 0, 1);
+		TestTrue(TEXT("Triangle: has a center"), TestPredicates::GetCircumcenter(A, B, C, Center));
+		TestTrue(TEXT("Triangle: centroid of an equilateral"), Center.Equals(FVector(1.0 / 3.0), 1e-12));
+		TestFalse(TEXT("Triangle: collinear has none"), TestPredicates::GetCircumcenter(A, A * 2, A * 3, Center));
+	}
+
+	// Tetrahedron
+	{
+		FVector Center;
+		const TArray<FVector> OnSphere = PCGExPredicateTestsLocal::CosphericalPoints();
+		TestTrue(TEXT("Tetrahedron: far one has a center"), TestPredicates::GetCircumcenter(OnSphere[0], OnSphere[2], OnSphere[5], OnSphere[7], Center));
+		TestTrue(TEXT("Tetrahedron: far center"), Center.Equals(FVector(PCGExPredicateTestsLocal::Offset, -PCGExPredicateTestsLocal::Offset, PCGExPredicateTestsLocal::Offset), 1e-3));
+
+		const FVector Offset(PCGExPredicateTestsLocal::Offset);
+		TestTrue(TEXT("Tetrahedron: has a center"), TestPredicates::GetCircumcenter(Offset, Offset + FVector(2, 0, 0), Offset + FVector(0, 2, 0), Offset + FVector(0, 0, 2), Center));
+		TestTrue(TEXT("Tetrahedron: center"), Center.Equals(Offset + FVector(1), 1e-6));
+		TestFalse(TEXT("Tetrahedron: coplanar has none"), TestPredicates::GetCircumcenter(Offset, Offset + FVector(1, 0, 0), Offset + FVector(0, 1, 0), Offset + FVector(1, 1, 0), Center));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExPredicatesDelaunayTest,
+	"PCGEx.Unit.Math.Predicates.DelaunayWithoutJitter",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExPredicatesDelaunayTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// All points on one circle: any fan is Delaunay, but it must be a consistent one
+	{
+		const TArray<FVector2D> Points = PCGExPredicateTestsLocal::CocircularPoints();
+
+		FTestDelaunay2 Delaunay;
+		TestTrue(TEXT("Cocircular processed"), Delaunay.Process(Points));
+
+		FString Error;
+		TestTrue(FString::Printf(TEXT("Cocircular is valid (%s)"), *Error), Delaunay.Validate(&Error, true));
+		TestEqual(TEXT("Cocircular: n - 2 triangles"), Delaunay.Sites.Num(), Points.Num() - 2);
+		TestEqual(TEXT("Cocircular: every point on the hull"), Delaunay.DelaunayHull.Num(), Points.Num());
+	}
+
+	// Points a few ulps off a line, plus a handful away from it
+	{
+		const double Ulp = FMath::Pow(2.0, -53.0);
+
+		TArray<FVector2D> Points;
+		for (int32 i = 0; i < 200; i++) { Points.Emplace(0.5 + (i % 17) * Ulp, 0.5 + (i % 13) * Ulp + (i / 17) * 1e-3); }
+		Points.Emplace(-1, 0);
+		Points.Emplace(2, 0);
+		Points.Emplace(0.5, 3);
+
+		FTestDelaunay2 Delaunay;
+		TestTrue(TEXT("Near-collinear processed"), Delaunay.Process(Points));
+
+		FString Error;
+		TestTrue(FString::Printf(TEXT("Near-collinear is valid (%s)"), *Error), Delaunay.Validate(&Error, true));
+	}
+
+	// Lattice far from the origin: every cell is cospherical
+	{
+		constexpr int32 Size = 5;
+		const FVector Origin(PCGExPredicateTestsLocal::Offset);
+
+		TArray<FVector> Points;
+		for (int32 z = 0; z < Size; z++) { for (int32 y = 0; y < Size; y++) { for (int32 x = 0; x < Size; x++) { Points.Add(Origin + FVector(x, y, z) * 3); } } }
+
+		FTestDelaunay3 Delaunay;
+		TestTrue(TEXT("Far lattice processed"), Delaunay.Process(Points));
+
+		FString Error;
+		TestTrue(FString::Printf(TEXT("Far lattice is valid (%s)"), *Error), Delaunay.Validate(&Error, true));
+		TestEqual(TEXT("Far lattice: six tetrahedra per cell"), Delaunay.Sites.Num(), 6 * (Size - 1) * (Size - 1) * (Size - 1));
+	}
+
+	return true;
+}
@@ -0,0 +1,186 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "Math/Geo/PCGExDelaunay.h"
+#include "Helpers/PCGExDelaunayTestHelpers.h"
+
+/**
+ * Streaming Delaunay 2D Tests
+ *
+ * Verifies the chunked, sweep-ordered mode of the incremental triangulator: the emitted sites,
+ * edges and hull match an in-memory run, every edge is emitted once, live triangles stay bounded
+ * by the frontier, and out-of-order, collinear or duplicated chunks are handled.
+ *
+ * Test naming convention: PCGEx.Unit.Delaunay.Streaming2.<Case>
+ */
+
+namespace PCGExStreamingDelaunayTestsLocal
+{
+	/** Random points over Width x Height, sorted along X, plus exact copies of some points */
+	TArray<FVector2D> SortedPositions(const int32 NumPoints, const double Width, const double Height, const int32 NumCopies, const int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<FVector2D> Positions;
+		Positions.Reserve(NumPoints + NumCopies);
+		for (int32 i = 0; i < NumPoints; i++) { Positions.Emplace(Random.FRandRange(0, Width), Random.FRandRange(0, Height)); }
+		for (int32 i = 0; i < NumCopies; i++) { Positions.Add(Positions[i * 7]); }
+
+		Positions.Sort([](const FVector2D& A, const FVector2D& B) { return A.X < B.X; });
+		return Positions;
+	}
+
+	FIntVector SortedTriple(const PCGExMath::Geo::FDelaunaySite2& Site)
+	{
+		int32 V[3] = {Site.Vtx[0], Site.Vtx[1], Site.Vtx[2]};
+		if (V[0] > V[1]) { Swap(V[0], V[1]); }
+		if (V[1] > V[2]) { Swap(V[1], V[2]); }
+		if (V[0] > V[1]) { Swap(V[0], V[1]); }
+		return FIntVector(V[0], V[1], V[2]);
+	}
+
+	struct FStreamOutput
+	{
+		TSet<FIntVector> Sites;
+		TArray<uint64> Edges;
+		int32 NumSites = 0;
+	};
+
+	/** Stream the positions in fixed-size chunks */
+	bool Stream(PCGExTest::FTestDelaunay2& Delaunay, const TArray<FVector2D>& Positions, const int32 ChunkSize, FStreamOutput& OutStream, int32* OutPeakVertices = nullptr)
+	{
+		Delaunay.BeginStream(
+			[&](const PCGExMath::Geo::FDelaunaySite2& Site)
+			{
+				OutStream.Sites.Add(SortedTriple(Site));
+				OutStream.NumSites++;
+			},
+			[&](const uint64 Edge) { OutStream.Edges.Add(Edge); });
+
+		for (int32 i = 0; i < Positions.Num(); i += ChunkSize)
+		{
+			Delaunay.AddChunk(MakeArrayView(Positions.GetData() + i, FMath::Min(ChunkSize, Positions.Num() - i)));
+			if (OutPeakVertices) { *OutPeakVertices = FMath::Max(*OutPeakVertices, Delaunay.NumLiveVertices()); }
+		}
+
+		return Delaunay.EndStream();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExStreamingDelaunay2MatchesProcessTest,
+	"PCGEx.Unit.Delaunay.Streaming2.MatchesProcess",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExStreamingDelaunay2MatchesProcessTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	const TArray<FVector2D> Positions = PCGExStreamingDelaunayTestsLocal::SortedPositions(5000, 1000, 1000, 100, 7);
+
+	FTestDelaunay2 InMemory;
+	TestTrue(TEXT("In-memory processed"), InMemory.Process(Positions));
+
+	TSet<FIntVector> Expected;
+	for (const PCGExMath::Geo::FDelaunaySite2& Site : InMemory.Sites) { Expected.Add(PCGExStreamingDelaunayTestsLocal::SortedTriple(Site)); }
+
+	for (const int32 ChunkSize : {1, 250, 5100})
+	{
+		FTestDelaunay2 Delaunay;
+		PCGExStreamingDelaunayTestsLocal::FStreamOutput Output;
+		TestTrue(FString::Printf(TEXT("%d: streamed"), ChunkSize), PCGExStreamingDelaunayTestsLocal::Stream(Delaunay, Positions, ChunkSize, Output));
+		TestTrue(FString::Printf(TEXT("%d: stream is valid"), ChunkSize), Delaunay.IsValid);
+
+		TestEqual(FString::Printf(TEXT("%d: same site count"), ChunkSize), Output.NumSites, InMemory.Sites.Num());
+		TestTrue(FString::Printf(TEXT("%d: same sites"), ChunkSize), Output.Sites.Num() == Expected.Num() && Output.Sites.Includes(Expected));
+
+		TSet<uint64> UniqueEdges;
+		UniqueEdges.Append(Output.Edges);
+		TestEqual(FString::Printf(TEXT("%d: each edge emitted once"), ChunkSize), UniqueEdges.Num(), Output.Edges.Num());
+		TestTrue(FString::Printf(TEXT("%d: same edges"), ChunkSize), UniqueEdges.Num() == InMemory.DelaunayEdges.Num() && UniqueEdges.Includes(InMemory.DelaunayEdges));
+
+		TestTrue(FString::Printf(TEXT("%d: same hull"), ChunkSize), Delaunay.DelaunayHull.Num() == InMemory.DelaunayHull.Num() && Delaunay.DelaunayHull.Includes(InMemory.DelaunayHull));
+		TestEqual(FString::Printf(TEXT("%d: same duplicates"), ChunkSize), Delaunay.NumDuplicates(), InMemory.NumDuplicates());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExStreamingDelaunay2BoundedMemoryTest,
+	"PCGEx.Unit.Delaunay.Streaming2.BoundedMemory",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExStreamingDelaunay2BoundedMemoryTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// Long strip: the frontier is a thin band across it
+	const TArray<FVector2D> Positions = PCGExStreamingDelaunayTestsLocal::SortedPositions(40000, 40000, 100, 0, 3);
+
+	FTestDelaunay2 Delaunay;
+	PCGExStreamingDelaunayTestsLocal::FStreamOutput Output;
+	int32 PeakVertices = 0;
+	TestTrue(TEXT("Streamed"), PCGExStreamingDelaunayTestsLocal::Stream(Delaunay, Positions, 500, Output, &PeakVertices));
+
+	const int32 H = Delaunay.DelaunayHull.Num();
+	TestEqual(TEXT("Triangle count"), Output.NumSites, 2 * Positions.Num() - H - 2);
+	TestEqual(TEXT("Edge count"), Output.Edges.Num(), 3 * Positions.Num() - H - 3);
+
+	TestTrue(FString::Printf(TEXT("Peak live triangles bounded (%d)"), Delaunay.GetPeakLiveTriangles()), Delaunay.GetPeakLiveTriangles() < Output.NumSites / 10);
+	TestTrue(FString::Printf(TEXT("Peak live vertices bounded (%d)"), PeakVertices), PeakVertices < Positions.Num() / 10);
+	TestEqual(TEXT("Nothing live after the end"), Delaunay.NumLiveTriangles(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExStreamingDelaunay2DegenerateTest,
+	"PCGEx.Unit.Delaunay.Streaming2.Degenerate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExStreamingDelaunay2DegenerateTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	// A chunk reaching back behind the sweep front is ignored
+	{
+		FTestDelaunay2 Delaunay;
+		Delaunay.BeginStream(nullptr, nullptr);
+
+		TArray<FVector2D> First = {FVector2D(0, 0), FVector2D(5, 1), FVector2D(3, 4)};
+		TArray<FVector2D> Behind = {FVector2D(4, 0), FVector2D(9, 9)};
+		TestTrue(TEXT("First chunk accepted"), Delaunay.AddChunk(First));
+		TestFalse(TEXT("Chunk behind the front rejected"), Delaunay.AddChunk(Behind));
+		TestTrue(TEXT("Stream ends"), Delaunay.EndStream());
+		TestEqual(TEXT("Rejected chunk was not inserted"), Delaunay.DelaunayHull.Num(), 3);
+	}
+
+	// Never more than a line
+	{
+		FTestDelaunay2 Delaunay;
+		Delaunay.BeginStream(nullptr, nullptr);
+
+		TArray<FVector2D> Line = {FVector2D(0, 0), FVector2D(1, 1), FVector2D(2, 2)};
+		TestTrue(TEXT("Collinear chunk accepted"), Delaunay.AddChunk(Line));
+		TestFalse(TEXT("Collinear stream fails"), Delaunay.EndStream());
+		TestFalse(TEXT("Collinear stream is not valid"), Delaunay.IsValid);
+	}
+
+	// Grid streamed one column at a time: the first column is collinear and buffered until the second
+	{
+		constexpr int32 Size = 40;
+
+		TArray<FVector2D> Positions;
+		for (int32 x = 0; x < Size; x++) { for (int32 y = 0; y < Size; y++) { Positions.Emplace(x * 10, y * 10); } }
+
+		FTestDelaunay2 Delaunay;
+		PCGExStreamingDelaunayTestsLocal::FStreamOutput Output;
+		TestTrue(TEXT("Grid streamed"), PCGExStreamingDelaunayTestsLocal::Stream(Delaunay, Positions, Size, Output));
+		TestEqual(TEXT("Grid: two triangles per cell"), Output.NumSites, 2 * (Size - 1) * (Size - 1));
+		TestEqual(TEXT("Grid: whole boundary is hull"), Delaunay.DelaunayHull.Num(), 4 * (Size - 1));
+		TestEqual(TEXT("Grid: each edge emitted once"), Output.Edges.Num(), 3 * Size * Size - 4 * (Size - 1) - 3);
+	}
+
+	return true;
+}
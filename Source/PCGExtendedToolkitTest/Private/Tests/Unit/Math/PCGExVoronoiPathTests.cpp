@@ -0,0 +1,159 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "Helpers/PCGExVoronoiTestHelpers.h"
+#include "PCGExH.h"
+
+/**
+ * Voronoi Metric Path Tests
+ *
+ * Verifies Manhattan/Chebyshev Voronoi edge paths: single-edge bends are axis-aligned plus
+ * diagonal and only appear when needed, and the batched parallel BuildPaths produces exactly the
+ * vertices and edges of the per-edge reference, on eager and lazy diagrams alike.
+ *
+ * Test naming convention: PCGEx.Unit.Voronoi.Paths2.<Case>
+ */
+
+namespace PCGExVoronoiPathTestsLocal
+{
+	/** Axis-aligned or 45 degrees */
+	bool IsMetricSegment(const FVector2D& A, const FVector2D& B)
+	{
+		const double DX = FMath::Abs(B.X - A.X);
+		const double DY = FMath::Abs(B.Y - A.Y);
+		const double Tolerance = 1e-3 * FMath::Max(1.0, DX + DY);
+		return DX <= Tolerance || DY <= Tolerance || FMath::Abs(DX - DY) <= Tolerance;
+	}
+
+	bool SamePaths(const PCGExTest::FTestVoronoiPaths2& A, const PCGExTest::FTestVoronoiPaths2& B)
+	{
+		if (A.NumBends != B.NumBends || A.Vertices.Num() != B.Vertices.Num() || A.Edges != B.Edges) { return false; }
+		for (int32 i = 0; i < A.Vertices.Num(); i++) { if (A.Vertices[i] != B.Vertices[i]) { return false; } }
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExVoronoiPaths2BendTest,
+	"PCGEx.Unit.Voronoi.Paths2.Bend",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExVoronoiPaths2BendTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	const FVector2D Start(0, 0);
+	const FVector2D End(10, 4);
+	FVector2D Bend;
+
+	// Diagonal on the side of the sites
+	TestTrue(TEXT("L1 bends"), TestVoronoiPaths::ComputeL1Bend(Start, End, FVector2D(0, 2), FVector2D(2, 0), Bend));
+	TestEqual(TEXT("L1 diagonal first"), Bend, FVector2D(4, 4));
+
+	TestTrue(TEXT("L1 bends"), TestVoronoiPaths::ComputeL1Bend(Start, End, FVector2D(8, 6), FVector2D(10, 0), Bend));
+	TestEqual(TEXT("L1 diagonal last"), Bend, FVector2D(6, 0));
+
+	// Nothing to bend
+	TestFalse(TEXT("L1 horizontal"), TestVoronoiPaths::ComputeL1Bend(Start, FVector2D(10, 0), FVector2D(5, -1), FVector2D(5, 1), Bend));
+	TestFalse(TEXT("L1 vertical"), TestVoronoiPaths::ComputeL1Bend(Start, FVector2D(0, 10), FVector2D(-1, 5), FVector2D(1, 5), Bend));
+	TestFalse(TEXT("L1 diagonal"), TestVoronoiPaths::ComputeL1Bend(Start, FVector2D(5, -5), FVector2D(0, -5), FVector2D(5, 0), Bend));
+
+	// Chebyshev goes through the 45 degree transform and back
+	const FVector2D P(3, -7);
+	TestTrue(TEXT("LInf round trip"), TestVoronoiPaths::FromLInf(TestVoronoiPaths::ToLInf(P)).Equals(P));
+	TestTrue(TEXT("LInf distance is L1 after transform"),
+		FMath::IsNearlyEqual(FMath::Abs(TestVoronoiPaths::ToLInf(P).X) + FMath::Abs(TestVoronoiPaths::ToLInf(P).Y), 7.0));
+
+	TestTrue(TEXT("LInf bends"), TestVoronoiPaths::ComputeLInfBend(Start, End, FVector2D(0, 2), FVector2D(2, 0), Bend));
+	TestTrue(TEXT("LInf bend is one of the two corners"), Bend.Equals(FVector2D(6, 0)) || Bend.Equals(FVector2D(4, 4)));
+	TestTrue(TEXT("LInf first segment"), PCGExVoronoiPathTestsLocal::IsMetricSegment(Start, Bend));
+	TestTrue(TEXT("LInf second segment"), PCGExVoronoiPathTestsLocal::IsMetricSegment(Bend, End));
+
+	TestFalse(TEXT("LInf horizontal"), TestVoronoiPaths::ComputeLInfBend(Start, FVector2D(10, 0), FVector2D(5, -1), FVector2D(5, 1), Bend));
+	TestFalse(TEXT("LInf diagonal"), TestVoronoiPaths::ComputeLInfBend(Start, FVector2D(5, 5), FVector2D(0, 5), FVector2D(5, 0), Bend));
+
+	// Full paths
+	TArray<FVector2D> Path;
+	TestVoronoiPaths::ComputeEdgePath(EPCGExVoronoiMetric::Euclidean, Start, End, FVector2D(0, 2), FVector2D(2, 0), Path);
+	TestEqual(TEXT("Euclidean path is straight"), Path.Num(), 2);
+
+	TestVoronoiPaths::ComputeEdgePath(EPCGExVoronoiMetric::Manhattan, Start, End, FVector2D(0, 2), FVector2D(2, 0), Path);
+	TestEqual(TEXT("Manhattan path has a bend"), Path.Num(), 3);
+	TestEqual(TEXT("Manhattan path starts at Start"), Path[0], Start);
+	TestEqual(TEXT("Manhattan path ends at End"), Path.Last(), End);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPCGExVoronoiPaths2MatchesPerEdgeTest,
+	"PCGEx.Unit.Voronoi.Paths2.MatchesPerEdge",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPCGExVoronoiPaths2MatchesPerEdgeTest::RunTest(const FString& Parameters)
+{
+	using namespace PCGExTest;
+
+	FRandomStream Random(12);
+
+	TArray<FVector2D> Positions;
+	for (int32 i = 0; i < 3000; i++) { Positions.Emplace(Random.FRandRange(0, 1000), Random.FRandRange(0, 1000)); }
+
+	FTestVoronoi2 Eager;
+	TestTrue(TEXT("Eager processed"), Eager.ProcessAll(Positions));
+
+	FTestVoronoi2 Lazy;
+	TestTrue(TEXT("Lazy processed"), Lazy.Process(Positions));
+
+	// Reused across every call, as a caller rebuilding paths would
+	FTestVoronoiPaths2 Batched;
+	FTestVoronoiPaths2 PerEdge;
+
+	const TPair<EPCGExVoronoiMetric, FString> Metrics[] = {
+		{EPCGExVoronoiMetric::Euclidean, TEXT("Euclidean")},
+		{EPCGExVoronoiMetric::Manhattan, TEXT("Manhattan")},
+		{EPCGExVoronoiMetric::Chebyshev, TEXT("Chebyshev")}};
+
+	for (const TPair<EPCGExVoronoiMetric, FString>& Entry : Metrics)
+	{
+		const EPCGExVoronoiMetric Metric = Entry.Key;
+		const FString& Name = Entry.Value;
+
+		for (const FTestVoronoi2* Voronoi : {&Eager, &Lazy})
+		{
+			const TCHAR* Mode = Voronoi == &Eager ? TEXT("eager") : TEXT("lazy");
+
+			TestTrue(FString::Printf(TEXT("%s %s: batched built"), *Name, Mode), Voronoi->BuildPaths(Metric, Batched));
+			TestTrue(FString::Printf(TEXT("%s %s: per-edge built"), *Name, Mode), Voronoi->BuildPathsPerEdge(Metric, PerEdge));
+			TestTrue(FString::Printf(TEXT("%s %s: same output"), *Name, Mode), PCGExVoronoiPathTestsLocal::SamePaths(Batched, PerEdge));
+
+			const int32 NumSites = Voronoi->Delaunay->Sites.Num();
+			TestEqual(FString::Printf(TEXT("%s %s: circumcenters then bends"), *Name, Mode), Batched.Vertices.Num(), NumSites + Batched.NumBends);
+			TestEqual(FString::Printf(TEXT("%s %s: one edge per Voronoi edge and bend"), *Name, Mode), Batched.Edges.Num(), Eager.VoronoiEdges.Num() + Batched.NumBends);
+		}
+
+		if (Metric == EPCGExVoronoiMetric::Euclidean)
+		{
+			TestEqual(TEXT("Euclidean: no bends"), Batched.NumBends, 0);
+			continue;
+		}
+
+		TestTrue(FString::Printf(TEXT("%s: most random edges bend"), *Name), Batched.NumBends > Eager.VoronoiEdges.Num() / 2);
+
+		int32 NumBad = 0;
+		for (const uint64 Edge : Batched.Edges)
+		{
+			if (!PCGExVoronoiPathTestsLocal::IsMetricSegment(Batched.Vertices[PCGEx::H64A(Edge)], Batched.Vertices[PCGEx::H64B(Edge)])) { NumBad++; }
+		}
+
+		TestEqual(FString::Printf(TEXT("%s: every segment is axis-aligned or diagonal"), *Name), NumBad, 0);
+	}
+
+	// Not processed
+	FTestVoronoi2 Empty;
+	TestFalse(TEXT("No paths before Process"), Empty.BuildPaths(EPCGExVoronoiMetric::Manhattan, Batched));
+	TestEqual(TEXT("Output reset"), Batched.Edges.Num(), 0);
+
+	return true;
+}
@@ -6,9 +6,12 @@
 #include "CoreMinimal.h"
 #include "Helpers/PCGExClusterHelpers.h"
 #include "Clusters/PCGExLink.h"
+#include "Clusters/PCGExClusterCache.h"
 
 namespace PCGExTest
 {
+	class FPersistentArtifactCache;
+
 	/**
 	 * Test version of FNodeChain that works with FTestCluster
 	 */
@@ -35,6 +38,57 @@ namespace PCGExTest
 		void GetNodeIndices(TArray<int32>& OutIndices, bool bReverse = false) const;
 	};
 
+	/**
+	 * Chains cached on a cluster, with breakpoint splits that can be updated incrementally.
+	 * Unsplit chains are built once; when breakpoints change only the chains that go
+	 * through a dirty point are split again, the others keep their FTestChain objects.
+	 * Not thread-safe: updates must not run concurrently with Gather or with each other.
+	 */
+	class PCGEXTENDEDTOOLKITTEST_API FCachedChainData : public PCGExClusters::ICachedClusterData
+	{
+	public:
+		static const FName CacheKey;
+
+		/** Deduplicated chains without breakpoints, in BuildChains order */
+		TArray<TSharedPtr<FTestChain>> BaseChains;
+
+		/** Breakpoint split of each base chain */
+		TArray<TArray<TSharedPtr<FTestChain>>> SplitChains;
+
+		/** Breakpoints the splits were computed against (indexed by PointIndex, empty if none) */
+		TArray<int8> Breakpoints;
+
+		/** PointIndex -> base chains going through it, CSR layout */
+		TArray<int32> PointChainOffsets;
+		TArray<int32> PointChains;
+
+		/** Build base chains, the point index and the initial splits */
+		void Build(const TSharedRef<FTestCluster>& Cluster, const TSharedPtr<TArray<int8>>& InBreakpoints);
+
+		/** Same as Build, with BaseChains already filled (e.g. restored from a persistent cache) */
+		void BuildFromBaseChains(const TSharedRef<FTestCluster>& Cluster, const TSharedPtr<TArray<int8>>& InBreakpoints);
+
+		/**
+		 * Re-split the chains going through any of the dirty points
+		 * @param InBreakpoints New breakpoints (indexed by PointIndex)
+		 * @param DirtyPoints Point indices whose breakpoint state may have changed
+		 * @return Number of base chains that were split again
+		 */
+		int32 UpdateBreakpoints(const TSharedRef<FTestCluster>& Cluster, const TSharedPtr<TArray<int8>>& InBreakpoints, TConstArrayView<int32> DirtyPoints);
+
+		/** Same as above, dirty points are found by diffing against the stored breakpoints */
+		int32 UpdateBreakpoints(const TSharedRef<FTestCluster>& Cluster, const TSharedPtr<TArray<int8>>& InBreakpoints);
+
+		/** Flattened, deduplicated chains. Identical to BuildChains with the current breakpoints. */
+		void Gather(TArray<TSharedPtr<FTestChain>>& OutChains) const;
+
+	private:
+		void SplitBaseChain(const TSharedRef<FTestCluster>& Cluster, int32 ChainIndex);
+	};
+
+	/** Footprint of cached chains, for cache store budgeting */
+	PCGEXTENDEDTOOLKITTEST_API int64 GetCachedDataSize(const FCachedChainData& Data);
+
 	/**
 	 * Test chain building helpers
 	 */
@@ -52,6 +106,36 @@ namespace PCGExTest
 			TArray<TSharedPtr<FTestChain>>& OutChains,
 			const TSharedPtr<TArray<int8>>& Breakpoints = nullptr);
 
+		/**
+		 * Parallel equivalent of BuildChains.
+		 * Seeds are gathered in node order and walked concurrently; a seed whose chain was already
+		 * walked from its other end is skipped through per-edge atomic claims. Breakpoints are applied
+		 * by the worker that built the chain. Output is identical to BuildChains, order included.
+		 * @param Cluster The test cluster
+		 * @param OutChains Output array of chains
+		 * @param Breakpoints Optional breakpoints array (indexed by PointIndex)
+		 * @return True if any chains were built
+		 */
+		PCGEXTENDEDTOOLKITTEST_API bool BuildChainsParallel(
+			const TSharedRef<FTestCluster>& Cluster,
+			TArray<TSharedPtr<FTestChain>>& OutChains,
+			const TSharedPtr<TArray<int8>>& Breakpoints = nullptr);
+
+		/**
+		 * Split a single chain at breakpoints, appending the resulting segments.
+		 * Closed loops whose seed isn't a breakpoint are rejoined across the seed.
+		 * Segments are not deduplicated against OutSegments.
+		 * @param SourceChain Chain to split
+		 * @param Cluster The test cluster
+		 * @param Breakpoints Breakpoints array (indexed by PointIndex)
+		 * @param OutSegments Array the segments are appended to
+		 */
+		PCGEXTENDEDTOOLKITTEST_API void SplitChain(
+			const TSharedPtr<FTestChain>& SourceChain,
+			const TSharedRef<FTestCluster>& Cluster,
+			const TArray<int8>& Breakpoints,
+			TArray<TSharedPtr<FTestChain>>& OutSegments);
+
 		/**
 		 * Apply breakpoints to existing chains, splitting them as needed
 		 * @param SourceChains Input chains to split
@@ -65,6 +149,30 @@ namespace PCGExTest
 			const TSharedPtr<TArray<int8>>& Breakpoints,
 			TArray<TSharedPtr<FTestChain>>& OutChains);
 
+		/**
+		 * Fetch the chain cache from the cluster, building it on first use.
+		 * An existing cache is brought up to date with the given breakpoints (diff-based).
+		 * @param PersistentCache Optional cache consulted before building, keyed on the cluster content hash
+		 */
+		PCGEXTENDEDTOOLKITTEST_API TSharedPtr<FCachedChainData> GetOrBuildCachedChains(
+			const TSharedRef<FTestCluster>& Cluster,
+			const TSharedPtr<TArray<int8>>& Breakpoints,
+			FPersistentArtifactCache* PersistentCache = nullptr);
+
+		/**
+		 * Incremental counterpart of BuildChains for interactive breakpoint edits
+		 * @param Cluster The test cluster, whose cache holds the chains
+		 * @param Breakpoints New breakpoints array (indexed by PointIndex)
+		 * @param DirtyPoints Point indices toggled since the last call
+		 * @param OutChains Output array of chains, identical to BuildChains
+		 * @return Number of chains that had to be split again
+		 */
+		PCGEXTENDEDTOOLKITTEST_API int32 UpdateChains(
+			const TSharedRef<FTestCluster>& Cluster,
+			const TSharedPtr<TArray<int8>>& Breakpoints,
+			TConstArrayView<int32> DirtyPoints,
+			TArray<TSharedPtr<FTestChain>>& OutChains);
+
 		/**
 		 * Filter chains to only include leaf chains
 		 * @param SourceChains Input chains
@@ -80,5 +188,15 @@ namespace PCGExTest
 		PCGEXTENDEDTOOLKITTEST_API int32 CountLeafChains(const TArray<TSharedPtr<FTestChain>>& Chains);
 		PCGEXTENDEDTOOLKITTEST_API int32 CountClosedLoops(const TArray<TSharedPtr<FTestChain>>& Chains);
 		PCGEXTENDEDTOOLKITTEST_API int32 CountSingleEdgeChains(const TArray<TSharedPtr<FTestChain>>& Chains);
+
+		/**
+		 * Compare two chain lists element-wise (seed, links, flags, hash)
+		 * @param OutMismatch Optional description of the first difference
+		 * @return True if both lists hold identical chains in the same order
+		 */
+		PCGEXTENDEDTOOLKITTEST_API bool ChainsMatch(
+			const TArray<TSharedPtr<FTestChain>>& A,
+			const TArray<TSharedPtr<FTestChain>>& B,
+			FString* OutMismatch = nullptr);
 	}
 }
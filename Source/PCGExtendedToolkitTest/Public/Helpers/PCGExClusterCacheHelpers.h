@@ -0,0 +1,173 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Clusters/PCGExClusterCache.h"
+#include "Clusters/Artifacts/PCGExCachedFaceEnumerator.h"
+#include "Misc/ScopeRWLock.h"
+
+#include <atomic>
+
+namespace PCGExTest
+{
+	/** Approximate memory footprint of cached artifacts, used for budget accounting */
+	PCGEXTENDEDTOOLKITTEST_API int64 GetCachedDataSize(const PCGExClusters::ICachedClusterData& Data);
+	PCGEXTENDEDTOOLKITTEST_API int64 GetCachedDataSize(const PCGExClusters::FCachedTangentFrames& Data);
+	PCGEXTENDEDTOOLKITTEST_API int64 GetCachedDataSize(const PCGExClusters::FCachedFaceEnumerator& Data);
+
+	/**
+	 * Sizer of one concrete cached data type. Its address is the type id stored with
+	 * cache entries, so data held through an ICachedClusterData pointer can still be
+	 * sized as what it really is.
+	 */
+	struct FCachedDataType
+	{
+		int64 (*GetSize)(const PCGExClusters::ICachedClusterData& Data) = nullptr;
+	};
+
+	using FCachedDataTypeId = const FCachedDataType*;
+
+	/** Type id of T, sized with the GetCachedDataSize overload of T. The base interface has none: data held as such is untyped */
+	template <typename T>
+	FCachedDataTypeId GetCachedDataTypeId()
+	{
+		if constexpr (std::is_same_v<T, PCGExClusters::ICachedClusterData>) { return nullptr; }
+		else
+		{
+			static const FCachedDataType Type{[](const PCGExClusters::ICachedClusterData& Data) -> int64 { return GetCachedDataSize(static_cast<const T&>(Data)); }};
+			return &Type;
+		}
+	}
+
+	/** Footprint of Data as the type TypeId identifies, or as the base interface when untyped */
+	FORCEINLINE int64 GetCachedDataSize(const PCGExClusters::ICachedClusterData& Data, const FCachedDataTypeId TypeId)
+	{
+		return TypeId ? TypeId->GetSize(Data) : GetCachedDataSize(Data);
+	}
+
+	/** Snapshot of cache store activity */
+	struct PCGEXTENDEDTOOLKITTEST_API FClusterCacheStats
+	{
+		int64 Hits = 0;
+		int64 Misses = 0;
+
+		/** Entries dropped on lookup because their ContextHash, version or type didn't match */
+		int64 StaleDrops = 0;
+
+		/** Entries dropped to stay under budget */
+		int64 Evictions = 0;
+
+		int64 Insertions = 0;
+
+		/** Entries refused because they were larger than the whole budget */
+		int64 Rejections = 0;
+
+		int64 BytesInUse = 0;
+		int64 PeakBytes = 0;
+		int32 NumEntries = 0;
+
+		double GetHitRatio() const;
+		FString ToString() const;
+	};
+
+	/**
+	 * Shared, budgeted store for cluster cached data.
+	 *
+	 * Entries are keyed by owner (typically the cluster) and name. On lookup the
+	 * ContextHash, version and, for typed entries, the stored type must match, otherwise
+	 * the entry is dropped and the lookup counts as a miss. When an insertion would
+	 * exceed the budget, least recently used entries are evicted down to LowWaterRatio
+	 * of the budget, so eviction runs in batches rather than on every insertion.
+	 *
+	 * Evicted data stays alive for holders of a shared pointer; the store only drops its reference.
+	 */
+	class PCGEXTENDEDTOOLKITTEST_API FClusterCacheStore : public TSharedFromThis<FClusterCacheStore>
+	{
+	public:
+		/** @param InBudgetBytes Memory budget; <= 0 means unlimited */
+		explicit FClusterCacheStore(int64 InBudgetBytes = 0, double InLowWaterRatio = 0.9);
+
+		void SetBudget(int64 InBudgetBytes);
+		FORCEINLINE int64 GetBudget() const { return BudgetBytes; }
+
+		template <typename T>
+		TSharedPtr<T> Find(const void* Owner, const FName Key, const uint32 ExpectedContextHash = 0, const uint32 ExpectedVersion = 0)
+		{
+			return StaticCastSharedPtr<T>(FindImpl(Owner, Key, ExpectedContextHash, ExpectedVersion, GetCachedDataTypeId<T>()));
+		}
+
+		/** Untyped lookup, ignores the stored type */
+		TSharedPtr<PCGExClusters::ICachedClusterData> Find(const void* Owner, FName Key, uint32 ExpectedContextHash = 0, uint32 ExpectedVersion = 0);
+
+		/** Typed insertion, size computed with GetCachedDataSize */
+		template <typename T>
+		bool Add(const void* Owner, const FName Key, const TSharedPtr<T>& Data, const uint32 Version = 0)
+		{
+			return AddImpl(Owner, Key, Data, Data ? GetCachedDataSize(*Data) : 0, Version, GetCachedDataTypeId<T>());
+		}
+
+		/**
+		 * Insertion with explicit size
+		 * @param TypeId Concrete type of Data, checked by typed lookups; nullptr stores it untyped
+		 * @return False if the entry is larger than the budget and wasn't stored
+		 */
+		bool AddWithSize(const void* Owner, FName Key, const TSharedPtr<PCGExClusters::ICachedClusterData>& Data, int64 SizeBytes, uint32 Version = 0, FCachedDataTypeId TypeId = nullptr);
+
+		bool Remove(const void* Owner, FName Key);
+
+		/** Drop every entry of an owner, e.g. when a cluster is destroyed */
+		int32 RemoveOwner(const void* Owner);
+
+		void Empty();
+
+		FClusterCacheStats GetStats() const;
+		void ResetStats();
+
+	private:
+		using FTypeId = FCachedDataTypeId;
+
+		struct FEntryKey
+		{
+			const void* Owner = nullptr;
+			FName Name;
+
+			FORCEINLINE bool operator==(const FEntryKey& Other) const { return Owner == Other.Owner && Name == Other.Name; }
+			FORCEINLINE friend uint32 GetTypeHash(const FEntryKey& InKey) { return HashCombineFast(PointerHash(InKey.Owner), GetTypeHash(InKey.Name)); }
+		};
+
+		struct FEntry
+		{
+			TSharedPtr<PCGExClusters::ICachedClusterData> Data;
+			int64 SizeBytes = 0;
+			uint32 Version = 0;
+			FTypeId TypeId = nullptr;
+			std::atomic<uint64> LastAccess{0};
+		};
+
+		TSharedPtr<PCGExClusters::ICachedClusterData> FindImpl(const void* Owner, FName Key, uint32 ExpectedContextHash, uint32 ExpectedVersion, FTypeId ExpectedType);
+		bool AddImpl(const void* Owner, FName Key, const TSharedPtr<PCGExClusters::ICachedClusterData>& Data, int64 SizeBytes, uint32 Version, FTypeId TypeId);
+
+		/** Requires the write lock */
+		void RemoveEntry_Unsafe(const FEntryKey& Key);
+		void EvictToFit_Unsafe(int64 IncomingBytes);
+
+		int64 BudgetBytes = 0;
+		double LowWaterRatio = 0.9;
+
+		mutable FRWLock Lock;
+		TMap<FEntryKey, TSharedPtr<FEntry>> Entries;
+		int64 BytesInUse = 0;
+		int64 PeakBytes = 0;
+
+		std::atomic<uint64> AccessTick{0};
+
+		std::atomic<int64> Hits{0};
+		std::atomic<int64> Misses{0};
+		std::atomic<int64> StaleDrops{0};
+		std::atomic<int64> Evictions{0};
+		std::atomic<int64> Insertions{0};
+		std::atomic<int64> Rejections{0};
+	};
+}
@@ -8,6 +8,7 @@
 #include "Clusters/PCGExEdge.h"
 #include "Clusters/PCGExClusterCache.h"
 #include "Containers/PCGExIndexLookup.h"
+#include "Helpers/PCGExClusterCacheHelpers.h"
 
 namespace PCGExClusters
 {
@@ -37,13 +38,58 @@ namespace PCGExTest
 
 		FBox Bounds = FBox(ForceInit);
 
+		/**
+		 * Compressed-sparse-row adjacency.
+		 * Links of node i are AdjacencyLinks[AdjacencyOffsets[i] .. AdjacencyOffsets[i + 1]).
+		 * Built by Initialize, in the same order as FNode::Links, so it can stand in for them.
+		 */
+		TArray<int32> AdjacencyOffsets;
+		TArray<PCGExGraphs::FLink> AdjacencyLinks;
+
 		FTestCluster() = default;
+		~FTestCluster();
 
+		/**
+		 * @param bReleaseNodeLinks If true, per-node Links arrays are freed once the CSR adjacency is built.
+		 * Only the CSR accessors below remain valid for topology queries.
+		 */
 		void Initialize(
 			const TSharedPtr<PCGEx::FIndexLookup>& InNodeIndexLookup,
 			const TSharedPtr<TArray<PCGExClusters::FNode>>& InNodes,
 			const TSharedPtr<TArray<PCGExGraphs::FEdge>>& InEdges,
-			const TArray<FVector>& InPositions);
+			const TArray<FVector>& InPositions,
+			bool bReleaseNodeLinks = false);
+
+		/**
+		 * (Re)build the CSR adjacency. Uses FNode::Links when nodes carry them,
+		 * otherwise derives links from the edge list (start side first, in edge order).
+		 */
+		void BuildAdjacency();
+
+		/**
+		 * Identifies the current adjacency. BuildAdjacency assigns a new value, unique across clusters,
+		 * so data derived from the topology can detect any rewiring, including one that keeps the counts.
+		 */
+		FORCEINLINE uint64 GetTopologyVersion() const { return TopologyVersion; }
+
+		FORCEINLINE int32 NumNodes() const { return AdjacencyOffsets.Num() - 1; }
+
+		// CSR topology queries, valid whether or not nodes still own their Links
+		FORCEINLINE int32 GetNumLinks(const int32 NodeIndex) const { return AdjacencyOffsets[NodeIndex + 1] - AdjacencyOffsets[NodeIndex]; }
+		FORCEINLINE bool IsLeaf(const int32 NodeIndex) const { return GetNumLinks(NodeIndex) == 1; }
+		FORCEINLINE bool IsBinary(const int32 NodeIndex) const { return GetNumLinks(NodeIndex) == 2; }
+		FORCEINLINE bool IsComplex(const int32 NodeIndex) const { return GetNumLinks(NodeIndex) > 2; }
+		FORCEINLINE bool IsIsolated(const int32 NodeIndex) const { return GetNumLinks(NodeIndex) == 0; }
+
+		FORCEINLINE const PCGExGraphs::FLink& GetLink(const int32 NodeIndex, const int32 LinkIndex) const
+		{
+			return AdjacencyLinks[AdjacencyOffsets[NodeIndex] + LinkIndex];
+		}
+
+		FORCEINLINE TConstArrayView<PCGExGraphs::FLink> GetLinks(const int32 NodeIndex) const
+		{
+			return TConstArrayView<PCGExGraphs::FLink>(AdjacencyLinks.GetData() + AdjacencyOffsets[NodeIndex], GetNumLinks(NodeIndex));
+		}
 
 		// FCluster-compatible interface for chain testing
 		FORCEINLINE PCGExClusters::FNode* GetNode(const int32 Index) const { return (NodesDataPtr + Index); }
@@ -78,23 +124,58 @@ namespace PCGExTest
 		template <typename T>
 		TSharedPtr<T> GetCachedData(FName Key, uint32 ExpectedContextHash = 0) const
 		{
+			if (CacheStore) { return CacheStore->Find<T>(this, Key, ExpectedContextHash); }
+
 			FReadScopeLock ReadLock(ClusterLock);
-			if (const TSharedPtr<PCGExClusters::ICachedClusterData>* Entry = CachedData.Find(Key))
+			if (const FLocalCachedData* Entry = CachedData.Find(Key))
 			{
-				if (ExpectedContextHash == 0 || (*Entry)->ContextHash == ExpectedContextHash)
+				if (ExpectedContextHash == 0 || Entry->Data->ContextHash == ExpectedContextHash)
 				{
-					return StaticCastSharedPtr<T>(*Entry);
+					return StaticCastSharedPtr<T>(Entry->Data);
 				}
 			}
 			return nullptr;
 		}
 
-		void SetCachedData(FName Key, const TSharedPtr<PCGExClusters::ICachedClusterData>& Data);
+		/** Size taken from the concrete type T when a cache store accounts it */
+		template <typename T>
+		void SetCachedData(FName Key, const TSharedPtr<T>& Data)
+		{
+			const FCachedDataTypeId TypeId = GetCachedDataTypeId<T>();
+			SetCachedDataImpl(Key, Data, Data && CacheStore ? GetCachedDataSize(*Data, TypeId) : 0, TypeId);
+		}
+
+		/** @param SizeBytes Footprint accounted against the cache store budget, if any */
+		template <typename T>
+		void SetCachedData(FName Key, const TSharedPtr<T>& Data, const int64 SizeBytes)
+		{
+			SetCachedDataImpl(Key, Data, SizeBytes, GetCachedDataTypeId<T>());
+		}
+
 		void ClearCachedData();
 
+		/**
+		 * Route cached data through a shared, budgeted store instead of the cluster-local map.
+		 * Entries already cached locally are moved to the store.
+		 */
+		void SetCacheStore(const TSharedPtr<FClusterCacheStore>& InCacheStore);
+		FORCEINLINE const TSharedPtr<FClusterCacheStore>& GetCacheStore() const { return CacheStore; }
+
 	private:
+		/** Local entries keep their type so they can be sized when migrated to a store */
+		struct FLocalCachedData
+		{
+			TSharedPtr<PCGExClusters::ICachedClusterData> Data;
+			FCachedDataTypeId TypeId = nullptr;
+		};
+
+		void SetCachedDataImpl(FName Key, const TSharedPtr<PCGExClusters::ICachedClusterData>& Data, int64 SizeBytes, FCachedDataTypeId TypeId);
+
+		uint64 TopologyVersion = 0;
+
 		mutable FRWLock ClusterLock;
-		TMap<FName, TSharedPtr<PCGExClusters::ICachedClusterData>> CachedData;
+		TMap<FName, FLocalCachedData> CachedData;
+		TSharedPtr<FClusterCacheStore> CacheStore;
 	};
 
 	/**
@@ -181,6 +262,35 @@ namespace PCGExTest
 		 */
 		FClusterBuilder& WithGrid(int32 CountX, int32 CountY, double Spacing = 100.0, const FVector& Origin = FVector::ZeroVector);
 
+		/**
+		 * Create a square grid keeping a random subset of its edges: a mix of isolated nodes, leaves,
+		 * binaries, junctions and loops. Point index is y * Size + x, as in WithGrid.
+		 * @param Size Nodes per side
+		 * @param KeepRatio Probability of keeping each grid edge
+		 * @param Seed Random seed for the kept edges
+		 * @param Height Optional Z of node (x, y)
+		 * @param Rotation Applied to every position, after the height
+		 * @param Spacing Distance between nodes
+		 */
+		FClusterBuilder& WithSparseGrid(
+			int32 Size, float KeepRatio, int32 Seed,
+			const TFunction<double(int32, int32)>& Height = nullptr,
+			const FQuat& Rotation = FQuat::Identity,
+			double Spacing = 100.0);
+
+		/**
+		 * Renumber the points added so far in random order, as if read from scattered input points.
+		 * Positions and edges are kept, only their point indices change.
+		 * @param Seed Random seed for the permutation
+		 */
+		FClusterBuilder& WithShuffledPoints(int32 Seed);
+
+		/**
+		 * Build the cluster with CSR adjacency only: nodes don't allocate their own Links array.
+		 * Topology must then be queried through FTestCluster::GetLinks / IsLeaf / etc.
+		 */
+		FClusterBuilder& WithCompactAdjacency(bool bEnabled = true);
+
 		/**
 		 * Build the cluster
 		 * @return Shared ref to the built cluster
@@ -196,6 +306,7 @@ namespace PCGExTest
 		TArray<FVector> Positions;
 		TArray<TPair<int32, int32>> EdgeDefinitions;
 		TMap<int32, int32> PointToNodeIndex;
+		bool bCompactAdjacency = false;
 	};
 
 	/**
@@ -0,0 +1,57 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/PCGExIndexLookup.h"
+#include "Helpers/PCGExClusterHelpers.h"
+
+namespace PCGExTest
+{
+	/**
+	 * Remaps from a reordered cluster back to the cluster it was built from.
+	 * In the reordered cluster, node i is point i: NodeToSource also maps points back.
+	 */
+	struct PCGEXTENDEDTOOLKITTEST_API FClusterOrder
+	{
+		/** Reordered node (and point) index -> source node index */
+		TSharedPtr<PCGEx::FIndexLookup> NodeToSource;
+
+		/** Source node index -> reordered node (and point) index */
+		TSharedPtr<PCGEx::FIndexLookup> SourceToNode;
+
+		/** Reordered node (and point) index -> source point index */
+		TSharedPtr<PCGEx::FIndexLookup> PointToSourcePoint;
+
+		/** Reordered edge index -> source edge index */
+		TSharedPtr<PCGEx::FIndexLookup> EdgeToSource;
+	};
+
+	/**
+	 * Spatial renumbering of cluster memory.
+	 *
+	 * Nodes are laid out by PCGEx::MH64 Morton code of their position, edges by their
+	 * (lowest, highest) reordered endpoints, so neighbors in space are neighbors in memory and
+	 * BFS, chain walks and face walks stop jumping across arrays when the input order is scattered.
+	 */
+	namespace TestClusterReorder
+	{
+		/**
+		 * Build a copy of the cluster with nodes and edges in Morton order.
+		 * Positions are copied in the new node order and node i gets point index i; edges keep their
+		 * direction, PointIndex and IOIndex. Nodes only carry their own Links if the source's do.
+		 * Anything indexed by point (breakpoints, cached data) must be remapped through OutOrder.
+		 */
+		PCGEXTENDEDTOOLKITTEST_API TSharedRef<FTestCluster> BuildMortonOrdered(
+			const FTestCluster& Source,
+			FClusterOrder& OutOrder,
+			bool bParallel = true);
+
+		/**
+		 * Average |Start - End| node index distance over edges.
+		 * A rough proxy for how far apart in memory a traversal steps.
+		 */
+		PCGEXTENDEDTOOLKITTEST_API double GetAverageEdgeSpan(const FTestCluster& Cluster);
+	}
+}
@@ -0,0 +1,235 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Clusters/PCGExEdge.h"
+#include "Helpers/PCGExClusterHelpers.h"
+
+#include <type_traits>
+
+namespace PCGExTest
+{
+	/**
+	 * Compact edge storage for clusters whose indices fit in TIndex (uint16 or uint32).
+	 *
+	 * Compared to TArray<FEdge>, where every field is a full int32:
+	 * - Start/End are packed in a single word (4 bytes with uint16, 8 with uint32)
+	 * - Index is the position in the array
+	 * - PointIndex is only stored when it differs from Index somewhere
+	 * - IOIndex is shared by every edge of a cluster, and stored once
+	 * - Validity is only stored when some edge is invalid
+	 *
+	 * The packed endpoints of an edge, lowest first, double as its unordered key:
+	 * a 32-bit key replaces H64U for uint16 clusters.
+	 */
+	template <typename TIndex>
+	class TCompactEdges
+	{
+		static_assert(std::is_same_v<TIndex, uint16> || std::is_same_v<TIndex, uint32>, "TCompactEdges supports uint16 and uint32 indices");
+
+	public:
+		using FPacked = std::conditional_t<sizeof(TIndex) == 2, uint32, uint64>;
+
+		static constexpr int32 IndexBits = sizeof(TIndex) * 8;
+		static constexpr uint64 MaxIndex = TNumericLimits<TIndex>::Max();
+
+		static FORCEINLINE FPacked Pack(const TIndex A, const TIndex B) { return static_cast<FPacked>(A) | (static_cast<FPacked>(B) << IndexBits); }
+		static FORCEINLINE TIndex PackedA(const FPacked Packed) { return static_cast<TIndex>(Packed); }
+		static FORCEINLINE TIndex PackedB(const FPacked Packed) { return static_cast<TIndex>(Packed >> IndexBits); }
+
+		/** True if every point index, edge index and edge point index fits */
+		static bool CanHold(const TArray<PCGExGraphs::FEdge>& Edges)
+		{
+			if (static_cast<uint64>(Edges.Num()) > MaxIndex + 1) { return false; }
+
+			for (const PCGExGraphs::FEdge& E : Edges)
+			{
+				if (E.Start > MaxIndex || E.End > MaxIndex) { return false; }
+				if (E.PointIndex < 0 || static_cast<uint64>(E.PointIndex) > MaxIndex) { return false; }
+			}
+
+			return true;
+		}
+
+		/**
+		 * @return false, leaving the storage empty, if an index doesn't fit, an edge's Index isn't its
+		 * position, or edges come from different IO
+		 */
+		bool Build(const TArray<PCGExGraphs::FEdge>& Edges)
+		{
+			Reset();
+			if (!CanHold(Edges)) { return false; }
+
+			const int32 NumEdges = Edges.Num();
+			IOIndex = NumEdges ? Edges[0].IOIndex : -1;
+
+			bool bIdentityPointIndices = true;
+			bool bAllValid = true;
+
+			for (int32 i = 0; i < NumEdges; i++)
+			{
+				const PCGExGraphs::FEdge& E = Edges[i];
+				if (E.Index != i || E.IOIndex != IOIndex)
+				{
+					Reset();
+					return false;
+				}
+
+				bIdentityPointIndices &= E.PointIndex == i;
+				bAllValid &= E.bValid != 0;
+			}
+
+			Endpoints.SetNumUninitialized(NumEdges);
+			for (int32 i = 0; i < NumEdges; i++) { Endpoints[i] = Pack(static_cast<TIndex>(Edges[i].Start), static_cast<TIndex>(Edges[i].End)); }
+
+			if (!bIdentityPointIndices)
+			{
+				PointIndices.SetNumUninitialized(NumEdges);
+				for (int32 i = 0; i < NumEdges; i++) { PointIndices[i] = static_cast<TIndex>(Edges[i].PointIndex); }
+			}
+
+			if (!bAllValid)
+			{
+				Valid.Init(false, NumEdges);
+				for (int32 i = 0; i < NumEdges; i++) { Valid[i] = Edges[i].bValid != 0; }
+			}
+
+			return true;
+		}
+
+		/**
+		 * Take over packed endpoints, lowest first, as edges 0..N-1 with PointIndex == Index; nothing is copied.
+		 * With uint32 these are H64U keys, e.g. FTestFlatDelaunay2::Edges.
+		 * @return false, leaving the storage empty, if there are more edges than TIndex can index
+		 */
+		bool Build(TArray<FPacked>&& PackedEndpoints, const int32 InIOIndex)
+		{
+			Reset();
+			if (static_cast<uint64>(PackedEndpoints.Num()) > MaxIndex + 1) { return false; }
+
+			Endpoints = MoveTemp(PackedEndpoints);
+			IOIndex = InIOIndex;
+			return true;
+		}
+
+		void Reset()
+		{
+			Endpoints.Reset();
+			PointIndices.Reset();
+			Valid.Reset();
+			IOIndex = -1;
+		}
+
+		FORCEINLINE int32 Num() const { return Endpoints.Num(); }
+		FORCEINLINE int32 GetIOIndex() const { return IOIndex; }
+
+		FORCEINLINE bool HasPointIndices() const { return !PointIndices.IsEmpty(); }
+		FORCEINLINE bool HasValidity() const { return !Valid.IsEmpty(); }
+
+		FORCEINLINE TIndex GetStart(const int32 Index) const { return PackedA(Endpoints[Index]); }
+		FORCEINLINE TIndex GetEnd(const int32 Index) const { return PackedB(Endpoints[Index]); }
+		FORCEINLINE int32 GetPointIndex(const int32 Index) const { return PointIndices.IsEmpty() ? Index : PointIndices[Index]; }
+		FORCEINLINE bool IsValid(const int32 Index) const { return Valid.IsEmpty() || Valid[Index]; }
+
+		FORCEINLINE TIndex Other(const int32 Index, const TIndex Key) const
+		{
+			const FPacked Packed = Endpoints[Index];
+			return PackedA(Packed) == Key ? PackedB(Packed) : PackedA(Packed);
+		}
+
+		/** Same for both directions, like FEdge::H64U */
+		FORCEINLINE FPacked GetUnorderedKey(const int32 Index) const
+		{
+			const TIndex A = GetStart(Index);
+			const TIndex B = GetEnd(Index);
+			return A < B ? Pack(A, B) : Pack(B, A);
+		}
+
+		FORCEINLINE TConstArrayView<FPacked> GetPackedEndpoints() const { return Endpoints; }
+
+		/** Full FEdge, as stored before compaction */
+		PCGExGraphs::FEdge Get(const int32 Index) const
+		{
+			PCGExGraphs::FEdge E(Index, GetStart(Index), GetEnd(Index), GetPointIndex(Index), IOIndex);
+			E.bValid = IsValid(Index) ? 1 : 0;
+			return E;
+		}
+
+		void Expand(TArray<PCGExGraphs::FEdge>& OutEdges) const
+		{
+			OutEdges.SetNumUninitialized(Num());
+			for (int32 i = 0; i < Num(); i++) { OutEdges[i] = Get(i); }
+		}
+
+		SIZE_T GetAllocatedSize() const
+		{
+			return Endpoints.GetAllocatedSize() + PointIndices.GetAllocatedSize() + Valid.GetAllocatedSize();
+		}
+
+	private:
+		TArray<FPacked> Endpoints;
+
+		/** Empty when PointIndex == Index for every edge */
+		TArray<TIndex> PointIndices;
+
+		/** Empty when every edge is valid */
+		TBitArray<> Valid;
+
+		int32 IOIndex = -1;
+	};
+
+	/**
+	 * Compact counterpart of the CSR adjacency: each FLink (Node, Edge) packed in a single word.
+	 * Links of node i are Links[Offsets[i] .. Offsets[i + 1]).
+	 */
+	template <typename TIndex>
+	class TCompactLinks
+	{
+	public:
+		using FPacked = typename TCompactEdges<TIndex>::FPacked;
+
+		/** @return false, leaving the storage empty, if node or edge indices don't fit */
+		bool Build(const FTestCluster& Cluster)
+		{
+			Offsets.Reset();
+			Links.Reset();
+
+			const int32 NumNodes = Cluster.NumNodes();
+			const int32 NumEdges = Cluster.Edges ? Cluster.Edges->Num() : 0;
+			if (static_cast<uint64>(NumNodes) > TCompactEdges<TIndex>::MaxIndex + 1 ||
+				static_cast<uint64>(NumEdges) > TCompactEdges<TIndex>::MaxIndex + 1) { return false; }
+
+			Offsets.SetNumUninitialized(Cluster.AdjacencyOffsets.Num());
+			for (int32 i = 0; i < Offsets.Num(); i++) { Offsets[i] = static_cast<uint32>(Cluster.AdjacencyOffsets[i]); }
+
+			Links.SetNumUninitialized(Cluster.AdjacencyLinks.Num());
+			for (int32 i = 0; i < Links.Num(); i++)
+			{
+				const PCGExGraphs::FLink& Lk = Cluster.AdjacencyLinks[i];
+				Links[i] = TCompactEdges<TIndex>::Pack(static_cast<TIndex>(Lk.Node), static_cast<TIndex>(Lk.Edge));
+			}
+
+			return true;
+		}
+
+		FORCEINLINE int32 NumNodes() const { return Offsets.Num() - 1; }
+		FORCEINLINE int32 GetNumLinks(const int32 NodeIndex) const { return Offsets[NodeIndex + 1] - Offsets[NodeIndex]; }
+		FORCEINLINE TConstArrayView<FPacked> GetLinks(const int32 NodeIndex) const { return TConstArrayView<FPacked>(Links.GetData() + Offsets[NodeIndex], GetNumLinks(NodeIndex)); }
+
+		static FORCEINLINE int32 GetNode(const FPacked Link) { return TCompactEdges<TIndex>::PackedA(Link); }
+		static FORCEINLINE int32 GetEdge(const FPacked Link) { return TCompactEdges<TIndex>::PackedB(Link); }
+
+		SIZE_T GetAllocatedSize() const { return Offsets.GetAllocatedSize() + Links.GetAllocatedSize(); }
+
+	private:
+		TArray<uint32> Offsets;
+		TArray<FPacked> Links;
+	};
+
+	using FCompactEdges16 = TCompactEdges<uint16>;
+	using FCompactEdges32 = TCompactEdges<uint32>;
+	using FCompactLinks16 = TCompactLinks<uint16>;
+	using FCompactLinks32 = TCompactLinks<uint32>;
+}
@@ -0,0 +1,217 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Helpers/PCGExClusterHelpers.h"
+#include "Clusters/PCGExClusterCache.h"
+#include "Clusters/Artifacts/PCGExCell.h"
+#include "Math/PCGExProjectionDetails.h"
+
+namespace PCGExTest
+{
+	class FPersistentArtifactCache;
+
+	/** Face of a test DCEL turned into a cell */
+	struct PCGEXTENDEDTOOLKITTEST_API FTestCell
+	{
+		/** Lowest half-edge of the face, identifies it and orders cells */
+		int32 Face = -1;
+
+		/** Origin node of each half-edge, starting at Face */
+		TArray<int32> Nodes;
+
+		/** Signed area around the projection normal, positive for CCW (interior) faces */
+		double Area = 0;
+
+		bool bIsConvex = false;
+		bool bHasLeaves = false;
+
+		/** Outer face of a component (non-positive area) */
+		bool bIsWrapper = false;
+	};
+
+	/** Edge inserted into or removed from a test DCEL */
+	struct PCGEXTENDEDTOOLKITTEST_API FTestDCELEdit
+	{
+		int32 FromNode = -1;
+		int32 ToNode = -1;
+
+		/** Edge index given to an inserted edge, ignored by removals */
+		int32 EdgeIndex = -1;
+
+		bool bRemove = false;
+
+		static FTestDCELEdit Insert(const int32 InFromNode, const int32 InToNode, const int32 InEdgeIndex) { return {InFromNode, InToNode, InEdgeIndex, false}; }
+		static FTestDCELEdit Remove(const int32 InFromNode, const int32 InToNode) { return {InFromNode, InToNode, -1, true}; }
+	};
+
+	/** What an edit set changed, for callers keeping per-face data around */
+	struct PCGEXTENDEDTOOLKITTEST_API FTestDCELEditResult
+	{
+		/** Old half-edge index to new one, -1 for removed half-edges. Preserves order of the surviving ones. */
+		TArray<int32> HalfEdgeRemap;
+
+		/** Faces that no longer exist, identified by their lowest old half-edge, sorted */
+		TArray<int32> RemovedFaces;
+
+		/** Faces created by the edits, starting at their lowest new half-edge, sorted by it */
+		TArray<TArray<int32>> AddedFaces;
+	};
+
+	/**
+	 * Half-edge structure (DCEL) over a test cluster, mirroring FPlanarFaceEnumerator's build.
+	 *
+	 * Half-edges are stored in the cluster's CSR layout: the outgoing half-edges of node i are
+	 * [Offsets[i] .. Offsets[i + 1]), sorted counter-clockwise by angle. Angles come either from
+	 * a global projection plane or from per-node tangent frames (LocalTangent).
+	 *
+	 * Both build phases are independent per node / per half-edge:
+	 * - per-node angle computation and ring sort
+	 * - next-pointer linking: next(h) is the half-edge preceding twin(h) in the target's ring,
+	 *   which walks each face with the face on its left (CCW interior faces)
+	 * The parallel and single-threaded builds produce identical arrays.
+	 */
+	class PCGEXTENDEDTOOLKITTEST_API FTestDCEL
+	{
+	public:
+		/** Per-node half-edge ranges, same as FTestCluster::AdjacencyOffsets */
+		TArray<int32> Offsets;
+
+		TArray<int32> Origin;
+		TArray<int32> Target;
+		TArray<int32> Edge;
+		TArray<int32> Twin;
+		TArray<int32> Next;
+
+		/** Position of the half-edge in its origin's CCW ring */
+		TArray<int32> RingPos;
+
+		/** Angle of the half-edge around its origin, in the projection used by the build */
+		TArray<double> Angle;
+
+		/** Projected node positions, only filled by the global projection build */
+		TArray<FVector2D> Positions2D;
+
+		/** Normal used to orient faces: global projection normal, or per-node frame normals for LocalTangent */
+		FVector ProjectionNormal = FVector::UpVector;
+		TArray<FVector> NodeNormals;
+
+		/** Build projecting every node on the plane of the given normal */
+		void Build(const FTestCluster& Cluster, const FVector& InProjectionNormal = FVector::UpVector, bool bParallel = true);
+
+		/** Build measuring angles in each origin node's tangent frame (LocalTangent projection) */
+		void Build(const FTestCluster& Cluster, const TArray<FQuat>& NodeFrames, bool bParallel = true);
+
+		FORCEINLINE int32 NumHalfEdges() const { return Origin.Num(); }
+		FORCEINLINE int32 NumNodes() const { return Offsets.Num() - 1; }
+		FORCEINLINE int32 GetDegree(const int32 NodeIndex) const { return Offsets[NodeIndex + 1] - Offsets[NodeIndex]; }
+
+		/**
+		 * Walk every face, one after another.
+		 * Each face is the loop of half-edges reached through Next, starting from its lowest half-edge.
+		 * @return Number of faces
+		 */
+		int32 WalkFaces(TArray<TArray<int32>>& OutFaces) const;
+
+		/**
+		 * Turn faces into cells, filtered by the constraints inside the worker that walked them.
+		 * Wrapper faces are never output as cells; with Constraints.bBuildWrapper the largest one
+		 * is returned through OutWrapper.
+		 *
+		 * The parallel path claims each face for the lowest half-edge a walker started from (atomic
+		 * min on per-half-edge labels), then walks claimed faces concurrently. Cells are ordered by
+		 * face, so the output is identical to the single-threaded walk.
+		 *
+		 * Supported constraints: bBuildWrapper, bKeepCellsWithLeaves, bDuplicateLeafPoints,
+		 * bConvexOnly, bConcaveOnly, MaxPointCount.
+		 * @return Number of cells
+		 */
+		int32 ExtractCells(
+			const FTestCluster& Cluster,
+			const PCGExClusters::FCellConstraints& Constraints,
+			TArray<FTestCell>& OutCells,
+			FTestCell* OutWrapper = nullptr,
+			bool bParallel = true) const;
+
+		/**
+		 * Patch the structure for a small set of edge insertions and removals, applied in order.
+		 * Only the rings of edited nodes are re-sorted and only the faces around them are walked
+		 * again; everything else is copied with remapped indices. The result is the
+		 * structure a full build of the edited cluster would produce (edge indices aside).
+		 *
+		 * Requires a global projection build, node positions are unchanged.
+		 * Inserted edges must not cross existing or other inserted edges in the projection; this isn't
+		 * checked, as it would mean walking the whole face around each insertion. A crossing edge still
+		 * yields consistent twin/next pointers (Validate passes), but its faces no longer bound regions of
+		 * the plane: cell areas, convexity and the face count no longer match the embedding.
+		 * @return false, leaving the structure untouched, if an edit is invalid (unknown node, missing or duplicate edge)
+		 */
+		bool ApplyEdits(const TArray<FTestDCELEdit>& Edits, FTestDCELEditResult& OutResult, bool bParallel = true);
+
+		/**
+		 * Bring cells extracted before ApplyEdits up to date: cells of removed faces are dropped,
+		 * the others are renumbered, and added faces are turned into cells.
+		 * Same output as ExtractCells on the patched structure. The wrapper isn't tracked.
+		 */
+		void UpdateCells(
+			const FTestCluster& Cluster,
+			const PCGExClusters::FCellConstraints& Constraints,
+			const FTestDCELEditResult& EditResult,
+			TArray<FTestCell>& InOutCells) const;
+
+		/** Check twin/next consistency. Returns false and describes the first problem otherwise. */
+		bool Validate(FString* OutError = nullptr) const;
+
+		/** True if both structures hold identical arrays */
+		bool Equals(const FTestDCEL& Other) const;
+
+	private:
+		FORCEINLINE FVector GetNormal(const int32 NodeIndex) const { return NodeNormals.IsEmpty() ? ProjectionNormal : NodeNormals[NodeIndex]; }
+
+		/** Measure a face and build its cell. Returns false if the constraints reject it; wrappers are never rejected. */
+		bool BuildCell(const FTestCluster& Cluster, const PCGExClusters::FCellConstraints& Constraints, TConstArrayView<int32> FaceHalfEdges, FTestCell& OutCell) const;
+
+		void BuildImpl(const FTestCluster& Cluster, TFunctionRef<double(int32 FromNode, int32 ToNode)> ComputeAngle, bool bParallel);
+	};
+
+	/**
+	 * Face enumeration cached on a cluster: the DCEL and the cells extracted from it.
+	 * ContextHash combines the projection hash and the cell constraints hash, see ComputeCellsContextHash.
+	 */
+	class PCGEXTENDEDTOOLKITTEST_API FCachedDCELCells : public PCGExClusters::ICachedClusterData
+	{
+	public:
+		static const FName CacheKey;
+
+		FTestDCEL DCEL;
+		TArray<FTestCell> Cells;
+
+		/** Face -1 if the constraints don't build one */
+		FTestCell Wrapper;
+	};
+
+	PCGEXTENDEDTOOLKITTEST_API int64 GetCachedDataSize(const FCachedDCELCells& Data);
+
+	/** Hash of the FCellConstraints fields ExtractCells supports */
+	PCGEXTENDEDTOOLKITTEST_API uint32 ComputeCellConstraintsHash(const PCGExClusters::FCellConstraints& Constraints);
+
+	/** FFaceEnumeratorCacheFactory::ComputeProjectionHash combined with ComputeCellConstraintsHash */
+	PCGEXTENDEDTOOLKITTEST_API uint32 ComputeCellsContextHash(const FPCGExGeo2DProjectionDetails& Projection, const PCGExClusters::FCellConstraints& Constraints);
+
+	/**
+	 * Fetch the cells from the cluster cache, then from the persistent cache, and only enumerate
+	 * faces if both miss. LocalTangent builds in NodeFrames; every other method projects along
+	 * Projection.Normal, the test DCEL has no best-fit plane.
+	 * @param PersistentCache Optional cache consulted before building, keyed on the cluster content hash and ComputeCellsContextHash
+	 * @param bOutFromPersistentCache Optional, set to true if the cells were restored from the persistent cache
+	 */
+	PCGEXTENDEDTOOLKITTEST_API TSharedPtr<FCachedDCELCells> GetOrBuildCachedCells(
+		const TSharedRef<FTestCluster>& Cluster,
+		const FPCGExGeo2DProjectionDetails& Projection,
+		const PCGExClusters::FCellConstraints& Constraints,
+		const TArray<FQuat>* NodeFrames = nullptr,
+		FPersistentArtifactCache* PersistentCache = nullptr,
+		bool* bOutFromPersistentCache = nullptr);
+}
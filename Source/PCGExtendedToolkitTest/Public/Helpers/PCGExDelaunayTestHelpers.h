@@ -0,0 +1,475 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/Geo/PCGExDelaunay.h"
+
+struct FPCGExGeo2DProjectionDetails;
+
+namespace PCGExTest
+{
+	/**
+	 * Flat 2D Delaunay output: index arrays, no per-site structs or hashed containers.
+	 *
+	 * Edges are unique H64U keys in ascending order. That is the packed endpoint layout of
+	 * TCompactEdges<uint32>, edge index being the position, and the input TestEdgeDedup::BuildAdjacency
+	 * expects, so cluster edges and links are built straight from it.
+	 */
+	struct FTestFlatDelaunay2
+	{
+		/** 3 per site, counter-clockwise */
+		TArray<int32> SiteVtx;
+
+		/** 3 per site; SiteNeighbors[3s + k] is the site across edge (SiteVtx[3s + k], SiteVtx[3s + (k + 1) % 3]), -1 on the hull */
+		TArray<int32> SiteNeighbors;
+
+		TArray<uint64> Edges;
+
+		/** Hull vertices, ascending */
+		TArray<int32> Hull;
+
+		FORCEINLINE int32 NumSites() const { return SiteVtx.Num() / 3; }
+
+		void Reset()
+		{
+			SiteVtx.Reset();
+			SiteNeighbors.Reset();
+			Edges.Reset();
+			Hull.Reset();
+		}
+	};
+
+	/** Flat 3D Delaunay output, see FTestFlatDelaunay2. Like FDelaunaySite3, sites carry no adjacency. */
+	struct FTestFlatDelaunay3
+	{
+		/** 4 per site, sorted */
+		TArray<int32> SiteVtx;
+
+		TArray<uint64> Edges;
+
+		/** Hull vertices, ascending */
+		TArray<int32> Hull;
+
+		FORCEINLINE int32 NumSites() const { return SiteVtx.Num() / 4; }
+
+		void Reset()
+		{
+			SiteVtx.Reset();
+			Edges.Reset();
+			Hull.Reset();
+		}
+	};
+
+	/**
+	 * Incremental 2D Delaunay triangulation over a half-edge mesh, exposing the TDelaunay2 output
+	 * (Sites, DelaunayEdges, DelaunayHull).
+	 *
+	 * Points are inserted in Morton order. Each one is located by walking from the last triangle
+	 * created, then inserted Bowyer-Watson style: the triangles whose circumcircle contains it are
+	 * removed and the cavity is re-triangulated as a fan around the new point. The convex hull is
+	 * closed by ghost triangles sharing a vertex at infinity, so points outside the current hull
+	 * are inserted the same way.
+	 *
+	 * Triangle t owns half-edges 3t, 3t + 1, 3t + 2, counter-clockwise. Vertex indices are
+	 * input indices; GhostVertex marks the vertex at infinity.
+	 * Duplicate positions are inserted once, the other copies are left unconnected.
+	 */
+	class PCGEXTENDEDTOOLKITTEST_API FTestDelaunay2
+	{
+	public:
+		static constexpr int32 GhostVertex = -1;
+
+		/** Real triangles, counter-clockwise. Neighbors[k] is the site across edge (Vtx[k], Vtx[k + 1]), -1 on the hull. */
+		TArray<PCGExMath::Geo::FDelaunaySite2> Sites;
+		TSet<uint64> DelaunayEdges;
+		TSet<int32> DelaunayHull;
+		bool IsValid = false;
+
+		/** Set before Process to fill Flat instead of Sites, DelaunayEdges and DelaunayHull. Local updates need the latter. */
+		bool bFlatOutput = false;
+		FTestFlatDelaunay2 Flat;
+
+		/** Same inputs as TDelaunay2::Process */
+		bool Process(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails);
+
+		/** @return false if there are fewer than 3 distinct, non-collinear points */
+		bool Process(TConstArrayView<FVector2D> Positions);
+
+		void Reset();
+
+		/** Projected positions, by input index */
+		TConstArrayView<FVector2D> GetVertices() const { return Vertices; }
+
+		/** Number of input points that were not connected because another point shares their position */
+		FORCEINLINE int32 NumDuplicates() const { return Duplicates; }
+
+		// Half-edge mesh
+
+		/** Triangle slots, including ghosts and freed slots */
+		FORCEINLINE int32 NumTriangleSlots() const { return HalfEdgeVtx.Num() / 3; }
+
+		FORCEINLINE static int32 Next(const int32 HalfEdge) { return HalfEdge % 3 == 2 ? HalfEdge - 2 : HalfEdge + 1; }
+		FORCEINLINE static int32 Prev(const int32 HalfEdge) { return HalfEdge % 3 == 0 ? HalfEdge + 2 : HalfEdge - 1; }
+
+		/** Origin vertex of a half-edge */
+		FORCEINLINE int32 GetOrigin(const int32 HalfEdge) const { return HalfEdgeVtx[HalfEdge]; }
+		FORCEINLINE int32 GetTwin(const int32 HalfEdge) const { return HalfEdgeTwin[HalfEdge]; }
+
+		FORCEINLINE bool IsFree(const int32 Triangle) const { return HalfEdgeVtx[Triangle * 3] == FreeVertex; }
+		FORCEINLINE bool IsGhost(const int32 Triangle) const
+		{
+			const int32 Base = Triangle * 3;
+			return HalfEdgeVtx[Base] == GhostVertex || HalfEdgeVtx[Base + 1] == GhostVertex || HalfEdgeVtx[Base + 2] == GhostVertex;
+		}
+
+		/**
+		 * Check twin symmetry, counter-clockwise real triangles and the empty circumcircle property (brute force, for tests).
+		 * After ProcessConstrained, the empty circle check becomes: every edge that isn't a constraint is locally Delaunay.
+		 */
+		bool Validate(FString* OutError = nullptr, bool bCheckEmptyCircles = false) const;
+
+		// Constrained
+
+		/** Constraints kept by the last ProcessConstrained, H64U; one running through other vertices is kept as its pieces */
+		TSet<uint64> ConstrainedEdges;
+
+		/** Constraints left out, from the first piece crossing a kept constraint, or for a missing endpoint */
+		TArray<uint64> SkippedConstraints;
+
+		/** ProcessConstrained with the TDelaunay2::Process inputs */
+		bool ProcessConstrained(
+			const TArrayView<FVector>& Positions, TConstArrayView<uint64> Constraints,
+			const FPCGExGeo2DProjectionDetails& ProjectionDetails, bool bInteriorOnly = false);
+
+		/**
+		 * Constrained Delaunay triangulation. After Process, each constraint (H64U of two input indices, in order) is
+		 * forced in by flipping away the edges it crosses, then Lawson flips that never touch a constraint restore the
+		 * Delaunay property around it. Constraint endpoints on a duplicate position use the connected copy.
+		 * @param bInteriorOnly Only output the triangles inside the constraints: odd number of constraints crossed from
+		 * the hull. DelaunayHull then holds the vertices on the boundary of what's left.
+		 * @return false if there are fewer than 3 distinct, non-collinear points
+		 */
+		bool ProcessConstrained(TConstArrayView<FVector2D> Positions, TConstArrayView<uint64> Constraints, bool bInteriorOnly = false);
+
+		/** Local updates don't preserve constraints, and are refused after ProcessConstrained */
+		FORCEINLINE bool IsConstrained() const { return bConstrained; }
+
+		// Local updates, after Process
+
+		/** What an InsertPoint or RemovePoint changed */
+		struct FUpdate
+		{
+			/** Sites whose vertices or neighbors changed, including sites moved to another Id; sorted */
+			TArray<int32> DirtySites;
+
+			/** Sites.Num() before the update; Ids from the current Sites.Num() up to it are gone */
+			int32 PreviousNumSites = 0;
+
+			TArray<uint64> AddedEdges;
+			TArray<uint64> RemovedEdges;
+		};
+
+		/**
+		 * Insert a point into the processed triangulation. Only the triangles whose circumcircle contains it are
+		 * replaced, and Sites, DelaunayEdges and DelaunayHull are patched in place. Released site Ids are reused
+		 * first; the last sites are moved into any left over so Sites stays compact.
+		 * @return The new vertex index, or INDEX_NONE if the position is already a vertex or nothing was processed
+		 */
+		int32 InsertPoint(const FVector2D& Position, FUpdate* OutUpdate = nullptr);
+
+		/**
+		 * Remove a vertex and re-triangulate the hole it leaves. Ears of its link polygon are clipped when their
+		 * circumcircle holds no other link vertex, which yields the Delaunay triangulation of the hole. The link
+		 * of a hull vertex is an open chain, and what can't be clipped from it becomes hull.
+		 * The vertex index stays allocated but unconnected, like a duplicate.
+		 * @return false if the vertex is not connected, or removing it would leave no triangle
+		 */
+		bool RemovePoint(int32 Vertex, FUpdate* OutUpdate = nullptr);
+
+		// Streaming
+
+		using FOnSiteFinalized = TFunction<void(const PCGExMath::Geo::FDelaunaySite2&)>;
+		using FOnEdgeFinalized = TFunction<void(uint64)>;
+
+		/**
+		 * Start a streaming triangulation. Points arrive in chunks swept along +X; after each chunk, triangles whose
+		 * circumcircle lies strictly left of the sweep front can't be affected by later points, so they are emitted
+		 * and dropped along with the vertices nothing references anymore. Memory is bounded by the frontier.
+		 *
+		 * Emitted sites use stream-wide point indices (running count over all chunks) and sequential Ids; their
+		 * Neighbors are left at -1 since a neighbor may not be final yet. Each edge is emitted once, H64U-hashed,
+		 * by the first of its sides to be finalized. Sites, DelaunayEdges and DelaunayHull are not filled, except for
+		 * the hull on EndStream.
+		 */
+		void BeginStream(FOnSiteFinalized&& OnSite, FOnEdgeFinalized&& OnEdge);
+
+		/**
+		 * Insert a chunk, in any order within the chunk.
+		 * @return false if a point is left of a previous chunk; the chunk is then ignored
+		 */
+		bool AddChunk(TConstArrayView<FVector2D> Positions);
+
+		/** Emit everything left and fill DelaunayHull. @return false if the stream never held 3 non-collinear points */
+		bool EndStream();
+
+		/** Triangle slots currently held, and the most held right before a finalization pass */
+		FORCEINLINE int32 NumLiveTriangles() const { return NumTriangleSlots(); }
+		FORCEINLINE int32 GetPeakLiveTriangles() const { return PeakLiveTriangles; }
+		FORCEINLINE int32 NumLiveVertices() const { return Vertices.Num(); }
+
+	protected:
+		static constexpr int32 FreeVertex = -2;
+
+		TArray<FVector2D> Vertices;
+
+		TArray<int32> HalfEdgeVtx;
+		TArray<int32> HalfEdgeTwin;
+		TArray<int32> FreeTriangles;
+
+		/** Triangle the next point location starts from */
+		int32 LastTriangle = 0;
+		int32 Duplicates = 0;
+
+		// Insertion scratch, kept across insertions
+		TArray<int32> TriangleStamp;
+		int32 CurrentStamp = 0;
+		TArray<int32> CavityTriangles;
+		TArray<int32> CavityStack;
+		TArray<int32> BoundaryEdges;
+		TArray<int32> NewTriangles;
+		TArray<int32> FanSlot;
+		uint32 WalkSeed = 0x9E3779B9;
+
+		// Streaming state. Vertices are compacted after each chunk, StreamIds maps them back to stream-wide indices.
+		bool bStreaming = false;
+		bool bStreamSeeded = false;
+		int32 StreamedPoints = 0;
+		int32 EmittedSites = 0;
+		int32 PeakLiveTriangles = 0;
+		int32 LastGhost = INDEX_NONE;
+		double SweepFront = 0;
+		TArray<int32> StreamIds;
+		FOnSiteFinalized OnSiteFinalized;
+		FOnEdgeFinalized OnEdgeFinalized;
+
+		// Constraint state. VertexHalfEdge is only kept while constraints are inserted.
+		bool bConstrained = false;
+		TBitArray<> ExteriorTriangles;
+		TArray<int32> VertexHalfEdge;
+		TArray<uint64> ConstraintCrossings;
+		TArray<uint64> FlipStack;
+
+		// Local update state. TriangleSite is INDEX_NONE for ghosts and free slots.
+		TArray<int32> TriangleSite;
+		TArray<int32> SiteTriangle;
+		TArray<int32> ReleasedSites;
+		TArray<uint64> ReplacedEdges;
+		TArray<int32> ReplacedHullRefs;
+
+		/** Mesh only, no output; @return false if the points are degenerate */
+		bool Triangulate(TConstArrayView<FVector2D> Positions);
+
+		/** Seed the mesh with the first non-degenerate triangle and its three ghosts */
+		bool InitializeFirstTriangle(TConstArrayView<int32> Order, int32 (&OutSeeds)[3]);
+
+		/** @return Triangle containing or, if ghost, seeing the position */
+		int32 Locate(const FVector2D& P, int32 StartTriangle);
+
+		/** Walk the ghost ring both ways from LastGhost. @return A ghost seeing the position, if it lies outside the hull */
+		int32 LocateOnHull(const FVector2D& P) const;
+
+		bool IsInConflict(int32 Triangle, const FVector2D& P) const;
+
+		/** @return false if the position is already a vertex */
+		bool InsertVertex(int32 Vertex);
+		bool InsertVertexAt(int32 Vertex, int32 Start);
+
+		/** Gather the triangles in conflict with the vertex into CavityTriangles, and their outer edges into BoundaryEdges */
+		bool CollectCavity(int32 Vertex, int32 Start);
+
+		/** Replace the cavity with a fan around the vertex; the fan goes into NewTriangles */
+		void FillCavity(int32 Vertex);
+
+		int32 AllocateTriangle();
+		void FreeTriangle(int32 Triangle);
+		void SetTriangle(int32 Triangle, int32 A, int32 B, int32 C);
+
+		/** B may be INDEX_NONE: an open edge, whose other side a stream has already finalized */
+		FORCEINLINE void Link(const int32 A, const int32 B)
+		{
+			HalfEdgeTwin[A] = B;
+			if (B != INDEX_NONE) { HalfEdgeTwin[B] = A; }
+		}
+
+		/** Emit and drop triangles whose circumcircle is strictly left of Front, then compact the mesh */
+		void FinalizeBehind(double Front);
+
+		/** @return false if the constraint crosses a kept one; the pieces up to there are kept */
+		bool InsertConstraint(int32 From, int32 To);
+
+		/** Connected vertex at the position of Vertex, itself unless it is a duplicate */
+		int32 ResolveConstraintVertex(int32 Vertex);
+
+		/** Half-edge From -> To, from VertexHalfEdge */
+		int32 FindHalfEdge(int32 From, int32 To) const;
+
+		/** Replace the diagonal of the two triangles around HalfEdge with the other one, keeping VertexHalfEdge valid */
+		void FlipEdge(int32 HalfEdge);
+
+		/** Lawson flips from the edges in FlipStack, never flipping a constraint */
+		void RestoreDelaunay();
+
+		/** Fill ExteriorTriangles: an even number of constraints crossed from the hull */
+		void MarkExterior();
+
+		/** Fill Sites, DelaunayEdges and DelaunayHull, or Flat, from the mesh */
+		void BuildOutput();
+		void BuildFlatOutput();
+
+		/** @return A half-edge leaving the vertex, INDEX_NONE if no triangle uses it */
+		int32 FindOutgoing(int32 Vertex);
+
+		/** Release the sites of triangles about to be replaced, and remember their edges and hull vertices */
+		void BeginLocalUpdate(TConstArrayView<int32> Triangles);
+
+		/** Patch Sites, DelaunayEdges and DelaunayHull for the triangles that replaced them */
+		void EndLocalUpdate(TConstArrayView<int32> Triangles, FUpdate* OutUpdate);
+	};
+
+	/**
+	 * Incremental 3D Delaunay tetrahedralization, exposing the TDelaunay3 output
+	 * (Sites, DelaunayEdges, DelaunayHull).
+	 *
+	 * Process inserts points one at a time the same way FTestDelaunay2 does, over tetrahedra with
+	 * face adjacency; ghost tetrahedra share the vertex at infinity and close the convex hull.
+	 *
+	 * ProcessParallel splits the points into kd blocks and tetrahedralizes each block on its own.
+	 * A block tetrahedron whose circumsphere lies strictly inside its block region is final. Points
+	 * touched only by final tetrahedra are settled; all others form the border set, which is
+	 * tetrahedralized once more. Border tetrahedra that are not final and whose circumsphere holds
+	 * no settled point (exact in-sphere test) complete the result, which is the same triangulation
+	 * as Process for points in general position.
+	 *
+	 * Tetrahedron t owns vertices 4t .. 4t + 3, positively oriented. Its face k is opposite vertex k,
+	 * and TetAdjacency[4t + k] is 4n + j for the face j of neighbor n across it.
+	 */
+	class PCGEXTENDEDTOOLKITTEST_API FTestDelaunay3
+	{
+	public:
+		static constexpr int32 GhostVertex = -1;
+
+		/** Real tetrahedra, vertices sorted */
+		TArray<PCGExMath::Geo::FDelaunaySite3> Sites;
+		TSet<uint64> DelaunayEdges;
+		TSet<int32> DelaunayHull;
+		bool IsValid = false;
+
+		/** Set before Process or ProcessParallel to fill Flat instead of Sites, DelaunayEdges and DelaunayHull */
+		bool bFlatOutput = false;
+		FTestFlatDelaunay3 Flat;
+
+		/** @return false if there are fewer than 4 distinct, non-coplanar points */
+		bool Process(TConstArrayView<FVector> Positions);
+
+		/**
+		 * Block-parallel tetrahedralization.
+		 * @param NumBlocks Rounded down to a power of two; runs Process when below 2 or when blocks would hold too few points
+		 */
+		bool ProcessParallel(TConstArrayView<FVector> Positions, int32 NumBlocks = 8);
+
+		void Reset();
+
+		/** Input positions, by input index */
+		TConstArrayView<FVector> GetVertices() const { return Vertices; }
+
+		FORCEINLINE int32 NumDuplicates() const { return Duplicates; }
+
+		/** Size of the border set re-tetrahedralized by the last ProcessParallel */
+		FORCEINLINE int32 NumBorderPoints() const { return BorderPoints; }
+
+		// Tetrahedral mesh, from the last Process
+
+		FORCEINLINE int32 NumTetrahedronSlots() const { return TetVtx.Num() / 4; }
+
+		FORCEINLINE bool IsFree(const int32 Tetrahedron) const { return TetVtx[Tetrahedron * 4] == FreeVertex; }
+		FORCEINLINE int32 GetGhostCorner(const int32 Tetrahedron) const
+		{
+			const int32 Base = Tetrahedron * 4;
+			for (int32 k = 0; k < 4; k++) { if (TetVtx[Base + k] == GhostVertex) { return k; } }
+			return INDEX_NONE;
+		}
+		FORCEINLINE bool IsGhost(const int32 Tetrahedron) const { return GetGhostCorner(Tetrahedron) != INDEX_NONE; }
+
+		/**
+		 * Check adjacency symmetry, positive orientation and the empty circumsphere property (brute force, for tests).
+		 * Only covers the mesh kept by Process; fails after ProcessParallel, which keeps none.
+		 */
+		bool Validate(FString* OutError = nullptr, bool bCheckEmptySpheres = false) const;
+
+		/**
+		 * Check the output sites (or Flat) on their own, for either Process or ProcessParallel (for tests):
+		 * no flat site, every point is a vertex or a counted duplicate, each face is shared by at most two
+		 * sites lying on opposite sides, every boundary face is a hull facet and the sites fill the hull volume.
+		 * @param bCheckEmptySpheres Also run the exact in-sphere test of every site against every vertex
+		 */
+		bool ValidateSites(FString* OutError = nullptr, bool bCheckEmptySpheres = false) const;
+
+	protected:
+		static constexpr int32 FreeVertex = -2;
+
+		TArray<FVector> Vertices;
+
+		TArray<int32> TetVtx;
+		TArray<int32> TetAdjacency;
+		TArray<int32> FreeTetrahedra;
+
+		int32 LastTetrahedron = 0;
+		int32 Duplicates = 0;
+		int32 BorderPoints = 0;
+
+		// Insertion scratch, kept across insertions
+		TArray<int32> TetStamp;
+		int32 CurrentStamp = 0;
+		TArray<int32> CavityTetrahedra;
+		TArray<int32> CavityStack;
+		TArray<int32> BoundaryFaces;
+		TArray<int32> NewTetrahedra;
+		TMap<uint64, int32> FanFaces;
+		uint32 WalkSeed = 0x9E3779B9;
+
+		/** Mesh only, no output; @return false if the points are degenerate */
+		bool Tetrahedralize(TConstArrayView<FVector> Positions);
+
+		/** Seed the mesh with the first non-degenerate tetrahedron and its four ghosts */
+		bool InitializeFirstTetrahedron(TConstArrayView<int32> Order, int32 (&OutSeeds)[4]);
+
+		/** @return Tetrahedron containing or, if ghost, seeing the position */
+		int32 Locate(const FVector& P, int32 StartTetrahedron);
+
+		bool IsInConflict(int32 Tetrahedron, const FVector& P) const;
+
+		/** @return false if the position is already a vertex */
+		bool InsertVertex(int32 Vertex);
+
+		int32 AllocateTetrahedron();
+		void FreeTetrahedron(int32 Tetrahedron);
+
+		/** Link the faces around the shared apex (corner 3) of a fan of new tetrahedra */
+		void LinkFan(TConstArrayView<int32> Fan);
+
+		FORCEINLINE void Link(const int32 A, const int32 B)
+		{
+			TetAdjacency[A] = B;
+			TetAdjacency[B] = A;
+		}
+
+		/** Real tetrahedra as input vertex quads, and hull vertices (with repeats), from the mesh */
+		void GatherTetrahedra(TArray<FIntVector4>& OutTetrahedra, TConstArrayView<int32> VertexMap = TConstArrayView<int32>()) const;
+		void GatherHull(TArray<int32>& OutHull, TConstArrayView<int32> VertexMap = TConstArrayView<int32>()) const;
+
+		/** Fill Sites, DelaunayEdges and DelaunayHull, or Flat */
+		void BuildOutput(TConstArrayView<FIntVector4> Tetrahedra, TArray<int32>& Hull);
+	};
+}
@@ -0,0 +1,48 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Clusters/PCGExLink.h"
+
+namespace PCGExTest
+{
+	/**
+	 * Batch edge deduplication for graph building, over unordered H64U(Start, End) keys.
+	 *
+	 * The sorted path radix-sorts the keys and keeps the first of each run of equal keys: two
+	 * linear passes over contiguous memory instead of one random hash probe per edge.
+	 * Self-loops (Start == End) are dropped by both paths.
+	 */
+	namespace TestEdgeDedup
+	{
+		/**
+		 * Unique keys in ascending order.
+		 * @param OutFirstIndex If set, input position of the first occurrence of each unique key
+		 * @return Number of unique edges
+		 */
+		PCGEXTENDEDTOOLKITTEST_API int32 DedupSorted(
+			TConstArrayView<uint64> Keys,
+			TArray<uint64>& OutUniqueKeys,
+			TArray<int32>* OutFirstIndex = nullptr);
+
+		/**
+		 * Reference path through a TSet. Unique keys in first-occurrence order.
+		 * @return Number of unique edges
+		 */
+		PCGEXTENDEDTOOLKITTEST_API int32 DedupHashed(
+			TConstArrayView<uint64> Keys,
+			TArray<uint64>& OutUniqueKeys);
+
+		/**
+		 * CSR adjacency from unique edge keys: edge i is UniqueKeys[i], endpoints are node indices.
+		 * Links of node n are OutLinks[OutOffsets[n] .. OutOffsets[n + 1]), in edge order.
+		 */
+		PCGEXTENDEDTOOLKITTEST_API void BuildAdjacency(
+			int32 NumNodes,
+			TConstArrayView<uint64> UniqueKeys,
+			TArray<int32>& OutOffsets,
+			TArray<PCGExGraphs::FLink>& OutLinks);
+	}
+}
@@ -0,0 +1,83 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Clusters/PCGExClusterCache.h"
+#include "Helpers/PCGExClusterHelpers.h"
+
+namespace PCGExTest
+{
+	/** Node class by number of links. The value is the link count, clamped to 3. */
+	enum class ETestNodeClass : uint8
+	{
+		Isolated = 0,
+		Leaf     = 1,
+		Binary   = 2,
+		Complex  = 3,
+	};
+
+	/**
+	 * Leaf/binary/complex classification of every node, computed in one pass and cached on the cluster.
+	 * Classes are one byte per node; node indices are also grouped by class (in node order within a
+	 * class) so consumers can iterate "all leaves" or "all binaries" without scanning the node array.
+	 */
+	class PCGEXTENDEDTOOLKITTEST_API FCachedNodeClasses : public PCGExClusters::ICachedClusterData
+	{
+	public:
+		static const FName CacheKey;
+		static constexpr int32 NumClasses = 4;
+
+		static FORCEINLINE ETestNodeClass Classify(const int32 NumLinks) { return static_cast<ETestNodeClass>(FMath::Min(NumLinks, 3)); }
+
+		/** One class per node */
+		TArray<uint8> Classes;
+
+		/** Nodes of class c are ClassNodes[ClassOffsets[c] .. ClassOffsets[c + 1]) */
+		int32 ClassOffsets[NumClasses + 1] = {};
+		TArray<int32> ClassNodes;
+
+		/** Total link count of the cluster at build time, twice its edge count */
+		int32 NumLinks = 0;
+
+		/** Cluster topology version at build time */
+		uint64 TopologyVersion = 0;
+
+		void Build(const FTestCluster& Cluster, bool bParallel = true);
+
+		/** Whether these classes were built from the cluster's current adjacency */
+		bool IsUpToDate(const FTestCluster& Cluster) const;
+
+		FORCEINLINE int32 NumNodes() const { return Classes.Num(); }
+
+		FORCEINLINE ETestNodeClass Get(const int32 NodeIndex) const { return static_cast<ETestNodeClass>(Classes[NodeIndex]); }
+		FORCEINLINE bool IsLeaf(const int32 NodeIndex) const { return Classes[NodeIndex] == static_cast<uint8>(ETestNodeClass::Leaf); }
+		FORCEINLINE bool IsBinary(const int32 NodeIndex) const { return Classes[NodeIndex] == static_cast<uint8>(ETestNodeClass::Binary); }
+		FORCEINLINE bool IsComplex(const int32 NodeIndex) const { return Classes[NodeIndex] == static_cast<uint8>(ETestNodeClass::Complex); }
+
+		FORCEINLINE int32 Num(const ETestNodeClass Class) const { return ClassOffsets[static_cast<uint8>(Class) + 1] - ClassOffsets[static_cast<uint8>(Class)]; }
+
+		/** Nodes of the given class, in ascending node order */
+		FORCEINLINE TConstArrayView<int32> GetNodes(const ETestNodeClass Class) const
+		{
+			return TConstArrayView<int32>(ClassNodes.GetData() + ClassOffsets[static_cast<uint8>(Class)], Num(Class));
+		}
+
+		FORCEINLINE TConstArrayView<int32> GetLeaves() const { return GetNodes(ETestNodeClass::Leaf); }
+		FORCEINLINE TConstArrayView<int32> GetBinaries() const { return GetNodes(ETestNodeClass::Binary); }
+		FORCEINLINE TConstArrayView<int32> GetComplex() const { return GetNodes(ETestNodeClass::Complex); }
+	};
+
+	/** Footprint of cached node classes, for cache store budgeting */
+	PCGEXTENDEDTOOLKITTEST_API int64 GetCachedDataSize(const FCachedNodeClasses& Data);
+
+	namespace TestNodeClasses
+	{
+		/**
+		 * Fetch the node classes from the cluster cache, building them on first use or when stale
+		 * @param bStore Cache a fresh build on the cluster; false leaves the cluster cache untouched
+		 */
+		PCGEXTENDEDTOOLKITTEST_API TSharedPtr<FCachedNodeClasses> GetOrBuildNodeClasses(const TSharedRef<FTestCluster>& Cluster, bool bStore = true);
+	}
+}
@@ -0,0 +1,175 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Clusters/PCGExClusterCache.h"
+#include "Helpers/PCGExClusterHelpers.h"
+#include "Misc/ScopeRWLock.h"
+
+#include <atomic>
+
+namespace PCGExTest
+{
+	/** Artifact name for FCachedTangentFrames entries */
+	PCGEXTENDEDTOOLKITTEST_API extern const FName TangentFramesArtifact;
+
+	/**
+	 * Content hash of a cluster: node/point mapping, CSR adjacency, edge endpoints and
+	 * node positions quantized to PositionTolerance. Two clusters with the same hash
+	 * produce the same topology-derived artifacts, whichever execution built them.
+	 */
+	PCGEXTENDEDTOOLKITTEST_API uint64 ComputeClusterContentHash(const FTestCluster& Cluster, double PositionTolerance = 0.01);
+
+	/** Content address of a cached artifact */
+	struct PCGEXTENDEDTOOLKITTEST_API FClusterArtifactKey
+	{
+		uint64 ContentHash = 0;
+
+		/** Artifact-specific settings hash, e.g. ComputeCellsContextHash for face enumeration */
+		uint32 ContextHash = 0;
+
+		FName Artifact;
+
+		FClusterArtifactKey() = default;
+
+		FClusterArtifactKey(const uint64 InContentHash, const uint32 InContextHash, const FName InArtifact)
+			: ContentHash(InContentHash), ContextHash(InContextHash), Artifact(InArtifact)
+		{
+		}
+
+		FORCEINLINE bool operator==(const FClusterArtifactKey& Other) const
+		{
+			return ContentHash == Other.ContentHash && ContextHash == Other.ContextHash && Artifact == Other.Artifact;
+		}
+
+		FORCEINLINE friend uint32 GetTypeHash(const FClusterArtifactKey& Key)
+		{
+			return HashCombineFast(HashCombineFast(GetTypeHash(Key.ContentHash), Key.ContextHash), GetTypeHash(Key.Artifact));
+		}
+	};
+
+	/**
+	 * Binary encoding of one artifact type.
+	 * Decode receives the cluster the artifact is restored for, so derived data
+	 * that is cheap to rebuild (indices, splits) doesn't need to be stored.
+	 */
+	struct PCGEXTENDEDTOOLKITTEST_API FArtifactCodec
+	{
+		TFunction<void(const PCGExClusters::ICachedClusterData& Data, FArchive& Ar)> Encode;
+		TFunction<TSharedPtr<PCGExClusters::ICachedClusterData>(FArchive& Ar, const TSharedRef<FTestCluster>& Cluster)> Decode;
+	};
+
+	struct PCGEXTENDEDTOOLKITTEST_API FPersistentArtifactCacheStats
+	{
+		int64 Hits = 0;
+		int64 Misses = 0;
+		int64 Stores = 0;
+
+		/** Entries whose blob couldn't be decoded, dropped on lookup */
+		int64 DecodeFailures = 0;
+
+		int64 BytesStored = 0;
+		int32 NumEntries = 0;
+
+		FString ToString() const;
+	};
+
+	/**
+	 * Content-addressed artifact cache that outlives clusters.
+	 *
+	 * Artifacts are stored encoded, keyed by cluster content hash, context hash and artifact
+	 * name; every hit decodes a fresh instance, so mutable artifacts are never shared between
+	 * clusters. The process-wide instance survives across graph executions, and the whole
+	 * cache can be written to / read from disk to survive editor sessions.
+	 *
+	 * Codecs for FCachedTangentFrames, FCachedChainData and FCachedDCELCells are registered by default.
+	 */
+	class PCGEXTENDEDTOOLKITTEST_API FPersistentArtifactCache
+	{
+	public:
+		FPersistentArtifactCache();
+
+		/** Process-wide cache */
+		static FPersistentArtifactCache& Get();
+
+		void RegisterCodec(FName Artifact, const FArtifactCodec& Codec);
+		bool HasCodec(FName Artifact) const;
+
+		/** Decode the artifact stored under Key, or nullptr */
+		TSharedPtr<PCGExClusters::ICachedClusterData> Find(const FClusterArtifactKey& Key, const TSharedRef<FTestCluster>& Cluster);
+
+		/** Encode and store an artifact. Returns false if no codec is registered for it. */
+		bool Add(const FClusterArtifactKey& Key, const PCGExClusters::ICachedClusterData& Data);
+
+		bool Contains(const FClusterArtifactKey& Key) const;
+		void Empty();
+
+		/**
+		 * Write every entry to a single binary file (header, then key + blob per entry)
+		 * @return False if the file couldn't be written
+		 */
+		bool SaveToFile(const FString& Path) const;
+
+		/**
+		 * Merge entries from a file written by SaveToFile. Files with another format version are ignored.
+		 * @return Number of entries loaded, -1 if the file is missing or invalid
+		 */
+		int32 LoadFromFile(const FString& Path);
+
+		FPersistentArtifactCacheStats GetStats() const;
+		void ResetStats();
+
+	private:
+		mutable FRWLock Lock;
+		TMap<FName, FArtifactCodec> Codecs;
+		TMap<FClusterArtifactKey, TArray<uint8>> Blobs;
+		int64 BytesStored = 0;
+
+		std::atomic<int64> Hits{0};
+		std::atomic<int64> Misses{0};
+		std::atomic<int64> Stores{0};
+		std::atomic<int64> DecodeFailures{0};
+	};
+
+	/**
+	 * Fetch an artifact from the cluster cache, then from the persistent cache, and only build it
+	 * if both miss. Built artifacts are stored in both caches.
+	 * @param ContextHash Artifact settings hash, also written to the artifact's ContextHash
+	 * @param BuildFn Called on a miss
+	 * @param bOutFromPersistentCache Optional, set to true if the artifact was restored from the persistent cache
+	 */
+	template <typename T>
+	TSharedPtr<T> FindOrBuildArtifact(
+		const TSharedRef<FTestCluster>& Cluster,
+		const FName Artifact,
+		const uint32 ContextHash,
+		TFunctionRef<TSharedPtr<T>()> BuildFn,
+		FPersistentArtifactCache& Cache = FPersistentArtifactCache::Get(),
+		bool* bOutFromPersistentCache = nullptr)
+	{
+		if (bOutFromPersistentCache) { *bOutFromPersistentCache = false; }
+
+		if (TSharedPtr<T> InCluster = Cluster->GetCachedData<T>(Artifact, ContextHash)) { return InCluster; }
+
+		const FClusterArtifactKey Key(ComputeClusterContentHash(*Cluster), ContextHash, Artifact);
+
+		TSharedPtr<T> Data = StaticCastSharedPtr<T>(Cache.Find(Key, Cluster));
+		if (Data)
+		{
+			if (bOutFromPersistentCache) { *bOutFromPersistentCache = true; }
+		}
+		else
+		{
+			Data = BuildFn();
+			if (!Data) { return nullptr; }
+			Data->ContextHash = ContextHash;
+			Cache.Add(Key, *Data);
+		}
+
+		Data->ContextHash = ContextHash;
+		Cluster->SetCachedData(Artifact, Data, GetCachedDataSize(*Data));
+		return Data;
+	}
+}
@@ -0,0 +1,96 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExTest
+{
+	/**
+	 * Batched point-in-polygon and point-in-triangle classification.
+	 *
+	 * Batches write one output word per 32 points, in parallel. The per-point tests are scalar loops
+	 * over flat coordinate arrays; the speedup comes from the parallel words and, for FTestPolygon2,
+	 * from only testing the edges of the point's Y band. Results match the scalar tests exactly: the
+	 * crossing test evaluates the same expression, division included, as PCGExMath::Geo::IsPointInPolygon.
+	 */
+	namespace TestPointInPolygon
+	{
+		/** Even-odd crossing test of one point */
+		PCGEXTENDEDTOOLKITTEST_API bool IsInside(const FVector2D& Point, TConstArrayView<FVector2D> Polygon);
+
+		/** Every point against every edge, no setup. Bit i of OutInside is point i. */
+		PCGEXTENDEDTOOLKITTEST_API void ClassifyPoints(TConstArrayView<FVector2D> Points, TConstArrayView<FVector2D> Polygon, TBitArray<>& OutInside);
+
+		/** Same, using X and Y only */
+		PCGEXTENDEDTOOLKITTEST_API void ClassifyPoints(TConstArrayView<FVector> Points, TConstArrayView<FVector2D> Polygon, TBitArray<>& OutInside);
+
+		/** Point in triangle, either winding, boundary included */
+		PCGEXTENDEDTOOLKITTEST_API bool IsInTriangle(const FVector2D& Point, const FVector2D& A, const FVector2D& B, const FVector2D& C);
+
+		PCGEXTENDEDTOOLKITTEST_API void ClassifyPoints(
+			TConstArrayView<FVector2D> Points,
+			const FVector2D& A, const FVector2D& B, const FVector2D& C,
+			TBitArray<>& OutInside);
+
+		/** Same, in XY */
+		PCGEXTENDEDTOOLKITTEST_API void ClassifyPoints(
+			TConstArrayView<FVector> Points,
+			const FVector& A, const FVector& B, const FVector& C,
+			TBitArray<>& OutInside);
+	}
+
+	/**
+	 * Polygon prepared for many point-in-polygon queries.
+	 *
+	 * Edges are bucketed into horizontal bands over the polygon bounds, and each band stores its
+	 * edges as flat coordinate arrays. A point only tests the edges of its band, which are the only
+	 * ones that can cross its Y. An edge spanning several bands is stored in each of them.
+	 * Horizontal edges never cross and are left out.
+	 */
+	class PCGEXTENDEDTOOLKITTEST_API FTestPolygon2
+	{
+	public:
+		FTestPolygon2() = default;
+
+		/** @param InNumBands Number of Y bands; 0 picks one per edge */
+		explicit FTestPolygon2(TConstArrayView<FVector2D> Polygon, int32 InNumBands = 0);
+
+		void Build(TConstArrayView<FVector2D> Polygon, int32 InNumBands = 0);
+
+		/** Same result as TestPointInPolygon::IsInside against the source polygon */
+		bool IsInside(const FVector2D& Point) const;
+
+		/** Bit i of OutInside is point i */
+		void ClassifyPoints(TConstArrayView<FVector2D> Points, TBitArray<>& OutInside) const;
+
+		/** Same, using X and Y only */
+		void ClassifyPoints(TConstArrayView<FVector> Points, TBitArray<>& OutInside) const;
+
+		FORCEINLINE int32 NumEdges() const { return NumPolygonEdges; }
+		FORCEINLINE int32 NumBands() const { return BandOffsets.Num() - 1; }
+
+		/** Edges stored over all bands */
+		FORCEINLINE int32 NumBandEdges() const { return EdgeXi.Num(); }
+
+		FORCEINLINE const FBox2D& GetBounds() const { return Bounds; }
+
+	protected:
+		int32 NumPolygonEdges = 0;
+		FBox2D Bounds = FBox2D(ForceInit);
+		double InvBandHeight = 0;
+
+		/** Edges of band b are [BandOffsets[b], BandOffsets[b + 1]) in the edge arrays */
+		TArray<int32> BandOffsets;
+
+		// Edge k runs from vertex i to vertex j = i - 1, as in the crossing test
+		TArray<double> EdgeXi;
+		TArray<double> EdgeYi;
+		TArray<double> EdgeXj;
+		TArray<double> EdgeYj;
+
+		/** Monotonic in Y, so an edge's bands always contain the band of any Y it spans */
+		FORCEINLINE int32 GetBand(const double Y) const { return FMath::Clamp(static_cast<int32>((Y - Bounds.Min.Y) * InvBandHeight), 0, NumBands() - 1); }
+	};
+}
@@ -0,0 +1,194 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExTest
+{
+	/**
+	 * Adaptive-precision geometric predicates (Shewchuk).
+	 *
+	 * Each predicate first evaluates the determinant in plain double precision along with a bound on
+	 * its rounding error. Only when the result is too close to zero to trust its sign does it fall back
+	 * to exact floating-point expansion arithmetic, so the sign is always correct and exactly zero for
+	 * degenerate inputs, at the cost of a few extra flops on the common path.
+	 *
+	 * Returned values are the determinant, or an approximation of it with the exact sign.
+	 */
+	namespace TestPredicates
+	{
+		// Relative error bounds of the filters, in units of the input permanent
+		constexpr double Epsilon = 1.1102230246251565e-16; // 2^-53
+		constexpr double Orient2DBound = (3.0 + 16.0 * Epsilon) * Epsilon;
+		constexpr double Orient3DBound = (7.0 + 56.0 * Epsilon) * Epsilon;
+		constexpr double InCircleBound = (10.0 + 96.0 * Epsilon) * Epsilon;
+		constexpr double InSphereBound = (16.0 + 224.0 * Epsilon) * Epsilon;
+
+		PCGEXTENDEDTOOLKITTEST_API double Orient2DExact(const FVector2D& A, const FVector2D& B, const FVector2D& C);
+		PCGEXTENDEDTOOLKITTEST_API double InCircleExact(const FVector2D& A, const FVector2D& B, const FVector2D& C, const FVector2D& D);
+		PCGEXTENDEDTOOLKITTEST_API double Orient3DExact(const FVector& A, const FVector& B, const FVector& C, const FVector& D);
+		PCGEXTENDEDTOOLKITTEST_API double InSphereExact(const FVector& A, const FVector& B, const FVector& C, const FVector& D, const FVector& E);
+
+		/** > 0 if C is left of A->B (ABC counter-clockwise), 0 if collinear */
+		FORCEINLINE double Orient2D(const FVector2D& A, const FVector2D& B, const FVector2D& C)
+		{
+			const double Left = (A.X - C.X) * (B.Y - C.Y);
+			const double Right = (A.Y - C.Y) * (B.X - C.X);
+			const double Det = Left - Right;
+
+			// Opposite signs can't cancel
+			if ((Left > 0 && Right <= 0) || (Left < 0 && Right >= 0) || Left == 0) { return Det; }
+
+			const double Bound = Orient2DBound * FMath::Abs(Left + Right);
+			if (Det >= Bound || -Det >= Bound) { return Det; }
+
+			return Orient2DExact(A, B, C);
+		}
+
+		/** > 0 if D is inside the circumcircle of the counter-clockwise triangle ABC, 0 if cocircular */
+		FORCEINLINE double InCircle(const FVector2D& A, const FVector2D& B, const FVector2D& C, const FVector2D& D)
+		{
+			const double ADX = A.X - D.X;
+			const double ADY = A.Y - D.Y;
+			const double BDX = B.X - D.X;
+			const double BDY = B.Y - D.Y;
+			const double CDX = C.X - D.X;
+			const double CDY = C.Y - D.Y;
+
+			const double BDXCDY = BDX * CDY;
+			const double CDXBDY = CDX * BDY;
+			const double CDXADY = CDX * ADY;
+			const double ADXCDY = ADX * CDY;
+			const double ADXBDY = ADX * BDY;
+			const double BDXADY = BDX * ADY;
+
+			const double ALift = ADX * ADX + ADY * ADY;
+			const double BLift = BDX * BDX + BDY * BDY;
+			const double CLift = CDX * CDX + CDY * CDY;
+
+			const double Det = ALift * (BDXCDY - CDXBDY) + BLift * (CDXADY - ADXCDY) + CLift * (ADXBDY - BDXADY);
+			const double Permanent =
+				(FMath::Abs(BDXCDY) + FMath::Abs(CDXBDY)) * ALift
+				+ (FMath::Abs(CDXADY) + FMath::Abs(ADXCDY)) * BLift
+				+ (FMath::Abs(ADXBDY) + FMath::Abs(BDXADY)) * CLift;
+
+			const double Bound = InCircleBound * Permanent;
+			if (Det > Bound || -Det > Bound) { return Det; }
+
+			return InCircleExact(A, B, C, D);
+		}
+
+		/** > 0 if D is on the positive side of A, B, C (i.e. the tetrahedron ABCD is positively oriented), 0 if coplanar */
+		FORCEINLINE double Orient3D(const FVector& A, const FVector& B, const FVector& C, const FVector& D)
+		{
+			// Pivot on D; the determinant of (A - D, B - D, C - D) is the negated orientation
+			const double ADX = A.X - D.X;
+			const double ADY = A.Y - D.Y;
+			const double ADZ = A.Z - D.Z;
+			const double BDX = B.X - D.X;
+			const double BDY = B.Y - D.Y;
+			const double BDZ = B.Z - D.Z;
+			const double CDX = C.X - D.X;
+			const double CDY = C.Y - D.Y;
+			const double CDZ = C.Z - D.Z;
+
+			const double BDXCDY = BDX * CDY;
+			const double CDXBDY = CDX * BDY;
+			const double CDXADY = CDX * ADY;
+			const double ADXCDY = ADX * CDY;
+			const double ADXBDY = ADX * BDY;
+			const double BDXADY = BDX * ADY;
+
+			const double Det = ADZ * (BDXCDY - CDXBDY) + BDZ * (CDXADY - ADXCDY) + CDZ * (ADXBDY - BDXADY);
+			const double Permanent =
+				(FMath::Abs(BDXCDY) + FMath::Abs(CDXBDY)) * FMath::Abs(ADZ)
+				+ (FMath::Abs(CDXADY) + FMath::Abs(ADXCDY)) * FMath::Abs(BDZ)
+				+ (FMath::Abs(ADXBDY) + FMath::Abs(BDXADY)) * FMath::Abs(CDZ);
+
+			const double Bound = Orient3DBound * Permanent;
+			if (Det > Bound || -Det > Bound) { return -Det; }
+
+			return Orient3DExact(A, B, C, D);
+		}
+
+		/** > 0 if E is inside the circumsphere of the positively oriented tetrahedron ABCD, 0 if cospherical */
+		FORCEINLINE double InSphere(const FVector& A, const FVector& B, const FVector& C, const FVector& D, const FVector& E)
+		{
+			const FVector AE = A - E;
+			const FVector BE = B - E;
+			const FVector CE = C - E;
+			const FVector DE = D - E;
+
+			const double AEXBEY = AE.X * BE.Y;
+			const double BEXAEY = BE.X * AE.Y;
+			const double BEXCEY = BE.X * CE.Y;
+			const double CEXBEY = CE.X * BE.Y;
+			const double CEXDEY = CE.X * DE.Y;
+			const double DEXCEY = DE.X * CE.Y;
+			const double DEXAEY = DE.X * AE.Y;
+			const double AEXDEY = AE.X * DE.Y;
+			const double AEXCEY = AE.X * CE.Y;
+			const double CEXAEY = CE.X * AE.Y;
+			const double BEXDEY = BE.X * DE.Y;
+			const double DEXBEY = DE.X * BE.Y;
+
+			const double AB = AEXBEY - BEXAEY;
+			const double BC = BEXCEY - CEXBEY;
+			const double CD = CEXDEY - DEXCEY;
+			const double DA = DEXAEY - AEXDEY;
+			const double AC = AEXCEY - CEXAEY;
+			const double BD = BEXDEY - DEXBEY;
+
+			const double ABC = AE.Z * BC - BE.Z * AC + CE.Z * AB;
+			const double BCD = BE.Z * CD - CE.Z * BD + DE.Z * BC;
+			const double CDA = CE.Z * DA + DE.Z * AC + AE.Z * CD;
+			const double DAB = DE.Z * AB + AE.Z * BD + BE.Z * DA;
+
+			const double ALift = AE.SizeSquared();
+			const double BLift = BE.SizeSquared();
+			const double CLift = CE.SizeSquared();
+			const double DLift = DE.SizeSquared();
+
+			const double Det = (ALift * BCD - BLift * CDA) + (CLift * DAB - DLift * ABC);
+
+			const double ABAbs = FMath::Abs(AEXBEY) + FMath::Abs(BEXAEY);
+			const double BCAbs = FMath::Abs(BEXCEY) + FMath::Abs(CEXBEY);
+			const double CDAbs = FMath::Abs(CEXDEY) + FMath::Abs(DEXCEY);
+			const double DAAbs = FMath::Abs(DEXAEY) + FMath::Abs(AEXDEY);
+			const double ACAbs = FMath::Abs(AEXCEY) + FMath::Abs(CEXAEY);
+			const double BDAbs = FMath::Abs(BEXDEY) + FMath::Abs(DEXBEY);
+
+			const double Permanent =
+				ALift * (FMath::Abs(BE.Z) * CDAbs + FMath::Abs(CE.Z) * BDAbs + FMath::Abs(DE.Z) * BCAbs)
+				+ BLift * (FMath::Abs(CE.Z) * DAAbs + FMath::Abs(DE.Z) * ACAbs + FMath::Abs(AE.Z) * CDAbs)
+				+ CLift * (FMath::Abs(DE.Z) * ABAbs + FMath::Abs(AE.Z) * BDAbs + FMath::Abs(BE.Z) * DAAbs)
+				+ DLift * (FMath::Abs(AE.Z) * BCAbs + FMath::Abs(BE.Z) * ACAbs + FMath::Abs(CE.Z) * ABAbs);
+
+			const double Bound = InSphereBound * Permanent;
+			if (Det > Bound || -Det > Bound) { return Det; }
+
+			return InSphereExact(A, B, C, D, E);
+		}
+
+		/**
+		 * Circumcenter of the triangle ABC. The denominator comes from the exact orientation, so the
+		 * center is only rejected for truly collinear points and never lands on the wrong side.
+		 * @return false if A, B and C are collinear
+		 */
+		PCGEXTENDEDTOOLKITTEST_API bool GetCircumcenter(const FVector2D& A, const FVector2D& B, const FVector2D& C, FVector2D& OutCenter);
+
+		/**
+		 * Circumcenter of the triangle ABC, in its plane.
+		 * @return false if A, B and C are collinear
+		 */
+		PCGEXTENDEDTOOLKITTEST_API bool GetCircumcenter(const FVector& A, const FVector& B, const FVector& C, FVector& OutCenter);
+
+		/**
+		 * Circumcenter of the tetrahedron ABCD, with the same exact denominator.
+		 * @return false if A, B, C and D are coplanar
+		 */
+		PCGEXTENDEDTOOLKITTEST_API bool GetCircumcenter(const FVector& A, const FVector& B, const FVector& C, const FVector& D, FVector& OutCenter);
+	}
+}
@@ -0,0 +1,464 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/ScopeRWLock.h"
+
+#include <atomic>
+
+/**
+ * Sharded container variants for write-heavy build phases.
+ *
+ * PCGExMT::TH64MapShards locks a shard on every write, which is the right call when
+ * reads and writes interleave. Many call sites however do "build everything, then Collapse".
+ * For that pattern each writer can own a private set of shards, and the shards are merged
+ * once, in parallel, at the end. No lock is ever taken.
+ *
+ * The runtime-sized variants (FH64SetShardsDyn / TH64MapShardsDyn) pick their shard count at
+ * construction, see ComputeShardCount, and can record lock contention per shard for profiling.
+ */
+namespace PCGExTest
+{
+	/**
+	 * Shard selector shared by the build-then-merge containers.
+	 * Fibonacci hashing so that sequential keys don't pile up in the same shard.
+	 */
+	FORCEINLINE uint32 GetShardIndex(const uint64 Key, const uint32 NumShards)
+	{
+		return static_cast<uint32>(((Key ^ (Key >> 31)) * 0x9E3779B97F4A7C15ull) >> 32) % NumShards;
+	}
+
+	/**
+	 * Build-then-merge counterpart of PCGExMT::TH64MapShards.
+	 *
+	 * Writers are identified by a slot index (typically the ParallelFor chunk index) and must never
+	 * share a slot concurrently. Lookups are only valid after Merge().
+	 *
+	 * @code
+	 * TH64MapBuildShards<int32> Map(NumChunks);
+	 * ParallelFor(NumChunks, [&](int32 Chunk){ for (...) { Map.Add(Chunk, Key, Value); } });
+	 * Map.Collapse(OutMap);
+	 * @endcode
+	 */
+	template <typename T, int32 NumShards = 32>
+	class TH64MapBuildShards
+	{
+		static_assert(NumShards > 0, "NumShards must be positive");
+
+	public:
+		using FShardMap = TMap<uint64, T>;
+
+		explicit TH64MapBuildShards(const int32 InNumSlots = 1)
+		{
+			Init(InNumSlots);
+		}
+
+		/** Reset the container and allocate one private shard set per writer slot */
+		void Init(const int32 InNumSlots)
+		{
+			Slots.Reset();
+			Slots.SetNum(FMath::Max(1, InNumSlots));
+			for (FShardMap& Shard : Merged) { Shard.Reset(); }
+			bMerged = false;
+		}
+
+		FORCEINLINE int32 NumSlots() const { return Slots.Num(); }
+
+		/** Reserve room for an expected number of entries per slot */
+		void Reserve(const int32 ExpectedPerSlot)
+		{
+			const int32 PerShard = FMath::DivideAndRoundUp(FMath::Max(0, ExpectedPerSlot), NumShards);
+			for (FSlot& Slot : Slots) { for (FShardMap& Shard : Slot.Shards) { Shard.Reserve(PerShard); } }
+		}
+
+		FORCEINLINE void Add(const int32 Slot, const uint64 Key, const T& Value)
+		{
+			Slots[Slot].Shards[GetShardIndex(Key, NumShards)].Add(Key, Value);
+		}
+
+		FORCEINLINE void Add(const int32 Slot, const uint64 Key, T&& Value)
+		{
+			Slots[Slot].Shards[GetShardIndex(Key, NumShards)].Add(Key, MoveTemp(Value));
+		}
+
+		/** Same contract as TH64MapShards::FindOrAddAndUpdate, scoped to the writer slot */
+		template <typename FUpdateFunc>
+		void FindOrAddAndUpdate(const int32 Slot, const uint64 Key, const T& Default, FUpdateFunc&& UpdateFunc)
+		{
+			FShardMap& Shard = Slots[Slot].Shards[GetShardIndex(Key, NumShards)];
+			bool bIsNew = false;
+			T* Value = Shard.Find(Key);
+			if (!Value)
+			{
+				Value = &Shard.Add(Key, Default);
+				bIsNew = true;
+			}
+			UpdateFunc(*Value, bIsNew);
+		}
+
+		/** Merge all slots, one shard per task. On duplicate keys the highest slot wins. */
+		void Merge()
+		{
+			Merge([](T& Existing, T& Incoming) { Existing = MoveTemp(Incoming); });
+		}
+
+		/**
+		 * Merge all slots, one shard per task. Slots are visited in ascending order, so the result
+		 * is deterministic regardless of how work was distributed among writers.
+		 * @param MergeFunc void(T& Existing, T& Incoming), called when a key exists in more than one slot
+		 */
+		template <typename FMergeFunc>
+		void Merge(FMergeFunc&& MergeFunc)
+		{
+			ParallelFor(
+				NumShards, [&](const int32 ShardIndex)
+				{
+					FShardMap& Target = Merged[ShardIndex];
+
+					int32 Total = Target.Num();
+					for (const FSlot& Slot : Slots) { Total += Slot.Shards[ShardIndex].Num(); }
+					Target.Reserve(Total);
+
+					for (FSlot& Slot : Slots)
+					{
+						FShardMap& Source = Slot.Shards[ShardIndex];
+						for (TPair<uint64, T>& Pair : Source)
+						{
+							if (T* Existing = Target.Find(Pair.Key)) { MergeFunc(*Existing, Pair.Value); }
+							else { Target.Add(Pair.Key, MoveTemp(Pair.Value)); }
+						}
+						Source.Empty();
+					}
+				});
+
+			bMerged = true;
+		}
+
+		FORCEINLINE bool IsMerged() const { return bMerged; }
+
+		/** Post-merge lookup */
+		const T* Find(const uint64 Key) const
+		{
+			check(bMerged);
+			return Merged[GetShardIndex(Key, NumShards)].Find(Key);
+		}
+
+		FORCEINLINE bool Contains(const uint64 Key) const { return Find(Key) != nullptr; }
+
+		/** Post-merge entry count */
+		int32 Num() const
+		{
+			int32 Total = 0;
+			for (const FShardMap& Shard : Merged) { Total += Shard.Num(); }
+			return Total;
+		}
+
+		/** Merge if needed, then move everything into a single map. The container is empty afterward. */
+		void Collapse(TMap<uint64, T>& OutMap)
+		{
+			if (!bMerged) { Merge(); }
+
+			OutMap.Reserve(OutMap.Num() + Num());
+			for (FShardMap& Shard : Merged)
+			{
+				for (TPair<uint64, T>& Pair : Shard) { OutMap.Add(Pair.Key, MoveTemp(Pair.Value)); }
+				Shard.Empty();
+			}
+
+			bMerged = false;
+		}
+
+		void Empty()
+		{
+			for (FSlot& Slot : Slots) { for (FShardMap& Shard : Slot.Shards) { Shard.Empty(); } }
+			for (FShardMap& Shard : Merged) { Shard.Empty(); }
+			bMerged = false;
+		}
+
+	private:
+		struct FSlot
+		{
+			FShardMap Shards[NumShards];
+		};
+
+		TArray<FSlot> Slots;
+		FShardMap Merged[NumShards];
+		bool bMerged = false;
+	};
+
+	/**
+	 * Derive a shard count from the worker count and the expected number of entries.
+	 * Aims for ~4 shards per worker, without going below MinEntriesPerShard entries per shard
+	 * when the expected size is known. Always a power of two in [1, MaxShards].
+	 * @param NumWorkers Number of concurrent writers. <= 0 uses the number of logical cores.
+	 * @param ExpectedSize Expected number of entries. <= 0 if unknown.
+	 */
+	PCGEXTENDEDTOOLKITTEST_API int32 ComputeShardCount(int32 NumWorkers = -1, int32 ExpectedSize = -1);
+
+	/** Snapshot of per-shard lock activity */
+	struct PCGEXTENDEDTOOLKITTEST_API FShardContentionStats
+	{
+		/** Number of times each shard lock was taken */
+		TArray<int64> Acquisitions;
+
+		/** Number of times each shard lock was already held and the caller had to wait */
+		TArray<int64> Waits;
+
+		int64 GetTotalAcquisitions() const;
+		int64 GetTotalWaits() const;
+
+		/** Waits / Acquisitions over all shards, 0 if nothing was recorded */
+		double GetWaitRatio() const;
+
+		/** Index of the shard with the most waits, -1 if there were none */
+		int32 GetHottestShard() const;
+
+		FString ToString() const;
+	};
+
+	/** Lock + counters shared by the runtime-sized sharded containers */
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FContendedShardLock
+	{
+		FRWLock Lock;
+		std::atomic<int64> Acquisitions{0};
+		std::atomic<int64> Waits{0};
+
+		FORCEINLINE void ReadLock(const bool bTrack)
+		{
+			if (!bTrack) { Lock.ReadLock(); }
+			else
+			{
+				if (!Lock.TryReadLock())
+				{
+					Waits.fetch_add(1, std::memory_order_relaxed);
+					Lock.ReadLock();
+				}
+				Acquisitions.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		FORCEINLINE void WriteLock(const bool bTrack)
+		{
+			if (!bTrack) { Lock.WriteLock(); }
+			else
+			{
+				if (!Lock.TryWriteLock())
+				{
+					Waits.fetch_add(1, std::memory_order_relaxed);
+					Lock.WriteLock();
+				}
+				Acquisitions.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		FORCEINLINE void ReadUnlock() { Lock.ReadUnlock(); }
+		FORCEINLINE void WriteUnlock() { Lock.WriteUnlock(); }
+	};
+
+	/**
+	 * Shared base of FH64SetShardsDyn / TH64MapShardsDyn.
+	 * Owns the shard payloads and their locks; shard count is fixed at construction.
+	 */
+	template <typename TPayload>
+	class TH64ShardsDynBase
+	{
+	public:
+		explicit TH64ShardsDynBase(const int32 InNumShards = -1, const bool bInTrackContention = false)
+			: NumShards(InNumShards > 0 ? InNumShards : ComputeShardCount()),
+			  bTrackContention(bInTrackContention)
+		{
+			Locks = MakeUnique<FContendedShardLock[]>(NumShards);
+			Payloads.SetNum(NumShards);
+		}
+
+		TH64ShardsDynBase(const TH64ShardsDynBase&) = delete;
+		TH64ShardsDynBase& operator=(const TH64ShardsDynBase&) = delete;
+
+		FORCEINLINE int32 GetNumShards() const { return NumShards; }
+		FORCEINLINE bool IsTrackingContention() const { return bTrackContention; }
+		FORCEINLINE int32 GetShardFor(const uint64 Key) const { return static_cast<int32>(GetShardIndex(Key, NumShards)); }
+
+		/** Number of entries held by a single shard (takes that shard's read lock) */
+		int32 GetShardNum(const int32 ShardIndex) const
+		{
+			FContendedShardLock& L = Locks[ShardIndex];
+			L.ReadLock(false);
+			const int32 Count = Payloads[ShardIndex].Num();
+			L.ReadUnlock();
+			return Count;
+		}
+
+		FShardContentionStats GetContentionStats() const
+		{
+			FShardContentionStats Stats;
+			Stats.Acquisitions.SetNumUninitialized(NumShards);
+			Stats.Waits.SetNumUninitialized(NumShards);
+			for (int32 i = 0; i < NumShards; i++)
+			{
+				Stats.Acquisitions[i] = Locks[i].Acquisitions.load(std::memory_order_relaxed);
+				Stats.Waits[i] = Locks[i].Waits.load(std::memory_order_relaxed);
+			}
+			return Stats;
+		}
+
+		void ResetContentionStats()
+		{
+			for (int32 i = 0; i < NumShards; i++)
+			{
+				Locks[i].Acquisitions.store(0, std::memory_order_relaxed);
+				Locks[i].Waits.store(0, std::memory_order_relaxed);
+			}
+		}
+
+		void Empty()
+		{
+			for (int32 i = 0; i < NumShards; i++)
+			{
+				Locks[i].WriteLock(false);
+				Payloads[i].Empty();
+				Locks[i].WriteUnlock();
+			}
+		}
+
+	protected:
+		template <typename FFunc>
+		FORCEINLINE auto Read(const uint64 Key, FFunc&& Func) const
+		{
+			const int32 ShardIndex = GetShardFor(Key);
+			FContendedShardLock& L = Locks[ShardIndex];
+			L.ReadLock(bTrackContention);
+			ON_SCOPE_EXIT { L.ReadUnlock(); };
+			return Func(Payloads[ShardIndex]);
+		}
+
+		template <typename FFunc>
+		FORCEINLINE auto Write(const uint64 Key, FFunc&& Func)
+		{
+			const int32 ShardIndex = GetShardFor(Key);
+			FContendedShardLock& L = Locks[ShardIndex];
+			L.WriteLock(bTrackContention);
+			ON_SCOPE_EXIT { L.WriteUnlock(); };
+			return Func(Payloads[ShardIndex]);
+		}
+
+		const int32 NumShards;
+		const bool bTrackContention;
+		TUniquePtr<FContendedShardLock[]> Locks;
+		TArray<TPayload> Payloads;
+	};
+
+	/** Runtime-sized counterpart of PCGExMT::TH64SetShards */
+	class FH64SetShardsDyn : public TH64ShardsDynBase<TSet<uint64>>
+	{
+	public:
+		using TH64ShardsDynBase::TH64ShardsDynBase;
+
+		FORCEINLINE void Add(const uint64 Value)
+		{
+			Write(Value, [&](TSet<uint64>& Set) { Set.Add(Value); });
+		}
+
+		FORCEINLINE void Add(const uint64 Value, bool& bIsAlreadySet)
+		{
+			Write(Value, [&](TSet<uint64>& Set) { Set.Add(Value, &bIsAlreadySet); });
+		}
+
+		FORCEINLINE bool Contains(const uint64 Value) const
+		{
+			return Read(Value, [&](const TSet<uint64>& Set) { return Set.Contains(Value); });
+		}
+
+		FORCEINLINE bool Remove(const uint64 Value)
+		{
+			return Write(Value, [&](TSet<uint64>& Set) { return Set.Remove(Value) > 0; });
+		}
+
+		/** Move all shards into a single set. Not thread-safe with concurrent writers. */
+		void Collapse(TSet<uint64>& OutSet)
+		{
+			int32 Total = OutSet.Num();
+			for (const TSet<uint64>& Set : Payloads) { Total += Set.Num(); }
+			OutSet.Reserve(Total);
+			for (TSet<uint64>& Set : Payloads)
+			{
+				OutSet.Append(Set);
+				Set.Empty();
+			}
+		}
+	};
+
+	/** Runtime-sized counterpart of PCGExMT::TH64MapShards */
+	template <typename T>
+	class TH64MapShardsDyn : public TH64ShardsDynBase<TMap<uint64, T>>
+	{
+		using FBase = TH64ShardsDynBase<TMap<uint64, T>>;
+		using FShardMap = TMap<uint64, T>;
+
+	public:
+		using FBase::FBase;
+
+		FORCEINLINE void Add(const uint64 Key, const T& Value)
+		{
+			this->Write(Key, [&](FShardMap& Map) { Map.Add(Key, Value); });
+		}
+
+		/** Copy of the value if found */
+		FORCEINLINE bool Find(const uint64 Key, T& OutValue) const
+		{
+			return this->Read(
+				Key, [&](const FShardMap& Map)
+				{
+					if (const T* Value = Map.Find(Key))
+					{
+						OutValue = *Value;
+						return true;
+					}
+					return false;
+				});
+		}
+
+		FORCEINLINE bool Contains(const uint64 Key) const
+		{
+			return this->Read(Key, [&](const FShardMap& Map) { return Map.Contains(Key); });
+		}
+
+		FORCEINLINE bool Remove(const uint64 Key)
+		{
+			return this->Write(Key, [&](FShardMap& Map) { return Map.Remove(Key) > 0; });
+		}
+
+		template <typename FUpdateFunc>
+		void FindOrAddAndUpdate(const uint64 Key, const T& Default, FUpdateFunc&& UpdateFunc)
+		{
+			this->Write(
+				Key, [&](FShardMap& Map)
+				{
+					bool bIsNew = false;
+					T* Value = Map.Find(Key);
+					if (!Value)
+					{
+						Value = &Map.Add(Key, Default);
+						bIsNew = true;
+					}
+					UpdateFunc(*Value, bIsNew);
+				});
+		}
+
+		/** Move all shards into a single map. Not thread-safe with concurrent writers. */
+		void Collapse(TMap<uint64, T>& OutMap)
+		{
+			int32 Total = OutMap.Num();
+			for (const FShardMap& Map : this->Payloads) { Total += Map.Num(); }
+			OutMap.Reserve(Total);
+			for (FShardMap& Map : this->Payloads)
+			{
+				for (TPair<uint64, T>& Pair : Map) { OutMap.Add(Pair.Key, MoveTemp(Pair.Value)); }
+				Map.Empty();
+			}
+		}
+	};
+}
@@ -0,0 +1,45 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Clusters/Artifacts/PCGExCachedFaceEnumerator.h"
+#include "Helpers/PCGExClusterHelpers.h"
+
+namespace PCGExTest
+{
+	/**
+	 * Per-node tangent frames for the LocalTangent projection, over test clusters.
+	 *
+	 * Same three steps as the LocalTangent processor:
+	 * 1. Node normal from the most independent pair of incident edge directions (Up if fewer than two)
+	 * 2. BFS from the lowest node of each component, flipping normals that disagree with their parent
+	 * 3. Frame with Z = normal and an adaptive X hint (Forward, or Right when the normal is close to Forward)
+	 */
+	namespace TestTangentFrames
+	{
+		/** Reference path, node by node on FVector / FRotationMatrix */
+		PCGEXTENDEDTOOLKITTEST_API void ComputeScalar(
+			const FTestCluster& Cluster,
+			TArray<FQuat>& OutFrames,
+			TArray<FVector>* OutNormals = nullptr);
+
+		/**
+		 * Batch path on structure-of-arrays buffers.
+		 * Normals and frames are computed over contiguous component arrays in fixed-size batches, with
+		 * the frame built inline instead of through FRotationMatrix; the BFS only propagates a sign per node.
+		 * The loops are scalar. Produces the same frames as ComputeScalar, up to rounding.
+		 */
+		PCGEXTENDEDTOOLKITTEST_API void ComputeBatched(
+			const FTestCluster& Cluster,
+			TArray<FQuat>& OutFrames,
+			TArray<FVector>* OutNormals = nullptr,
+			bool bParallel = true);
+
+		/** Frames wrapped as cluster cached data */
+		PCGEXTENDEDTOOLKITTEST_API TSharedPtr<PCGExClusters::FCachedTangentFrames> BuildCachedTangentFrames(
+			const FTestCluster& Cluster,
+			bool bBatched = true);
+	}
+}
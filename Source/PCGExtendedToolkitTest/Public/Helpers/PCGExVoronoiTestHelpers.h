@@ -0,0 +1,175 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/Geo/PCGExVoronoi.h"
+#include "Helpers/PCGExDelaunayTestHelpers.h"
+
+namespace PCGExTest
+{
+	/** Voronoi cell of one input point in 2D */
+	struct FTestVoronoiCell2
+	{
+		int32 Point = INDEX_NONE;
+
+		/** Delaunay sites around the point, counter-clockwise; each one is a cell vertex */
+		TArray<int32> Sites;
+
+		/** Circumcenters of Sites */
+		TArray<FVector2D> Vertices;
+
+		/** false on the convex hull: the cell is unbounded, Vertices is its finite chain */
+		bool bClosed = false;
+	};
+
+	/** Voronoi cell of one input point in 3D */
+	struct FTestVoronoiCell3
+	{
+		int32 Point = INDEX_NONE;
+
+		/** Delaunay sites incident to the point; each one is a cell vertex */
+		TArray<int32> Sites;
+
+		/** Circumcenters of Sites */
+		TArray<FVector> Vertices;
+
+		/** Cell edges, between sites sharing a face, as H64U(local index, local index) */
+		TArray<uint64> Edges;
+
+		/** false on the convex hull, where some faces have a single site */
+		bool bClosed = false;
+	};
+
+	/** 2D Voronoi edges drawn as metric bisector paths */
+	struct FTestVoronoiPaths2
+	{
+		/** Circumcenters first, one per Delaunay site, then the bend vertices */
+		TArray<FVector2D> Vertices;
+
+		/** H64U(vertex, vertex); one edge per straight Voronoi edge, two per bent one */
+		TArray<uint64> Edges;
+
+		int32 NumBends = 0;
+	};
+
+	namespace TestVoronoiPaths
+	{
+		/** Chebyshev distance is Manhattan distance after this 45 degree transform */
+		FORCEINLINE FVector2D ToLInf(const FVector2D& P) { return FVector2D((P.X + P.Y) * 0.5, (P.X - P.Y) * 0.5); }
+		FORCEINLINE FVector2D FromLInf(const FVector2D& P) { return FVector2D(P.X + P.Y, P.X - P.Y); }
+
+		/**
+		 * Manhattan path from Start to End: one 45 degree segment and one axis-aligned segment, with the
+		 * diagonal kept on the side closest to the midpoint of the two sites the edge separates.
+		 * @return false if the path is a single straight segment
+		 */
+		PCGEXTENDEDTOOLKITTEST_API bool ComputeL1Bend(
+			const FVector2D& Start, const FVector2D& End,
+			const FVector2D& SiteA, const FVector2D& SiteB,
+			FVector2D& OutBend);
+
+		/** Same as ComputeL1Bend, in the Chebyshev metric */
+		PCGEXTENDEDTOOLKITTEST_API bool ComputeLInfBend(
+			const FVector2D& Start, const FVector2D& End,
+			const FVector2D& SiteA, const FVector2D& SiteB,
+			FVector2D& OutBend);
+
+		/** Full path of one edge, Start and End included. Euclidean paths are straight */
+		PCGEXTENDEDTOOLKITTEST_API void ComputeEdgePath(
+			EPCGExVoronoiMetric Metric,
+			const FVector2D& Start, const FVector2D& End,
+			const FVector2D& SiteA, const FVector2D& SiteB,
+			TArray<FVector2D>& OutPath);
+	}
+
+	/**
+	 * 2D Voronoi over FTestDelaunay2, with cells built on demand.
+	 *
+	 * Process triangulates once and keeps one incident site per point, nothing else: circumcenters
+	 * and cells are only computed for the points asked for, by walking the site neighbors around
+	 * them. GetCellsInBounds builds the cells of the points inside a box, in parallel.
+	 *
+	 * ProcessAll is the eager equivalent of TVoronoi2::Process (every circumcenter and Voronoi edge),
+	 * kept as the reference.
+	 */
+	class PCGEXTENDEDTOOLKITTEST_API FTestVoronoi2
+	{
+	public:
+		TSharedPtr<FTestDelaunay2> Delaunay;
+		bool IsValid = false;
+
+		// Eager output, ProcessAll only
+		TArray<FVector2D> Circumcenters;
+		TSet<uint64> VoronoiEdges;
+
+		/** Triangulate only. @return false if the Delaunay triangulation failed */
+		bool Process(TConstArrayView<FVector2D> Positions);
+
+		/** Triangulate, then compute every circumcenter and Voronoi edge */
+		bool ProcessAll(TConstArrayView<FVector2D> Positions);
+
+		/** @return false if the point isn't connected (duplicate position) */
+		bool GetCell(int32 Point, FTestVoronoiCell2& OutCell) const;
+
+		/** Cells of the connected points inside Bounds. @return The number of cells */
+		int32 GetCellsInBounds(const FBox2D& Bounds, TArray<FTestVoronoiCell2>& OutCells) const;
+
+		/** Circumcenter of a Delaunay site, computed on each call */
+		FVector2D GetCircumcenter(int32 Site) const;
+
+		/**
+		 * Every finite Voronoi edge as a metric path, batched: edge slots come from a per-site prefix
+		 * sum, bends are computed in parallel straight into the output, and OutPaths keeps its
+		 * allocations across calls. Reuses the eager circumcenters when ProcessAll ran.
+		 * @return false if not processed
+		 */
+		bool BuildPaths(EPCGExVoronoiMetric Metric, FTestVoronoiPaths2& OutPaths) const;
+
+		/** Reference for BuildPaths: one ComputeEdgePath per edge, appended in the same order */
+		bool BuildPathsPerEdge(EPCGExVoronoiMetric Metric, FTestVoronoiPaths2& OutPaths) const;
+
+	protected:
+		/** One site per point, INDEX_NONE if unconnected */
+		TArray<int32> PointSite;
+	};
+
+	/**
+	 * 3D Voronoi over FTestDelaunay3, with cells built on demand.
+	 *
+	 * Process tetrahedralizes once and indexes the sites incident to each point. A cell takes the
+	 * circumspheres of those sites and pairs them through the faces they share, so circumspheres and
+	 * face matching, the bulk of TVoronoi3::Process, are only paid for the cells used.
+	 */
+	class PCGEXTENDEDTOOLKITTEST_API FTestVoronoi3
+	{
+	public:
+		TSharedPtr<FTestDelaunay3> Delaunay;
+		bool IsValid = false;
+
+		// Eager output, ProcessAll only
+		TArray<FSphere> Circumspheres;
+		TSet<uint64> VoronoiEdges;
+
+		/** Tetrahedralize only. @return false if the Delaunay tetrahedralization failed */
+		bool Process(TConstArrayView<FVector> Positions, bool bParallel = false);
+
+		/** Tetrahedralize, then compute every circumsphere and Voronoi edge */
+		bool ProcessAll(TConstArrayView<FVector> Positions, bool bParallel = false);
+
+		/** @return false if the point isn't connected (duplicate position) */
+		bool GetCell(int32 Point, FTestVoronoiCell3& OutCell) const;
+
+		/** Cells of the connected points inside Bounds. @return The number of cells */
+		int32 GetCellsInBounds(const FBox& Bounds, TArray<FTestVoronoiCell3>& OutCells) const;
+
+		/** Circumsphere of a Delaunay site, computed on each call */
+		FSphere GetCircumsphere(int32 Site) const;
+
+	protected:
+		/** Sites incident to point p are PointSites[PointSiteOffsets[p] .. PointSiteOffsets[p + 1]) */
+		TArray<int32> PointSiteOffsets;
+		TArray<int32> PointSites;
+	};
+}